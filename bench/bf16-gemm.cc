@@ -58,11 +58,8 @@ static void bf16_gemm(benchmark::State& state,
       sizeof(xnn_bfloat16) * (w_elements + c_elements));
 
   xnnpack::Buffer<xnn_bfloat16, XNN_ALLOCATION_ALIGNMENT> w(w_elements * num_buffers);
-  xnn_pack_f16_gemm_goi_w(/*groups=*/1, nc, kc, nr, kr, sr,
-                          reinterpret_cast<const uint16_t*>(k.data()),
-                          reinterpret_cast<const uint16_t*>(b.data()), /*scale=*/nullptr,
-                          reinterpret_cast<uint16_t*>(w.data()),
-                          /*extra_bytes=*/0, /*params=*/nullptr);
+  xnn_pack_bf16_gemm_goi_w(/*groups=*/1, nc, kc, nr, kr, sr, k.data(), b.data(), /*scale=*/nullptr,
+                           w.data(), /*extra_bytes=*/0, /*params=*/nullptr);
   xnnpack::Buffer<xnn_bfloat16> c(c_elements * num_buffers);
 
   // Prepare minmax parameters.
@@ -184,6 +181,40 @@ static void bf16_gemm(benchmark::State& state,
   BENCHMARK_GEMM(bf16_gemm_5x4c8__neonbf16_bfmlal)
 #endif  // XNN_ENABLE_ARM_BF16 && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
 
+#if XNN_ENABLE_AVX512BF16 && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  static void bf16_gemm_1x16c2__avx512bf16_broadcast(benchmark::State& state, const char* net) {
+    bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_1x16c2__avx512bf16_broadcast, 1, 16, 2, 1,
+      xnn_init_bf16_minmax_scalar_params, benchmark::utils::CheckAVX512BF16);
+  }
+  static void bf16_gemm_4x16c2__avx512bf16_broadcast(benchmark::State& state, const char* net) {
+    bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_4x16c2__avx512bf16_broadcast, 4, 16, 2, 1,
+      xnn_init_bf16_minmax_scalar_params, benchmark::utils::CheckAVX512BF16);
+  }
+  static void bf16_gemm_7x16c2__avx512bf16_broadcast(benchmark::State& state, const char* net) {
+    bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_7x16c2__avx512bf16_broadcast, 7, 16, 2, 1,
+      xnn_init_bf16_minmax_scalar_params, benchmark::utils::CheckAVX512BF16);
+  }
+  static void bf16_gemm_1x32c2__avx512bf16_broadcast(benchmark::State& state, const char* net) {
+    bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_1x32c2__avx512bf16_broadcast, 1, 32, 2, 1,
+      xnn_init_bf16_minmax_scalar_params, benchmark::utils::CheckAVX512BF16);
+  }
+  static void bf16_gemm_4x32c2__avx512bf16_broadcast(benchmark::State& state, const char* net) {
+    bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_4x32c2__avx512bf16_broadcast, 4, 32, 2, 1,
+      xnn_init_bf16_minmax_scalar_params, benchmark::utils::CheckAVX512BF16);
+  }
+  static void bf16_gemm_7x32c2__avx512bf16_broadcast(benchmark::State& state, const char* net) {
+    bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_7x32c2__avx512bf16_broadcast, 7, 32, 2, 1,
+      xnn_init_bf16_minmax_scalar_params, benchmark::utils::CheckAVX512BF16);
+  }
+
+  BENCHMARK_GEMM(bf16_gemm_1x16c2__avx512bf16_broadcast)
+  BENCHMARK_GEMM(bf16_gemm_4x16c2__avx512bf16_broadcast)
+  BENCHMARK_GEMM(bf16_gemm_7x16c2__avx512bf16_broadcast)
+  BENCHMARK_GEMM(bf16_gemm_1x32c2__avx512bf16_broadcast)
+  BENCHMARK_GEMM(bf16_gemm_4x32c2__avx512bf16_broadcast)
+  BENCHMARK_GEMM(bf16_gemm_7x32c2__avx512bf16_broadcast)
+#endif  // XNN_ENABLE_AVX512BF16 && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
   static void bf16_gemm_1x4c8__neonfma_zip(benchmark::State& state, const char* net) {
     bf16_gemm(state, xnn_bf16_gemm_minmax_ukernel_1x4c8__neonfma_zip, 1, 4, 8, 1,
@@ -231,6 +231,25 @@ static void f16_spmm(benchmark::State& state,
   BENCHMARK_SPMM(spmm80_32x1__neonfp16arith_x2)
 #endif  // XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void spmm80_8x1__f16c(benchmark::State& state, const char* net) {
+    f16_spmm(state, xnn_f16_spmm_minmax_ukernel_8x1__f16c, 8, 1, 0.8f,
+      xnn_init_f16_minmax_scalar_params, benchmark::utils::CheckF16C);
+  }
+  static void spmm80_16x1__f16c(benchmark::State& state, const char* net) {
+    f16_spmm(state, xnn_f16_spmm_minmax_ukernel_16x1__f16c, 16, 1, 0.8f,
+      xnn_init_f16_minmax_scalar_params, benchmark::utils::CheckF16C);
+  }
+  static void spmm80_32x1__f16c(benchmark::State& state, const char* net) {
+    f16_spmm(state, xnn_f16_spmm_minmax_ukernel_32x1__f16c, 32, 1, 0.8f,
+      xnn_init_f16_minmax_scalar_params, benchmark::utils::CheckF16C);
+  }
+
+  BENCHMARK_SPMM(spmm80_8x1__f16c)
+  BENCHMARK_SPMM(spmm80_16x1__f16c)
+  BENCHMARK_SPMM(spmm80_32x1__f16c)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 #ifndef XNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
 #endif
@@ -21,6 +21,7 @@
 #include "xnnpack/raddstoreexpminusmax.h"
 #include "xnnpack/vbinary.h"
 #include "xnnpack/reduce.h"
+#include "xnnpack/rmaxaddexp.h"
 #include "xnnpack/vscaleexpminusmax.h"
 #include "xnnpack/vscaleextexp.h"
 #include "xnnpack/buffer.h"
@@ -248,7 +249,7 @@ static void ThreePassSoftMaxWithRecomputing(
     rmax(elements * sizeof(float), x.data(), &x_max, &rmax_params);
     float y_sum;
     raddexpminusmax(elements * sizeof(float), x.data(), &y_sum, x_max);
-    vscaleexpminusmax(elements * sizeof(float), x.data(), y.data() + packed_elements * buffer_index, x_max, 1.0f / y_sum);
+    vscaleexpminusmax(elements * sizeof(float), x.data(), y.data() + packed_elements * buffer_index, 1.0f / y_sum, x_max);
     const auto end = std::chrono::high_resolution_clock::now();
 
     const auto elapsed_seconds =
@@ -403,6 +404,66 @@ static void TwoPassSoftMax(
     benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
 }
 
+static void TwoPassOnlineSoftMax(
+  benchmark::State& state,
+  xnn_f32_rmaxaddexp_ukernel_fn rmaxaddexp,
+  xnn_f32_vscaleexpminusmax_ukernel_fn vscaleexpminusmax,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check != nullptr && !isa_check(state)) {
+    return;
+  }
+
+  const size_t elements = state.range(0);
+  const size_t cache_line_size_max = 128;
+  const size_t packed_elements = benchmark::utils::RoundUp(elements, cache_line_size_max / sizeof(float));
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1000.0f, 1000.0f), std::ref(rng));
+
+  const size_t num_buffers = 1 +
+    benchmark::utils::DivideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(), packed_elements * sizeof(float));
+  xnnpack::Buffer<float> x(elements);
+  xnnpack::Buffer<float> y(packed_elements * num_buffers);
+
+  std::generate(x.begin(), x.end(), std::ref(f32rng));
+
+  benchmark::utils::DisableDenormals();
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    benchmark::utils::PrefetchToL1(x.data(), x.size() * sizeof(float));
+    if (++buffer_index == num_buffers) {
+      buffer_index = 0;
+    }
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    float x_max;
+    float y_sum;
+    rmaxaddexp(elements * sizeof(float), x.data(), &x_max, &y_sum, nullptr);
+    vscaleexpminusmax(elements * sizeof(float), x.data(), y.data() + packed_elements * buffer_index, 1.0f / y_sum, x_max);
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const auto elapsed_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  const size_t elements_per_iteration = elements;
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * elements_per_iteration, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = 2 * elements * sizeof(float);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
 static void CharacteristicArguments(benchmark::internal::Benchmark* b) {
   // Size        Iterations  Parameters used by Stable Diffusion
   b->Arg( 128);  // 1
@@ -420,6 +481,10 @@ static void CharacteristicArguments(benchmark::internal::Benchmark* b) {
 #endif
 
 #if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  BENCHMARK_CAPTURE(TwoPassOnlineSoftMax, avx512f_rr2_p5,
+    xnn_f32_rmaxaddexp_ukernel__avx512f_rr2_p5_u64,
+    xnn_f32_vscaleexpminusmax_ukernel__avx512f_p5_scalef_u16,
+    benchmark::utils::CheckAVX512F)->Apply(CharacteristicArguments)->UseManualTime();
   BENCHMARK_CAPTURE(TwoPassSoftMax, avx512f_p5_scalef,
     xnn_f32_raddextexp_ukernel__avx512f_p5_scalef_u144_acc3,
     xnn_f32_vscaleextexp_ukernel__avx512f_p5_scalef_u16,
@@ -440,6 +505,13 @@ static void CharacteristicArguments(benchmark::internal::Benchmark* b) {
 #endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(TwoPassOnlineSoftMax, avx2_rr2_p5,
+    xnn_f32_rmaxaddexp_ukernel__avx2_rr2_p5_u32,
+    xnn_f32_vscaleexpminusmax_ukernel__avx2_p5_u24,
+    benchmark::utils::CheckAVX2)->Apply(CharacteristicArguments)->UseManualTime();
+  BENCHMARK_CAPTURE(TwoPassOnlineSoftMax, sse2_rr2_p5,
+    xnn_f32_rmaxaddexp_ukernel__sse2_rr2_p5_u16,
+    xnn_f32_vscaleexpminusmax_ukernel__sse2_rr2_p5_u16)->Apply(CharacteristicArguments)->UseManualTime();
   BENCHMARK_CAPTURE(TwoPassSoftMax, avx2_p5,
     xnn_f32_raddextexp_ukernel__avx2_p5_u96,
     xnn_f32_vscaleextexp_ukernel__avx2_p5_u32,
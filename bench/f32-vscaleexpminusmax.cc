@@ -56,7 +56,7 @@ static void f32_vscaleexpminusmax(
     }
     state.ResumeTiming();
 
-    vscaleexpminusmax(elements * sizeof(float), x.data(), y.data() + packed_elements * buffer_index, x_max, 1.0f / y_sum);
+    vscaleexpminusmax(elements * sizeof(float), x.data(), y.data() + packed_elements * buffer_index, 1.0f / y_sum, x_max);
   }
 
   const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
@@ -226,6 +226,170 @@ void xnnpack_dynamic_fully_connected_f32(benchmark::State& state, const char* ne
     benchmark::Counter::kIsRate);
 }
 
+void xnnpack_fully_connected_sparse_f32(benchmark::State& state, const char* net, bool sparse_2of4) {
+  const size_t batch_size = state.range(0);
+  const size_t input_channels = state.range(1);
+  const size_t output_channels = state.range(2);
+  const float sparsity = state.range(3) / 100.0f;
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(0.01f, 1.0f), std::ref(rng));
+  auto pdist = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), std::ref(rng));
+
+  xnnpack::Buffer<float> input(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  xnnpack::Buffer<float> kernel(input_channels * output_channels);
+  std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+  if (sparse_2of4) {
+    // Keep 2 consecutive weights in each group of 4 input channels.
+    for (size_t oc = 0; oc < output_channels; oc++) {
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        if ((ic + oc) % 4 >= 2) {
+          kernel[oc * input_channels + ic] = 0.0f;
+        }
+      }
+    }
+  } else {
+    // Zero out whole input channels, which makes blocks of output channels
+    // sparse regardless of the block size.
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      if (pdist() < sparsity) {
+        for (size_t oc = 0; oc < output_channels; oc++) {
+          kernel[oc * input_channels + ic] = 0.0f;
+        }
+      }
+    }
+  }
+  xnnpack::Buffer<float> bias(output_channels);
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  const size_t output_elements = batch_size * output_channels;
+
+  xnn_status status = xnn_initialize(nullptr /* allocator */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  const size_t num_buffers = 1 +
+    benchmark::utils::DivideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
+      sizeof(float) * (kernel.size() + bias.size() + output_elements));
+  xnnpack::Buffer<float> output(output_elements * num_buffers);
+
+  xnnpack::Buffer<xnn_operator_t> ops(num_buffers);
+  for (xnn_operator_t& op : ops) {
+    status = xnn_create_fully_connected_sparse_nc_f32(
+      input_channels, output_channels,
+      input_channels, output_channels,
+      kernel.data(), bias.data(),
+      -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity(),
+      /*flags=*/0, nullptr, nullptr, &op);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to create FP32 Sparse Fully Connected operator");
+      return;
+    }
+  }
+
+  for (size_t i = 0; i < ops.size(); i++) {
+    status = xnn_reshape_fully_connected_sparse_nc_f32(
+      ops[i],
+      batch_size,
+      /*threadpool=*/nullptr);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to reshape FP32 Sparse Fully Connected operator");
+      return;
+    }
+  }
+
+  for (size_t i = 0; i < ops.size(); i++) {
+    status = xnn_setup_fully_connected_sparse_nc_f32(
+      ops[i],
+      input.data(), output.data() + i * output_elements);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to setup FP32 Sparse Fully Connected operator");
+      return;
+    }
+  }
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    buffer_index = (buffer_index + 1) % num_buffers;
+    state.ResumeTiming();
+
+    status = xnn_run_operator(ops[buffer_index], /*threadpool=*/nullptr);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run FP32 Sparse Fully Connected operator");
+      return;
+    }
+  }
+
+  for (xnn_operator_t& op : ops) {
+    status = xnn_delete_operator(op);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to delete FP32 Sparse Fully Connected operator");
+      return;
+    }
+    op = nullptr;
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  // FLOPS are counted for the dense layer, so that they compare directly.
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * 2 *
+      batch_size * input_channels * output_channels,
+    benchmark::Counter::kIsRate);
+}
+
+// Large layers whose weights don't fit in the L2 cache.
+static void LargeFullyConnected(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"M", "K", "N"});
+
+  /*         M      K      N */
+  b->Args({  64,  4096,  4096});
+  b->Args({ 256,  4096,  4096});
+  b->Args({ 256,  4096, 11008});
+  b->Args({ 256, 11008,  4096});
+  b->Args({1024,  1024,  1024});
+  b->Args({1024,  2048,  8192});
+}
+
+BENCHMARK_CAPTURE(xnnpack_fully_connected_f32, large, "Large")->Apply(LargeFullyConnected)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_dynamic_fully_connected_f32, large, "Large")->Apply(LargeFullyConnected)->UseRealTime();
+
+// Pruned layers with S% of the input channels zeroed out. S = 0 measures the
+// dense operator that xnn_create_fully_connected_sparse_nc_f32 falls back to.
+static void SparseFullyConnected(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"M", "K", "N", "S"});
+
+  for (int64_t sparsity : {0, 50, 70, 80, 90}) {
+    /*         M      K      N  S */
+    b->Args({   1,  4096,  4096, sparsity});
+    b->Args({  64,  1024,  1024, sparsity});
+    b->Args({  64,  4096,  4096, sparsity});
+    b->Args({ 256,  4096, 11008, sparsity});
+  }
+}
+
+static void SparseFullyConnected2of4(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"M", "K", "N", "S"});
+
+  /*         M      K      N   S */
+  b->Args({   1,  4096,  4096, 50});
+  b->Args({  64,  1024,  1024, 50});
+  b->Args({  64,  4096,  4096, 50});
+  b->Args({ 256,  4096, 11008, 50});
+}
+
+BENCHMARK_CAPTURE(xnnpack_fully_connected_sparse_f32, sparse, "Sparse", /*sparse_2of4=*/false)
+  ->Apply(SparseFullyConnected)->UseRealTime();
+BENCHMARK_CAPTURE(xnnpack_fully_connected_sparse_f32, sparse_2of4, "Sparse", /*sparse_2of4=*/true)
+  ->Apply(SparseFullyConnected2of4)->UseRealTime();
+
 #ifndef XNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
 #endif
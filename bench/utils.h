@@ -203,6 +203,10 @@ bool CheckAVX512AMX(benchmark::State& state);
 // If AVX512 or FP16 are unsupported, report error in benchmark state, and return false.
 bool CheckAVX512FP16(benchmark::State& state);
 
+// Check if x86 SKX-level + BF16 AVX512 extensions (AVX512F, AVX512CD, AVX512BW, AVX512DQ, AVX512VL and BF16) are supported.
+// If AVX512 or BF16 are unsupported, report error in benchmark state, and return false.
+bool CheckAVX512BF16(benchmark::State& state);
+
 // Check if x86 AVX-VNNI extension is supported.
 // If AVX-VNNI extension is unsupported, report error in benchmark state, and return false.
 bool CheckAVXVNNI(benchmark::State& state);
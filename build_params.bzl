@@ -91,6 +91,10 @@ def xnnpack_configurable_defines():
         ":avx512fp16_enabled",
         ["XNN_ENABLE_AVX512FP16=1"],
         ["XNN_ENABLE_AVX512FP16=0"],
+    ) + xnnpack_select_if(
+        ":avx512bf16_enabled",
+        ["XNN_ENABLE_AVX512BF16=1"],
+        ["XNN_ENABLE_AVX512BF16=0"],
     ) + xnnpack_select_if(
         ":avxvnni_enabled",
         ["XNN_ENABLE_AVXVNNI=1"],
@@ -763,6 +767,23 @@ XNNPACK_PARAMS_FOR_ARCH = {
         mingw_copts = ["-fno-asynchronous-unwind-tables"],
         msys_copts = ["-fno-asynchronous-unwind-tables"],
     ),
+    "avx512bf16": _create_params(
+        cond = "//:avx512bf16_enabled",
+        gcc_x86_copts = [
+            "-mf16c",
+            "-mfma",
+            "-mavx512f",
+            "-mavx512cd",
+            "-mavx512bw",
+            "-mavx512dq",
+            "-mavx512vl",
+            "-mavx512bf16",
+        ],
+        msvc_x86_32_copts = ["/arch:AVX512"],
+        msvc_x86_64_copts = ["/arch:AVX512"],
+        mingw_copts = ["-fno-asynchronous-unwind-tables"],
+        msys_copts = ["-fno-asynchronous-unwind-tables"],
+    ),
 
     # RISC-V.
     "rvv": _create_params(
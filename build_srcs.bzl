@@ -19,8 +19,12 @@ OPERATOR_SRCS = [
     "src/operators/convolution-nhwc.c",
     "src/operators/deconvolution-nhwc.c",
     "src/operators/dynamic-fully-connected-nc.c",
+    "src/operators/elementwise-chain-nc.c",
     "src/operators/fully-connected-nc.c",
+    "src/operators/fully-connected-sparse-nc.c",
+    "src/operators/gemm-epilogue.c",
     "src/operators/max-pooling-nhwc.c",
+    "src/operators/norm-nc.c",
     "src/operators/pack-lh.c",
     "src/operators/reduce-nd.c",
     "src/operators/resize-bilinear-nchw.c",
@@ -49,10 +53,13 @@ SUBGRAPH_SRCS = [
     "src/subgraph/deprecated.c",
     "src/subgraph/depth-to-space-2d.c",
     "src/subgraph/depthwise-convolution-2d.c",
+    "src/subgraph/elementwise-chain.c",
     "src/subgraph/even-split.c",
     "src/subgraph/fully-connected-sparse.c",
     "src/subgraph/fully-connected.c",
+    "src/subgraph/kv-cache-append.c",
     "src/subgraph/max-pooling-2d.c",
+    "src/subgraph/norm.c",
     "src/subgraph/pack-lh.c",
     "src/subgraph/reshape-helpers.c",
     "src/subgraph/rope.c",
@@ -95,11 +102,13 @@ XNNPACK_SRCS = [
     "src/configs/ibilinear-config.c",
     "src/configs/lut32norm-config.c",
     "src/configs/maxpool-config.c",
+    "src/configs/norm-config.c",
     "src/configs/pavgpool-config.c",
     "src/configs/pack-lh-config.c",
     "src/configs/raddstoreexpminusmax-config.c",
     "src/configs/reduce-config.c",
     "src/configs/rmax-config.c",
+    "src/configs/rmaxaddexp-config.c",
     "src/configs/spmm-config.c",
     "src/configs/transpose-config.c",
     "src/configs/unary-elementwise-config.c",
@@ -14,6 +14,7 @@ SET(PROD_AVX512SKX_MICROKERNEL_SRCS
   src/f16-f32acc-rdsum/gen/f16-f32acc-rdsum-7p7x-avx512skx-c64.c
   src/f16-f32acc-rsum/gen/f16-f32acc-rsum-avx512skx-u64-acc4.c
   src/f16-rminmax/gen/f16-rmax-avx512skx-u64-acc4.c
+  src/f16-rminmax/gen/f16-rmin-avx512skx-u64-acc4.c
   src/f16-rminmax/gen/f16-rminmax-avx512skx-u64-acc4.c
   src/f32-f16-vcvt/gen/f32-f16-vcvt-avx512skx-u16.c
   src/f32-qc8w-gemm/gen/f32-qc4w-gemm-1x32-minmax-avx512skx-broadcast.c
@@ -73,7 +74,6 @@ SET(NON_PROD_AVX512SKX_MICROKERNEL_SRCS
   src/f16-rminmax/gen/f16-rmin-avx512skx-u32-acc2.c
   src/f16-rminmax/gen/f16-rmin-avx512skx-u48-acc3.c
   src/f16-rminmax/gen/f16-rmin-avx512skx-u64-acc2.c
-  src/f16-rminmax/gen/f16-rmin-avx512skx-u64-acc4.c
   src/f16-rminmax/gen/f16-rminmax-avx512skx-u16.c
   src/f16-rminmax/gen/f16-rminmax-avx512skx-u32-acc2.c
   src/f16-rminmax/gen/f16-rminmax-avx512skx-u48-acc3.c
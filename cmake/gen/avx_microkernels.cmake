@@ -19,6 +19,8 @@ SET(PROD_AVX_MICROKERNEL_SRCS
   src/f32-f16-vcvt/gen/f32-f16-vcvt-avx-u24.c
   src/f32-gemm/gen/f32-gemm-1x16-minmax-avx-broadcast.c
   src/f32-gemm/gen/f32-gemm-5x16-minmax-avx-broadcast.c
+  src/f32-gemminc/gen/f32-gemminc-1x16-minmax-avx-broadcast.c
+  src/f32-gemminc/gen/f32-gemminc-5x16-minmax-avx-broadcast.c
   src/f32-igemm/gen/f32-igemm-1x16-minmax-avx-broadcast.c
   src/f32-igemm/gen/f32-igemm-5x16-minmax-avx-broadcast.c
   src/f32-qc4w-gemm/gen/f32-qc4w-gemm-1x16-minmax-avx-broadcast.c
@@ -27,9 +29,14 @@ SET(PROD_AVX_MICROKERNEL_SRCS
   src/f32-qc8w-gemm/gen/f32-qc8w-gemm-5x16-minmax-avx-broadcast.c
   src/f32-qs8-vcvt/gen/f32-qs8-vcvt-avx-u32.c
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-u32.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-avx-c32.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-avx-c32.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-avx-c32.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx-c32.c
   src/f32-rminmax/gen/f32-rmax-avx-u32-acc4.c
+  src/f32-rminmax/gen/f32-rmin-avx-u32-acc4.c
   src/f32-rminmax/gen/f32-rminmax-avx-u32-acc4.c
+  src/f32-rprod/gen/f32-rprod-avx-u32-acc4.c
   src/f32-rsum/gen/f32-rsum-avx-u32-acc4.c
   src/f32-vbinary/gen/f32-vadd-avx-u16.c
   src/f32-vbinary/gen/f32-vaddc-avx-u16.c
@@ -150,12 +157,10 @@ SET(NON_PROD_AVX_MICROKERNEL_SRCS
   src/f32-gemm/gen/f32-gemm-6x16-minmax-avx-broadcast.c
   src/f32-gemm/gen/f32-gemm-7x8-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-1x8-minmax-avx-broadcast.c
-  src/f32-gemminc/gen/f32-gemminc-1x16-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-3x16-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-4x8-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-4x16-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-5x8-minmax-avx-broadcast.c
-  src/f32-gemminc/gen/f32-gemminc-5x16-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-6x8-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-6x16-minmax-avx-broadcast.c
   src/f32-gemminc/gen/f32-gemminc-7x8-minmax-avx-broadcast.c
@@ -186,6 +191,9 @@ SET(NON_PROD_AVX_MICROKERNEL_SRCS
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-u8.c
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-u16.c
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx-u24.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-avx-c16.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-avx-c16.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-avx-c16.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx-c16.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx-c64.c
   src/f32-rminmax/gen/f32-rmax-avx-u8.c
@@ -196,11 +204,12 @@ SET(NON_PROD_AVX_MICROKERNEL_SRCS
   src/f32-rminmax/gen/f32-rmin-avx-u16-acc2.c
   src/f32-rminmax/gen/f32-rmin-avx-u24-acc3.c
   src/f32-rminmax/gen/f32-rmin-avx-u32-acc2.c
-  src/f32-rminmax/gen/f32-rmin-avx-u32-acc4.c
   src/f32-rminmax/gen/f32-rminmax-avx-u8.c
   src/f32-rminmax/gen/f32-rminmax-avx-u16-acc2.c
   src/f32-rminmax/gen/f32-rminmax-avx-u24-acc3.c
   src/f32-rminmax/gen/f32-rminmax-avx-u32-acc2.c
+  src/f32-rprod/gen/f32-rprod-avx-u8.c
+  src/f32-rprod/gen/f32-rprod-avx-u16-acc2.c
   src/f32-rsum/gen/f32-rsum-avx-u8.c
   src/f32-rsum/gen/f32-rsum-avx-u16-acc2.c
   src/f32-rsum/gen/f32-rsum-avx-u24-acc3.c
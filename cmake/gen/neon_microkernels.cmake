@@ -35,6 +35,7 @@ SET(PROD_NEON_MICROKERNEL_SRCS
   src/f32-igemm/gen/f32-igemm-1x8-minmax-neon-lane-ld64.c
   src/f32-igemm/gen/f32-igemm-4x2-minmax-neon-lane-ld64.c
   src/f32-igemm/gen/f32-igemm-4x8-minmax-neon-lane-ld128.c
+  src/f32-layernorm/gen/f32-layernorm-neon-u16.c
   src/f32-maxpool/f32-maxpool-9p8x-minmax-neon-c4.c
   src/f32-pavgpool/f32-pavgpool-9p8x-minmax-neon-c4.c
   src/f32-pavgpool/f32-pavgpool-9x-minmax-neon-c4.c
@@ -44,9 +45,16 @@ SET(PROD_NEON_MICROKERNEL_SRCS
   src/f32-qc8w-gemm/gen/f32-qc8w-gemm-4x8-minmax-neon-lane-ld64.c
   src/f32-qs8-vcvt/gen/f32-qs8-vcvt-neon-u32.c
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-neon-u32.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-neon-c16.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-neon-c16.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-neon-c16.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-neon-c16.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-neon-rr2-p5-u16.c
   src/f32-rminmax/gen/f32-rmax-neon-u16-acc4.c
+  src/f32-rminmax/gen/f32-rmin-neon-u16-acc4.c
   src/f32-rminmax/gen/f32-rminmax-neon-u16-acc4.c
+  src/f32-rmsnorm/gen/f32-rmsnorm-neon-u16.c
+  src/f32-rprod/gen/f32-rprod-neon-u16-acc4.c
   src/f32-rsum/gen/f32-rsum-neon-u16-acc4.c
   src/f32-spmm/gen/f32-spmm-32x1-minmax-neon.c
   src/f32-vbinary/gen/f32-vadd-neon-u8.c
@@ -81,6 +89,7 @@ SET(PROD_NEON_MICROKERNEL_SRCS
   src/f32-vrnd/gen/f32-vrndu-neon-u8.c
   src/f32-vrnd/gen/f32-vrndz-neon-u8.c
   src/f32-vrsqrt/gen/f32-vrsqrt-neon-rsqrt-u16.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-neon-rr2-p5-u16.c
   src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-lut64-p2-nr2recps-u8.c
   src/f32-vtanh/gen/f32-vtanh-neon-rational-9-8-div.c
   src/f32-vunary/gen/f32-vabs-neon.c
@@ -322,6 +331,7 @@ SET(NON_PROD_NEON_MICROKERNEL_SRCS
   src/f32-igemm/gen/f32-igemm-6x8s4-minmax-neon.c
   src/f32-igemm/gen/f32-igemm-6x16-minmax-neon-lane-ld128.c
   src/f32-igemm/gen/f32-igemm-8x8s4-minmax-neon.c
+  src/f32-layernorm/gen/f32-layernorm-neon-u8.c
   src/f32-ppmm/gen/f32-ppmm-4x8-minmax-neon-prfm.c
   src/f32-ppmm/gen/f32-ppmm-4x8-minmax-neon.c
   src/f32-ppmm/gen/f32-ppmm-4x16-minmax-neon-prfm.c
@@ -354,8 +364,13 @@ SET(NON_PROD_NEON_MICROKERNEL_SRCS
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-neon-rr2-p5-u8-acc2.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-neon-rr2-p5-u16-acc2.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-neon-rr2-p5-u16-acc4.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-neon-c32.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-neon-c32.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-neon-c32.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-neon-c32.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-neon-c64.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-neon-rr2-p5-u4.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-neon-rr2-p5-u8.c
   src/f32-rminmax/gen/f32-rmax-neon-u4.c
   src/f32-rminmax/gen/f32-rmax-neon-u8-acc2.c
   src/f32-rminmax/gen/f32-rmax-neon-u12-acc3.c
@@ -364,11 +379,13 @@ SET(NON_PROD_NEON_MICROKERNEL_SRCS
   src/f32-rminmax/gen/f32-rmin-neon-u8-acc2.c
   src/f32-rminmax/gen/f32-rmin-neon-u12-acc3.c
   src/f32-rminmax/gen/f32-rmin-neon-u16-acc2.c
-  src/f32-rminmax/gen/f32-rmin-neon-u16-acc4.c
   src/f32-rminmax/gen/f32-rminmax-neon-u4.c
   src/f32-rminmax/gen/f32-rminmax-neon-u8-acc2.c
   src/f32-rminmax/gen/f32-rminmax-neon-u12-acc3.c
   src/f32-rminmax/gen/f32-rminmax-neon-u16-acc2.c
+  src/f32-rmsnorm/gen/f32-rmsnorm-neon-u8.c
+  src/f32-rprod/gen/f32-rprod-neon-u4.c
+  src/f32-rprod/gen/f32-rprod-neon-u8-acc2.c
   src/f32-rsum/gen/f32-rsum-neon-u4.c
   src/f32-rsum/gen/f32-rsum-neon-u8-acc2.c
   src/f32-rsum/gen/f32-rsum-neon-u12-acc3.c
@@ -425,6 +442,8 @@ SET(NON_PROD_NEON_MICROKERNEL_SRCS
   src/f32-vrnd/gen/f32-vrndz-neon-u4.c
   src/f32-vrsqrt/gen/f32-vrsqrt-neon-rsqrt-u4.c
   src/f32-vrsqrt/gen/f32-vrsqrt-neon-rsqrt-u8.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-neon-rr2-p5-u4.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-neon-rr2-p5-u8.c
   src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-lut64-p2-nr2recps-u4.c
   src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-lut64-p2-nr2recps-u12.c
   src/f32-vsigmoid/gen/f32-vsigmoid-neon-rr2-lut64-p2-nr2recps-u16.c
@@ -11,10 +11,14 @@
 
 SET(PROD_NEONFP16_MICROKERNEL_SRCS
   src/f16-f32-vcvt/gen/f16-f32-vcvt-neonfp16-u16.c
+  src/f16-layernorm/gen/f16-layernorm-neonfp16-u16.c
+  src/f16-rmsnorm/gen/f16-rmsnorm-neonfp16-u16.c
   src/f32-f16-vcvt/gen/f32-f16-vcvt-neonfp16-u16.c)
 
 SET(NON_PROD_NEONFP16_MICROKERNEL_SRCS
   src/f16-f32-vcvt/gen/f16-f32-vcvt-neonfp16-u8.c
+  src/f16-layernorm/gen/f16-layernorm-neonfp16-u8.c
+  src/f16-rmsnorm/gen/f16-rmsnorm-neonfp16-u8.c
   src/f32-f16-vcvt/gen/f32-f16-vcvt-neonfp16-u8.c)
 
 SET(ALL_NEONFP16_MICROKERNEL_SRCS ${PROD_NEONFP16_MICROKERNEL_SRCS} + ${NON_PROD_NEONFP16_MICROKERNEL_SRCS})
@@ -39,7 +39,10 @@ SET(PROD_NEONFP16ARITH_MICROKERNEL_SRCS
   src/f16-pavgpool/f16-pavgpool-9x-minmax-neonfp16arith-c8.c
   src/f16-qs8-vcvt/gen/f16-qs8-vcvt-neonfp16arith-u32.c
   src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-neonfp16arith-rr2-p2-u32.c
+  src/f16-rdminmax/gen/f16-rdmax-7p7x-neonfp16arith-c16.c
+  src/f16-rdminmax/gen/f16-rdmin-7p7x-neonfp16arith-c16.c
   src/f16-rminmax/gen/f16-rmax-neonfp16arith-u32-acc4.c
+  src/f16-rminmax/gen/f16-rmin-neonfp16arith-u32-acc4.c
   src/f16-rminmax/gen/f16-rminmax-neonfp16arith-u32-acc4.c
   src/f16-spmm/gen/f16-spmm-32x1-minmax-neonfp16arith-pipelined.c
   src/f16-vbinary/gen/f16-vadd-neonfp16arith-u16.c
@@ -211,6 +214,8 @@ SET(NON_PROD_NEONFP16ARITH_MICROKERNEL_SRCS
   src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-neonfp16arith-rr2-p2-u96-acc3.c
   src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-neonfp16arith-rr2-p2-u96-acc6.c
   src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-neonfp16arith-rr2-p2-u96.c
+  src/f16-rdminmax/gen/f16-rdmax-7p7x-neonfp16arith-c32.c
+  src/f16-rdminmax/gen/f16-rdmin-7p7x-neonfp16arith-c32.c
   src/f16-rminmax/gen/f16-rmax-neonfp16arith-u8.c
   src/f16-rminmax/gen/f16-rmax-neonfp16arith-u16-acc2.c
   src/f16-rminmax/gen/f16-rmax-neonfp16arith-u24-acc3.c
@@ -222,7 +227,6 @@ SET(NON_PROD_NEONFP16ARITH_MICROKERNEL_SRCS
   src/f16-rminmax/gen/f16-rmin-neonfp16arith-u24-acc3.c
   src/f16-rminmax/gen/f16-rmin-neonfp16arith-u24.c
   src/f16-rminmax/gen/f16-rmin-neonfp16arith-u32-acc2.c
-  src/f16-rminmax/gen/f16-rmin-neonfp16arith-u32-acc4.c
   src/f16-rminmax/gen/f16-rmin-neonfp16arith-u32.c
   src/f16-rminmax/gen/f16-rmin-neonfp16arith-u64-acc2.c
   src/f16-rminmax/gen/f16-rmin-neonfp16arith-u64-acc4.c
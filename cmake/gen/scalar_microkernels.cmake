@@ -14,7 +14,10 @@ SET(PROD_SCALAR_MICROKERNEL_SRCS
   src/f16-f32-vcvt/gen/f16-f32-vcvt-scalar-u4.c
   src/f16-qs8-vcvt/gen/f16-qs8-vcvt-scalar-imagic-u4.c
   src/f16-qu8-vcvt/gen/f16-qu8-vcvt-scalar-imagic-u4.c
+  src/f16-rdminmax/gen/f16-rdmax-7p7x-scalar-c2.c
+  src/f16-rdminmax/gen/f16-rdmin-7p7x-scalar-c2.c
   src/f16-rminmax/gen/f16-rmax-scalar-u2-acc2.c
+  src/f16-rminmax/gen/f16-rmin-scalar-u2-acc2.c
   src/f16-rminmax/gen/f16-rminmax-scalar-u2-acc2.c
   src/f32-argmaxpool/f32-argmaxpool-4x-scalar-c1.c
   src/f32-argmaxpool/f32-argmaxpool-9p8x-scalar-c1.c
@@ -52,6 +55,8 @@ SET(PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-gemm/gen/f32-gemm-4x4-minmax-scalar.c
   src/f32-gemm/gen/f32-gemm-4x4-relu-scalar.c
   src/f32-gemm/gen/f32-gemm-4x4-scalar.c
+  src/f32-gemminc/gen/f32-gemminc-1x4-minmax-scalar.c
+  src/f32-gemminc/gen/f32-gemminc-4x4-minmax-scalar.c
   src/f32-ibilinear-chw/gen/f32-ibilinear-chw-scalar-p4.c
   src/f32-ibilinear/gen/f32-ibilinear-scalar-c2.c
   src/f32-igemm/gen/f32-igemm-1x4-minmax-scalar.c
@@ -65,6 +70,7 @@ SET(PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-igemm/gen/f32-igemm-4x4-minmax-scalar.c
   src/f32-igemm/gen/f32-igemm-4x4-relu-scalar.c
   src/f32-igemm/gen/f32-igemm-4x4-scalar.c
+  src/f32-layernorm/gen/f32-layernorm-scalar-u4.c
   src/f32-maxpool/f32-maxpool-9p8x-minmax-scalar-c1.c
   src/f32-pavgpool/f32-pavgpool-9p8x-minmax-scalar-c1.c
   src/f32-pavgpool/f32-pavgpool-9x-minmax-scalar-c1.c
@@ -79,10 +85,18 @@ SET(PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-scalar-imagic-u4.c
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-scalar-lrintf-u4.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-u4-acc2.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-scalar-c4.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-scalar-c4.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-scalar-c4.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-scalar.c
   src/f32-rminmax/gen/f32-rmax-scalar-u4-acc4.c
+  src/f32-rminmax/gen/f32-rmin-scalar-u4-acc4.c
   src/f32-rminmax/gen/f32-rminmax-scalar-u4-acc4.c
+  src/f32-rmsnorm/gen/f32-rmsnorm-scalar-u4.c
+  src/f32-rprod/gen/f32-rprod-scalar-u4-acc4.c
   src/f32-rsum/gen/f32-rsum-scalar-u4-acc4.c
+  src/f32-spgemm/gen/f32-spgemm-2of4-4x4-minmax-scalar.c
+  src/f32-spgemm/gen/f32-spgemm-4x4-minmax-scalar.c
   src/f32-spmm/gen/f32-spmm-8x1-minmax-scalar.c
   src/f32-spmm/gen/f32-spmm-8x2-minmax-scalar.c
   src/f32-spmm/gen/f32-spmm-8x4-minmax-scalar.c
@@ -272,7 +286,6 @@ SET(NON_PROD_SCALAR_MICROKERNEL_SRCS
   src/f16-rminmax/gen/f16-rmax-scalar-u4-acc2.c
   src/f16-rminmax/gen/f16-rmax-scalar-u4-acc4.c
   src/f16-rminmax/gen/f16-rmin-scalar-u1.c
-  src/f16-rminmax/gen/f16-rmin-scalar-u2-acc2.c
   src/f16-rminmax/gen/f16-rmin-scalar-u3-acc3.c
   src/f16-rminmax/gen/f16-rmin-scalar-u4-acc2.c
   src/f16-rminmax/gen/f16-rmin-scalar-u4-acc4.c
@@ -364,9 +377,7 @@ SET(NON_PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-f16-vcvt/gen/f32-f16-vcvt-scalar-fabsf-u3.c
   src/f32-f16-vcvt/gen/f32-f16-vcvt-scalar-fabsf-u4.c
   src/f32-gemm/gen/f32-gemm-4x2-relu-scalar.c
-  src/f32-gemminc/gen/f32-gemminc-1x4-minmax-scalar.c
   src/f32-gemminc/gen/f32-gemminc-2x4-minmax-scalar.c
-  src/f32-gemminc/gen/f32-gemminc-4x4-minmax-scalar.c
   src/f32-ibilinear-chw/gen/f32-ibilinear-chw-scalar-p1.c
   src/f32-ibilinear-chw/gen/f32-ibilinear-chw-scalar-p2.c
   src/f32-ibilinear/gen/f32-ibilinear-scalar-c1.c
@@ -419,6 +430,9 @@ SET(NON_PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-u1.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-u2-acc2.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-scalar-rr2-p5-u4-acc4.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-scalar-rr2-p5-u1.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-scalar-rr2-p5-u2.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-scalar-rr2-p5-u4.c
   src/f32-rminmax/gen/f32-rmax-scalar-u1.c
   src/f32-rminmax/gen/f32-rmax-scalar-u2-acc2.c
   src/f32-rminmax/gen/f32-rmax-scalar-u3-acc3.c
@@ -427,15 +441,18 @@ SET(NON_PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-rminmax/gen/f32-rmin-scalar-u2-acc2.c
   src/f32-rminmax/gen/f32-rmin-scalar-u3-acc3.c
   src/f32-rminmax/gen/f32-rmin-scalar-u4-acc2.c
-  src/f32-rminmax/gen/f32-rmin-scalar-u4-acc4.c
   src/f32-rminmax/gen/f32-rminmax-scalar-u1.c
   src/f32-rminmax/gen/f32-rminmax-scalar-u2-acc2.c
   src/f32-rminmax/gen/f32-rminmax-scalar-u3-acc3.c
   src/f32-rminmax/gen/f32-rminmax-scalar-u4-acc2.c
+  src/f32-rprod/gen/f32-rprod-scalar-u1.c
+  src/f32-rprod/gen/f32-rprod-scalar-u2-acc2.c
   src/f32-rsum/gen/f32-rsum-scalar-u1.c
   src/f32-rsum/gen/f32-rsum-scalar-u2-acc2.c
   src/f32-rsum/gen/f32-rsum-scalar-u3-acc3.c
   src/f32-rsum/gen/f32-rsum-scalar-u4-acc2.c
+  src/f32-spgemm/gen/f32-spgemm-1x4-minmax-scalar.c
+  src/f32-spgemm/gen/f32-spgemm-2of4-1x4-minmax-scalar.c
   src/f32-spmm/gen/f32-spmm-1x1-minmax-scalar-pipelined.c
   src/f32-spmm/gen/f32-spmm-1x1-minmax-scalar.c
   src/f32-spmm/gen/f32-spmm-2x1-minmax-scalar-pipelined.c
@@ -531,6 +548,9 @@ SET(NON_PROD_SCALAR_MICROKERNEL_SRCS
   src/f32-vrnd/gen/f32-vrndu-scalar-libm-u2.c
   src/f32-vrnd/gen/f32-vrndz-scalar-libm-u2.c
   src/f32-vrsqrt/gen/f32-vrsqrt-scalar-rsqrt-u2.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-scalar-rr2-p5-u1.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-scalar-rr2-p5-u2.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-scalar-rr2-p5-u4.c
   src/f32-vsigmoid/gen/f32-vsigmoid-scalar-rr2-lut64-p2-div-u1.c
   src/f32-vsigmoid/gen/f32-vsigmoid-scalar-rr2-lut64-p2-div-u4.c
   src/f32-vsigmoid/gen/f32-vsigmoid-scalar-rr2-lut2048-p1-div-u1.c
@@ -25,6 +25,8 @@ SET(PROD_SSE_MICROKERNEL_SRCS
   src/f32-gemm/gen/f32-gemm-1x8-minmax-sse-load1.c
   src/f32-gemm/gen/f32-gemm-4x2c4-minmax-sse.c
   src/f32-gemm/gen/f32-gemm-4x8-minmax-sse-load1.c
+  src/f32-gemminc/gen/f32-gemminc-1x8-minmax-sse-load1.c
+  src/f32-gemminc/gen/f32-gemminc-4x8-minmax-sse-load1.c
   src/f32-ibilinear-chw/gen/f32-ibilinear-chw-sse-p8.c
   src/f32-ibilinear/gen/f32-ibilinear-sse-c8.c
   src/f32-igemm/gen/f32-igemm-1x8-minmax-sse-load1.c
@@ -35,6 +37,7 @@ SET(PROD_SSE_MICROKERNEL_SRCS
   src/f32-pavgpool/f32-pavgpool-9x-minmax-sse-c4.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-sse-c16.c
   src/f32-rminmax/gen/f32-rmax-sse-u16-acc4.c
+  src/f32-rminmax/gen/f32-rmin-sse-u16-acc4.c
   src/f32-rminmax/gen/f32-rminmax-sse-u16-acc4.c
   src/f32-rsum/gen/f32-rsum-sse-u16-acc4.c
   src/f32-spmm/gen/f32-spmm-32x1-minmax-sse.c
@@ -146,13 +149,11 @@ SET(NON_PROD_SSE_MICROKERNEL_SRCS
   src/f32-gemm/gen/f32-gemm-6x8-minmax-sse-load1.c
   src/f32-gemm/gen/f32-gemm-6x8s4-minmax-sse.c
   src/f32-gemminc/gen/f32-gemminc-1x8-minmax-sse-dup.c
-  src/f32-gemminc/gen/f32-gemminc-1x8-minmax-sse-load1.c
   src/f32-gemminc/gen/f32-gemminc-1x8s4-minmax-sse.c
   src/f32-gemminc/gen/f32-gemminc-3x8-minmax-sse-dup.c
   src/f32-gemminc/gen/f32-gemminc-3x8-minmax-sse-load1.c
   src/f32-gemminc/gen/f32-gemminc-3x8s4-minmax-sse.c
   src/f32-gemminc/gen/f32-gemminc-4x8-minmax-sse-dup.c
-  src/f32-gemminc/gen/f32-gemminc-4x8-minmax-sse-load1.c
   src/f32-gemminc/gen/f32-gemminc-4x8s4-minmax-sse.c
   src/f32-gemminc/gen/f32-gemminc-5x8-minmax-sse-dup.c
   src/f32-gemminc/gen/f32-gemminc-5x8-minmax-sse-load1.c
@@ -187,7 +188,6 @@ SET(NON_PROD_SSE_MICROKERNEL_SRCS
   src/f32-rminmax/gen/f32-rmin-sse-u8-acc2.c
   src/f32-rminmax/gen/f32-rmin-sse-u12-acc3.c
   src/f32-rminmax/gen/f32-rmin-sse-u16-acc2.c
-  src/f32-rminmax/gen/f32-rmin-sse-u16-acc4.c
   src/f32-rminmax/gen/f32-rminmax-sse-u4.c
   src/f32-rminmax/gen/f32-rminmax-sse-u8-acc2.c
   src/f32-rminmax/gen/f32-rminmax-sse-u12-acc3.c
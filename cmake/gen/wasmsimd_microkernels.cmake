@@ -88,6 +88,7 @@ SET(PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-igemm/gen/f32-igemm-5x8-minmax-wasmsimd-arm-splat.c
   src/f32-igemm/gen/f32-igemm-5x8-relu-wasmsimd-splat.c
   src/f32-igemm/gen/f32-igemm-5x8-wasmsimd-splat.c
+  src/f32-layernorm/gen/f32-layernorm-wasmsimd-u16.c
   src/f32-maxpool/f32-maxpool-9p8x-minmax-wasmsimd-arm-c4.c
   src/f32-maxpool/f32-maxpool-9p8x-minmax-wasmsimd-x86-c4.c
   src/f32-pavgpool/f32-pavgpool-9p8x-minmax-wasmsimd-arm-c4.c
@@ -107,9 +108,16 @@ SET(PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-qs8-vcvt/gen/f32-qs8-vcvt-wasmsimd-magic-u32.c
   src/f32-qu8-vcvt/gen/f32-qu8-vcvt-wasmsimd-magic-u32.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-wasmsimd-rr2-p5-u16-acc2.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-wasmsimd-c16.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-wasmsimd-c16.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-wasmsimd-c16.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-wasmsimd-c16.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-wasmsimd-rr2-p5-u16.c
   src/f32-rminmax/gen/f32-rmax-wasmsimd-pminmax-u16-acc4.c
+  src/f32-rminmax/gen/f32-rmin-wasmsimd-pminmax-u16-acc4.c
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-minmax-u16-acc4.c
+  src/f32-rmsnorm/gen/f32-rmsnorm-wasmsimd-u16.c
+  src/f32-rprod/gen/f32-rprod-wasmsimd-u16-acc4.c
   src/f32-rsum/gen/f32-rsum-wasmsimd-u16-acc4.c
   src/f32-spmm/gen/f32-spmm-32x1-minmax-wasmsimd-arm.c
   src/f32-spmm/gen/f32-spmm-32x1-minmax-wasmsimd-x86.c
@@ -156,6 +164,7 @@ SET(PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-vrnd/gen/f32-vrndne-wasmsimd-u8.c
   src/f32-vrnd/gen/f32-vrndu-wasmsimd-u8.c
   src/f32-vrnd/gen/f32-vrndz-wasmsimd-u8.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-wasmsimd-rr2-p5-u16.c
   src/f32-vsigmoid/gen/f32-vsigmoid-wasmsimd-rr2-p5-div-u16.c
   src/f32-vsqrt/gen/f32-vsqrt-wasmsimd-sqrt-u8.c
   src/f32-vtanh/gen/f32-vtanh-wasmsimd-rational-9-8-div.c
@@ -553,6 +562,7 @@ SET(NON_PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-igemm/gen/f32-igemm-6x8s4-minmax-wasmsimd-x86.c
   src/f32-igemm/gen/f32-igemm-6x8s4-relu-wasmsimd.c
   src/f32-igemm/gen/f32-igemm-6x8s4-wasmsimd.c
+  src/f32-layernorm/gen/f32-layernorm-wasmsimd-u8.c
   src/f32-ppmm/gen/f32-ppmm-4x8-minmax-wasmsimd-arm-splat.c
   src/f32-ppmm/gen/f32-ppmm-4x8-minmax-wasmsimd-x86-splat.c
   src/f32-qc8w-gemm/gen/f32-qc8w-gemm-1x8-minmax-wasmsimd-arm-loadsplat.c
@@ -626,8 +636,13 @@ SET(NON_PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-wasmsimd-rr2-p5-u4.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-wasmsimd-rr2-p5-u8-acc2.c
   src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-wasmsimd-rr2-p5-u16-acc4.c
+  src/f32-rdminmax/gen/f32-rdmax-7p7x-wasmsimd-c32.c
+  src/f32-rdminmax/gen/f32-rdmin-7p7x-wasmsimd-c32.c
+  src/f32-rdprod/gen/f32-rdprod-7p7x-wasmsimd-c32.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-wasmsimd-c32.c
   src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-wasmsimd-c64.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-wasmsimd-rr2-p5-u4.c
+  src/f32-rmaxaddexp/gen/f32-rmaxaddexp-wasmsimd-rr2-p5-u8.c
   src/f32-rminmax/gen/f32-rmax-wasmsimd-minmax-u4.c
   src/f32-rminmax/gen/f32-rmax-wasmsimd-minmax-u8-acc2.c
   src/f32-rminmax/gen/f32-rmax-wasmsimd-minmax-u12-acc3.c
@@ -646,7 +661,6 @@ SET(NON_PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-rminmax/gen/f32-rmin-wasmsimd-pminmax-u8-acc2.c
   src/f32-rminmax/gen/f32-rmin-wasmsimd-pminmax-u12-acc3.c
   src/f32-rminmax/gen/f32-rmin-wasmsimd-pminmax-u16-acc2.c
-  src/f32-rminmax/gen/f32-rmin-wasmsimd-pminmax-u16-acc4.c
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-minmax-u4.c
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-minmax-u8-acc2.c
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-minmax-u12-acc3.c
@@ -656,6 +670,9 @@ SET(NON_PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-pminmax-u12-acc3.c
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-pminmax-u16-acc2.c
   src/f32-rminmax/gen/f32-rminmax-wasmsimd-pminmax-u16-acc4.c
+  src/f32-rmsnorm/gen/f32-rmsnorm-wasmsimd-u8.c
+  src/f32-rprod/gen/f32-rprod-wasmsimd-u4.c
+  src/f32-rprod/gen/f32-rprod-wasmsimd-u8-acc2.c
   src/f32-rsum/gen/f32-rsum-wasmsimd-u4.c
   src/f32-rsum/gen/f32-rsum-wasmsimd-u8-acc2.c
   src/f32-rsum/gen/f32-rsum-wasmsimd-u12-acc3.c
@@ -775,6 +792,8 @@ SET(NON_PROD_WASMSIMD_MICROKERNEL_SRCS
   src/f32-vrnd/gen/f32-vrndne-wasmsimd-u4.c
   src/f32-vrnd/gen/f32-vrndu-wasmsimd-u4.c
   src/f32-vrnd/gen/f32-vrndz-wasmsimd-u4.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-wasmsimd-rr2-p5-u4.c
+  src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-wasmsimd-rr2-p5-u8.c
   src/f32-vsigmoid/gen/f32-vsigmoid-wasmsimd-rr2-lut64-p2-div-u4.c
   src/f32-vsigmoid/gen/f32-vsigmoid-wasmsimd-rr2-lut64-p2-div-u8.c
   src/f32-vsigmoid/gen/f32-vsigmoid-wasmsimd-rr2-lut64-p2-div-u12.c
@@ -10,11 +10,16 @@ PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f16-f32acc-gemm/gen/f16-f32acc-gemm-4x16-minmax-avx2-broadcast.c",
     "src/f16-f32acc-igemm/gen/f16-f32acc-igemm-1x16-minmax-avx2-broadcast.c",
     "src/f16-f32acc-igemm/gen/f16-f32acc-igemm-4x16-minmax-avx2-broadcast.c",
+    "src/f16-layernorm/gen/f16-layernorm-avx2-u32.c",
     "src/f16-pavgpool/f16-pavgpool-9p8x-minmax-avx2-c8.c",
     "src/f16-pavgpool/f16-pavgpool-9x-minmax-avx2-c8.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u32.c",
+    "src/f16-rmaxaddexp/gen/f16-rmaxaddexp-avx2-rr2-p5-u32.c",
+    "src/f16-rmsnorm/gen/f16-rmsnorm-avx2-u32.c",
     "src/f16-velu/gen/f16-velu-avx2-rr1-p3-u16.c",
+    "src/f16-vscaleexpminusmax/gen/f16-vscaleexpminusmax-avx2-rr2-p5-u32.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-rcp-u32.c",
+    "src/f32-layernorm/gen/f32-layernorm-avx2-u32.c",
     "src/f32-qc4w-gemm/gen/f32-qc4w-gemm-1x16-minmax-avx2-broadcast.c",
     "src/f32-qc4w-gemm/gen/f32-qc4w-gemm-3x16-minmax-avx2-broadcast.c",
     "src/f32-qc8w-gemm/gen/f32-qc8w-gemm-1x16-minmax-avx2-broadcast.c",
@@ -22,8 +27,12 @@ PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-avx2-u64.c",
     "src/f32-qu8-vcvt/gen/f32-qu8-vcvt-avx2-u64.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx2-rr2-p5-u32-acc2.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx2-rr2-p5-u32.c",
+    "src/f32-rmsnorm/gen/f32-rmsnorm-avx2-u32.c",
+    "src/f32-spgemm/gen/f32-spgemm-2of4-4x8-minmax-avx2.c",
     "src/f32-velu/gen/f32-velu-avx2-rr1-lut4-p4-perm-u32.c",
     "src/f32-vlog/gen/f32-vlog-avx2-rational-3-3-div.c",
+    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u24.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx2-rr1-p5-div-u16.c",
     "src/qd8-f16-qb4w-gemm/gen/qd8-f16-qb4w-gemm-1x8c8-minmax-avx2.c",
     "src/qd8-f16-qb4w-gemm/gen/qd8-f16-qb4w-gemm-3x8c8-minmax-avx2.c",
@@ -112,6 +121,7 @@ NON_PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f16-igemm/gen/f16-igemm-5x16-minmax-avx2-broadcast.c",
     "src/f16-igemm/gen/f16-igemm-6x8-minmax-avx2-broadcast.c",
     "src/f16-igemm/gen/f16-igemm-7x8-minmax-avx2-broadcast.c",
+    "src/f16-layernorm/gen/f16-layernorm-avx2-u16.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u16-acc2.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u16.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u32-acc2.c",
@@ -134,7 +144,10 @@ NON_PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u96-acc3.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u96-acc6.c",
     "src/f16-raddstoreexpminusmax/gen/f16-raddstoreexpminusmax-avx2-rr1-p2-u96.c",
+    "src/f16-rmaxaddexp/gen/f16-rmaxaddexp-avx2-rr2-p5-u16.c",
+    "src/f16-rmsnorm/gen/f16-rmsnorm-avx2-u16.c",
     "src/f16-velu/gen/f16-velu-avx2-rr1-p3-u8.c",
+    "src/f16-vscaleexpminusmax/gen/f16-vscaleexpminusmax-avx2-rr2-p5-u16.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-div-u8.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-div-u16.c",
     "src/f16-vsigmoid/gen/f16-vsigmoid-avx2-rr1-p2-div-u24.c",
@@ -150,6 +163,7 @@ NON_PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f16-vtanh/gen/f16-vtanh-avx2-expm1minus-rr1-p3h2ts-rcp-u16.c",
     "src/f16-vtanh/gen/f16-vtanh-avx2-expm1minus-rr1-p3h2ts-rcp-u24.c",
     "src/f16-vtanh/gen/f16-vtanh-avx2-expm1minus-rr1-p3h2ts-rcp-u32.c",
+    "src/f32-layernorm/gen/f32-layernorm-avx2-u16.c",
     "src/f32-qc4w-gemm/gen/f32-qc4w-gemm-2x16-minmax-avx2-broadcast.c",
     "src/f32-qc4w-gemm/gen/f32-qc4w-gemm-4x16-minmax-avx2-broadcast.c",
     "src/f32-qc4w-gemm/gen/f32-qc4w-gemm-5x16-minmax-avx2-broadcast.c",
@@ -217,6 +231,10 @@ NON_PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx2-rr2-p5-u8.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx2-rr2-p5-u16-acc2.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx2-rr2-p5-u32-acc4.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx2-rr2-p5-u8.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx2-rr2-p5-u16.c",
+    "src/f32-rmsnorm/gen/f32-rmsnorm-avx2-u16.c",
+    "src/f32-spgemm/gen/f32-spgemm-2of4-1x8-minmax-avx2.c",
     "src/f32-velu/gen/f32-velu-avx2-rr1-lut4-p4-perm-u8.c",
     "src/f32-velu/gen/f32-velu-avx2-rr1-lut4-p4-perm-u16.c",
     "src/f32-velu/gen/f32-velu-avx2-rr1-lut4-p4-perm-u24.c",
@@ -234,7 +252,6 @@ NON_PROD_AVX2_MICROKERNEL_SRCS = [
     "src/f32-velu/gen/f32-velu-avx2-rr1-p6-u32.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u8.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u16.c",
-    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u24.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u32.c",
     "src/f32-vscaleextexp/gen/f32-vscaleextexp-avx2-p5-u8.c",
     "src/f32-vscaleextexp/gen/f32-vscaleextexp-avx2-p5-u16.c",
@@ -13,13 +13,26 @@ PROD_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-dwconv/gen/f32-dwconv-25p16c-minmax-avx512f.c",
     "src/f32-gemm/gen/f32-gemm-1x32-minmax-avx512f-broadcast.c",
     "src/f32-gemm/gen/f32-gemm-7x32-minmax-avx512f-broadcast.c",
+    "src/f32-gemminc/gen/f32-gemminc-1x32-minmax-avx512f-broadcast.c",
+    "src/f32-gemminc/gen/f32-gemminc-7x32-minmax-avx512f-broadcast.c",
     "src/f32-igemm/gen/f32-igemm-1x32-minmax-avx512f-broadcast.c",
     "src/f32-igemm/gen/f32-igemm-7x32-minmax-avx512f-broadcast.c",
+    "src/f32-layernorm/gen/f32-layernorm-avx512f-u64.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr2-p5-u64-acc2.c",
+    "src/f32-rdminmax/gen/f32-rdmax-7p7x-avx512f-c64.c",
+    "src/f32-rdminmax/gen/f32-rdmin-7p7x-avx512f-c64.c",
+    "src/f32-rdprod/gen/f32-rdprod-7p7x-avx512f-c64.c",
     "src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx512f-c64.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx512f-rr2-p5-u64.c",
     "src/f32-rminmax/gen/f32-rmax-avx512f-u64-acc4.c",
+    "src/f32-rminmax/gen/f32-rmin-avx512f-u64-acc4.c",
     "src/f32-rminmax/gen/f32-rminmax-avx512f-u64-acc4.c",
+    "src/f32-rmsnorm/gen/f32-rmsnorm-avx512f-u64.c",
+    "src/f32-rprod/gen/f32-rprod-avx512f-u64-acc4.c",
     "src/f32-rsum/gen/f32-rsum-avx512f-u64-acc4.c",
+    "src/f32-spmm/gen/f32-spmm-32x2-minmax-avx512f.c",
+    "src/f32-spmm/gen/f32-spmm-32x4-minmax-avx512f.c",
+    "src/f32-spmm/gen/f32-spmm-64x1-minmax-avx512f.c",
     "src/f32-vbinary/gen/f32-vadd-avx512f-u32.c",
     "src/f32-vbinary/gen/f32-vaddc-avx512f-u32.c",
     "src/f32-vbinary/gen/f32-vdiv-avx512f-u32.c",
@@ -54,6 +67,7 @@ PROD_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-vrnd/gen/f32-vrndu-avx512f-u16.c",
     "src/f32-vrnd/gen/f32-vrndz-avx512f-u16.c",
     "src/f32-vrsqrt/gen/f32-vrsqrt-avx512f-rsqrt-u32.c",
+    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u16.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-avx512f-rr2-lut32-p2-perm2-scalef-div-u64.c",
     "src/f32-vsqrt/gen/f32-vsqrt-avx512f-rsqrt-u16.c",
     "src/f32-vtanh/gen/f32-vtanh-avx512f-rational-9-8-nr.c",
@@ -137,6 +151,7 @@ NON_PROD_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-igemm/gen/f32-igemm-7x16-minmax-avx512f-broadcast.c",
     "src/f32-igemm/gen/f32-igemm-8x16-minmax-avx512f-broadcast.c",
     "src/f32-igemm/gen/f32-igemm-8x32-minmax-avx512f-broadcast.c",
+    "src/f32-layernorm/gen/f32-layernorm-avx512f-u32.c",
     "src/f32-raddexpminusmax/gen/f32-raddexpminusmax-avx512f-p5-scalef-u64-acc2.c",
     "src/f32-raddexpminusmax/gen/f32-raddexpminusmax-avx512f-p5-scalef-u64-acc4.c",
     "src/f32-raddexpminusmax/gen/f32-raddexpminusmax-avx512f-p5-scalef-u64.c",
@@ -174,9 +189,14 @@ NON_PROD_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr2-p5-u16.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr2-p5-u32-acc2.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-avx512f-rr2-p5-u64-acc4.c",
+    "src/f32-rdminmax/gen/f32-rdmax-7p7x-avx512f-c32.c",
+    "src/f32-rdminmax/gen/f32-rdmin-7p7x-avx512f-c32.c",
+    "src/f32-rdprod/gen/f32-rdprod-7p7x-avx512f-c32.c",
     "src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx512f-c16.c",
     "src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx512f-c32.c",
     "src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-avx512f-c128.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx512f-rr2-p5-u16.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx512f-rr2-p5-u32.c",
     "src/f32-rminmax/gen/f32-rmax-avx512f-u16.c",
     "src/f32-rminmax/gen/f32-rmax-avx512f-u32-acc2.c",
     "src/f32-rminmax/gen/f32-rmax-avx512f-u48-acc3.c",
@@ -185,15 +205,21 @@ NON_PROD_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-rminmax/gen/f32-rmin-avx512f-u32-acc2.c",
     "src/f32-rminmax/gen/f32-rmin-avx512f-u48-acc3.c",
     "src/f32-rminmax/gen/f32-rmin-avx512f-u64-acc2.c",
-    "src/f32-rminmax/gen/f32-rmin-avx512f-u64-acc4.c",
     "src/f32-rminmax/gen/f32-rminmax-avx512f-u16.c",
     "src/f32-rminmax/gen/f32-rminmax-avx512f-u32-acc2.c",
     "src/f32-rminmax/gen/f32-rminmax-avx512f-u48-acc3.c",
     "src/f32-rminmax/gen/f32-rminmax-avx512f-u64-acc2.c",
+    "src/f32-rmsnorm/gen/f32-rmsnorm-avx512f-u32.c",
+    "src/f32-rprod/gen/f32-rprod-avx512f-u16.c",
+    "src/f32-rprod/gen/f32-rprod-avx512f-u32-acc2.c",
     "src/f32-rsum/gen/f32-rsum-avx512f-u16.c",
     "src/f32-rsum/gen/f32-rsum-avx512f-u32-acc2.c",
     "src/f32-rsum/gen/f32-rsum-avx512f-u48-acc3.c",
     "src/f32-rsum/gen/f32-rsum-avx512f-u64-acc2.c",
+    "src/f32-spmm/gen/f32-spmm-16x1-minmax-avx512f.c",
+    "src/f32-spmm/gen/f32-spmm-32x1-minmax-avx512f.c",
+    "src/f32-spmm/gen/f32-spmm-64x2-minmax-avx512f.c",
+    "src/f32-spmm/gen/f32-spmm-64x4-minmax-avx512f.c",
     "src/f32-vbinary/gen/f32-vadd-avx512f-u16.c",
     "src/f32-vbinary/gen/f32-vaddc-avx512f-u16.c",
     "src/f32-vbinary/gen/f32-vdiv-avx512f-u16.c",
@@ -236,7 +262,6 @@ NON_PROD_AVX512F_MICROKERNEL_SRCS = [
     "src/f32-vrnd/gen/f32-vrndz-avx512f-u32.c",
     "src/f32-vrsqrt/gen/f32-vrsqrt-avx512f-rsqrt-u16.c",
     "src/f32-vrsqrt/gen/f32-vrsqrt-avx512f-rsqrt-u64.c",
-    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u16.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u32.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u48.c",
     "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u64.c",
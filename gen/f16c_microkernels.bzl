@@ -12,6 +12,8 @@ PROD_F16C_MICROKERNEL_SRCS = [
     "src/f16-f32acc-rdsum/gen/f16-f32acc-rdsum-7p7x-f16c-c32.c",
     "src/f16-f32acc-rsum/gen/f16-f32acc-rsum-f16c-u32-acc4.c",
     "src/f16-maxpool/f16-maxpool-9p8x-minmax-f16c-c8.c",
+    "src/f16-rdminmax/gen/f16-rdmax-7p7x-f16c-c32.c",
+    "src/f16-rdminmax/gen/f16-rdmin-7p7x-f16c-c32.c",
     "src/f16-rminmax/f16-rmax-f16c-u32.c",
     "src/f16-vbinary/gen/f16-vadd-f16c-u16.c",
     "src/f16-vbinary/gen/f16-vaddc-f16c-u16.c",
@@ -55,6 +57,11 @@ NON_PROD_F16C_MICROKERNEL_SRCS = [
     "src/f16-f32acc-rsum/gen/f16-f32acc-rsum-f16c-u16-acc2.c",
     "src/f16-f32acc-rsum/gen/f16-f32acc-rsum-f16c-u24-acc3.c",
     "src/f16-f32acc-rsum/gen/f16-f32acc-rsum-f16c-u32-acc2.c",
+    "src/f16-rdminmax/gen/f16-rdmax-7p7x-f16c-c16.c",
+    "src/f16-rdminmax/gen/f16-rdmin-7p7x-f16c-c16.c",
+    "src/f16-spmm/gen/f16-spmm-8x1-minmax-f16c.c",
+    "src/f16-spmm/gen/f16-spmm-16x1-minmax-f16c.c",
+    "src/f16-spmm/gen/f16-spmm-32x1-minmax-f16c.c",
     "src/f16-vbinary/gen/f16-vadd-f16c-u8.c",
     "src/f16-vbinary/gen/f16-vaddc-f16c-u8.c",
     "src/f16-vbinary/gen/f16-vdiv-f16c-u16.c",
@@ -6,12 +6,13 @@ Auto-generated file. Do not edit!
 """
 
 PROD_NEONBF16_MICROKERNEL_SRCS = [
+    "src/bf16-gemm/gen/bf16-gemm-1x8c2-minmax-neonbf16-bfdot-lane-ld128.c",
+    "src/bf16-gemm/gen/bf16-gemm-5x8c2-minmax-neonbf16-bfdot-lane-ld128.c",
 ]
 
 NON_PROD_NEONBF16_MICROKERNEL_SRCS = [
     "src/bf16-gemm/gen/bf16-gemm-1x4c8-minmax-neonbf16-bfdot.c",
     "src/bf16-gemm/gen/bf16-gemm-1x4c8-minmax-neonbf16-bfmlal.c",
-    "src/bf16-gemm/gen/bf16-gemm-1x8c2-minmax-neonbf16-bfdot-lane-ld128.c",
     "src/bf16-gemm/gen/bf16-gemm-2x4c8-minmax-neonbf16-bfdot.c",
     "src/bf16-gemm/gen/bf16-gemm-2x4c8-minmax-neonbf16-bfmlal.c",
     "src/bf16-gemm/gen/bf16-gemm-3x4c8-minmax-neonbf16-bfdot.c",
@@ -21,7 +22,6 @@ NON_PROD_NEONBF16_MICROKERNEL_SRCS = [
     "src/bf16-gemm/gen/bf16-gemm-4x8c2-minmax-neonbf16-bfdot-lane-ld128.c",
     "src/bf16-gemm/gen/bf16-gemm-5x4c8-minmax-neonbf16-bfdot.c",
     "src/bf16-gemm/gen/bf16-gemm-5x4c8-minmax-neonbf16-bfmlal.c",
-    "src/bf16-gemm/gen/bf16-gemm-5x8c2-minmax-neonbf16-bfdot-lane-ld128.c",
     "src/bf16-gemm/gen/bf16-gemm-6x8c2-minmax-neonbf16-bfdot-lane-ld128.c",
 ]
 
@@ -7,11 +7,15 @@ Auto-generated file. Do not edit!
 
 PROD_NEONFP16_MICROKERNEL_SRCS = [
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-neonfp16-u16.c",
+    "src/f16-layernorm/gen/f16-layernorm-neonfp16-u16.c",
+    "src/f16-rmsnorm/gen/f16-rmsnorm-neonfp16-u16.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-neonfp16-u16.c",
 ]
 
 NON_PROD_NEONFP16_MICROKERNEL_SRCS = [
     "src/f16-f32-vcvt/gen/f16-f32-vcvt-neonfp16-u8.c",
+    "src/f16-layernorm/gen/f16-layernorm-neonfp16-u8.c",
+    "src/f16-rmsnorm/gen/f16-rmsnorm-neonfp16-u8.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-neonfp16-u8.c",
 ]
 
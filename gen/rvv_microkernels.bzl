@@ -23,6 +23,7 @@ PROD_RVV_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-rvv-rr2-p6-u4v.c",
     "src/f32-rdsum/gen/f32-rdsum-7p7x-minmax-rvv-u4v.c",
     "src/f32-rminmax/gen/f32-rmax-rvv-u8v.c",
+    "src/f32-rminmax/gen/f32-rmin-rvv-u8v.c",
     "src/f32-rminmax/gen/f32-rminmax-rvv-u8v.c",
     "src/f32-vbinary/gen/f32-vadd-rvv-u8v.c",
     "src/f32-vbinary/gen/f32-vaddc-rvv-u8v.c",
@@ -92,7 +93,6 @@ NON_PROD_RVV_MICROKERNEL_SRCS = [
     "src/f32-rminmax/gen/f32-rmin-rvv-u1v.c",
     "src/f32-rminmax/gen/f32-rmin-rvv-u2v.c",
     "src/f32-rminmax/gen/f32-rmin-rvv-u4v.c",
-    "src/f32-rminmax/gen/f32-rmin-rvv-u8v.c",
     "src/f32-rminmax/gen/f32-rminmax-rvv-u1v.c",
     "src/f32-rminmax/gen/f32-rminmax-rvv-u2v.c",
     "src/f32-rminmax/gen/f32-rminmax-rvv-u4v.c",
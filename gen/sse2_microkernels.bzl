@@ -13,9 +13,16 @@ PROD_SSE2_MICROKERNEL_SRCS = [
     "src/f32-argmaxpool/f32-argmaxpool-9p8x-sse2-c4.c",
     "src/f32-argmaxpool/f32-argmaxpool-9x-sse2-c4.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-sse2-u16.c",
+    "src/f32-layernorm/gen/f32-layernorm-sse2-u16.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-sse2-u32.c",
     "src/f32-qu8-vcvt/gen/f32-qu8-vcvt-sse2-u32.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-u16-acc2.c",
+    "src/f32-rdminmax/gen/f32-rdmax-7p7x-sse2-c16.c",
+    "src/f32-rdminmax/gen/f32-rdmin-7p7x-sse2-c16.c",
+    "src/f32-rdprod/gen/f32-rdprod-7p7x-sse2-c16.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-sse2-rr2-p5-u16.c",
+    "src/f32-rmsnorm/gen/f32-rmsnorm-sse2-u16.c",
+    "src/f32-rprod/gen/f32-rprod-sse2-u16-acc4.c",
     "src/f32-vbinary/gen/f32-vprelu-sse2-u8.c",
     "src/f32-vbinary/gen/f32-vpreluc-sse2-u8.c",
     "src/f32-vbinary/gen/f32-vrpreluc-sse2-u8.c",
@@ -29,6 +36,7 @@ PROD_SSE2_MICROKERNEL_SRCS = [
     "src/f32-vrnd/gen/f32-vrndne-sse2-u8.c",
     "src/f32-vrnd/gen/f32-vrndu-sse2-u8.c",
     "src/f32-vrnd/gen/f32-vrndz-sse2-u8.c",
+    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-sse2-rr2-p5-u16.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-lut64-p2-div-u8.c",
     "src/f32-vtanh/gen/f32-vtanh-sse2-rational-9-8-div.c",
     "src/f32-vunary/gen/f32-vabs-sse2.c",
@@ -112,6 +120,7 @@ NON_PROD_SSE2_MICROKERNEL_SRCS = [
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-sse2-u8.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-sse2-u24.c",
     "src/f32-f16-vcvt/gen/f32-f16-vcvt-sse2-u32.c",
+    "src/f32-layernorm/gen/f32-layernorm-sse2-u8.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-sse2-u8.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-sse2-u16.c",
     "src/f32-qs8-vcvt/gen/f32-qs8-vcvt-sse2-u24.c",
@@ -121,6 +130,14 @@ NON_PROD_SSE2_MICROKERNEL_SRCS = [
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-u4.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-u8-acc2.c",
     "src/f32-raddstoreexpminusmax/gen/f32-raddstoreexpminusmax-sse2-rr2-p5-u16-acc4.c",
+    "src/f32-rdminmax/gen/f32-rdmax-7p7x-sse2-c32.c",
+    "src/f32-rdminmax/gen/f32-rdmin-7p7x-sse2-c32.c",
+    "src/f32-rdprod/gen/f32-rdprod-7p7x-sse2-c32.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-sse2-rr2-p5-u4.c",
+    "src/f32-rmaxaddexp/gen/f32-rmaxaddexp-sse2-rr2-p5-u8.c",
+    "src/f32-rmsnorm/gen/f32-rmsnorm-sse2-u8.c",
+    "src/f32-rprod/gen/f32-rprod-sse2-u4.c",
+    "src/f32-rprod/gen/f32-rprod-sse2-u8-acc2.c",
     "src/f32-vbinary/gen/f32-vprelu-sse2-u4.c",
     "src/f32-vbinary/gen/f32-vpreluc-sse2-u4.c",
     "src/f32-vbinary/gen/f32-vrpreluc-sse2-u4.c",
@@ -137,6 +154,8 @@ NON_PROD_SSE2_MICROKERNEL_SRCS = [
     "src/f32-vrnd/gen/f32-vrndne-sse2-u4.c",
     "src/f32-vrnd/gen/f32-vrndu-sse2-u4.c",
     "src/f32-vrnd/gen/f32-vrndz-sse2-u4.c",
+    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-sse2-rr2-p5-u4.c",
+    "src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-sse2-rr2-p5-u8.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-lut64-p2-div-u4.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-lut64-p2-div-u12.c",
     "src/f32-vsigmoid/gen/f32-vsigmoid-sse2-rr2-lut64-p2-div-u16.c",
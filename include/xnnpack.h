@@ -56,6 +56,42 @@ extern "C" {
 /// Enable the just-in-time compiler.
 #define XNN_FLAG_JIT 0x00000010
 
+/// Run independent operators of a Runtime concurrently.
+///
+/// Operators are grouped in stages of operators which do not depend on each other. Stages with a single operator run
+/// it on the whole thread pool, while operators of larger stages run concurrently, one operator per thread. This is
+/// mostly beneficial for graphs with many small operators in parallel branches.
+/// Note: this flag is ignored if XNN_FLAG_BASIC_PROFILING or XNN_FLAG_DETAILED_PROFILING is specified.
+#define XNN_FLAG_INTER_OPERATOR_PARALLELISM 0x00000100
+
+/// Memoize the results of reshaping a Runtime for each combination of external input shapes.
+///
+/// When xnn_reshape_runtime is called with external input shapes (and KV cache positions) that the Runtime was
+/// reshaped for before, the operator state and memory plan computed for these shapes are restored instead of
+/// reshaping every operator and planning memory again. This is beneficial for Runtimes which alternate between a few
+/// input shapes, e.g. the prefill and decode steps of a language model.
+/// Note: Runtimes with operators whose reshaped state can't be restored (e.g. convolutions with indirection buffers)
+/// reshape every operator every time.
+#define XNN_FLAG_CACHE_RESHAPE_PLANS 0x00000400
+
+/// Record the start and end time, the number of parallel tiles and the busy time of every thread pool worker for each
+/// operator, and make them available as a Chrome trace through xnn_profile_info_chrome_trace.
+///
+/// Implies XNN_FLAG_BASIC_PROFILING. Every tile is timed individually, so this flag adds noticeable overhead to
+/// operators with many small tiles.
+#define XNN_FLAG_DETAILED_PROFILING 0x00000800
+
+/// Time the alternative GEMM microkernels available on this hardware on the shape of each FP32 Fully Connected
+/// operator when it is created, and use the fastest.
+///
+/// Can be passed to xnn_create_runtime_v4 (applies to all Fully Connected nodes) or to
+/// xnn_create_fully_connected_nc_f32. When a weights cache created by XNNPACK is used, the choices are recorded in the
+/// weights cache, and saved with it by xnn_save_weights_cache, so operators created with the same weights cache or a
+/// weights cache loaded from the file are not timed again. Operators which are not in a finalized weights cache are not
+/// timed either, and use the default GEMM microkernel.
+/// Note: autotuning adds to the creation time of operators which are not in the weights cache.
+#define XNN_FLAG_AUTOTUNE_GEMM 0x00001000
+
 /// The convolution operator represents a depthwise convolution, and use HWGo layout for filters.
 #define XNN_FLAG_DEPTHWISE_CONVOLUTION 0x00000001
 
@@ -98,7 +134,11 @@ extern "C" {
 /// Retain reduced dimensions with length 1.
 #define XNN_FLAG_KEEP_DIMS 0x00000040
 
-// Next unused flag value: 0x00000100.
+/// Apply a causal mask in a scaled dot-product attention operator: query token i attends to key/value tokens 0 to
+/// i + (key_value_tokens - query_tokens), i.e. the query tokens are the last tokens of the key/value sequence.
+#define XNN_FLAG_CAUSAL_MASK 0x00000200
+
+// Next unused flag value: 0x00002000.
 
 /// The number of entries in an array of xnn_quantization_params that XNNPACK may read beyond array bounds.
 /// The caller must allocate at least this many extra xnn_quantization_params before passing the array to XNNPACK.
@@ -1193,7 +1233,7 @@ struct xnn_attention_logits_cap_tanh_params {
 ///
 /// This operator is experimental.
 ///
-/// The Scaled Dot-Product Attention Node computes a multi-head or multi-query scaled dot attention on the query, key,
+/// The Scaled Dot-Product Attention Node computes a multi-head, grouped-query, or multi-query scaled dot attention on the query, key,
 /// and value tensors.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1205,26 +1245,32 @@ struct xnn_attention_logits_cap_tanh_params {
 ///                   is the 0 or more dimensions treated as batch size.
 /// @param key_id - Value ID for the key tensor. The key tensor must be a 2+--dimensional tensor defined in the
 ///                 @a subgraph. It can have the same number of dimensions as the query, with the dimensions as
-///                 [*, H, U, C] (multi-head), or have 1 less dimension than the query, with the dimensions as
-///                 as [*, U, C] (multi-query, number of heads omitted implies single head), where H/U/C are the
-///                 heads/key_value_tokens/channels, and * is the 0 or more dimensions treated as batch size. These
-///                 batch size dimensions must be the same as query.
+///                 [*, G, U, C] (multi-head if G == H, grouped-query if G < H), or have 1 less dimension than the
+///                 query, with the dimensions as [*, U, C] (multi-query, number of heads omitted implies single
+///                 head), where G/U/C are the heads/key_value_tokens/channels, and * is the 0 or more dimensions
+///                 treated as batch size. H must be divisible by G, and each key head is shared by H/G consecutive
+///                 query heads. These batch size dimensions must be the same as query.
 /// @param value_id - Value ID for the value tensor. The value tensor must be a 2+--dimensional tensor defined in the
 ///                   @a subgraph. It can have the same number of dimensions as the query, with the dimensions as
-///                   [*, H, U, D] (multi-head), or have 1 less dimension than the query, with the dimensions as
-///                   as [*, U, D] (multi-query, number of heads omitted implies single head), where H/U/D are the
-///                   heads/key_value_tokens/value_channels, and * is the 0 or more dimensions treated as batch size.
-///                   These batch size dimensions must be the same as query and key.
+///                   [*, G, U, D] (multi-head if G == H, grouped-query if G < H), or have 1 less dimension than the
+///                   query, with the dimensions as [*, U, D] (multi-query, number of heads omitted implies single
+///                   head), where G/U/D are the heads/key_value_tokens/value_channels, and * is the 0 or more
+///                   dimensions treated as batch size. Value heads must be the same as key heads. These batch size
+///                   dimensions must be the same as query and key.
 /// @param scale_id - Value ID for the scale tensor. The scale tensor must be a 1D tensor defined in the @a subgraph
 ///                   with [C] dimensions. The query tensor is multiplied with this scale tensor before the dot product
 ///                   with the key tensor.
 /// @param mask_id - Value ID for the mask tensor. The mask tensor must be a 2D tensor defined in the @a subgraph with
-///                  [T, U] dimensions. The mask tensor is added to the logits (query dot value).
+///                  [T, U] dimensions. The mask tensor is added to the logits (query dot value). Can be
+///                  XNN_INVALID_VALUE_ID if the XNN_FLAG_CAUSAL_MASK flag is specified.
 /// @param output_id - Value ID for the output tensor. The output tensor must be a 3+-dimensional tensor defined in the
 ///                    @a subgraph with the dimensions as [*, H, T, D], where H/T/D are the heads/tokens/value_channels,
 ///                    and * is the 0 or more dimensions treated as batch size. These batch size dimensions must be the
 ///                    same as query, key, and value.
-/// @param flags - binary features of the Scaled Dot Product Attention Node. No supported flags are currently defined.
+/// @param flags - binary features of the Scaled Dot Product Attention Node. The only currently supported value is
+///                XNN_FLAG_CAUSAL_MASK, which requires U >= T and masks out the logits of key/value tokens after each
+///                query token without reading a mask tensor. Blocks of key/value tokens masked for all query tokens are
+///                skipped.
 enum xnn_status xnn_define_scaled_dot_product_attention(
   xnn_subgraph_t subgraph,
   enum xnn_attention_logits_cap_type cap_type,
@@ -1428,6 +1474,12 @@ enum xnn_reduce_operator {
   xnn_reduce_invalid = -1,
   xnn_reduce_sum,
   xnn_reduce_mean,
+  xnn_reduce_max,
+  xnn_reduce_min,
+  xnn_reduce_prod,
+  // Index of the maximum element over the reduced axes, flattened in row-major
+  // order of the reduced dimensions. The output tensor must be int32.
+  xnn_reduce_argmax,
 };
 
 /// Define a Reduce Node and add it to a Subgraph.
@@ -1633,6 +1685,26 @@ enum xnn_status xnn_define_copy(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a KV Cache Append Node and add it to a Subgraph.
+///
+/// The KV Cache Append Node writes N new tokens of keys or values in place into a persistent cache tensor, starting at
+/// the position set with xnn_set_kv_cache_position (0 by default). After the Node runs, the first position + N tokens
+/// of the cache are valid, and a Scaled Dot Product Attention Node consuming the cache as key or value attends only
+/// over these tokens. This API is experimental and may change.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the new tokens. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph with [*, G, N, C] dimensions.
+/// @param cache_id - Value ID for the cache. The cache tensor must be a persistent N-dimensional tensor defined in the
+///                   @a subgraph with [*, G, S, C] dimensions, where S is the maximum number of cached tokens. All
+///                   dimensions except the second-innermost must match the input tensor.
+/// @param flags - binary features of the KV Cache Append Node. No supported flags are currently defined.
+enum xnn_status xnn_define_kv_cache_append(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t cache_id,
+  uint32_t flags);
+
 /// Define a 2-Output Split Node and add it to a Subgraph.
 ///
 /// The 2-Output Split Node splits an input tensor into two output tensors along a specified axis evenly.
@@ -1794,6 +1866,59 @@ enum xnn_status xnn_define_rope(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Layer Norm Node and add it to a Subgraph.
+///
+/// The Layer Norm Node normalizes every row along the innermost dimension of the input to zero mean and unit variance,
+/// then multiplies it by a per-channel scale and adds a per-channel bias:
+///   output = (input - mean(input)) / sqrt(variance(input) + epsilon) * scale + bias
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param epsilon - value added to the variance to avoid division by zero. Must be finite and non-negative.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph with at least one dimension.
+/// @param scale_id - Value ID for the scale tensor. The scale tensor must be a 1D tensor defined in the @a subgraph,
+///                   with as many elements as the innermost dimension of the input, and the same datatype as the
+///                   input.
+/// @param bias_id - Value ID for the bias tensor. The bias tensor must be a 1D tensor defined in the @a subgraph, with
+///                  as many elements as the innermost dimension of the input, and the same datatype as the input.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor. The output can have the same datatype as the
+///                    input, or be a dynamically quantized tensor with one non-batch dimension.
+/// @param flags - binary features of the Layer Norm Node. No supported flags are currently defined.
+enum xnn_status xnn_define_layer_norm(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t scale_id,
+  uint32_t bias_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a RMS Norm Node and add it to a Subgraph.
+///
+/// The RMS Norm Node divides every row along the innermost dimension of the input by its root mean square, then
+/// multiplies it by a per-channel scale:
+///   output = input / sqrt(mean(input ** 2) + epsilon) * scale
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param epsilon - value added to the mean square to avoid division by zero. Must be finite and non-negative.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph with at least one dimension.
+/// @param scale_id - Value ID for the scale tensor. The scale tensor must be a 1D tensor defined in the @a subgraph,
+///                   with as many elements as the innermost dimension of the input, and the same datatype as the
+///                   input.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor. The output can have the same datatype as the
+///                    input, or be a dynamically quantized tensor with one non-batch dimension.
+/// @param flags - binary features of the RMS Norm Node. No supported flags are currently defined.
+enum xnn_status xnn_define_rms_norm(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t scale_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Abs Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -2231,6 +2356,27 @@ bool xnn_weights_cache_is_finalized(xnn_weights_cache_t cache);
 /// @param weights_cache - the weights cache object to destroy.
 enum xnn_status xnn_delete_weights_cache(xnn_weights_cache_t weights_cache);
 
+/// Save the packed weights and the index of a weights cache to a file. The file can be loaded with
+/// xnn_create_weights_cache_from_file by processes using the same build of XNNPACK on the same kind of hardware. This
+/// API is experimental and may change.
+///
+/// @param weights_cache - a weights cache created by xnn_create_weights_cache or xnn_create_weights_cache_with_size.
+///                        The weights cache must not be hard finalized, as hard finalization discards the index.
+/// @param path - path of the file to write.
+enum xnn_status xnn_save_weights_cache(xnn_weights_cache_t weights_cache, const char* path);
+
+/// Create a finalized weights cache from a file written by xnn_save_weights_cache. The packed weights are mapped
+/// read-only from the file where the platform supports it, so that they are shared between processes through the page
+/// cache. The weights cache behaves like a soft finalized weights cache: creating operators with weights which are not
+/// in the file fails. This API is experimental and may change.
+///
+/// @param path - path of the file to load.
+/// @param weights_cache_out - pointer to the variable that will be initialized to a handle to the weights cache provider
+///                            upon successful return.
+/// @retval xnn_status_invalid_parameter - the file can not be read, or was saved by a different build of XNNPACK.
+/// @retval xnn_status_unsupported_hardware - the file was saved on hardware with different features.
+enum xnn_status xnn_create_weights_cache_from_file(const char* path, xnn_weights_cache_t* weights_cache_out);
+
 typedef struct xnn_workspace* xnn_workspace_t;
 
 /// Create a workspace object.
@@ -2253,6 +2399,12 @@ enum xnn_profile_info {
   xnn_profile_info_operator_name,
   /// Returns a uint64_t[] with the runtimes of all operators in the same order as xnn_profile_info_operator_name.
   xnn_profile_info_operator_timing,
+  /// Returns a null-terminated char[] with the last invocation of the Runtime in the Chrome trace event JSON format,
+  /// which can be loaded in chrome://tracing or Perfetto. Each operator is a complete event on thread 0, annotated with
+  /// its microkernel type and number of parallel tiles, and the time each thread pool worker was busy running the
+  /// operator is a complete event on the worker's own thread, starting at the operator's start time.
+  /// Requires a Runtime created with XNN_FLAG_DETAILED_PROFILING.
+  xnn_profile_info_chrome_trace,
 };
 
 /// Return profile information for all operators.
@@ -2285,11 +2437,13 @@ enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
 ///                     pool is NULL, the computation would run on the caller thread without parallelization.
 /// @param flags - binary features of the runtime. The only currently supported values are
 ///                XNN_FLAG_HINT_SPARSE_INFERENCE, XNN_FLAG_HINT_FP16_INFERENCE, XNN_FLAG_FORCE_FP16_INFERENCE,
-///                XNN_FLAG_YIELD_WORKERS, and XNN_FLAG_TRANSIENT_INDIRECTION_BUFFER. If XNN_FLAG_YIELD_WORKERS is
-///                specified, worker threads would be yielded to the system scheduler after processing the last operator
-///                in the Runtime. If XNN_FLAG_TRANSIENT_INDIRECTION_BUFFER is specified, convolution operators will
-///                initialize indirection buffers on each inference run using temporary memory in the workspace, instead
-///                of initializing persistent indirection buffers once.
+///                XNN_FLAG_YIELD_WORKERS, XNN_FLAG_TRANSIENT_INDIRECTION_BUFFER, and XNN_FLAG_INTER_OPERATOR_PARALLELISM.
+///                If XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded to the system scheduler after
+///                processing the last operator in the Runtime. If XNN_FLAG_TRANSIENT_INDIRECTION_BUFFER is specified,
+///                convolution operators will initialize indirection buffers on each inference run using temporary memory
+///                in the workspace, instead of initializing persistent indirection buffers once. If
+///                XNN_FLAG_INTER_OPERATOR_PARALLELISM is specified, operators which do not depend on each other will be
+///                run concurrently.
 /// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
 ///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
 ///                      used to create it.
@@ -2318,6 +2472,28 @@ enum xnn_status xnn_create_runtime(
   xnn_subgraph_t subgraph,
   xnn_runtime_t* runtime_out);
 
+/// Create a Runtime object which shares the optimized execution plan and the packed weights of another Runtime.
+///
+/// Cloning a Runtime doesn't optimize the subgraph, create operators, or look up packed weights. The clone has its own
+/// workspace and operator state, and can be reshaped, set up and invoked concurrently with the cloned Runtime and its
+/// other clones, e.g. to serve concurrent requests with a single copy of the model weights. Clones of a Runtime may be
+/// created and deleted concurrently on different threads.
+///
+/// @param runtime - the Runtime object to clone. It must not be deleted before all its clones are deleted.
+/// @param workspace - a workspace to hold the internal tensors of the clone. If workspace is NULL, the clone has its
+///                    own workspace. The workspace must not be shared with Runtimes which are invoked concurrently
+///                    with the clone.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the clone. If the thread
+///                     pool is NULL, the computation would run on the caller thread without parallelization.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the cloned Runtime object
+///                      upon successful return. The clone must be reshaped with @ref xnn_reshape_runtime before it is
+///                      set up.
+enum xnn_status xnn_clone_runtime(
+  xnn_runtime_t runtime,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  xnn_runtime_t* runtime_out);
+
 struct xnn_external_value {
   uint32_t id;
   void* data;
@@ -2337,6 +2513,16 @@ enum xnn_status xnn_reshape_external_value(
   size_t num_dims,
   const size_t* dims);
 
+/// Set the token position at which KV Cache Append Nodes write into a cache. The position takes effect on the next
+/// call to xnn_reshape_runtime. This API is experimental and may change.
+///
+/// @param cache_id - Value ID of a persistent cache tensor written by a KV Cache Append Node.
+/// @param position - number of tokens already in the cache. Must not exceed the maximum number of cached tokens.
+enum xnn_status xnn_set_kv_cache_position(
+  xnn_runtime_t runtime,
+  uint32_t cache_id,
+  size_t position);
+
 /// Get the external value shape.
 ///
 /// @param external_id - external ID for the Value. The ID must be within the range of reversed Value IDs specified on
@@ -3760,6 +3946,30 @@ enum xnn_status xnn_setup_dynamic_fully_connected_nc_f32(
   const float* bias,
   float* output);
 
+enum xnn_status xnn_create_fully_connected_nc_bf16(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const void* kernel,
+  const void* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_code_cache_t code_cache,
+  xnn_weights_cache_t weights_cache,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_reshape_fully_connected_nc_bf16(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_setup_fully_connected_nc_bf16(
+  xnn_operator_t fully_connected_op,
+  const void* input,
+  void* output);
+
 enum xnn_status xnn_create_fully_connected_nc_f16(
   size_t input_channels,
   size_t output_channels,
@@ -3832,6 +4042,38 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
   const float* input,
   float* output);
 
+/// Create a Fully Connected operator with sparse weights.
+///
+/// The weights are analyzed at creation time and packed in a block-sparse representation (blocks of one input channel
+/// by several output channels, or 2:4 structured sparsity along the input channels) when that is estimated to be
+/// faster than a dense matrix multiplication. Otherwise, or if the hardware has no sparse microkernels, a dense Fully
+/// Connected (NC, F32) operator is created. In both cases the operator must be reshaped and setup with
+/// xnn_reshape_fully_connected_sparse_nc_f32 and xnn_setup_fully_connected_sparse_nc_f32. Either packing of the weights
+/// is stored in the weights cache, if one is provided.
+enum xnn_status xnn_create_fully_connected_sparse_nc_f32(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_code_cache_t code_cache,
+  xnn_weights_cache_t weights_cache,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_reshape_fully_connected_sparse_nc_f32(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_setup_fully_connected_sparse_nc_f32(
+  xnn_operator_t fully_connected_op,
+  const float* input,
+  float* output);
+
 enum xnn_status xnn_create_fully_connected_nc_f32_qc4w(
   size_t input_channels,
   size_t output_channels,
@@ -4428,6 +4670,65 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_u8(
   const uint8_t* input,
   uint8_t* output);
 
+// Input and output datatypes are either both xnn_datatype_fp16 or both xnn_datatype_fp32. The output can also be
+// xnn_datatype_qdint8 or xnn_datatype_qduint8, with one set of quantization parameters per row.
+enum xnn_status xnn_create_layer_norm_nc(
+  enum xnn_datatype input_datatype,
+  enum xnn_datatype output_datatype,
+  float epsilon,
+  uint32_t flags,
+  xnn_operator_t* layer_norm_op_out);
+
+enum xnn_status xnn_reshape_layer_norm_nc(
+  xnn_operator_t layer_norm_op,
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  size_t* workspace_size,
+  size_t* workspace_alignment,
+  pthreadpool_t threadpool);
+
+// For a quantized output, quantization_params must be padded with at least XNN_EXTRA_QUANTIZATION_PARAMS entries.
+// Otherwise, it is ignored.
+enum xnn_status xnn_setup_layer_norm_nc(
+  xnn_operator_t layer_norm_op,
+  void* workspace,
+  const void* input,
+  const void* scale,
+  const void* bias,
+  void* output,
+  struct xnn_quantization_params* quantization_params);
+
+// Input and output datatypes are either both xnn_datatype_fp16 or both xnn_datatype_fp32. The output can also be
+// xnn_datatype_qdint8 or xnn_datatype_qduint8, with one set of quantization parameters per row.
+enum xnn_status xnn_create_rms_norm_nc(
+  enum xnn_datatype input_datatype,
+  enum xnn_datatype output_datatype,
+  float epsilon,
+  uint32_t flags,
+  xnn_operator_t* rms_norm_op_out);
+
+enum xnn_status xnn_reshape_rms_norm_nc(
+  xnn_operator_t rms_norm_op,
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  size_t batch_size,
+  size_t* workspace_size,
+  size_t* workspace_alignment,
+  pthreadpool_t threadpool);
+
+// For a quantized output, quantization_params must be padded with at least XNN_EXTRA_QUANTIZATION_PARAMS entries.
+// Otherwise, it is ignored.
+enum xnn_status xnn_setup_rms_norm_nc(
+  xnn_operator_t rms_norm_op,
+  void* workspace,
+  const void* input,
+  const void* scale,
+  void* output,
+  struct xnn_quantization_params* quantization_params);
+
 enum xnn_status xnn_create_rope_nthc_f16(
   uint32_t flags,
   xnn_operator_t* rope_op_out);
@@ -4480,6 +4781,8 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f16(
   size_t query_heads,
   // Number of tokens in query.
   size_t query_tokens,
+  // Number of key/value heads. Must divide query_heads: each key/value head is shared by query_heads / key_value_heads
+  // consecutive query heads (grouped-query attention).
   size_t key_value_heads,
   // Number of tokens in key/value. For self-attention, this is same as tokens.
   size_t key_value_tokens,
@@ -4492,7 +4795,8 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f16(
 // Query is of dimension [batch_size, query_heads, query_tokens, channels].
 // Key and value are of dimension [batch_size, key_value_heads, key_value_tokens, channels].
 // Scale is of dimension [channels].
-// Mask is of dimension [query_tokens, key_value_tokens].
+// Mask is of dimension [query_tokens, key_value_tokens]. Mask can be NULL if the operator was created with the
+// XNN_FLAG_CAUSAL_MASK flag.
 enum xnn_status xnn_setup_scaled_dot_product_attention_nhtc_f16(
   xnn_operator_t attention_op,
   void* workspace,
@@ -4519,6 +4823,8 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f32(
   size_t query_heads,
   // Number of tokens in query.
   size_t query_tokens,
+  // Number of key/value heads. Must divide query_heads: each key/value head is shared by query_heads / key_value_heads
+  // consecutive query heads (grouped-query attention).
   size_t key_value_heads,
   // Number of tokens in key/value. For self-attention, this is same as tokens.
   size_t key_value_tokens,
@@ -4531,7 +4837,8 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f32(
 // Query is of dimension [batch_size, query_heads, query_tokens, query_key_channels].
 // Key and value are of dimension [batch_size, key_value_heads, key_value_tokens, query_key_channels].
 // Scale is of dimension [query_key_channels].
-// Mask is of dimension [query_tokens, key_value_tokens].
+// Mask is of dimension [query_tokens, key_value_tokens]. Mask can be NULL if the operator was created with the
+// XNN_FLAG_CAUSAL_MASK flag.
 // Output is of dimension [batch_size, query_heads, query_tokens, value_channels].
 enum xnn_status xnn_setup_scaled_dot_product_attention_nhtc_f32(
   xnn_operator_t attention_op,
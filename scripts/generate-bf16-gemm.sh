@@ -35,4 +35,12 @@ tools/xngen src/bf16-gemm/c8-neonbf16.c.in -D MR=3 -D NR=4 -D BFOPT=BFMLAL -o sr
 tools/xngen src/bf16-gemm/c8-neonbf16.c.in -D MR=4 -D NR=4 -D BFOPT=BFMLAL -o src/bf16-gemm/gen/bf16-gemm-4x4c8-minmax-neonbf16-bfmlal.c &
 tools/xngen src/bf16-gemm/c8-neonbf16.c.in -D MR=5 -D NR=4 -D BFOPT=BFMLAL -o src/bf16-gemm/gen/bf16-gemm-5x4c8-minmax-neonbf16-bfmlal.c &
 
+################################### x86 AVX512 ################################
+tools/xngen src/bf16-gemm/c2-avx512bf16-broadcast.c.in -D MR=1 -D NR=16 -o src/bf16-gemm/gen/bf16-gemm-1x16c2-minmax-avx512bf16-broadcast.c &
+tools/xngen src/bf16-gemm/c2-avx512bf16-broadcast.c.in -D MR=4 -D NR=16 -o src/bf16-gemm/gen/bf16-gemm-4x16c2-minmax-avx512bf16-broadcast.c &
+tools/xngen src/bf16-gemm/c2-avx512bf16-broadcast.c.in -D MR=7 -D NR=16 -o src/bf16-gemm/gen/bf16-gemm-7x16c2-minmax-avx512bf16-broadcast.c &
+tools/xngen src/bf16-gemm/c2-avx512bf16-broadcast.c.in -D MR=1 -D NR=32 -o src/bf16-gemm/gen/bf16-gemm-1x32c2-minmax-avx512bf16-broadcast.c &
+tools/xngen src/bf16-gemm/c2-avx512bf16-broadcast.c.in -D MR=4 -D NR=32 -o src/bf16-gemm/gen/bf16-gemm-4x32c2-minmax-avx512bf16-broadcast.c &
+tools/xngen src/bf16-gemm/c2-avx512bf16-broadcast.c.in -D MR=7 -D NR=32 -o src/bf16-gemm/gen/bf16-gemm-7x32c2-minmax-avx512bf16-broadcast.c &
+
 wait
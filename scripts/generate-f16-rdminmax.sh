@@ -0,0 +1,23 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/f16-rdminmax/scalar.c.in -D CHANNELS=2 -D ACCUMULATORS=7 -D OP=MAX -o src/f16-rdminmax/gen/f16-rdmax-7p7x-scalar-c2.c &
+tools/xngen src/f16-rdminmax/scalar.c.in -D CHANNELS=2 -D ACCUMULATORS=7 -D OP=MIN -o src/f16-rdminmax/gen/f16-rdmin-7p7x-scalar-c2.c &
+
+################################ ARM NEONFP16ARITH ############################
+tools/xngen src/f16-rdminmax/neonfp16arith.c.in -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MAX -o src/f16-rdminmax/gen/f16-rdmax-7p7x-neonfp16arith-c16.c &
+tools/xngen src/f16-rdminmax/neonfp16arith.c.in -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f16-rdminmax/gen/f16-rdmax-7p7x-neonfp16arith-c32.c &
+tools/xngen src/f16-rdminmax/neonfp16arith.c.in -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MIN -o src/f16-rdminmax/gen/f16-rdmin-7p7x-neonfp16arith-c16.c &
+tools/xngen src/f16-rdminmax/neonfp16arith.c.in -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f16-rdminmax/gen/f16-rdmin-7p7x-neonfp16arith-c32.c &
+
+################################## x86 F16C ###################################
+tools/xngen src/f16-rdminmax/f16c.c.in -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MAX -o src/f16-rdminmax/gen/f16-rdmax-7p7x-f16c-c16.c &
+tools/xngen src/f16-rdminmax/f16c.c.in -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f16-rdminmax/gen/f16-rdmax-7p7x-f16c-c32.c &
+tools/xngen src/f16-rdminmax/f16c.c.in -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MIN -o src/f16-rdminmax/gen/f16-rdmin-7p7x-f16c-c16.c &
+tools/xngen src/f16-rdminmax/f16c.c.in -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f16-rdminmax/gen/f16-rdmin-7p7x-f16c-c32.c &
+
+wait
@@ -0,0 +1,15 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################ ARM NEONFP16 #################################
+tools/xngen src/f16-rmsnorm/simd.c.in -D ARCH=neonfp16 -D BATCH_TILE=8 -o src/f16-rmsnorm/gen/f16-rmsnorm-neonfp16-u8.c &
+tools/xngen src/f16-rmsnorm/simd.c.in -D ARCH=neonfp16 -D BATCH_TILE=16 -o src/f16-rmsnorm/gen/f16-rmsnorm-neonfp16-u16.c &
+
+################################## x86 AVX2 ###################################
+tools/xngen src/f16-rmsnorm/simd.c.in -D ARCH=avx2 -D BATCH_TILE=16 -o src/f16-rmsnorm/gen/f16-rmsnorm-avx2-u16.c &
+tools/xngen src/f16-rmsnorm/simd.c.in -D ARCH=avx2 -D BATCH_TILE=32 -o src/f16-rmsnorm/gen/f16-rmsnorm-avx2-u32.c &
+
+wait
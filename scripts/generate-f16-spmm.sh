@@ -22,4 +22,9 @@ tools/xngen src/f16-spmm/neonfp16arith-pipelined.c.in -D MR=16 -D NR=1 -o src/f1
 tools/xngen src/f16-spmm/neonfp16arith-pipelined.c.in -D MR=24 -D NR=1 -o src/f16-spmm/gen/f16-spmm-24x1-minmax-neonfp16arith-pipelined.c &
 tools/xngen src/f16-spmm/neonfp16arith-pipelined.c.in -D MR=32 -D NR=1 -o src/f16-spmm/gen/f16-spmm-32x1-minmax-neonfp16arith-pipelined.c &
 
+################################### x86 F16C ##################################
+tools/xngen src/f16-spmm/f16c.c.in -D MR=8  -D NR=1 -o src/f16-spmm/gen/f16-spmm-8x1-minmax-f16c.c &
+tools/xngen src/f16-spmm/f16c.c.in -D MR=16 -D NR=1 -o src/f16-spmm/gen/f16-spmm-16x1-minmax-f16c.c &
+tools/xngen src/f16-spmm/f16c.c.in -D MR=32 -D NR=1 -o src/f16-spmm/gen/f16-spmm-32x1-minmax-f16c.c &
+
 wait
@@ -0,0 +1,11 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## x86 AVX2 ###################################
+tools/xngen src/f16-vscaleexpminusmax/avx2-rr2-p5.c.in -D BATCH_TILE=16 -o src/f16-vscaleexpminusmax/gen/f16-vscaleexpminusmax-avx2-rr2-p5-u16.c &
+tools/xngen src/f16-vscaleexpminusmax/avx2-rr2-p5.c.in -D BATCH_TILE=32 -o src/f16-vscaleexpminusmax/gen/f16-vscaleexpminusmax-avx2-rr2-p5-u32.c &
+
+wait
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### Scalar ####################################
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=scalar -D BATCH_TILE=4 -o src/f32-layernorm/gen/f32-layernorm-scalar-u4.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=neon -D BATCH_TILE=8 -o src/f32-layernorm/gen/f32-layernorm-neon-u8.c &
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=neon -D BATCH_TILE=16 -o src/f32-layernorm/gen/f32-layernorm-neon-u16.c &
+
+################################## x86 SSE2 ###################################
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=sse2 -D BATCH_TILE=8 -o src/f32-layernorm/gen/f32-layernorm-sse2-u8.c &
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=sse2 -D BATCH_TILE=16 -o src/f32-layernorm/gen/f32-layernorm-sse2-u16.c &
+
+################################## x86 AVX2 ###################################
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=avx2 -D BATCH_TILE=16 -o src/f32-layernorm/gen/f32-layernorm-avx2-u16.c &
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=avx2 -D BATCH_TILE=32 -o src/f32-layernorm/gen/f32-layernorm-avx2-u32.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=avx512f -D BATCH_TILE=32 -o src/f32-layernorm/gen/f32-layernorm-avx512f-u32.c &
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=avx512f -D BATCH_TILE=64 -o src/f32-layernorm/gen/f32-layernorm-avx512f-u64.c &
+
+################################## WAsm SIMD ##################################
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=wasmsimd -D BATCH_TILE=8 -o src/f32-layernorm/gen/f32-layernorm-wasmsimd-u8.c &
+tools/xngen src/f32-layernorm/simd.c.in -D ARCH=wasmsimd -D BATCH_TILE=16 -o src/f32-layernorm/gen/f32-layernorm-wasmsimd-u16.c &
+
+wait
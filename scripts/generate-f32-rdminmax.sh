@@ -0,0 +1,41 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=scalar -D CHANNELS=4 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-scalar-c4.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=scalar -D CHANNELS=4 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-scalar-c4.c &
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=neon -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-neon-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=neon -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-neon-c32.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=neon -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-neon-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=neon -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-neon-c32.c &
+
+################################### x86 SSE2 ##################################
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=sse2 -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-sse2-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=sse2 -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-sse2-c32.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=sse2 -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-sse2-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=sse2 -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-sse2-c32.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-avx-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-avx-c32.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-avx-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-avx-c32.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx512f -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-avx512f-c32.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx512f -D CHANNELS=64 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-avx512f-c64.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx512f -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-avx512f-c32.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=avx512f -D CHANNELS=64 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-avx512f-c64.c &
+
+################################## WAsm SIMD ##################################
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=wasmsimd -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-wasmsimd-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=wasmsimd -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MAX -o src/f32-rdminmax/gen/f32-rdmax-7p7x-wasmsimd-c32.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=wasmsimd -D CHANNELS=16 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-wasmsimd-c16.c &
+tools/xngen src/f32-rdminmax/simd.c.in -D ARCH=wasmsimd -D CHANNELS=32 -D ACCUMULATORS=7 -D OP=MIN -o src/f32-rdminmax/gen/f32-rdmin-7p7x-wasmsimd-c32.c &
+
+wait
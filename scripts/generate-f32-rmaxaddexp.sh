@@ -0,0 +1,37 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### Scalar ####################################
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=scalar -D BATCH_TILE=1 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-scalar-rr2-p5-u1.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=scalar -D BATCH_TILE=2 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-scalar-rr2-p5-u2.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=scalar -D BATCH_TILE=4 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-scalar-rr2-p5-u4.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=neon -D BATCH_TILE=4 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-neon-rr2-p5-u4.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=neon -D BATCH_TILE=8 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-neon-rr2-p5-u8.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=neon -D BATCH_TILE=16 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-neon-rr2-p5-u16.c &
+
+################################## x86 SSE2 ###################################
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=sse2 -D BATCH_TILE=4 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-sse2-rr2-p5-u4.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=sse2 -D BATCH_TILE=8 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-sse2-rr2-p5-u8.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=sse2 -D BATCH_TILE=16 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-sse2-rr2-p5-u16.c &
+
+################################## x86 AVX2 ###################################
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=avx2 -D BATCH_TILE=8 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx2-rr2-p5-u8.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=avx2 -D BATCH_TILE=16 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx2-rr2-p5-u16.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=avx2 -D BATCH_TILE=32 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx2-rr2-p5-u32.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=avx512f -D BATCH_TILE=16 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx512f-rr2-p5-u16.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=avx512f -D BATCH_TILE=32 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx512f-rr2-p5-u32.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=avx512f -D BATCH_TILE=64 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-avx512f-rr2-p5-u64.c &
+
+################################## WAsm SIMD ##################################
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=wasmsimd -D BATCH_TILE=4 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-wasmsimd-rr2-p5-u4.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=wasmsimd -D BATCH_TILE=8 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-wasmsimd-rr2-p5-u8.c &
+tools/xngen src/f32-rmaxaddexp/simd-rr2-p5.c.in -D ARCH=wasmsimd -D BATCH_TILE=16 -o src/f32-rmaxaddexp/gen/f32-rmaxaddexp-wasmsimd-rr2-p5-u16.c &
+
+wait
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### Scalar ####################################
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=scalar -D BATCH_TILE=1 -D ACCUMULATORS=1 -o src/f32-rprod/gen/f32-rprod-scalar-u1.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=scalar -D BATCH_TILE=2 -D ACCUMULATORS=2 -o src/f32-rprod/gen/f32-rprod-scalar-u2-acc2.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=scalar -D BATCH_TILE=4 -D ACCUMULATORS=4 -o src/f32-rprod/gen/f32-rprod-scalar-u4-acc4.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=neon -D BATCH_TILE=4 -D ACCUMULATORS=1 -o src/f32-rprod/gen/f32-rprod-neon-u4.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=neon -D BATCH_TILE=8 -D ACCUMULATORS=2 -o src/f32-rprod/gen/f32-rprod-neon-u8-acc2.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=neon -D BATCH_TILE=16 -D ACCUMULATORS=4 -o src/f32-rprod/gen/f32-rprod-neon-u16-acc4.c &
+
+################################## x86 SSE2 ###################################
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=sse2 -D BATCH_TILE=4 -D ACCUMULATORS=1 -o src/f32-rprod/gen/f32-rprod-sse2-u4.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=sse2 -D BATCH_TILE=8 -D ACCUMULATORS=2 -o src/f32-rprod/gen/f32-rprod-sse2-u8-acc2.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=sse2 -D BATCH_TILE=16 -D ACCUMULATORS=4 -o src/f32-rprod/gen/f32-rprod-sse2-u16-acc4.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=avx -D BATCH_TILE=8 -D ACCUMULATORS=1 -o src/f32-rprod/gen/f32-rprod-avx-u8.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=avx -D BATCH_TILE=16 -D ACCUMULATORS=2 -o src/f32-rprod/gen/f32-rprod-avx-u16-acc2.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=avx -D BATCH_TILE=32 -D ACCUMULATORS=4 -o src/f32-rprod/gen/f32-rprod-avx-u32-acc4.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=avx512f -D BATCH_TILE=16 -D ACCUMULATORS=1 -o src/f32-rprod/gen/f32-rprod-avx512f-u16.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=avx512f -D BATCH_TILE=32 -D ACCUMULATORS=2 -o src/f32-rprod/gen/f32-rprod-avx512f-u32-acc2.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=avx512f -D BATCH_TILE=64 -D ACCUMULATORS=4 -o src/f32-rprod/gen/f32-rprod-avx512f-u64-acc4.c &
+
+################################## WAsm SIMD ##################################
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=wasmsimd -D BATCH_TILE=4 -D ACCUMULATORS=1 -o src/f32-rprod/gen/f32-rprod-wasmsimd-u4.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=wasmsimd -D BATCH_TILE=8 -D ACCUMULATORS=2 -o src/f32-rprod/gen/f32-rprod-wasmsimd-u8-acc2.c &
+tools/xngen src/f32-rprod/simd.c.in -D ARCH=wasmsimd -D BATCH_TILE=16 -D ACCUMULATORS=4 -o src/f32-rprod/gen/f32-rprod-wasmsimd-u16-acc4.c &
+
+wait
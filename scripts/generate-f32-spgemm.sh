@@ -0,0 +1,22 @@
+#!/bin/sh
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/f32-spgemm/scalar.c.in -D MR=1 -D NR=4 -D FORMAT=1XN -o src/f32-spgemm/gen/f32-spgemm-1x4-minmax-scalar.c &
+tools/xngen src/f32-spgemm/scalar.c.in -D MR=4 -D NR=4 -D FORMAT=1XN -o src/f32-spgemm/gen/f32-spgemm-4x4-minmax-scalar.c &
+
+tools/xngen src/f32-spgemm/scalar.c.in -D MR=1 -D NR=4 -D FORMAT=2OF4 -o src/f32-spgemm/gen/f32-spgemm-2of4-1x4-minmax-scalar.c &
+tools/xngen src/f32-spgemm/scalar.c.in -D MR=4 -D NR=4 -D FORMAT=2OF4 -o src/f32-spgemm/gen/f32-spgemm-2of4-4x4-minmax-scalar.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-spgemm/avx.c.in -D MR=1 -D NR=8  -D FORMAT=1XN -o src/f32-spgemm/gen/f32-spgemm-1x8-minmax-fma3.c &
+tools/xngen src/f32-spgemm/avx.c.in -D MR=4 -D NR=8  -D FORMAT=1XN -o src/f32-spgemm/gen/f32-spgemm-4x8-minmax-fma3.c &
+tools/xngen src/f32-spgemm/avx.c.in -D MR=4 -D NR=16 -D FORMAT=1XN -o src/f32-spgemm/gen/f32-spgemm-4x16-minmax-fma3.c &
+
+tools/xngen src/f32-spgemm/avx.c.in -D MR=1 -D NR=8  -D FORMAT=2OF4 -o src/f32-spgemm/gen/f32-spgemm-2of4-1x8-minmax-avx2.c &
+tools/xngen src/f32-spgemm/avx.c.in -D MR=4 -D NR=8  -D FORMAT=2OF4 -o src/f32-spgemm/gen/f32-spgemm-2of4-4x8-minmax-avx2.c &
+
+wait
@@ -73,6 +73,24 @@ tools/xngen src/f32-spmm/sse.c.in -D MR=8  -D NR=1 -D UNROLL=1 -o src/f32-spmm/g
 tools/xngen src/f32-spmm/sse.c.in -D MR=16 -D NR=1 -D UNROLL=1 -o src/f32-spmm/gen/f32-spmm-16x1-minmax-sse.c &
 tools/xngen src/f32-spmm/sse.c.in -D MR=32 -D NR=1 -D UNROLL=1 -o src/f32-spmm/gen/f32-spmm-32x1-minmax-sse.c &
 
+################################### x86 FMA3 ##################################
+tools/xngen src/f32-spmm/fma3.c.in -D MR=8  -D NR=1 -o src/f32-spmm/gen/f32-spmm-8x1-minmax-fma3.c &
+tools/xngen src/f32-spmm/fma3.c.in -D MR=16 -D NR=1 -o src/f32-spmm/gen/f32-spmm-16x1-minmax-fma3.c &
+tools/xngen src/f32-spmm/fma3.c.in -D MR=32 -D NR=1 -o src/f32-spmm/gen/f32-spmm-32x1-minmax-fma3.c &
+tools/xngen src/f32-spmm/fma3.c.in -D MR=16 -D NR=2 -o src/f32-spmm/gen/f32-spmm-16x2-minmax-fma3.c &
+tools/xngen src/f32-spmm/fma3.c.in -D MR=32 -D NR=2 -o src/f32-spmm/gen/f32-spmm-32x2-minmax-fma3.c &
+tools/xngen src/f32-spmm/fma3.c.in -D MR=16 -D NR=4 -o src/f32-spmm/gen/f32-spmm-16x4-minmax-fma3.c &
+tools/xngen src/f32-spmm/fma3.c.in -D MR=32 -D NR=4 -o src/f32-spmm/gen/f32-spmm-32x4-minmax-fma3.c &
+
+################################## x86 AVX512 #################################
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=16 -D NR=1 -o src/f32-spmm/gen/f32-spmm-16x1-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=1 -o src/f32-spmm/gen/f32-spmm-32x1-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=64 -D NR=1 -o src/f32-spmm/gen/f32-spmm-64x1-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=2 -o src/f32-spmm/gen/f32-spmm-32x2-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=64 -D NR=2 -o src/f32-spmm/gen/f32-spmm-64x2-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=4 -o src/f32-spmm/gen/f32-spmm-32x4-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=64 -D NR=4 -o src/f32-spmm/gen/f32-spmm-64x4-minmax-avx512f.c &
+
 ################################### WASM SIMD ###################################
 ### Microkernels without unrolling.
 tools/xngen src/f32-spmm/wasmsimd.c.in -D MR=4  -D NR=1 -D UNROLL=1 -D MINMAX=MINMAX  -D ARCH=        -o src/f32-spmm/gen/f32-spmm-4x1-minmax-wasmsimd-arm.c &
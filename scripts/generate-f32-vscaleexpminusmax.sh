@@ -4,6 +4,21 @@
 # This source code is licensed under the BSD-style license found in the
 # LICENSE file in the root directory of this source tree.
 
+################################### Scalar ####################################
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=scalar -D BATCH_TILE=1 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-scalar-rr2-p5-u1.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=scalar -D BATCH_TILE=2 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-scalar-rr2-p5-u2.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=scalar -D BATCH_TILE=4 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-scalar-rr2-p5-u4.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=neon -D BATCH_TILE=4 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-neon-rr2-p5-u4.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=neon -D BATCH_TILE=8 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-neon-rr2-p5-u8.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=neon -D BATCH_TILE=16 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-neon-rr2-p5-u16.c &
+
+################################## x86 SSE2 ###################################
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=sse2 -D BATCH_TILE=4 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-sse2-rr2-p5-u4.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=sse2 -D BATCH_TILE=8 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-sse2-rr2-p5-u8.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=sse2 -D BATCH_TILE=16 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-sse2-rr2-p5-u16.c &
+
 ################################### x86 AVX2 ##################################
 tools/xngen src/f32-vscaleexpminusmax/avx2-p5.c.in -D BATCH_TILE=8  -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u8.c &
 tools/xngen src/f32-vscaleexpminusmax/avx2-p5.c.in -D BATCH_TILE=16 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx2-p5-u16.c &
@@ -16,4 +31,9 @@ tools/xngen src/f32-vscaleexpminusmax/avx512f-p5-scalef.c.in -D BATCH_TILE=32  -
 tools/xngen src/f32-vscaleexpminusmax/avx512f-p5-scalef.c.in -D BATCH_TILE=48  -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u48.c &
 tools/xngen src/f32-vscaleexpminusmax/avx512f-p5-scalef.c.in -D BATCH_TILE=64  -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-avx512f-p5-scalef-u64.c &
 
+################################## WAsm SIMD ##################################
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=wasmsimd -D BATCH_TILE=4 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-wasmsimd-rr2-p5-u4.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=wasmsimd -D BATCH_TILE=8 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-wasmsimd-rr2-p5-u8.c &
+tools/xngen src/f32-vscaleexpminusmax/simd-rr2-p5.c.in -D ARCH=wasmsimd -D BATCH_TILE=16 -o src/f32-vscaleexpminusmax/gen/f32-vscaleexpminusmax-wasmsimd-rr2-p5-u16.c &
+
 wait
@@ -64,6 +64,9 @@ tools/generate-gemm-test.py --spec test/f32-ppmm-minmax.yaml --output-test test/
 tools/generate-spmm-test.py --spec test/f16-spmm-minmax.yaml --output-test test/f16-spmm-minmax.cc &
 tools/generate-spmm-test.py --spec test/f32-spmm-minmax.yaml --output-test test/f32-spmm-minmax.cc  --output-test test/f32-spmm-minmax-2.cc  --output-test test/f32-spmm-minmax-3.cc  --output-test test/f32-spmm-minmax-4.cc --output-bench bench/f32-spmm.cc &
 
+### Tests for SpGEMM micro-kernels
+tools/generate-spgemm-test.py --spec test/f32-spgemm-minmax.yaml --output test/f32-spgemm-minmax.cc &
+
 ### Tests for VBinary micro-kernels
 tools/generate-vbinary-test.py --tester VBinaryMicrokernelTester  --ukernel f16-vadd --output test/f16-vadd.cc &
 tools/generate-vbinary-test.py --tester VBinaryMicrokernelTester  --ukernel f16-vdiv --output test/f16-vdiv.cc &
@@ -180,6 +183,7 @@ tools/generate-reduce-test.py --tester ReduceMicrokernelTester --spec test/f16-r
 
 tools/generate-reduce-test.py --tester ReduceMicrokernelTester --spec test/f32-rmax.yaml --output test/f32-rmax.cc &
 tools/generate-reduce-test.py --tester ReduceMicrokernelTester --spec test/f32-rmin.yaml --output test/f32-rmin.cc &
+tools/generate-reduce-test.py --tester ReduceMicrokernelTester --spec test/f32-rprod.yaml --output test/f32-rprod.cc &
 tools/generate-reduce-test.py --tester ReduceMicrokernelTester --spec test/f32-rminmax.yaml --output test/f32-rminmax.cc &
 
 tools/generate-reduce-test.py --tester RSumMicrokernelTester --spec test/qs8-rsum.yaml --output test/qs8-rsum.cc &
@@ -190,6 +194,11 @@ tools/generate-reduce-test.py --tester ReduceMicrokernelTester --spec test/u8-rm
 
 tools/generate-rdsum-test.py --spec test/f16-f32acc-rdsum.yaml --output test/f16-f32acc-rdsum.cc &
 tools/generate-rdsum-test.py --spec test/f32-rdsum.yaml --output test/f32-rdsum.cc &
+tools/generate-rdsum-test.py --spec test/f16-rdmax.yaml --output test/f16-rdmax.cc &
+tools/generate-rdsum-test.py --spec test/f16-rdmin.yaml --output test/f16-rdmin.cc &
+tools/generate-rdsum-test.py --spec test/f32-rdmax.yaml --output test/f32-rdmax.cc &
+tools/generate-rdsum-test.py --spec test/f32-rdmin.yaml --output test/f32-rdmin.cc &
+tools/generate-rdsum-test.py --spec test/f32-rdprod.yaml --output test/f32-rdprod.cc &
 tools/generate-rdsum-test.py --spec test/qs8-rdsum-minmax-fp32.yaml --output test/qs8-rdsum-minmax-fp32.cc &
 tools/generate-rdsum-test.py --spec test/qu8-rdsum.yaml --output test/qu8-rdsum.cc &
 
@@ -0,0 +1,98 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-gemm/c2-avx512bf16-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/gemm.h"
+#include "xnnpack/intrinsics-polyfill.h"
+#include "xnnpack/math.h"
+#include "xnnpack/unaligned.h"
+
+
+void xnn_bf16_gemm_minmax_ukernel_1x16c2__avx512bf16_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const xnn_bfloat16* restrict a,
+    size_t a_stride,
+    const xnn_bfloat16* restrict w,
+    xnn_bfloat16* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const struct xnn_bf16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(xnn_bfloat16) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const xnn_bfloat16* a0 = a;
+  xnn_bfloat16* c0 = c;
+
+  do {
+    // Widen the bf16 bias to fp32 by shifting it into the upper half of each 32-bit lane.
+    __m512 vacc0x0 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*) w)), 16));
+    w += 16;
+
+    size_t k = kc;
+    for (; k >= 2 * sizeof(xnn_bfloat16); k -= 2 * sizeof(xnn_bfloat16)) {
+      const __m512bh vb0 = (__m512bh) _mm512_loadu_si512(w);
+      w += 32;
+
+      const __m512bh va0 = (__m512bh) _mm512_set1_epi32((int) unaligned_load_u32(a0));
+      a0 += 2;
+      vacc0x0 = _mm512_dpbf16_ps(vacc0x0, va0, vb0);
+    }
+    if XNN_UNLIKELY(k != 0) {
+      // The packed weights are zero-padded to an even number of channels, but
+      // A is not, so only the last element of each row of A is loaded.
+      const __m512bh vb0 = (__m512bh) _mm512_loadu_si512(w);
+      w += 32;
+
+      const __m512bh va0 = (__m512bh) _mm512_set1_epi32((int) (uint32_t) unaligned_load_u16(a0));
+      a0 += 1;
+      vacc0x0 = _mm512_dpbf16_ps(vacc0x0, va0, vb0);
+    }
+
+    const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+    vacc0x0 = _mm512_max_ps(vmin, vacc0x0);
+
+    const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+    vacc0x0 = _mm512_min_ps(vmax, vacc0x0);
+
+    const __m256i vout0x0 = (__m256i) _mm512_cvtneps_pbh(vacc0x0);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm256_storeu_si256((__m256i*) c0, vout0x0);
+      c0 = (xnn_bfloat16*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const xnn_bfloat16*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      // NC remainder (1..15)
+      assert(nc >= 1);
+      assert(nc <= 15);
+      // Prepare mask for valid 16-bit elements (depends on nc).
+      const __mmask16 vmask0 = _cvtu32_mask16((uint32_t) (((UINT64_C(1) << nc) - 1) >> 0));
+
+      _mm256_mask_storeu_epi16(c0 + 0, vmask0, vout0x0);
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,193 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-gemm/c2-avx512bf16-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/gemm.h"
+#include "xnnpack/intrinsics-polyfill.h"
+#include "xnnpack/math.h"
+#include "xnnpack/unaligned.h"
+
+
+void xnn_bf16_gemm_minmax_ukernel_4x32c2__avx512bf16_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const xnn_bfloat16* restrict a,
+    size_t a_stride,
+    const xnn_bfloat16* restrict w,
+    xnn_bfloat16* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const struct xnn_bf16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(xnn_bfloat16) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const xnn_bfloat16* a0 = a;
+  xnn_bfloat16* c0 = c;
+  const xnn_bfloat16* a1 = (const xnn_bfloat16*) ((uintptr_t) a0 + a_stride);
+  xnn_bfloat16* c1 = (xnn_bfloat16*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const xnn_bfloat16* a2 = (const xnn_bfloat16*) ((uintptr_t) a1 + a_stride);
+  xnn_bfloat16* c2 = (xnn_bfloat16*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const xnn_bfloat16* a3 = (const xnn_bfloat16*) ((uintptr_t) a2 + a_stride);
+  xnn_bfloat16* c3 = (xnn_bfloat16*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  do {
+    // Widen the bf16 bias to fp32 by shifting it into the upper half of each 32-bit lane.
+    __m512 vacc0x0 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*) w)), 16));
+    __m512 vacc0x1 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*) (w + 16))), 16));
+    __m512 vacc1x0 = vacc0x0;
+    __m512 vacc1x1 = vacc0x1;
+    __m512 vacc2x0 = vacc0x0;
+    __m512 vacc2x1 = vacc0x1;
+    __m512 vacc3x0 = vacc0x0;
+    __m512 vacc3x1 = vacc0x1;
+    w += 32;
+
+    size_t k = kc;
+    for (; k >= 2 * sizeof(xnn_bfloat16); k -= 2 * sizeof(xnn_bfloat16)) {
+      const __m512bh vb0 = (__m512bh) _mm512_loadu_si512(w);
+      const __m512bh vb1 = (__m512bh) _mm512_loadu_si512(w + 32);
+      w += 64;
+
+      const __m512bh va0 = (__m512bh) _mm512_set1_epi32((int) unaligned_load_u32(a0));
+      a0 += 2;
+      vacc0x0 = _mm512_dpbf16_ps(vacc0x0, va0, vb0);
+      vacc0x1 = _mm512_dpbf16_ps(vacc0x1, va0, vb1);
+      const __m512bh va1 = (__m512bh) _mm512_set1_epi32((int) unaligned_load_u32(a1));
+      a1 += 2;
+      vacc1x0 = _mm512_dpbf16_ps(vacc1x0, va1, vb0);
+      vacc1x1 = _mm512_dpbf16_ps(vacc1x1, va1, vb1);
+      const __m512bh va2 = (__m512bh) _mm512_set1_epi32((int) unaligned_load_u32(a2));
+      a2 += 2;
+      vacc2x0 = _mm512_dpbf16_ps(vacc2x0, va2, vb0);
+      vacc2x1 = _mm512_dpbf16_ps(vacc2x1, va2, vb1);
+      const __m512bh va3 = (__m512bh) _mm512_set1_epi32((int) unaligned_load_u32(a3));
+      a3 += 2;
+      vacc3x0 = _mm512_dpbf16_ps(vacc3x0, va3, vb0);
+      vacc3x1 = _mm512_dpbf16_ps(vacc3x1, va3, vb1);
+    }
+    if XNN_UNLIKELY(k != 0) {
+      // The packed weights are zero-padded to an even number of channels, but
+      // A is not, so only the last element of each row of A is loaded.
+      const __m512bh vb0 = (__m512bh) _mm512_loadu_si512(w);
+      const __m512bh vb1 = (__m512bh) _mm512_loadu_si512(w + 32);
+      w += 64;
+
+      const __m512bh va0 = (__m512bh) _mm512_set1_epi32((int) (uint32_t) unaligned_load_u16(a0));
+      a0 += 1;
+      vacc0x0 = _mm512_dpbf16_ps(vacc0x0, va0, vb0);
+      vacc0x1 = _mm512_dpbf16_ps(vacc0x1, va0, vb1);
+      const __m512bh va1 = (__m512bh) _mm512_set1_epi32((int) (uint32_t) unaligned_load_u16(a1));
+      a1 += 1;
+      vacc1x0 = _mm512_dpbf16_ps(vacc1x0, va1, vb0);
+      vacc1x1 = _mm512_dpbf16_ps(vacc1x1, va1, vb1);
+      const __m512bh va2 = (__m512bh) _mm512_set1_epi32((int) (uint32_t) unaligned_load_u16(a2));
+      a2 += 1;
+      vacc2x0 = _mm512_dpbf16_ps(vacc2x0, va2, vb0);
+      vacc2x1 = _mm512_dpbf16_ps(vacc2x1, va2, vb1);
+      const __m512bh va3 = (__m512bh) _mm512_set1_epi32((int) (uint32_t) unaligned_load_u16(a3));
+      a3 += 1;
+      vacc3x0 = _mm512_dpbf16_ps(vacc3x0, va3, vb0);
+      vacc3x1 = _mm512_dpbf16_ps(vacc3x1, va3, vb1);
+    }
+
+    const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+    vacc0x0 = _mm512_max_ps(vmin, vacc0x0);
+    vacc1x0 = _mm512_max_ps(vmin, vacc1x0);
+    vacc2x0 = _mm512_max_ps(vmin, vacc2x0);
+    vacc3x0 = _mm512_max_ps(vmin, vacc3x0);
+    vacc0x1 = _mm512_max_ps(vmin, vacc0x1);
+    vacc1x1 = _mm512_max_ps(vmin, vacc1x1);
+    vacc2x1 = _mm512_max_ps(vmin, vacc2x1);
+    vacc3x1 = _mm512_max_ps(vmin, vacc3x1);
+
+    const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+    vacc0x0 = _mm512_min_ps(vmax, vacc0x0);
+    vacc1x0 = _mm512_min_ps(vmax, vacc1x0);
+    vacc2x0 = _mm512_min_ps(vmax, vacc2x0);
+    vacc3x0 = _mm512_min_ps(vmax, vacc3x0);
+    vacc0x1 = _mm512_min_ps(vmax, vacc0x1);
+    vacc1x1 = _mm512_min_ps(vmax, vacc1x1);
+    vacc2x1 = _mm512_min_ps(vmax, vacc2x1);
+    vacc3x1 = _mm512_min_ps(vmax, vacc3x1);
+
+    const __m256i vout0x0 = (__m256i) _mm512_cvtneps_pbh(vacc0x0);
+    const __m256i vout0x1 = (__m256i) _mm512_cvtneps_pbh(vacc0x1);
+    const __m256i vout1x0 = (__m256i) _mm512_cvtneps_pbh(vacc1x0);
+    const __m256i vout1x1 = (__m256i) _mm512_cvtneps_pbh(vacc1x1);
+    const __m256i vout2x0 = (__m256i) _mm512_cvtneps_pbh(vacc2x0);
+    const __m256i vout2x1 = (__m256i) _mm512_cvtneps_pbh(vacc2x1);
+    const __m256i vout3x0 = (__m256i) _mm512_cvtneps_pbh(vacc3x0);
+    const __m256i vout3x1 = (__m256i) _mm512_cvtneps_pbh(vacc3x1);
+
+    if XNN_LIKELY(nc >= 32) {
+      _mm256_storeu_si256((__m256i*) c0, vout0x0);
+      _mm256_storeu_si256((__m256i*) (c0 + 16), vout0x1);
+      c0 = (xnn_bfloat16*) ((uintptr_t) c0 + cn_stride);
+      _mm256_storeu_si256((__m256i*) c1, vout1x0);
+      _mm256_storeu_si256((__m256i*) (c1 + 16), vout1x1);
+      c1 = (xnn_bfloat16*) ((uintptr_t) c1 + cn_stride);
+      _mm256_storeu_si256((__m256i*) c2, vout2x0);
+      _mm256_storeu_si256((__m256i*) (c2 + 16), vout2x1);
+      c2 = (xnn_bfloat16*) ((uintptr_t) c2 + cn_stride);
+      _mm256_storeu_si256((__m256i*) c3, vout3x0);
+      _mm256_storeu_si256((__m256i*) (c3 + 16), vout3x1);
+      c3 = (xnn_bfloat16*) ((uintptr_t) c3 + cn_stride);
+
+      a0 = (const xnn_bfloat16*) ((uintptr_t) a0 - kc);
+      a1 = (const xnn_bfloat16*) ((uintptr_t) a1 - kc);
+      a2 = (const xnn_bfloat16*) ((uintptr_t) a2 - kc);
+      a3 = (const xnn_bfloat16*) ((uintptr_t) a3 - kc);
+
+      nc -= 32;
+    } else {
+      // NC remainder (1..31)
+      assert(nc >= 1);
+      assert(nc <= 31);
+      // Prepare mask for valid 16-bit elements (depends on nc).
+      const __mmask16 vmask0 = _cvtu32_mask16((uint32_t) (((UINT64_C(1) << nc) - 1) >> 0));
+      const __mmask16 vmask1 = _cvtu32_mask16((uint32_t) (((UINT64_C(1) << nc) - 1) >> 16));
+
+      _mm256_mask_storeu_epi16(c0 + 0, vmask0, vout0x0);
+      _mm256_mask_storeu_epi16(c0 + 16, vmask1, vout0x1);
+      _mm256_mask_storeu_epi16(c1 + 0, vmask0, vout1x0);
+      _mm256_mask_storeu_epi16(c1 + 16, vmask1, vout1x1);
+      _mm256_mask_storeu_epi16(c2 + 0, vmask0, vout2x0);
+      _mm256_mask_storeu_epi16(c2 + 16, vmask1, vout2x1);
+      _mm256_mask_storeu_epi16(c3 + 0, vmask0, vout3x0);
+      _mm256_mask_storeu_epi16(c3 + 16, vmask1, vout3x1);
+      nc = 0;
+    }
+  } while (nc != 0);
+}
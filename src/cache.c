@@ -3,15 +3,19 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
-#include <assert.h>  // For assert.
-#include <stddef.h>  // For size_t.
-#include <stdint.h>  // For uint32_t.
+#include <assert.h>    // For assert.
+#include <inttypes.h>  // For PRIu32.
+#include <stdbool.h>   // For bool.
+#include <stddef.h>    // For size_t.
+#include <stdint.h>    // For uint32_t.
+#include <stdio.h>     // For FILE.
 #include <string.h>
 
 #include "xnnpack.h"
 #include "xnnpack/allocator.h"
 #include "xnnpack/cache.h"
 #include "xnnpack/common.h"
+#include "xnnpack/hardware-config.h"
 #include "xnnpack/log.h"
 #include "xnnpack/math.h"
 #include "xnnpack/memory.h"
@@ -25,6 +29,33 @@
 #define XNN_CACHE_MAX_LOAD_BUCKETS_MULTIPLIER 3
 #define XNN_CACHE_GROWTH_FACTOR 2
 
+// Weights cache file format:
+// - struct weights_cache_file_header,
+// - build identifier (build_identifier_size bytes),
+// - buckets (num_buckets struct xnn_cache_bucket),
+// - GEMM autotuning results (num_gemm_tunings struct xnn_gemm_tuning_record),
+// - packed weights (weights_size bytes) at weights_offset, a multiple of XNN_WEIGHTS_CACHE_FILE_ALIGNMENT so that they
+//   can be mapped directly on systems with pages of up to 64KB.
+#define XNN_WEIGHTS_CACHE_FILE_MAGIC UINT32_C(0x43574E58)  // "XNWC"
+#define XNN_WEIGHTS_CACHE_FILE_VERSION 2
+#define XNN_WEIGHTS_CACHE_FILE_ALIGNMENT 65536
+
+struct weights_cache_file_header {
+  uint32_t magic;
+  uint32_t version;
+  // Size of struct xnn_cache_bucket, buckets are stored as-is.
+  uint32_t bucket_size;
+  uint32_t build_identifier_size;
+  // Architecture flags of the hardware config the weights were packed for.
+  uint64_t arch_flags;
+  uint64_t num_buckets;
+  uint64_t num_entries;
+  uint64_t max_weights_size;
+  uint64_t weights_offset;
+  uint64_t weights_size;
+  uint64_t num_gemm_tunings;
+};
+
 // MurmurHash3 implementation, copied from smhasher, with minor modifications in
 // style and main loop.
 
@@ -324,6 +355,7 @@ enum xnn_status xnn_internal_release_weights_cache(struct xnn_internal_weights_c
     if (cache->cache.buckets != NULL) {
       xnn_release_memory(cache->cache.buckets);
     }
+    xnn_release_memory(cache->gemm_tunings);
     const enum xnn_status status = xnn_mutex_destroy(&cache->mutex);
     if (status != xnn_status_success) {
       return status;
@@ -469,3 +501,263 @@ size_t xnn_weights_cache_look_up(
 {
   return cache->look_up(cache->context, cache_key);
 }
+
+static bool is_internal_weights_cache(xnn_weights_cache_t cache)
+{
+  return cache->delete_cache == (enum xnn_status (*)(void*)) xnn_internal_delete_weights_cache;
+}
+
+static struct xnn_gemm_tuning_record* find_gemm_tuning(
+  struct xnn_internal_weights_cache* cache, const struct xnn_gemm_tuning_record* record)
+{
+  for (size_t i = 0; i < cache->num_gemm_tunings; i++) {
+    struct xnn_gemm_tuning_record* tuning = &cache->gemm_tunings[i];
+    if (tuning->operator_type == record->operator_type && tuning->input_channels == record->input_channels &&
+        tuning->output_channels == record->output_channels) {
+      return tuning;
+    }
+  }
+  return NULL;
+}
+
+bool xnn_internal_weights_cache_look_up_gemm_tuning(
+  struct xnn_internal_weights_cache* cache, struct xnn_gemm_tuning_record* record)
+{
+  if (xnn_mutex_lock(&cache->mutex) != xnn_status_success) {
+    return false;
+  }
+  const struct xnn_gemm_tuning_record* tuning = find_gemm_tuning(cache, record);
+  if (tuning != NULL) {
+    *record = *tuning;
+  }
+  xnn_mutex_unlock(&cache->mutex);
+  return tuning != NULL;
+}
+
+enum xnn_status xnn_internal_weights_cache_insert_gemm_tuning(
+  struct xnn_internal_weights_cache* cache, const struct xnn_gemm_tuning_record* record)
+{
+  enum xnn_status status = xnn_mutex_lock(&cache->mutex);
+  if (status != xnn_status_success) {
+    return status;
+  }
+  struct xnn_gemm_tuning_record* tuning = find_gemm_tuning(cache, record);
+  if (tuning == NULL) {
+    struct xnn_gemm_tuning_record* gemm_tunings = xnn_reallocate_memory(
+      cache->gemm_tunings, (cache->num_gemm_tunings + 1) * sizeof(struct xnn_gemm_tuning_record));
+    if (gemm_tunings == NULL) {
+      xnn_log_error("failed to allocate memory for GEMM autotuning results");
+      xnn_mutex_unlock(&cache->mutex);
+      return xnn_status_out_of_memory;
+    }
+    cache->gemm_tunings = gemm_tunings;
+    tuning = &gemm_tunings[cache->num_gemm_tunings++];
+  }
+  *tuning = *record;
+  xnn_mutex_unlock(&cache->mutex);
+  return xnn_status_success;
+}
+
+bool xnn_weights_cache_look_up_gemm_tuning(xnn_weights_cache_t cache, struct xnn_gemm_tuning_record* record)
+{
+  if (cache == NULL || !is_internal_weights_cache(cache)) {
+    return false;
+  }
+  return xnn_internal_weights_cache_look_up_gemm_tuning(cache->context, record);
+}
+
+void xnn_weights_cache_insert_gemm_tuning(xnn_weights_cache_t cache, const struct xnn_gemm_tuning_record* record)
+{
+  if (cache != NULL && is_internal_weights_cache(cache)) {
+    xnn_internal_weights_cache_insert_gemm_tuning(cache->context, record);
+  }
+}
+
+static bool write_zeros(FILE* file, size_t size)
+{
+  static const uint8_t zeros[256] = {0};
+  while (size != 0) {
+    const size_t n = min(size, sizeof(zeros));
+    if (fwrite(zeros, 1, n, file) != n) {
+      return false;
+    }
+    size -= n;
+  }
+  return true;
+}
+
+enum xnn_status xnn_internal_save_weights_cache(struct xnn_internal_weights_cache* cache, const char* path)
+{
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    xnn_log_error("failed to save weights cache: hardware not supported");
+    return xnn_status_unsupported_hardware;
+  }
+  if (cache->cache.buckets == NULL) {
+    xnn_log_error("failed to save weights cache: hard finalized weights cache does not keep its index");
+    return xnn_status_invalid_state;
+  }
+
+  enum xnn_status status = xnn_mutex_lock(&cache->mutex);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const size_t build_identifier_size = xnn_experimental_get_build_identifier_size();
+  const size_t buckets_size = cache->cache.num_buckets * sizeof(struct xnn_cache_bucket);
+  const size_t gemm_tunings_size = cache->num_gemm_tunings * sizeof(struct xnn_gemm_tuning_record);
+  const size_t index_size =
+    sizeof(struct weights_cache_file_header) + build_identifier_size + buckets_size + gemm_tunings_size;
+  const struct weights_cache_file_header header = {
+    .magic = XNN_WEIGHTS_CACHE_FILE_MAGIC,
+    .version = XNN_WEIGHTS_CACHE_FILE_VERSION,
+    .bucket_size = sizeof(struct xnn_cache_bucket),
+    .build_identifier_size = (uint32_t) build_identifier_size,
+    .arch_flags = hardware_config->arch_flags,
+    .num_buckets = cache->cache.num_buckets,
+    .num_entries = cache->cache.num_entries,
+    .max_weights_size = cache->max_weights_size,
+    .weights_offset = round_up_po2(index_size, XNN_WEIGHTS_CACHE_FILE_ALIGNMENT),
+    .weights_size = cache->cache.weights.size,
+    .num_gemm_tunings = cache->num_gemm_tunings,
+  };
+
+  FILE* file = fopen(path, "wb");
+  if (file == NULL) {
+    xnn_log_error("failed to save weights cache: cannot open %s for writing", path);
+    xnn_mutex_unlock(&cache->mutex);
+    return xnn_status_invalid_parameter;
+  }
+  bool success =
+    fwrite(&header, sizeof(header), 1, file) == 1 &&
+    fwrite(xnn_experimental_get_build_identifier_data(), 1, build_identifier_size, file) == build_identifier_size &&
+    fwrite(cache->cache.buckets, 1, buckets_size, file) == buckets_size &&
+    fwrite(cache->gemm_tunings, 1, gemm_tunings_size, file) == gemm_tunings_size &&
+    write_zeros(file, header.weights_offset - index_size) &&
+    fwrite(cache->cache.weights.start, 1, cache->cache.weights.size, file) == cache->cache.weights.size;
+  success &= fclose(file) == 0;
+  xnn_mutex_unlock(&cache->mutex);
+
+  if (!success) {
+    xnn_log_error("failed to save weights cache: cannot write %s", path);
+    return xnn_status_invalid_state;
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_internal_init_weights_cache_from_file(struct xnn_internal_weights_cache* cache, const char* path)
+{
+  memset(cache, 0, sizeof(struct xnn_internal_weights_cache));
+
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    xnn_log_error("failed to load weights cache: hardware not supported");
+    return xnn_status_unsupported_hardware;
+  }
+
+  FILE* file = fopen(path, "rb");
+  if (file == NULL) {
+    xnn_log_error("failed to load weights cache: cannot open %s", path);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = xnn_status_invalid_parameter;
+  uint8_t* build_identifier = NULL;
+  struct weights_cache_file_header header;
+  if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != XNN_WEIGHTS_CACHE_FILE_MAGIC) {
+    xnn_log_error("failed to load weights cache: %s is not a weights cache file", path);
+    goto error;
+  }
+  if (header.version != XNN_WEIGHTS_CACHE_FILE_VERSION || header.bucket_size != sizeof(struct xnn_cache_bucket)) {
+    xnn_log_error("failed to load weights cache: unsupported version %" PRIu32 " of %s", header.version, path);
+    goto error;
+  }
+
+  // Packed weights layouts depend on the microkernels in this build, and on the microkernels selected for this
+  // hardware.
+  build_identifier = xnn_allocate_memory(max(header.build_identifier_size, 1));
+  if (build_identifier == NULL) {
+    status = xnn_status_out_of_memory;
+    goto error;
+  }
+  if (fread(build_identifier, 1, header.build_identifier_size, file) != header.build_identifier_size ||
+      !xnn_experimental_check_build_identifier(build_identifier, header.build_identifier_size)) {
+    xnn_log_error("failed to load weights cache: %s was saved by a different build of XNNPACK", path);
+    goto error;
+  }
+  if (header.arch_flags != hardware_config->arch_flags) {
+    xnn_log_error(
+      "failed to load weights cache: %s was saved on hardware with different features (0x%" PRIx64 " vs 0x%" PRIx64 ")",
+      path, header.arch_flags, hardware_config->arch_flags);
+    status = xnn_status_unsupported_hardware;
+    goto error;
+  }
+  if (header.num_buckets == 0 || !is_po2(header.num_buckets) || header.num_entries > header.num_buckets ||
+      header.num_gemm_tunings > header.weights_offset / sizeof(struct xnn_gemm_tuning_record)) {
+    xnn_log_error("failed to load weights cache: %s has an invalid index", path);
+    goto error;
+  }
+
+  status = xnn_init_cache_with_size(&cache->cache, header.num_buckets, xnn_cache_type_weights);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+  status = xnn_status_invalid_parameter;
+  const size_t buckets_size = header.num_buckets * sizeof(struct xnn_cache_bucket);
+  if (fread(cache->cache.buckets, 1, buckets_size, file) != buckets_size) {
+    xnn_log_error("failed to load weights cache: %s is truncated", path);
+    goto error;
+  }
+  for (size_t i = 0; i < header.num_buckets; i++) {
+    const struct xnn_cache_bucket* bucket = &cache->cache.buckets[i];
+    if (bucket->offset > header.weights_size || bucket->size > header.weights_size - bucket->offset) {
+      xnn_log_error("failed to load weights cache: %s has an invalid index", path);
+      goto error;
+    }
+  }
+  cache->cache.num_entries = header.num_entries;
+  if (header.num_gemm_tunings != 0) {
+    const size_t gemm_tunings_size = header.num_gemm_tunings * sizeof(struct xnn_gemm_tuning_record);
+    cache->gemm_tunings = xnn_allocate_memory(gemm_tunings_size);
+    if (cache->gemm_tunings == NULL) {
+      status = xnn_status_out_of_memory;
+      goto error;
+    }
+    if (fread(cache->gemm_tunings, 1, gemm_tunings_size, file) != gemm_tunings_size) {
+      xnn_log_error("failed to load weights cache: %s is truncated", path);
+      goto error;
+    }
+    cache->num_gemm_tunings = header.num_gemm_tunings;
+  }
+  xnn_release_memory(build_identifier);
+  build_identifier = NULL;
+  fclose(file);
+  file = NULL;
+
+  // Keep room to pack weights for look ups after the mapped weights, as in a soft finalized cache.
+  status = xnn_map_weights_memory_from_file(
+    &cache->cache.weights, path, header.weights_offset, header.weights_size, header.max_weights_size);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  status = xnn_mutex_init(&cache->mutex);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  cache->max_weights_size = header.max_weights_size;
+  cache->finalization_state = xnn_cache_state_soft_finalized;
+  return xnn_status_success;
+
+error:
+  if (file != NULL) {
+    fclose(file);
+  }
+  xnn_release_memory(build_identifier);
+  xnn_release_weights_memory(&cache->cache.weights);
+  xnn_release_memory(cache->cache.buckets);
+  xnn_release_memory(cache->gemm_tunings);
+  memset(cache, 0, sizeof(struct xnn_internal_weights_cache));
+  return status;
+}
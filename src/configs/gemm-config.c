@@ -28,9 +28,14 @@
 #define XNN_MR_TO_INDEX(MR) (MR-1)
 
 
+static struct xnn_gemm_config bf16_gemm_config = {0};
 static struct xnn_gemm_config f16_gemm_config = {0};
 static struct xnn_gemm_config f32_gemm_config = {0};
 static struct xnn_gemm_config f32_gemm_nr2_config = {0};
+// Alternative F32 GEMM configs for the autotuner, the default config first.
+#define XNN_MAX_F32_GEMM_CANDIDATE_CONFIGS 8
+static struct xnn_gemm_config f32_gemm_candidate_configs[XNN_MAX_F32_GEMM_CANDIDATE_CONFIGS] = {0};
+static size_t num_f32_gemm_candidate_configs = 0;
 static struct xnn_gemm_config f32_qc4w_gemm_config = {0};
 static struct xnn_gemm_config f32_qc8w_gemm_config = {0};
 static struct xnn_gemm_config pf32_gemm_config = {0};
@@ -50,9 +55,11 @@ static struct xnn_gemm_config qdu8_f16_qc4w_gemm_config = {0};
 static struct xnn_gemm_config qs8_qc8w_gemm_config = {0};
 static struct xnn_gemm_config qu8_gemm_config = {0};
 
+XNN_INIT_ONCE_GUARD(bf16_gemm);
 XNN_INIT_ONCE_GUARD(f16_gemm);
 XNN_INIT_ONCE_GUARD(f32_gemm);
 XNN_INIT_ONCE_GUARD(f32_gemm_nr2);
+XNN_INIT_ONCE_GUARD(f32_gemm_candidates);
 XNN_INIT_ONCE_GUARD(f32_qc4w_gemm);
 XNN_INIT_ONCE_GUARD(f32_qc8w_gemm);
 XNN_INIT_ONCE_GUARD(pf32_gemm);
@@ -72,6 +79,36 @@ XNN_INIT_ONCE_GUARD(qdu8_f16_qc4w_gemm);
 XNN_INIT_ONCE_GUARD(qs8_qc8w_gemm);
 XNN_INIT_ONCE_GUARD(qu8_gemm);
 
+static void init_bf16_gemm_config(void) {
+  #if XNN_ARCH_ARM64 && XNN_ENABLE_ARM_BF16
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_bf16) {
+      bf16_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_bf16_gemm_minmax_ukernel_1x8c2__neonbf16_bfdot_lane_ld128);
+      bf16_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_bf16_gemm_minmax_ukernel_5x8c2__neonbf16_bfdot_lane_ld128);
+      bf16_gemm_config.init.bf16 = xnn_init_bf16_minmax_scalar_params;
+      bf16_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_pack_bf16_gemm_gio_w;
+      bf16_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_pack_bf16_gemm_goi_w;
+      bf16_gemm_config.mr = 5;
+      bf16_gemm_config.nr = 8;
+      bf16_gemm_config.log2_kr = 1;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && XNN_ENABLE_AVX512BF16
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx512bf16) {
+      bf16_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_bf16_gemm_minmax_ukernel_1x32c2__avx512bf16_broadcast);
+      bf16_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(7)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_bf16_gemm_minmax_ukernel_7x32c2__avx512bf16_broadcast);
+      bf16_gemm_config.init.bf16 = xnn_init_bf16_minmax_scalar_params;
+      bf16_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_pack_bf16_gemm_gio_w;
+      bf16_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_pack_bf16_gemm_goi_w;
+      bf16_gemm_config.mr = 7;
+      bf16_gemm_config.nr = 32;
+      bf16_gemm_config.log2_kr = 1;
+    }
+  #endif
+}
+
 static void init_f16_gemm_config(void) {
   #if XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -274,6 +311,81 @@ static void init_pf32_gemm_config(void) {
 #endif  // XNN_ARCH_ARM64 && XNN_ENABLE_KLEIDIAI
 }
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+#if XNN_ENABLE_AVX512F
+static void init_f32_gemm_config_7x32_avx512f(struct xnn_gemm_config* config) {
+  config->minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x32__avx512f_broadcast);
+  config->minmax.gemm[XNN_MR_TO_INDEX(7)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_7x32__avx512f_broadcast);
+  config->gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x32__avx512f_broadcast;
+  config->gemminc[XNN_MR_TO_INDEX(7)] = xnn_f32_gemminc_minmax_ukernel_7x32__avx512f_broadcast;
+  config->minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x32__avx512f_broadcast);
+  config->minmax.igemm[XNN_MR_TO_INDEX(7)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_7x32__avx512f_broadcast);
+  config->init.f32 = xnn_init_f32_minmax_scalar_params;
+  config->pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_x32_packw_gemm_gio_ukernel_x32__avx512f_u8;
+  config->pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x32__avx512f_u4_prfm;
+  config->mr = 7;
+  config->nr = 32;
+}
+#endif  // XNN_ENABLE_AVX512F
+
+static void init_f32_gemm_config_4x16s4_fma3(struct xnn_gemm_config* config) {
+  config->minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x16s4__fma3_broadcast);
+  config->minmax.gemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_4x16s4__fma3_broadcast);
+  config->gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x16s4__fma3_broadcast;
+  config->gemminc[XNN_MR_TO_INDEX(4)] = xnn_f32_gemminc_minmax_ukernel_4x16s4__fma3_broadcast;
+  config->minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x16s4__fma3_broadcast);
+  config->minmax.igemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_4x16s4__fma3_broadcast);
+  config->init.f32 = xnn_init_f32_minmax_scalar_params;
+  config->pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_pack_f32_gemm_gio_w;
+  config->pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x16s4__avx_u4;
+  config->mr = 4;
+  config->nr = 16;
+  config->log2_sr = 2;
+}
+
+static void init_f32_gemm_config_5x16_fma3(struct xnn_gemm_config* config) {
+  config->minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  config->minmax.gemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  config->gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x16__fma3_broadcast;
+  config->gemminc[XNN_MR_TO_INDEX(5)] = xnn_f32_gemminc_minmax_ukernel_5x16__fma3_broadcast;
+  config->minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast);
+  config->minmax.igemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast_prfm);
+  config->init.f32 = xnn_init_f32_minmax_scalar_params;
+  config->pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_x32_packw_gemm_gio_ukernel_x16__avx_u8;
+  config->pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x16__avx_u4;
+  config->mr = 5;
+  config->nr = 16;
+}
+
+static void init_f32_gemm_config_5x16_avx(struct xnn_gemm_config* config) {
+  config->minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast);
+  config->minmax.gemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_5x16__avx_broadcast);
+  config->gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x16__avx_broadcast;
+  config->gemminc[XNN_MR_TO_INDEX(5)] = xnn_f32_gemminc_minmax_ukernel_5x16__avx_broadcast;
+  config->minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast);
+  config->minmax.igemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast);
+  config->init.f32 = xnn_init_f32_minmax_scalar_params;
+  config->pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_x32_packw_gemm_gio_ukernel_x16__avx_u8;
+  config->pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x16__avx_u4;
+  config->mr = 5;
+  config->nr = 16;
+}
+
+static void init_f32_gemm_config_4x8_sse(struct xnn_gemm_config* config) {
+  config->minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x8__sse_load1);
+  config->minmax.gemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_4x8__sse_load1);
+  config->gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x8__sse_load1;
+  config->gemminc[XNN_MR_TO_INDEX(4)] = xnn_f32_gemminc_minmax_ukernel_4x8__sse_load1;
+  config->minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x8__sse_load1);
+  config->minmax.igemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_4x8__sse_load1);
+  config->init.f32 = xnn_init_f32_minmax_scalar_params;
+  config->pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_pack_f32_gemm_gio_w;
+  config->pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x8__sse2_u4;
+  config->mr = 4;
+  config->nr = 8;
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 static void init_f32_gemm_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -556,6 +668,8 @@ static void init_f32_gemm_config(void) {
             // TODO(fbarchard): Implement asm with indexed inputs
             f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x8__asm_aarch64_neonfma_ld128_acc2);
             f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128);
+            f32_gemm_config.gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x8__aarch64_neonfma_lane_ld64;
+            f32_gemm_config.gemminc[XNN_MR_TO_INDEX(6)] = xnn_f32_gemminc_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128;
             f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x8__asm_aarch64_neonfma_ld64);
             f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128);
             f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -575,6 +689,8 @@ static void init_f32_gemm_config(void) {
           default:
             f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x8__asm_aarch64_neonfma_ld128_acc4);
             f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_6x8__asm_aarch64_neonfma_ld128);
+            f32_gemm_config.gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x8__aarch64_neonfma_lane_ld64;
+            f32_gemm_config.gemminc[XNN_MR_TO_INDEX(6)] = xnn_f32_gemminc_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128;
             f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x8__asm_aarch64_neonfma_ld64);
             f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_6x8__asm_aarch64_neonfma_ld128);
             #if XNN_ENABLE_GEMM_M_SPECIALIZATION
@@ -663,6 +779,8 @@ static void init_f32_gemm_config(void) {
       #if XNN_ENABLE_ASSEMBLY
         f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x8__asm_aarch64_neonfma_ld128_acc4);
         f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_6x8__asm_aarch64_neonfma_ld128);
+        f32_gemm_config.gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x8__aarch64_neonfma_lane_ld64;
+        f32_gemm_config.gemminc[XNN_MR_TO_INDEX(6)] = xnn_f32_gemminc_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128;
         f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x8__asm_aarch64_neonfma_ld64);
         f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_6x8__asm_aarch64_neonfma_ld128);
         f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -673,6 +791,8 @@ static void init_f32_gemm_config(void) {
       #else  // !XNN_ENABLE_ASSEMBLY
         f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x8__aarch64_neonfma_lane_ld128);
         f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128);
+        f32_gemm_config.gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x8__aarch64_neonfma_lane_ld64;
+        f32_gemm_config.gemminc[XNN_MR_TO_INDEX(6)] = xnn_f32_gemminc_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128;
         f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x8__aarch64_neonfma_lane_ld128);
         f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(6)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_6x8__aarch64_neonfma_lane_ld128);
         f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -687,64 +807,23 @@ static void init_f32_gemm_config(void) {
     assert(hardware_config != NULL);
     #if XNN_ENABLE_AVX512F
       if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
-        f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x32__avx512f_broadcast);
-        f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(7)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_7x32__avx512f_broadcast);
-        f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x32__avx512f_broadcast);
-        f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(7)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_7x32__avx512f_broadcast);
-        f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
-        f32_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_x32_packw_gemm_gio_ukernel_x32__avx512f_u8;
-        f32_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x32__avx512f_u4_prfm;
-        f32_gemm_config.mr = 7;
-        f32_gemm_config.nr = 32;
+        init_f32_gemm_config_7x32_avx512f(&f32_gemm_config);
       } else
     #endif
     if (hardware_config->use_x86_fma3) {
       switch (cpuinfo_get_core(0)->uarch) {
         case cpuinfo_uarch_zen:
         case cpuinfo_uarch_dhyana:
-          f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x16s4__fma3_broadcast);
-          f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_4x16s4__fma3_broadcast);
-          f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x16s4__fma3_broadcast);
-          f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_4x16s4__fma3_broadcast);
-          f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
-          f32_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_pack_f32_gemm_gio_w;
-          f32_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x16s4__avx_u4;
-          f32_gemm_config.mr = 4;
-          f32_gemm_config.nr = 16;
-          f32_gemm_config.log2_sr = 2;
+          init_f32_gemm_config_4x16s4_fma3(&f32_gemm_config);
           break;
         default:
-          f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast);
-          f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_5x16__fma3_broadcast);
-          f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast);
-          f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast_prfm);
-          f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
-          f32_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_x32_packw_gemm_gio_ukernel_x16__avx_u8;
-          f32_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x16__avx_u4;
-          f32_gemm_config.mr = 5;
-          f32_gemm_config.nr = 16;
+          init_f32_gemm_config_5x16_fma3(&f32_gemm_config);
           break;
       }
     } else if (hardware_config->use_x86_avx) {
-      f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast);
-      f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_5x16__avx_broadcast);
-      f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast);
-      f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(5)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast);
-      f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
-      f32_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_x32_packw_gemm_gio_ukernel_x16__avx_u8;
-      f32_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x16__avx_u4;
-      f32_gemm_config.mr = 5;
-      f32_gemm_config.nr = 16;
+      init_f32_gemm_config_5x16_avx(&f32_gemm_config);
     } else {
-      f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x8__sse_load1);
-      f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_4x8__sse_load1);
-      f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x8__sse_load1);
-      f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_4x8__sse_load1);
-      f32_gemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
-      f32_gemm_config.pack_gemm_gio = (xnn_packw_gemm_gio_ukernel_fn) xnn_pack_f32_gemm_gio_w;
-      f32_gemm_config.pack_gemm_goi = (xnn_packw_gemm_goi_ukernel_fn) xnn_x32_packw_gemm_goi_ukernel_x8__sse2_u4;
-      f32_gemm_config.mr = 4;
-      f32_gemm_config.nr = 8;
+      init_f32_gemm_config_4x8_sse(&f32_gemm_config);
     }
   #elif XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -900,6 +979,8 @@ static void init_f32_gemm_config(void) {
     f32_gemm_config.linear.igemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_ukernel_4x4__scalar);
     f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_1x4__scalar);
     f32_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_minmax_ukernel_4x4__scalar);
+    f32_gemm_config.gemminc[XNN_MR_TO_INDEX(1)] = xnn_f32_gemminc_minmax_ukernel_1x4__scalar;
+    f32_gemm_config.gemminc[XNN_MR_TO_INDEX(4)] = xnn_f32_gemminc_minmax_ukernel_4x4__scalar;
     f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_1x4__scalar);
     f32_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(4)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_f32_igemm_minmax_ukernel_4x4__scalar);
     f32_gemm_config.relu.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_f32_gemm_relu_ukernel_1x4__scalar);
@@ -914,6 +995,53 @@ static void init_f32_gemm_config(void) {
   #endif
 }
 
+static void add_f32_gemm_candidate_config(const struct xnn_gemm_config* config) {
+  if (config->mr == 0 || config->minmax.gemm[XNN_MR_TO_INDEX(config->mr)].function[XNN_UARCH_DEFAULT] == NULL) {
+    return;
+  }
+  for (size_t i = 0; i < num_f32_gemm_candidate_configs; i++) {
+    const struct xnn_gemm_config* candidate = &f32_gemm_candidate_configs[i];
+    if (candidate->minmax.gemm[XNN_MR_TO_INDEX(candidate->mr)].function[XNN_UARCH_DEFAULT] ==
+        config->minmax.gemm[XNN_MR_TO_INDEX(config->mr)].function[XNN_UARCH_DEFAULT]) {
+      return;
+    }
+  }
+  assert(num_f32_gemm_candidate_configs < XNN_MAX_F32_GEMM_CANDIDATE_CONFIGS);
+  f32_gemm_candidate_configs[num_f32_gemm_candidate_configs++] = *config;
+}
+
+static void init_f32_gemm_candidates_config(void) {
+  add_f32_gemm_candidate_config(xnn_init_f32_gemm_config());
+  add_f32_gemm_candidate_config(xnn_init_f32_gemm_nr2_config());
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        struct xnn_gemm_config config = {0};
+        init_f32_gemm_config_7x32_avx512f(&config);
+        add_f32_gemm_candidate_config(&config);
+      }
+    #endif
+    if (hardware_config->use_x86_fma3) {
+      struct xnn_gemm_config config = {0};
+      init_f32_gemm_config_5x16_fma3(&config);
+      add_f32_gemm_candidate_config(&config);
+      struct xnn_gemm_config s4_config = {0};
+      init_f32_gemm_config_4x16s4_fma3(&s4_config);
+      add_f32_gemm_candidate_config(&s4_config);
+    }
+    if (hardware_config->use_x86_avx) {
+      struct xnn_gemm_config config = {0};
+      init_f32_gemm_config_5x16_avx(&config);
+      add_f32_gemm_candidate_config(&config);
+    }
+    struct xnn_gemm_config sse_config = {0};
+    init_f32_gemm_config_4x8_sse(&sse_config);
+    add_f32_gemm_candidate_config(&sse_config);
+  #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+}
+
 static void init_f32_gemm_nr2_config(void) {
   #if XNN_ARCH_ARM
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -2172,6 +2300,7 @@ static void init_qd8_f16_qc8w_gemm_config(void) {
     assert(hardware_config != NULL);
     #if XNN_ENABLE_AVX512AMX
       if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512amx) {
+        qd8_f16_qc8w_gemm_config.arch = xnn_arch_x86_avx512amx;
         qd8_f16_qc8w_gemm_config.minmax.dqgemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_fn) xnn_qd8_f16_qc8w_gemm_minmax_ukernel_1x64c4__avx512amx);
         qd8_f16_qc8w_gemm_config.minmax.dqgemm[XNN_MR_TO_INDEX(16)] = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_fn) xnn_qd8_f16_qc8w_gemm_minmax_ukernel_16x64c4__avx512amx);
         qd8_f16_qc8w_gemm_config.minmax.dqigemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_dqigemm_ukernel((xnn_dqigemm_ukernel_fn) xnn_qd8_f16_qc8w_igemm_minmax_ukernel_1x64c4__avx512amx);
@@ -3414,6 +3543,7 @@ static void init_qs8_qc8w_gemm_config(void) {
     assert(hardware_config != NULL);
     #if XNN_ENABLE_AVX512AMX
       if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512amx) {
+        qs8_qc8w_gemm_config.arch = xnn_arch_x86_avx512amx;
         qs8_qc8w_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_qs8_qc8w_gemm_minmax_fp32_ukernel_1x64c4__avx512amx);
         qs8_qc8w_gemm_config.minmax.gemm[XNN_MR_TO_INDEX(16)] = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_fn) xnn_qs8_qc8w_gemm_minmax_fp32_ukernel_16x64c4__avx512amx);
         qs8_qc8w_gemm_config.minmax.igemm[XNN_MR_TO_INDEX(1)] = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_fn) xnn_qs8_qc8w_igemm_minmax_fp32_ukernel_1x64c4__avx512amx);
@@ -3996,6 +4126,19 @@ static void init_qu8_gemm_config(void) {
   #endif
 }
 
+const struct xnn_gemm_config* xnn_init_bf16_gemm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(bf16_gemm);
+  // No microkernels for this hardware.
+  if (bf16_gemm_config.minmax.gemm[0].function[XNN_UARCH_DEFAULT] == NULL) {
+    return NULL;
+  }
+  return &bf16_gemm_config;
+}
+
 const struct xnn_gemm_config* xnn_init_f16_gemm_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL || !xnn_is_f16_compatible_config(hardware_config)) {
@@ -4032,6 +4175,17 @@ const struct xnn_gemm_config* xnn_init_f32_gemm_nr2_config() {
   return &f32_gemm_nr2_config;
 }
 
+const struct xnn_gemm_config* xnn_init_f32_gemm_candidate_configs(size_t* num_configs) {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    *num_configs = 0;
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_gemm_candidates);
+  *num_configs = num_f32_gemm_candidate_configs;
+  return f32_gemm_candidate_configs;
+}
+
 const struct xnn_gemm_config* xnn_init_f32_qc4w_gemm_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
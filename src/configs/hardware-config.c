@@ -3,7 +3,10 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <inttypes.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 
 #include "xnnpack/common.h"
 
@@ -63,6 +66,90 @@ static struct xnn_hardware_config hardware_config = {0};
 
 XNN_INIT_ONCE_GUARD(hardware);
 
+#if defined(__linux__)
+// Reads the size of the level `level` data or unified cache of cpu0 from sysfs, returns 0 if not found.
+static size_t read_sysfs_cache_size(uint32_t level) {
+  for (uint32_t index = 0; index < 16; index++) {
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%" PRIu32 "/level", index);
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+      break;
+    }
+    uint32_t cache_level = 0;
+    const int num_levels = fscanf(file, "%" SCNu32, &cache_level);
+    fclose(file);
+    if (num_levels != 1 || cache_level != level) {
+      continue;
+    }
+
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%" PRIu32 "/type", index);
+    file = fopen(path, "r");
+    if (file == NULL) {
+      continue;
+    }
+    char type[16] = {0};
+    const int num_types = fscanf(file, "%15s", type);
+    fclose(file);
+    if (num_types != 1 || type[0] == 'I') {
+      // Skip instruction caches.
+      continue;
+    }
+
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%" PRIu32 "/size", index);
+    file = fopen(path, "r");
+    if (file == NULL) {
+      continue;
+    }
+    size_t size = 0;
+    char unit = 0;
+    const int num_sizes = fscanf(file, "%zu%c", &size, &unit);
+    fclose(file);
+    if (num_sizes < 1) {
+      continue;
+    }
+    if (unit == 'K') {
+      size *= 1024;
+    } else if (unit == 'M') {
+      size *= 1024 * 1024;
+    }
+    return size;
+  }
+  return 0;
+}
+#endif  // defined(__linux__)
+
+static void init_cache_sizes(void) {
+  #if !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV && !XNN_ARCH_PPC64 && XNN_ENABLE_CPUINFO
+    const struct cpuinfo_cache* l1d_cache = cpuinfo_get_l1d_cache(0);
+    if (l1d_cache != NULL) {
+      hardware_config.l1_data_cache_size = l1d_cache->size;
+    }
+    const struct cpuinfo_cache* l2_cache = cpuinfo_get_l2_cache(0);
+    if (l2_cache != NULL) {
+      hardware_config.l2_cache_size = l2_cache->size;
+    }
+    const struct cpuinfo_cache* l3_cache = cpuinfo_get_l3_cache(0);
+    if (l3_cache != NULL) {
+      hardware_config.l3_cache_size = l3_cache->size;
+    }
+  #endif  // !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV && !XNN_ARCH_PPC64 && XNN_ENABLE_CPUINFO
+  #if defined(__linux__)
+    // Fall back to sysfs where cpuinfo is unavailable or doesn't know the cache sizes.
+    if (hardware_config.l1_data_cache_size == 0) {
+      hardware_config.l1_data_cache_size = read_sysfs_cache_size(1);
+    }
+    if (hardware_config.l2_cache_size == 0) {
+      hardware_config.l2_cache_size = read_sysfs_cache_size(2);
+    }
+    if (hardware_config.l3_cache_size == 0) {
+      hardware_config.l3_cache_size = read_sysfs_cache_size(3);
+    }
+  #endif  // defined(__linux__)
+  xnn_log_debug("cache sizes: L1D %zu, L2 %zu, L3 %zu bytes",
+    hardware_config.l1_data_cache_size, hardware_config.l2_cache_size, hardware_config.l3_cache_size);
+}
+
 static void init_hardware_config(void) {
   #if XNN_ARCH_ARM64 || XNN_ARCH_ARM
     #if XNN_PLATFORM_WINDOWS
@@ -146,6 +233,11 @@ static void init_hardware_config(void) {
 #else
     hardware_config.use_x86_avx512fp16 = 0;
 #endif
+#if XNN_ENABLE_AVX512BF16
+    hardware_config.use_x86_avx512bf16 = hardware_config.use_x86_avx512skx && cpuinfo_has_x86_avx512bf16();
+#else
+    hardware_config.use_x86_avx512bf16 = 0;
+#endif
 #if XNN_ENABLE_AVX512AMX
     hardware_config.use_x86_avx512amx = hardware_config.use_x86_avx512vnnigfni && cpuinfo_has_x86_amx_int8();
 #if XNN_ARCH_X86_64 && defined(__linux__) && !defined(CHROMIUM)
@@ -347,6 +439,7 @@ static void init_hardware_config(void) {
     if (hardware_config.use_x86_avx512vnnigfni) hardware_config.arch_flags |= xnn_arch_x86_avx512vnnigfni;
     if (hardware_config.use_x86_avx512amx) hardware_config.arch_flags |= xnn_arch_x86_avx512amx;
     if (hardware_config.use_x86_avx512fp16) hardware_config.arch_flags |= xnn_arch_x86_avx512fp16;
+    if (hardware_config.use_x86_avx512bf16) hardware_config.arch_flags |= xnn_arch_x86_avx512bf16;
   #endif
   #if XNN_ARCH_RISCV
     if (hardware_config.use_riscv_vector) hardware_config.arch_flags |= xnn_arch_riscv_vector;
@@ -371,6 +464,7 @@ static void init_hardware_config(void) {
     if (hardware_config.use_hvx) hardware_config.arch_flags |= xnn_arch_hvx;
   #endif  // XNN_ARCH_HEXAGON
 
+  init_cache_sizes();
 }
 
 const struct xnn_hardware_config* xnn_init_hardware_config() {
@@ -0,0 +1,106 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/config.h"
+#include "xnnpack/hardware-config.h"
+#include "xnnpack/init-once.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/norm.h"
+
+static struct xnn_norm_config f16_norm_config = {0};
+static struct xnn_norm_config f32_norm_config = {0};
+
+XNN_INIT_ONCE_GUARD(f16_norm);
+XNN_INIT_ONCE_GUARD(f32_norm);
+
+static void init_f16_norm_config(void) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f16_rmsnorm_ukernel__neonfp16_u16;
+      f16_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f16_layernorm_ukernel__neonfp16_u16;
+    }
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f16_rmsnorm_ukernel__avx2_u32;
+      f16_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f16_layernorm_ukernel__avx2_u32;
+    }
+  #endif
+}
+
+static void init_f32_norm_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__neon_u16;
+      f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__neon_u16;
+    } else {
+      f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__scalar_u4;
+      f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__scalar_u4;
+    }
+  #elif XNN_ARCH_ARM64
+    f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__neon_u16;
+    f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__neon_u16;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__avx512f_u64;
+        f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__avx512f_u64;
+      } else
+    #endif
+    if (hardware_config->use_x86_avx2) {
+      f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__avx2_u32;
+      f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__avx2_u32;
+    } else {
+      f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__sse2_u16;
+      f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__sse2_u16;
+    }
+  #elif XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+    f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__wasmsimd_u16;
+    f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__wasmsimd_u16;
+  #else
+    f32_norm_config.rmsnorm = (xnn_rmsnorm_ukernel_fn) xnn_f32_rmsnorm_ukernel__scalar_u4;
+    f32_norm_config.layernorm = (xnn_layernorm_ukernel_fn) xnn_f32_layernorm_ukernel__scalar_u4;
+  #endif
+}
+
+static bool is_f16_compatible_config(const struct xnn_hardware_config hardware_config[restrict XNN_MIN_ELEMENTS(1)]) {
+  #if (XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR) || (XNN_ARCH_ARM64 && XNN_ENABLE_ARM_FP16_VECTOR)
+    return hardware_config->use_arm_neon_fp16_arith;
+  #elif (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    return hardware_config->use_x86_avx2;
+  #else
+    return false;
+  #endif
+}
+
+const struct xnn_norm_config* xnn_init_f16_norm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f16_norm);
+  return &f16_norm_config;
+}
+
+const struct xnn_norm_config* xnn_init_f32_norm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_norm);
+  return &f32_norm_config;
+}
@@ -15,7 +15,12 @@
 
 static struct xnn_reduce_config f16_f32acc_rsum_config = {0};
 static struct xnn_reduce_config f16_f32acc_rdsum_config = {0};
+static struct xnn_reduce_config f16_reduce_max_config = {0};
+static struct xnn_reduce_config f16_reduce_min_config = {0};
 static struct xnn_reduce_config f16_rminmax_config = {0};
+static struct xnn_reduce_config f32_reduce_max_config = {0};
+static struct xnn_reduce_config f32_reduce_min_config = {0};
+static struct xnn_reduce_config f32_reduce_prod_config = {0};
 static struct xnn_reduce_config f32_rminmax_config = {0};
 static struct xnn_reduce_config f32_rsum_config = {0};
 static struct xnn_reduce_config f32_rdsum_config = {0};
@@ -26,7 +31,12 @@ static struct xnn_reduce_config qu8_rdsum_config = {0};
 
 XNN_INIT_ONCE_GUARD(f16_f32acc_rsum);
 XNN_INIT_ONCE_GUARD(f16_f32acc_rdsum);
+XNN_INIT_ONCE_GUARD(f16_reduce_max);
+XNN_INIT_ONCE_GUARD(f16_reduce_min);
 XNN_INIT_ONCE_GUARD(f16_rminmax);
+XNN_INIT_ONCE_GUARD(f32_reduce_max);
+XNN_INIT_ONCE_GUARD(f32_reduce_min);
+XNN_INIT_ONCE_GUARD(f32_reduce_prod);
 XNN_INIT_ONCE_GUARD(f32_rminmax);
 XNN_INIT_ONCE_GUARD(f32_rsum);
 XNN_INIT_ONCE_GUARD(f32_rdsum);
@@ -308,6 +318,302 @@ static void init_f16_f32acc_rsum_config(void) {
   #endif
 }
 
+static void init_f16_reduce_max_config(void) {
+  #if (XNN_ARCH_ARM || XNN_ARCH_ARM64) && XNN_ENABLE_ARM_FP16_VECTOR
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__neonfp16arith_u32_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__neonfp16arith_c16,
+      };
+    } else {
+      f16_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__scalar_u2_acc2,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__scalar_c2,
+      };
+    }
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512FP16
+      if (hardware_config->use_x86_avx512fp16) {
+        f16_reduce_max_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__avx512fp16_u128_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__f16c_c32,
+        };
+      } else
+    #endif
+    #if XNN_ENABLE_AVX512SKX
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512skx) {
+        f16_reduce_max_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__avx512skx_u64_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__f16c_c32,
+        };
+      } else
+    #endif
+    if (hardware_config->use_x86_f16c) {
+      f16_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__f16c_u32,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__f16c_c32,
+      };
+    } else {
+      f16_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__scalar_u2_acc2,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__scalar_c2,
+      };
+    }
+  #else
+    f16_reduce_max_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmax_ukernel__scalar_u2_acc2,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmax_ukernel_7p7x__scalar_c2,
+    };
+  #endif
+}
+
+static void init_f16_reduce_min_config(void) {
+  #if (XNN_ARCH_ARM || XNN_ARCH_ARM64) && XNN_ENABLE_ARM_FP16_VECTOR
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon_fp16_arith) {
+      f16_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__neonfp16arith_u32_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16,
+      };
+    } else {
+      f16_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__scalar_u2_acc2,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__scalar_c2,
+      };
+    }
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512FP16
+      if (hardware_config->use_x86_avx512fp16) {
+        f16_reduce_min_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__avx512fp16_u128_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__f16c_c32,
+        };
+      } else
+    #endif
+    #if XNN_ENABLE_AVX512SKX
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512skx) {
+        f16_reduce_min_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__avx512skx_u64_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__f16c_c32,
+        };
+      } else
+    #endif
+    if (hardware_config->use_x86_f16c) {
+      f16_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__scalar_u2_acc2,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__f16c_c32,
+      };
+    } else {
+      f16_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__scalar_u2_acc2,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__scalar_c2,
+      };
+    }
+  #else
+    f16_reduce_min_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f16_rmin_ukernel__scalar_u2_acc2,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f16_rdmin_ukernel_7p7x__scalar_c2,
+    };
+  #endif
+}
+
+static void init_f32_reduce_max_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__neon_u16_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__neon_c16,
+      };
+    } else {
+      f32_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__scalar_u4_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__scalar_c4,
+      };
+    }
+  #elif XNN_ARCH_ARM64
+    f32_reduce_max_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__neon_u16_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__neon_c16,
+    };
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_reduce_max_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__avx512f_u64_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__avx512f_c64,
+        };
+      } else
+    #endif
+    if (hardware_config->use_x86_avx) {
+      f32_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__avx_u32_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__avx_c32,
+      };
+    } else {
+      f32_reduce_max_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__sse_u16_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__sse2_c16,
+      };
+    }
+  #elif XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+    f32_reduce_max_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__wasmsimd_pminmax_u16_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__wasmsimd_c16,
+    };
+  #elif XNN_ARCH_WASM
+    f32_reduce_max_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__wasm_u4_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__scalar_c4,
+    };
+  #elif XNN_ARCH_RISCV && XNN_ENABLE_RISCV_VECTOR
+    f32_reduce_max_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__rvv_u8v,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__scalar_c4,
+    };
+  #else
+    f32_reduce_max_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmax_ukernel__scalar_u4_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmax_ukernel_7p7x__scalar_c4,
+    };
+  #endif
+}
+
+static void init_f32_reduce_min_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__neon_u16_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__neon_c16,
+      };
+    } else {
+      f32_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__scalar_u4_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__scalar_c4,
+      };
+    }
+  #elif XNN_ARCH_ARM64
+    f32_reduce_min_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__neon_u16_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__neon_c16,
+    };
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_reduce_min_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__avx512f_u64_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__avx512f_c64,
+        };
+      } else
+    #endif
+    if (hardware_config->use_x86_avx) {
+      f32_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__avx_u32_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__avx_c32,
+      };
+    } else {
+      f32_reduce_min_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__sse_u16_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__sse2_c16,
+      };
+    }
+  #elif XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+    f32_reduce_min_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__wasmsimd_pminmax_u16_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__wasmsimd_c16,
+    };
+  #elif XNN_ARCH_WASM
+    f32_reduce_min_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__wasm_u4_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__scalar_c4,
+    };
+  #elif XNN_ARCH_RISCV && XNN_ENABLE_RISCV_VECTOR
+    f32_reduce_min_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__rvv_u8v,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__scalar_c4,
+    };
+  #else
+    f32_reduce_min_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rmin_ukernel__scalar_u4_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdmin_ukernel_7p7x__scalar_c4,
+    };
+  #endif
+}
+
+static void init_f32_reduce_prod_config(void) {
+  #if XNN_ARCH_ARM
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_arm_neon) {
+      f32_reduce_prod_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__neon_u16_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__neon_c16,
+      };
+    } else {
+      f32_reduce_prod_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__scalar_u4_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__scalar_c4,
+      };
+    }
+  #elif XNN_ARCH_ARM64
+    f32_reduce_prod_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__neon_u16_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__neon_c16,
+    };
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_reduce_prod_config = (struct xnn_reduce_config) {
+          .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__avx512f_u64_acc4,
+          .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__avx512f_c64,
+        };
+      } else
+    #endif
+    if (hardware_config->use_x86_avx) {
+      f32_reduce_prod_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__avx_u32_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__avx_c32,
+      };
+    } else {
+      f32_reduce_prod_config = (struct xnn_reduce_config) {
+        .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__sse2_u16_acc4,
+        .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__sse2_c16,
+      };
+    }
+  #elif XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+    f32_reduce_prod_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__wasmsimd_u16_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__wasmsimd_c16,
+    };
+  #elif XNN_ARCH_WASM
+    f32_reduce_prod_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__scalar_u4_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__scalar_c4,
+    };
+  #else
+    f32_reduce_prod_config = (struct xnn_reduce_config) {
+      .ukernel = (xnn_reduce_ukernel_fn) xnn_f32_rprod_ukernel__scalar_u4_acc4,
+      .rd_ukernel = (xnn_rdsum_ukernel_fn) xnn_f32_rdprod_ukernel_7p7x__scalar_c4,
+    };
+  #endif
+}
+
 static void init_f16_rminmax_config(void) {
   #if (XNN_ARCH_ARM || XNN_ARCH_ARM64) && XNN_ENABLE_ARM_FP16_VECTOR
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
@@ -571,6 +877,51 @@ const struct xnn_reduce_config* xnn_init_f16_f32acc_rsum_config() {
   return &f16_f32acc_rsum_config;
 }
 
+const struct xnn_reduce_config* xnn_init_f16_reduce_max_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !xnn_is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f16_reduce_max);
+  return &f16_reduce_max_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f16_reduce_min_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !xnn_is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f16_reduce_min);
+  return &f16_reduce_min_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_reduce_max_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_reduce_max);
+  return &f32_reduce_max_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_reduce_min_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_reduce_min);
+  return &f32_reduce_min_config;
+}
+
+const struct xnn_reduce_config* xnn_init_f32_reduce_prod_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_reduce_prod);
+  return &f32_reduce_prod_config;
+}
+
 const struct xnn_reduce_config* xnn_init_f16_rminmax_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL) {
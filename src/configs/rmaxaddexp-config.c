@@ -0,0 +1,86 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/config.h"
+#include "xnnpack/hardware-config.h"
+#include "xnnpack/init-once.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/rmaxaddexp.h"
+#include "xnnpack/vscaleexpminusmax.h"
+
+static struct xnn_rmaxaddexp_config f16_rmaxaddexp_config = {0};
+static struct xnn_rmaxaddexp_config f32_rmaxaddexp_config = {0};
+
+XNN_INIT_ONCE_GUARD(f16_rmaxaddexp);
+XNN_INIT_ONCE_GUARD(f32_rmaxaddexp);
+
+static void init_f16_rmaxaddexp_config(void) {
+  #if (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_avx2) {
+      f16_rmaxaddexp_config.ukernel = (xnn_rmaxaddexp_ukernel_fn) xnn_f16_rmaxaddexp_ukernel__avx2_rr2_p5_u32;
+      f16_rmaxaddexp_config.vscale_ukernel = (xnn_vscaleexpminusmax_ukernel_fn) xnn_f16_vscaleexpminusmax_ukernel__avx2_rr2_p5_u32;
+    }
+  #endif
+}
+
+static void init_f32_rmaxaddexp_config(void) {
+  #if (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (hardware_config->use_x86_avx512f) {
+        f32_rmaxaddexp_config.ukernel = (xnn_rmaxaddexp_ukernel_fn) xnn_f32_rmaxaddexp_ukernel__avx512f_rr2_p5_u64;
+        f32_rmaxaddexp_config.vscale_ukernel = (xnn_vscaleexpminusmax_ukernel_fn) xnn_f32_vscaleexpminusmax_ukernel__avx512f_p5_scalef_u16;
+      } else
+    #endif
+    if (hardware_config->use_x86_avx2) {
+      f32_rmaxaddexp_config.ukernel = (xnn_rmaxaddexp_ukernel_fn) xnn_f32_rmaxaddexp_ukernel__avx2_rr2_p5_u32;
+      f32_rmaxaddexp_config.vscale_ukernel = (xnn_vscaleexpminusmax_ukernel_fn) xnn_f32_vscaleexpminusmax_ukernel__avx2_p5_u24;
+    }
+  #endif
+  // Elsewhere, softmax is bound by computing exponentials rather than by memory
+  // traffic, and the three-pass softmax, which computes them once, is faster.
+}
+
+static bool is_f16_compatible_config(const struct xnn_hardware_config hardware_config[restrict XNN_MIN_ELEMENTS(1)]) {
+  #if (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    return hardware_config->use_x86_avx2;
+  #else
+    return false;
+  #endif
+}
+
+const struct xnn_rmaxaddexp_config* xnn_init_f16_rmaxaddexp_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f16_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f16_rmaxaddexp);
+  return &f16_rmaxaddexp_config;
+}
+
+static bool is_f32_compatible_config(const struct xnn_hardware_config hardware_config[restrict XNN_MIN_ELEMENTS(1)]) {
+  #if (XNN_ARCH_X86 || XNN_ARCH_X86_64) && !XNN_PLATFORM_MOBILE
+    return hardware_config->use_x86_avx2 || hardware_config->use_x86_avx512f;
+  #else
+    return false;
+  #endif
+}
+
+const struct xnn_rmaxaddexp_config* xnn_init_f32_rmaxaddexp_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL || !is_f32_compatible_config(hardware_config)) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_rmaxaddexp);
+  return &f32_rmaxaddexp_config;
+}
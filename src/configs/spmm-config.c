@@ -17,11 +17,13 @@ static struct xnn_spmm_config f16_spmm_config = {0};
 static struct xnn_spmm_config f32_spmm_config = {0};
 static struct xnn_spmm_config f32_spmm2_config = {0};
 static struct xnn_spmm_config f32_spmm4_config = {0};
+static struct xnn_spgemm_config f32_spgemm_config = {0};
 
 XNN_INIT_ONCE_GUARD(f16_spmm);
 XNN_INIT_ONCE_GUARD(f32_spmm);
 XNN_INIT_ONCE_GUARD(f32_spmm2);
 XNN_INIT_ONCE_GUARD(f32_spmm4);
+XNN_INIT_ONCE_GUARD(f32_spgemm);
 
 static void init_f16_spmm_config(void) {
   #if XNN_ARCH_ARM && XNN_ENABLE_ARM_FP16_VECTOR && XNN_ENABLE_ARM_FP16_SCALAR
@@ -66,10 +68,27 @@ static void init_f32_spmm_config(void) {
     f32_spmm_config.mr = 32;
     f32_spmm_config.nr = 1;
   #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
-    f32_spmm_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_32x1__sse;
-    f32_spmm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
-    f32_spmm_config.mr = 32;
-    f32_spmm_config.nr = 1;
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_spmm_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_64x1__avx512f;
+        f32_spmm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+        f32_spmm_config.mr = 64;
+        f32_spmm_config.nr = 1;
+      } else
+    #endif
+    if (hardware_config->use_x86_fma3) {
+      f32_spmm_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_32x1__fma3;
+      f32_spmm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+      f32_spmm_config.mr = 32;
+      f32_spmm_config.nr = 1;
+    } else {
+      f32_spmm_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_32x1__sse;
+      f32_spmm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+      f32_spmm_config.mr = 32;
+      f32_spmm_config.nr = 1;
+    }
   #elif XNN_ARCH_WASMRELAXEDSIMD
     const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
     assert(hardware_config != NULL);
@@ -121,6 +140,23 @@ static void init_f32_spmm2_config(void) {
     f32_spmm2_config.init.f32 = xnn_init_f32_minmax_scalar_params;
     f32_spmm2_config.mr = 32;
     f32_spmm2_config.nr = 2;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_spmm2_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_32x2__avx512f;
+        f32_spmm2_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+        f32_spmm2_config.mr = 32;
+        f32_spmm2_config.nr = 2;
+      } else
+    #endif
+    if (hardware_config->use_x86_fma3) {
+      f32_spmm2_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_16x2__fma3;
+      f32_spmm2_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+      f32_spmm2_config.mr = 16;
+      f32_spmm2_config.nr = 2;
+    }
   #elif XNN_ARCH_WASM
     f32_spmm2_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_8x2__scalar;
     f32_spmm2_config.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -142,6 +178,23 @@ static void init_f32_spmm4_config(void) {
     f32_spmm4_config.init.f32 = xnn_init_f32_minmax_scalar_params;
     f32_spmm4_config.mr = 32;
     f32_spmm4_config.nr = 4;
+  #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    #if XNN_ENABLE_AVX512F
+      if (!XNN_PLATFORM_MOBILE && hardware_config->use_x86_avx512f) {
+        f32_spmm4_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_32x4__avx512f;
+        f32_spmm4_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+        f32_spmm4_config.mr = 32;
+        f32_spmm4_config.nr = 4;
+      } else
+    #endif
+    if (hardware_config->use_x86_fma3) {
+      f32_spmm4_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_16x4__fma3;
+      f32_spmm4_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+      f32_spmm4_config.mr = 16;
+      f32_spmm4_config.nr = 4;
+    }
   #elif XNN_ARCH_WASM
     f32_spmm4_config.ukernel = (xnn_spmm_ukernel_fn) xnn_f32_spmm_minmax_ukernel_8x4__scalar;
     f32_spmm4_config.init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -150,6 +203,22 @@ static void init_f32_spmm4_config(void) {
   #endif
 }
 
+static void init_f32_spgemm_config(void) {
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+    assert(hardware_config != NULL);
+    if (hardware_config->use_x86_fma3) {
+      f32_spgemm_config.ukernel = (xnn_spgemm_ukernel_fn) xnn_f32_spgemm_minmax_ukernel_4x8__fma3;
+      if (hardware_config->use_x86_avx2) {
+        f32_spgemm_config.ukernel_2of4 = (xnn_spgemm_ukernel_fn) xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2;
+      }
+      f32_spgemm_config.init.f32 = xnn_init_f32_minmax_scalar_params;
+      f32_spgemm_config.mr = 4;
+      f32_spgemm_config.nr = 8;
+    }
+  #endif
+}
+
 const struct xnn_spmm_config* xnn_init_f16_spmm_config() {
   const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
   if (hardware_config == NULL || !xnn_is_f16_chw_compatible_config(hardware_config)) {
@@ -185,3 +254,16 @@ const struct xnn_spmm_config* xnn_init_f32_spmm4_config() {
   XNN_INIT_ONCE(f32_spmm4);
   return &f32_spmm4_config;
 }
+
+const struct xnn_spgemm_config* xnn_init_f32_spgemm_config() {
+  const struct xnn_hardware_config* hardware_config = xnn_init_hardware_config();
+  if (hardware_config == NULL) {
+    return NULL;
+  }
+  XNN_INIT_ONCE(f32_spgemm);
+  // The sparse weights cost model is only calibrated for SIMD kernels.
+  if (f32_spgemm_config.ukernel == NULL) {
+    return NULL;
+  }
+  return &f32_spgemm_config;
+}
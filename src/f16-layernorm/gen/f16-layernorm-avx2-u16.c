@@ -0,0 +1,170 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-layernorm/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "xnnpack/simd/f32-avx2.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+#include "xnnpack/norm.h"
+
+
+#ifndef HAVE_XNN_LOADU_F16_AS_F32_AVX2
+#define HAVE_XNN_LOADU_F16_AS_F32_AVX2
+static XNN_INLINE xnn_simd_f32_t xnn_loadu_f16_as_f32(const uint16_t* ptr) {
+  return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) ptr));
+}
+
+static XNN_INLINE void xnn_storeu_f32_as_f16(uint16_t* ptr, xnn_simd_f32_t v) {
+  _mm_storeu_si128((__m128i*) ptr, _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+}
+#endif  // HAVE_XNN_LOADU_F16_AS_F32_AVX2
+
+void xnn_f16_layernorm_ukernel__avx2_u16(
+    size_t batch,
+    const xnn_float16* input,
+    const xnn_float16* scale,
+    const xnn_float16* bias,
+    xnn_float16* output,
+    float epsilon) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(scale != NULL);
+  assert(bias != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* w = (const uint16_t*) scale;
+  const uint16_t* b = (const uint16_t*) bias;
+  uint16_t* o = (uint16_t*) output;
+
+  // First pass: sum and sum of squares of the row, accumulated in single
+  // precision. Elements are shifted by the first element of the row to avoid
+  // cancellation in mean(d**2) - mean(d)**2, and the remaining elements are
+  // padded with the first element, which contributes zero to both sums.
+  const uint16_t vshift_bits = i[0];
+  const float vshift = _cvtsh_ss(vshift_bits);
+  const xnn_simd_f32_t vshift_simd = xnn_set1_f32(vshift);
+  const uint16_t* i0 = i;
+  size_t n = batch;
+  xnn_simd_f32_t vsum0 = xnn_zero_f32();
+  xnn_simd_f32_t vsum_sq0 = xnn_zero_f32();
+  xnn_simd_f32_t vsum1 = xnn_zero_f32();
+  xnn_simd_f32_t vsum_sq1 = xnn_zero_f32();
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vd0 = xnn_sub_f32(xnn_loadu_f16_as_f32(i0 + 0), vshift_simd);
+    const xnn_simd_f32_t vd1 = xnn_sub_f32(xnn_loadu_f16_as_f32(i0 + 8), vshift_simd);
+    i0 += 16;
+
+    vsum0 = xnn_add_f32(vsum0, vd0);
+    vsum_sq0 = xnn_fmadd_f32(vd0, vd0, vsum_sq0);
+    vsum1 = xnn_add_f32(vsum1, vd1);
+    vsum_sq1 = xnn_fmadd_f32(vd1, vd1, vsum_sq1);
+  }
+  vsum0 = xnn_add_f32(vsum0, vsum1);
+  vsum_sq0 = xnn_add_f32(vsum_sq0, vsum_sq1);
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vd = xnn_sub_f32(xnn_loadu_f16_as_f32(i0), vshift_simd);
+    i0 += 8;
+
+    vsum0 = xnn_add_f32(vsum0, vd);
+    vsum_sq0 = xnn_fmadd_f32(vd, vd, vsum_sq0);
+  }
+  if XNN_UNLIKELY(n != 0) {
+    uint16_t vtail[8];
+    vtail[0] = vshift_bits;
+    vtail[1] = vshift_bits;
+    vtail[2] = vshift_bits;
+    vtail[3] = vshift_bits;
+    vtail[4] = vshift_bits;
+    vtail[5] = vshift_bits;
+    vtail[6] = vshift_bits;
+    vtail[7] = vshift_bits;
+    memcpy(vtail, i0, n);
+    const xnn_simd_f32_t vd = xnn_sub_f32(xnn_loadu_f16_as_f32(vtail), vshift_simd);
+
+    vsum0 = xnn_add_f32(vsum0, vd);
+    vsum_sq0 = xnn_fmadd_f32(vd, vd, vsum_sq0);
+  }
+  float vsum_lanes[8];
+  float vsum_sq_lanes[8];
+  xnn_storeu_f32(vsum_lanes, vsum0);
+  xnn_storeu_f32(vsum_sq_lanes, vsum_sq0);
+  vsum_lanes[0] += vsum_lanes[1];
+  vsum_sq_lanes[0] += vsum_sq_lanes[1];
+  vsum_lanes[2] += vsum_lanes[3];
+  vsum_sq_lanes[2] += vsum_sq_lanes[3];
+  vsum_lanes[4] += vsum_lanes[5];
+  vsum_sq_lanes[4] += vsum_sq_lanes[5];
+  vsum_lanes[6] += vsum_lanes[7];
+  vsum_sq_lanes[6] += vsum_sq_lanes[7];
+  vsum_lanes[0] += vsum_lanes[2];
+  vsum_sq_lanes[0] += vsum_sq_lanes[2];
+  vsum_lanes[4] += vsum_lanes[6];
+  vsum_sq_lanes[4] += vsum_sq_lanes[6];
+  vsum_lanes[0] += vsum_lanes[4];
+  vsum_sq_lanes[0] += vsum_sq_lanes[4];
+
+  const float vinv_channels = 1.0f / (float) (batch / sizeof(uint16_t));
+  const float vmean_d = vsum_lanes[0] * vinv_channels;
+  const float vvariance = math_max_f32(vsum_sq_lanes[0] * vinv_channels - vmean_d * vmean_d, 0.0f);
+  const xnn_simd_f32_t vmean = xnn_set1_f32(vshift + vmean_d);
+  const xnn_simd_f32_t vmultiplier = xnn_set1_f32(1.0f / sqrtf(vvariance + epsilon));
+
+  // Second pass: output := (input - mean) / sqrt(variance + epsilon) * scale + bias.
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f16_as_f32(i + 0);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f16_as_f32(i + 8);
+    i += 16;
+    const xnn_simd_f32_t vscale0 = xnn_loadu_f16_as_f32(w + 0);
+    const xnn_simd_f32_t vscale1 = xnn_loadu_f16_as_f32(w + 8);
+    w += 16;
+    const xnn_simd_f32_t vbias0 = xnn_loadu_f16_as_f32(b + 0);
+    const xnn_simd_f32_t vbias1 = xnn_loadu_f16_as_f32(b + 8);
+    b += 16;
+
+    const xnn_simd_f32_t vy0 = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi0, vmean), vmultiplier), vscale0, vbias0);
+    const xnn_simd_f32_t vy1 = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi1, vmean), vmultiplier), vscale1, vbias1);
+
+    xnn_storeu_f32_as_f16(o + 0, vy0);
+    xnn_storeu_f32_as_f16(o + 8, vy1);
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi = xnn_loadu_f16_as_f32(i);
+    i += 8;
+    const xnn_simd_f32_t vscale = xnn_loadu_f16_as_f32(w);
+    w += 8;
+    const xnn_simd_f32_t vbias = xnn_loadu_f16_as_f32(b);
+    b += 8;
+
+    const xnn_simd_f32_t vy = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi, vmean), vmultiplier), vscale, vbias);
+
+    xnn_storeu_f32_as_f16(o, vy);
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const xnn_simd_f32_t vi = xnn_loadu_f16_as_f32(i);
+    const xnn_simd_f32_t vscale = xnn_loadu_f16_as_f32(w);
+    const xnn_simd_f32_t vbias = xnn_loadu_f16_as_f32(b);
+
+    const xnn_simd_f32_t vy = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi, vmean), vmultiplier), vscale, vbias);
+
+    uint16_t vtail[8];
+    xnn_storeu_f32_as_f16(vtail, vy);
+    memcpy(o, vtail, batch);
+  }
+}
@@ -0,0 +1,209 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rdminmax/neonfp16arith.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <arm_neon.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/reduce.h"
+
+
+void xnn_f16_rdmax_ukernel_7p7x__neonfp16arith_c16(
+    size_t rows,
+    size_t channels,
+    const xnn_float16* input,
+    size_t input_stride,
+    const xnn_float16* zero,
+    xnn_float16* output,
+    const struct xnn_f16_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(zero != NULL);
+  assert(output != NULL);
+
+  // The output holds the running maximum and is updated in place. Rows past
+  // the end of the input are read from `zero`, which holds the identity.
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* z = (const uint16_t*) zero;
+  uint16_t* o = (uint16_t*) output;
+  const size_t input_increment = 7 * input_stride;
+  for (; channels >= 16; channels -= 16) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    float16x8_t vacc0 = vreinterpretq_f16_u16(vld1q_u16(o + 0));
+    float16x8_t vacc1 = vreinterpretq_f16_u16(vld1q_u16(o + 8));
+
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i0 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i0 + 8)));
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i1 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i1 + 8)));
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i2 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i2 + 8)));
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i3 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i3 + 8)));
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i4 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i4 + 8)));
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i5 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i5 + 8)));
+      vacc0 = vmaxq_f16(vacc0, vreinterpretq_f16_u16(vld1q_u16(i6 + 0)));
+      vacc1 = vmaxq_f16(vacc1, vreinterpretq_f16_u16(vld1q_u16(i6 + 8)));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    vst1q_u16(o + 0, vreinterpretq_u16_f16(vacc0));
+    vst1q_u16(o + 8, vreinterpretq_u16_f16(vacc1));
+    o += 16;
+    i += 16;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    float16x8_t vacc = vreinterpretq_f16_u16(vld1q_u16(o));
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i0)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i1)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i2)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i3)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i4)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i5)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i6)));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    vst1q_u16(o, vreinterpretq_u16_f16(vacc));
+    o += 8;
+    i += 8;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    float16x8_t vacc = vreinterpretq_f16_u16(vld1q_u16(o));
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i0)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i1)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i2)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i3)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i4)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i5)));
+      vacc = vmaxq_f16(vacc, vreinterpretq_f16_u16(vld1q_u16(i6)));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    uint16x4_t vh = vreinterpret_u16_f16(vget_low_f16(vacc));
+    if (channels & 4) {
+      vst1_u16(o, vh);
+      vh = vreinterpret_u16_f16(vget_high_f16(vacc));
+      o += 4;
+    }
+    if (channels & 2) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0);
+      vh = vext_u16(vh, vh, 2);
+      o += 2;
+    }
+    if (channels & 1) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
@@ -0,0 +1,148 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rdminmax/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+#include "xnnpack/reduce.h"
+
+
+void xnn_f16_rdmax_ukernel_7p7x__scalar_c2(
+    size_t rows,
+    size_t channels,
+    const xnn_float16* input,
+    size_t input_stride,
+    const xnn_float16* zero,
+    xnn_float16* output,
+    const struct xnn_f16_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(zero != NULL);
+  assert(output != NULL);
+
+  // Half-precision values are compared as sign-magnitude integers. The output
+  // holds the running maximum and is updated in place. Rows past the end of
+  // the input are read from `zero`, which holds the identity.
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* z = (const uint16_t*) zero;
+  uint16_t* o = (uint16_t*) output;
+  const size_t input_increment = 7 * input_stride;
+  for (; channels >= 2; channels -= 2) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    int16_t vacc0 = math_signcomplement_f16(o[0]);
+    int16_t vacc1 = math_signcomplement_f16(o[1]);
+
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i0[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i0[1]));
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i1[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i1[1]));
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i2[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i2[1]));
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i3[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i3[1]));
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i4[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i4[1]));
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i5[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i5[1]));
+      vacc0 = math_max_s16(vacc0, math_signcomplement_f16(i6[0]));
+      vacc1 = math_max_s16(vacc1, math_signcomplement_f16(i6[1]));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    o[0] = (uint16_t) math_signcomplement_f16((uint16_t) vacc0);
+    o[1] = (uint16_t) math_signcomplement_f16((uint16_t) vacc1);
+    o += 2;
+    i += 2;
+  }
+  for (; channels != 0; channels -= 1) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    int16_t vacc = math_signcomplement_f16(*o);
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i0));
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i1));
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i2));
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i3));
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i4));
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i5));
+      vacc = math_max_s16(vacc, math_signcomplement_f16(*i6));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    *o++ = (uint16_t) math_signcomplement_f16((uint16_t) vacc);
+    i += 1;
+  }
+}
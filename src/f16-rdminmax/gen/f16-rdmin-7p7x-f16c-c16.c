@@ -0,0 +1,212 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rdminmax/f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/intrinsics-polyfill.h"
+#include "xnnpack/reduce.h"
+
+
+void xnn_f16_rdmin_ukernel_7p7x__f16c_c16(
+    size_t rows,
+    size_t channels,
+    const xnn_float16* input,
+    size_t input_stride,
+    const xnn_float16* zero,
+    xnn_float16* output,
+    const struct xnn_f16_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(zero != NULL);
+  assert(output != NULL);
+
+  // The minimum of half-precision values is exact in single precision. The
+  // output holds the running minimum and is updated in place. Rows past the
+  // end of the input are read from `zero`, which holds the identity.
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* z = (const uint16_t*) zero;
+  uint16_t* o = (uint16_t*) output;
+  const size_t input_increment = 7 * input_stride;
+  for (; channels >= 16; channels -= 16) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    __m256 vacc0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (o + 0)));
+    __m256 vacc1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (o + 8)));
+
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i0 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i0 + 8))));
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i1 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i1 + 8))));
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i2 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i2 + 8))));
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i3 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i3 + 8))));
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i4 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i4 + 8))));
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i5 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i5 + 8))));
+      vacc0 = _mm256_min_ps(vacc0, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i6 + 0))));
+      vacc1 = _mm256_min_ps(vacc1, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i6 + 8))));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    _mm_storeu_si128((__m128i*) (o + 0), _mm256_cvtps_ph(vacc0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vacc1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+    i += 16;
+  }
+  for (; channels >= 8; channels -= 8) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    __m256 vacc = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) o));
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    __m128i vh = _mm256_cvtps_ph(vacc, _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128((__m128i*) o, vh);
+    o += 8;
+    i += 8;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const uint16_t* i0 = i;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i + 1 * input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i + 2 * input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i + 3 * input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i + 4 * input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i + 5 * input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i + 6 * input_stride);
+
+    __m256 vacc = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) o));
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = z;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = z;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = z;
+      }
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)));
+      vacc = _mm256_min_ps(vacc, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+    }
+
+    __m128i vh = _mm256_cvtps_ph(vacc, _MM_FROUND_TO_NEAREST_INT);
+    if (channels & 4) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (channels & 2) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (channels & 1) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
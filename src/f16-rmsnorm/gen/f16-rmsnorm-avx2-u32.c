@@ -0,0 +1,145 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rmsnorm/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "xnnpack/simd/f32-avx2.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+#include "xnnpack/norm.h"
+
+
+#ifndef HAVE_XNN_LOADU_F16_AS_F32_AVX2
+#define HAVE_XNN_LOADU_F16_AS_F32_AVX2
+static XNN_INLINE xnn_simd_f32_t xnn_loadu_f16_as_f32(const uint16_t* ptr) {
+  return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) ptr));
+}
+
+static XNN_INLINE void xnn_storeu_f32_as_f16(uint16_t* ptr, xnn_simd_f32_t v) {
+  _mm_storeu_si128((__m128i*) ptr, _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+}
+#endif  // HAVE_XNN_LOADU_F16_AS_F32_AVX2
+
+void xnn_f16_rmsnorm_ukernel__avx2_u32(
+    size_t batch,
+    const xnn_float16* input,
+    const xnn_float16* scale,
+    xnn_float16* output,
+    float epsilon) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(scale != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* w = (const uint16_t*) scale;
+  uint16_t* o = (uint16_t*) output;
+
+  // First pass: sum of squares of the row, accumulated in single precision.
+  // The remaining elements are padded with zeroes.
+  const uint16_t* i0 = i;
+  size_t n = batch;
+  xnn_simd_f32_t vacc0 = xnn_zero_f32();
+  xnn_simd_f32_t vacc1 = xnn_zero_f32();
+  xnn_simd_f32_t vacc2 = xnn_zero_f32();
+  xnn_simd_f32_t vacc3 = xnn_zero_f32();
+  for (; n >= 32 * sizeof(uint16_t); n -= 32 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f16_as_f32(i0 + 0);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f16_as_f32(i0 + 8);
+    const xnn_simd_f32_t vi2 = xnn_loadu_f16_as_f32(i0 + 16);
+    const xnn_simd_f32_t vi3 = xnn_loadu_f16_as_f32(i0 + 24);
+    i0 += 32;
+
+    vacc0 = xnn_fmadd_f32(vi0, vi0, vacc0);
+    vacc1 = xnn_fmadd_f32(vi1, vi1, vacc1);
+    vacc2 = xnn_fmadd_f32(vi2, vi2, vacc2);
+    vacc3 = xnn_fmadd_f32(vi3, vi3, vacc3);
+  }
+  vacc0 = xnn_add_f32(vacc0, vacc1);
+  vacc2 = xnn_add_f32(vacc2, vacc3);
+  vacc0 = xnn_add_f32(vacc0, vacc2);
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi = xnn_loadu_f16_as_f32(i0);
+    i0 += 8;
+
+    vacc0 = xnn_fmadd_f32(vi, vi, vacc0);
+  }
+  if XNN_UNLIKELY(n != 0) {
+    uint16_t vtail[8] = {0};
+    memcpy(vtail, i0, n);
+    const xnn_simd_f32_t vi = xnn_loadu_f16_as_f32(vtail);
+
+    vacc0 = xnn_fmadd_f32(vi, vi, vacc0);
+  }
+  float vacc_lanes[8];
+  xnn_storeu_f32(vacc_lanes, vacc0);
+  vacc_lanes[0] += vacc_lanes[1];
+  vacc_lanes[2] += vacc_lanes[3];
+  vacc_lanes[4] += vacc_lanes[5];
+  vacc_lanes[6] += vacc_lanes[7];
+  vacc_lanes[0] += vacc_lanes[2];
+  vacc_lanes[4] += vacc_lanes[6];
+  vacc_lanes[0] += vacc_lanes[4];
+
+  const float vmean_sq = vacc_lanes[0] / (float) (batch / sizeof(uint16_t));
+  const xnn_simd_f32_t vmultiplier = xnn_set1_f32(1.0f / sqrtf(vmean_sq + epsilon));
+
+  // Second pass: output := input / sqrt(mean(input**2) + epsilon) * scale.
+  for (; batch >= 32 * sizeof(uint16_t); batch -= 32 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f16_as_f32(i + 0);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f16_as_f32(i + 8);
+    const xnn_simd_f32_t vi2 = xnn_loadu_f16_as_f32(i + 16);
+    const xnn_simd_f32_t vi3 = xnn_loadu_f16_as_f32(i + 24);
+    i += 32;
+    const xnn_simd_f32_t vscale0 = xnn_loadu_f16_as_f32(w + 0);
+    const xnn_simd_f32_t vscale1 = xnn_loadu_f16_as_f32(w + 8);
+    const xnn_simd_f32_t vscale2 = xnn_loadu_f16_as_f32(w + 16);
+    const xnn_simd_f32_t vscale3 = xnn_loadu_f16_as_f32(w + 24);
+    w += 32;
+
+    const xnn_simd_f32_t vy0 = xnn_mul_f32(xnn_mul_f32(vi0, vmultiplier), vscale0);
+    const xnn_simd_f32_t vy1 = xnn_mul_f32(xnn_mul_f32(vi1, vmultiplier), vscale1);
+    const xnn_simd_f32_t vy2 = xnn_mul_f32(xnn_mul_f32(vi2, vmultiplier), vscale2);
+    const xnn_simd_f32_t vy3 = xnn_mul_f32(xnn_mul_f32(vi3, vmultiplier), vscale3);
+
+    xnn_storeu_f32_as_f16(o + 0, vy0);
+    xnn_storeu_f32_as_f16(o + 8, vy1);
+    xnn_storeu_f32_as_f16(o + 16, vy2);
+    xnn_storeu_f32_as_f16(o + 24, vy3);
+    o += 32;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi = xnn_loadu_f16_as_f32(i);
+    i += 8;
+    const xnn_simd_f32_t vscale = xnn_loadu_f16_as_f32(w);
+    w += 8;
+
+    const xnn_simd_f32_t vy = xnn_mul_f32(xnn_mul_f32(vi, vmultiplier), vscale);
+
+    xnn_storeu_f32_as_f16(o, vy);
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const xnn_simd_f32_t vi = xnn_loadu_f16_as_f32(i);
+    const xnn_simd_f32_t vscale = xnn_loadu_f16_as_f32(w);
+
+    const xnn_simd_f32_t vy = xnn_mul_f32(xnn_mul_f32(vi, vmultiplier), vscale);
+
+    uint16_t vtail[8];
+    xnn_storeu_f32_as_f16(vtail, vy);
+    memcpy(o, vtail, batch);
+  }
+}
@@ -0,0 +1,157 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-spmm/f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/intrinsics-polyfill.h"
+#include "xnnpack/spmm.h"
+
+
+void xnn_f16_spmm_minmax_ukernel_8x1__f16c(
+    size_t mc,
+    size_t nc,
+    const xnn_float16* input,
+    const xnn_float16* weights,
+    const int32_t* widx_dmap,
+    const uint32_t* nidx_nnzmap,
+    xnn_float16* output,
+    size_t output_stride,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(uint16_t) == 0);
+  assert(nc != 0);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+
+  // Products are accumulated in fp32 and rounded to fp16 once per output.
+  const __m256 vmin = _mm256_cvtph_ps(_mm_set1_epi16(*(const uint16_t*) &params->scalar.min));
+  const __m256 vmax = _mm256_cvtph_ps(_mm_set1_epi16(*(const uint16_t*) &params->scalar.max));
+  XNN_FORCE_REALIZATION(vmin);
+  XNN_FORCE_REALIZATION(vmax);
+
+  while XNN_LIKELY(mc >= 8 * sizeof(uint16_t)) {
+    const uint16_t* w = (const uint16_t*) weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+          i = (const uint16_t*) ((uintptr_t) i + (uintptr_t) diff);
+          const __m256 vw = _mm256_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+          vacc0 = _mm256_add_ps(vacc0, _mm256_mul_ps(vi0, vw));
+        } while (--nnz != 0);
+      }
+      __m256 vout0 = _mm256_min_ps(vacc0, vmax);
+      vout0 = _mm256_max_ps(vout0, vmin);
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vout0, _MM_FROUND_TO_NEAREST_INT));
+      o = (uint16_t*) ((uintptr_t) o + output_stride);
+    } while (--n != 0);
+    o = (uint16_t*) ((uintptr_t) o - output_stride * nc) + 8;
+    i += 8;
+    mc -= 8 * sizeof(uint16_t);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    if (mc & (4 * sizeof(uint16_t))) {
+      const __m128 vmin_lo = _mm256_castps256_ps128(vmin);
+      const __m128 vmax_lo = _mm256_castps256_ps128(vmax);
+      const uint16_t* w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*) i));
+            i = (const uint16_t*) ((uintptr_t) i + (uintptr_t) diff);
+            const __m128 vw = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc = _mm_add_ps(vacc, _mm_mul_ps(vi, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout = _mm_min_ps(vacc, vmax_lo);
+        vout = _mm_max_ps(vout, vmin_lo);
+        const __m128i vh = _mm_cvtps_ph(vout, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64((__m128i*) o, vh);
+        o = (uint16_t*) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*) ((uintptr_t) o - output_stride * nc) + 4;
+      i += 4;
+    }
+    if (mc & (2 * sizeof(uint16_t))) {
+      const __m128 vmin_lo = _mm256_castps256_ps128(vmin);
+      const __m128 vmax_lo = _mm256_castps256_ps128(vmax);
+      const uint16_t* w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi = _mm_cvtph_ps(_mm_loadu_si32(i));
+            i = (const uint16_t*) ((uintptr_t) i + (uintptr_t) diff);
+            const __m128 vw = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc = _mm_add_ps(vacc, _mm_mul_ps(vi, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout = _mm_min_ps(vacc, vmax_lo);
+        vout = _mm_max_ps(vout, vmin_lo);
+        const __m128i vh = _mm_cvtps_ph(vout, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si32(o, vh);
+        o = (uint16_t*) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*) ((uintptr_t) o - output_stride * nc) + 2;
+      i += 2;
+    }
+    if (mc & (1 * sizeof(uint16_t))) {
+      const __m128 vmin_lo = _mm256_castps256_ps128(vmin);
+      const __m128 vmax_lo = _mm256_castps256_ps128(vmax);
+      const uint16_t* w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi = _mm_cvtph_ps(_mm_cvtsi32_si128((int) (uint32_t) *i));
+            i = (const uint16_t*) ((uintptr_t) i + (uintptr_t) diff);
+            const __m128 vw = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc = _mm_add_ps(vacc, _mm_mul_ps(vi, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout = _mm_min_ps(vacc, vmax_lo);
+        vout = _mm_max_ps(vout, vmin_lo);
+        const __m128i vh = _mm_cvtps_ph(vout, _MM_FROUND_TO_NEAREST_INT);
+        *o = (uint16_t) _mm_extract_epi16(vh, 0);
+        o = (uint16_t*) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*) ((uintptr_t) o - output_stride * nc) + 1;
+      i += 1;
+    }
+  }
+}
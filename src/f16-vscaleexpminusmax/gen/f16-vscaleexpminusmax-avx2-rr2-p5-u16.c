@@ -0,0 +1,126 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vscaleexpminusmax/avx2-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-avx2.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/intrinsics-polyfill.h"
+#include "xnnpack/vscaleexpminusmax.h"
+
+
+// Computes exp(x) for x <= 0. Inputs below -88.0 produce a zero scale s and
+// flush to +0.0f, including -inf.
+#ifndef HAVE_XNN_EXP_NONPOSITIVE_RR2_P5_F32
+#define HAVE_XNN_EXP_NONPOSITIVE_RR2_P5_F32
+static XNN_INLINE xnn_simd_f32_t xnn_exp_nonpositive_rr2_p5_f32(xnn_simd_f32_t vx) {
+  XNN_SIMD_CONST_F32(vmin_x, -0x1.6p+6f);
+  XNN_SIMD_CONST_F32(vlog2e, 0x1.715476p+0f);
+  XNN_SIMD_CONST_F32(vmagic_bias, 0x1.8000FEp23f);
+  XNN_SIMD_CONST_F32(vminus_ln2_hi, -0x1.62E400p-1f);
+  XNN_SIMD_CONST_F32(vminus_ln2_lo, -0x1.7F7D1Cp-20f);
+  XNN_SIMD_CONST_F32(vc5, 0x1.0F9F9Cp-7f);
+  XNN_SIMD_CONST_F32(vc4, 0x1.573A1Ap-5f);
+  XNN_SIMD_CONST_F32(vc3, 0x1.555A80p-3f);
+  XNN_SIMD_CONST_F32(vc2, 0x1.FFFDC6p-2f);
+  XNN_SIMD_CONST_F32(vc1, 0x1.FFFFF6p-1f);
+
+  // Clamp x so that n := round(x / log(2)) >= -127. For n == -127 the biased
+  // exponent of s := 2**n is zero, and so is s.
+  vx = xnn_max_f32(vx, vmin_x);
+
+  // Compute reduced argument n := round(x / log(2)), and s := 2**n by shifting
+  // the biased integer n into the exponent bits.
+  xnn_simd_f32_t vn = xnn_fmadd_f32(vx, vlog2e, vmagic_bias);
+  const xnn_simd_f32_t vs = xnn_sll_f32(vn, 23);
+  vn = xnn_sub_f32(vn, vmagic_bias);
+
+  // Compute reduced argument t := x - n * log(2) with Cody-Waite range reduction.
+  xnn_simd_f32_t vt = xnn_fmadd_f32(vn, vminus_ln2_hi, vx);
+  vt = xnn_fmadd_f32(vn, vminus_ln2_lo, vt);
+
+  // Compute degree-5 polynomial approximation for exp(t) on [-log(2)/2, log(2)/2]
+  // and reconstruct f := s + (t * s) * p.
+  xnn_simd_f32_t vp = xnn_fmadd_f32(vc5, vt, vc4);
+  vp = xnn_fmadd_f32(vp, vt, vc3);
+  vp = xnn_fmadd_f32(vp, vt, vc2);
+  vp = xnn_fmadd_f32(vp, vt, vc1);
+  vt = xnn_mul_f32(vt, vs);
+  return xnn_fmadd_f32(vt, vp, vs);
+}
+#endif  // HAVE_XNN_EXP_NONPOSITIVE_RR2_P5_F32
+void xnn_f16_vscaleexpminusmax_ukernel__avx2_rr2_p5_u16(
+    size_t batch,
+    const xnn_float16* input,
+    xnn_float16* output,
+    float scale,
+    float max) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  const xnn_simd_f32_t vscale = xnn_set1_f32(scale);
+  const xnn_simd_f32_t vi_max = xnn_set1_f32(max);
+
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 0)));
+    const xnn_simd_f32_t vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    xnn_simd_f32_t vf0 = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi0, vi_max));
+    xnn_simd_f32_t vf1 = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi1, vi_max));
+
+    vf0 = xnn_mul_f32(vf0, vscale);
+    vf1 = xnn_mul_f32(vf1, vscale);
+
+    _mm_storeu_si128((__m128i*) (o + 0), _mm256_cvtps_ph(vf0, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vf1, _MM_FROUND_TO_NEAREST_INT));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const xnn_simd_f32_t vi = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    xnn_simd_f32_t vf = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi, vi_max));
+    vf = xnn_mul_f32(vf, vscale);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vf, _MM_FROUND_TO_NEAREST_INT));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const xnn_simd_f32_t vi = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    xnn_simd_f32_t vf = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi, vi_max));
+    vf = xnn_mul_f32(vf, vscale);
+
+    __m128i vh = _mm256_cvtps_ph(vf, _MM_FROUND_TO_NEAREST_INT);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      _mm_storeu_si32(o, vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
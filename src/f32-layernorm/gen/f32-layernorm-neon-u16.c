@@ -0,0 +1,158 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-layernorm/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-neon.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+#include "xnnpack/norm.h"
+
+
+void xnn_f32_layernorm_ukernel__neon_u16(
+    size_t batch,
+    const float* input,
+    const float* scale,
+    const float* bias,
+    float* output,
+    float epsilon) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(scale != NULL);
+  assert(bias != NULL);
+  assert(output != NULL);
+  assert(xnn_simd_size_f32 == 4);
+
+  // First pass: sum and sum of squares of the row. Elements are shifted by the
+  // first element of the row, which is close to the mean for most data, so
+  // that computing the variance as mean(d**2) - mean(d)**2 does not cancel
+  // catastrophically when the mean is large compared to the deviation.
+  const float vshift = input[0];
+  const xnn_simd_f32_t vshift_simd = xnn_set1_f32(vshift);
+  const float* i = input;
+  size_t n = batch;
+  xnn_simd_f32_t vsum0 = xnn_zero_f32();
+  xnn_simd_f32_t vsum_sq0 = xnn_zero_f32();
+  xnn_simd_f32_t vsum1 = xnn_zero_f32();
+  xnn_simd_f32_t vsum_sq1 = xnn_zero_f32();
+  xnn_simd_f32_t vsum2 = xnn_zero_f32();
+  xnn_simd_f32_t vsum_sq2 = xnn_zero_f32();
+  xnn_simd_f32_t vsum3 = xnn_zero_f32();
+  xnn_simd_f32_t vsum_sq3 = xnn_zero_f32();
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const xnn_simd_f32_t vd0 = xnn_sub_f32(xnn_loadu_f32(i + 0 * xnn_simd_size_f32), vshift_simd);
+    const xnn_simd_f32_t vd1 = xnn_sub_f32(xnn_loadu_f32(i + 1 * xnn_simd_size_f32), vshift_simd);
+    const xnn_simd_f32_t vd2 = xnn_sub_f32(xnn_loadu_f32(i + 2 * xnn_simd_size_f32), vshift_simd);
+    const xnn_simd_f32_t vd3 = xnn_sub_f32(xnn_loadu_f32(i + 3 * xnn_simd_size_f32), vshift_simd);
+    i += 16;
+
+    vsum0 = xnn_add_f32(vsum0, vd0);
+    vsum_sq0 = xnn_fmadd_f32(vd0, vd0, vsum_sq0);
+    vsum1 = xnn_add_f32(vsum1, vd1);
+    vsum_sq1 = xnn_fmadd_f32(vd1, vd1, vsum_sq1);
+    vsum2 = xnn_add_f32(vsum2, vd2);
+    vsum_sq2 = xnn_fmadd_f32(vd2, vd2, vsum_sq2);
+    vsum3 = xnn_add_f32(vsum3, vd3);
+    vsum_sq3 = xnn_fmadd_f32(vd3, vd3, vsum_sq3);
+  }
+  vsum0 = xnn_add_f32(vsum0, vsum1);
+  vsum_sq0 = xnn_add_f32(vsum_sq0, vsum_sq1);
+  vsum2 = xnn_add_f32(vsum2, vsum3);
+  vsum_sq2 = xnn_add_f32(vsum_sq2, vsum_sq3);
+  vsum0 = xnn_add_f32(vsum0, vsum2);
+  vsum_sq0 = xnn_add_f32(vsum_sq0, vsum_sq2);
+  for (; n >= xnn_simd_bytes_f32; n -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vd = xnn_sub_f32(xnn_loadu_f32(i), vshift_simd);
+    i += xnn_simd_size_f32;
+
+    vsum0 = xnn_add_f32(vsum0, vd);
+    vsum_sq0 = xnn_fmadd_f32(vd, vd, vsum_sq0);
+  }
+  float vsum_lanes[4];
+  float vsum_sq_lanes[4];
+  xnn_storeu_f32(vsum_lanes, vsum0);
+  xnn_storeu_f32(vsum_sq_lanes, vsum_sq0);
+  vsum_lanes[0] += vsum_lanes[1];
+  vsum_sq_lanes[0] += vsum_sq_lanes[1];
+  vsum_lanes[2] += vsum_lanes[3];
+  vsum_sq_lanes[2] += vsum_sq_lanes[3];
+  vsum_lanes[0] += vsum_lanes[2];
+  vsum_sq_lanes[0] += vsum_sq_lanes[2];
+  float vsum = vsum_lanes[0];
+  float vsum_sq = vsum_sq_lanes[0];
+  for (; n != 0; n -= sizeof(float)) {
+    const float vd = *i++ - vshift;
+    vsum += vd;
+    vsum_sq += vd * vd;
+  }
+
+  const float vinv_channels = 1.0f / (float) (batch / sizeof(float));
+  const float vmean_d = vsum * vinv_channels;
+  const float vvariance = math_max_f32(vsum_sq * vinv_channels - vmean_d * vmean_d, 0.0f);
+  const xnn_simd_f32_t vmean = xnn_set1_f32(vshift + vmean_d);
+  const xnn_simd_f32_t vmultiplier = xnn_set1_f32(1.0f / sqrtf(vvariance + epsilon));
+
+  // Second pass: output := (input - mean) / sqrt(variance + epsilon) * scale + bias.
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f32(input + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f32(input + 1 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi2 = xnn_loadu_f32(input + 2 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi3 = xnn_loadu_f32(input + 3 * xnn_simd_size_f32);
+    input += 16;
+    const xnn_simd_f32_t vscale0 = xnn_loadu_f32(scale + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vscale1 = xnn_loadu_f32(scale + 1 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vscale2 = xnn_loadu_f32(scale + 2 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vscale3 = xnn_loadu_f32(scale + 3 * xnn_simd_size_f32);
+    scale += 16;
+    const xnn_simd_f32_t vbias0 = xnn_loadu_f32(bias + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vbias1 = xnn_loadu_f32(bias + 1 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vbias2 = xnn_loadu_f32(bias + 2 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vbias3 = xnn_loadu_f32(bias + 3 * xnn_simd_size_f32);
+    bias += 16;
+
+    const xnn_simd_f32_t vy0 = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi0, vmean), vmultiplier), vscale0, vbias0);
+    const xnn_simd_f32_t vy1 = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi1, vmean), vmultiplier), vscale1, vbias1);
+    const xnn_simd_f32_t vy2 = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi2, vmean), vmultiplier), vscale2, vbias2);
+    const xnn_simd_f32_t vy3 = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi3, vmean), vmultiplier), vscale3, vbias3);
+
+    xnn_storeu_f32(output + 0 * xnn_simd_size_f32, vy0);
+    xnn_storeu_f32(output + 1 * xnn_simd_size_f32, vy1);
+    xnn_storeu_f32(output + 2 * xnn_simd_size_f32, vy2);
+    xnn_storeu_f32(output + 3 * xnn_simd_size_f32, vy3);
+    output += 16;
+  }
+  for (; batch >= xnn_simd_bytes_f32; batch -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vi = xnn_loadu_f32(input);
+    input += xnn_simd_size_f32;
+    const xnn_simd_f32_t vscale = xnn_loadu_f32(scale);
+    scale += xnn_simd_size_f32;
+    const xnn_simd_f32_t vbias = xnn_loadu_f32(bias);
+    bias += xnn_simd_size_f32;
+
+    const xnn_simd_f32_t vy = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi, vmean), vmultiplier), vscale, vbias);
+
+    xnn_storeu_f32(output, vy);
+    output += xnn_simd_size_f32;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const xnn_simd_f32_t vi = xnn_load_tail_f32(input, batch >> XNN_LOG2_SIZEOF_FLOAT);
+    const xnn_simd_f32_t vscale = xnn_load_tail_f32(scale, batch >> XNN_LOG2_SIZEOF_FLOAT);
+    const xnn_simd_f32_t vbias = xnn_load_tail_f32(bias, batch >> XNN_LOG2_SIZEOF_FLOAT);
+
+    const xnn_simd_f32_t vy = xnn_fmadd_f32(xnn_mul_f32(xnn_sub_f32(vi, vmean), vmultiplier), vscale, vbias);
+
+    xnn_store_tail_f32(output, vy, batch >> XNN_LOG2_SIZEOF_FLOAT);
+  }
+}
@@ -0,0 +1,213 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rdminmax/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-avx.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/reduce.h"
+
+
+void xnn_f32_rdmax_ukernel_7p7x__avx_c32(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    const float* zero,
+    float* output,
+    const struct xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(input != NULL);
+  assert(zero != NULL);
+  assert(output != NULL);
+  assert(xnn_simd_size_f32 == 8);
+
+  // The output holds the running maximum and is updated in place. Rows
+  // past the end of the input are read from `zero`, which holds the identity.
+  const size_t input_increment = 7 * input_stride;
+  for (; channels >= 32; channels -= 32) {
+    const float* i0 = input;
+    const float* i1 = (const float*) ((uintptr_t) input + 1 * input_stride);
+    const float* i2 = (const float*) ((uintptr_t) input + 2 * input_stride);
+    const float* i3 = (const float*) ((uintptr_t) input + 3 * input_stride);
+    const float* i4 = (const float*) ((uintptr_t) input + 4 * input_stride);
+    const float* i5 = (const float*) ((uintptr_t) input + 5 * input_stride);
+    const float* i6 = (const float*) ((uintptr_t) input + 6 * input_stride);
+
+    xnn_simd_f32_t vacc0 = xnn_loadu_f32(output);
+    xnn_simd_f32_t vacc1 = xnn_loadu_f32(output + 1 * xnn_simd_size_f32);
+    xnn_simd_f32_t vacc2 = xnn_loadu_f32(output + 2 * xnn_simd_size_f32);
+    xnn_simd_f32_t vacc3 = xnn_loadu_f32(output + 3 * xnn_simd_size_f32);
+
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = zero;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = zero;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = zero;
+      }
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i0 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i0 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i0 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i0 + 3 * xnn_simd_size_f32));
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i1 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i1 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i1 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i1 + 3 * xnn_simd_size_f32));
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i2 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i2 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i2 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i2 + 3 * xnn_simd_size_f32));
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i3 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i3 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i3 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i3 + 3 * xnn_simd_size_f32));
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i4 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i4 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i4 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i4 + 3 * xnn_simd_size_f32));
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i5 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i5 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i5 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i5 + 3 * xnn_simd_size_f32));
+      vacc0 = xnn_max_f32(vacc0, xnn_loadu_f32(i6 + 0 * xnn_simd_size_f32));
+      vacc1 = xnn_max_f32(vacc1, xnn_loadu_f32(i6 + 1 * xnn_simd_size_f32));
+      vacc2 = xnn_max_f32(vacc2, xnn_loadu_f32(i6 + 2 * xnn_simd_size_f32));
+      vacc3 = xnn_max_f32(vacc3, xnn_loadu_f32(i6 + 3 * xnn_simd_size_f32));
+      i0 = (const float*) ((uintptr_t) i0 + input_increment);
+      i1 = (const float*) ((uintptr_t) i1 + input_increment);
+      i2 = (const float*) ((uintptr_t) i2 + input_increment);
+      i3 = (const float*) ((uintptr_t) i3 + input_increment);
+      i4 = (const float*) ((uintptr_t) i4 + input_increment);
+      i5 = (const float*) ((uintptr_t) i5 + input_increment);
+      i6 = (const float*) ((uintptr_t) i6 + input_increment);
+    }
+
+    xnn_storeu_f32(output, vacc0);
+    xnn_storeu_f32(output + 1 * xnn_simd_size_f32, vacc1);
+    xnn_storeu_f32(output + 2 * xnn_simd_size_f32, vacc2);
+    xnn_storeu_f32(output + 3 * xnn_simd_size_f32, vacc3);
+    output += 32;
+    input += 32;
+  }
+  for (; channels >= xnn_simd_size_f32; channels -= xnn_simd_size_f32) {
+    const float* i0 = input;
+    const float* i1 = (const float*) ((uintptr_t) input + 1 * input_stride);
+    const float* i2 = (const float*) ((uintptr_t) input + 2 * input_stride);
+    const float* i3 = (const float*) ((uintptr_t) input + 3 * input_stride);
+    const float* i4 = (const float*) ((uintptr_t) input + 4 * input_stride);
+    const float* i5 = (const float*) ((uintptr_t) input + 5 * input_stride);
+    const float* i6 = (const float*) ((uintptr_t) input + 6 * input_stride);
+
+    xnn_simd_f32_t vacc = xnn_loadu_f32(output);
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = zero;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = zero;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = zero;
+      }
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i0));
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i1));
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i2));
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i3));
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i4));
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i5));
+      vacc = xnn_max_f32(vacc, xnn_loadu_f32(i6));
+      i0 = (const float*) ((uintptr_t) i0 + input_increment);
+      i1 = (const float*) ((uintptr_t) i1 + input_increment);
+      i2 = (const float*) ((uintptr_t) i2 + input_increment);
+      i3 = (const float*) ((uintptr_t) i3 + input_increment);
+      i4 = (const float*) ((uintptr_t) i4 + input_increment);
+      i5 = (const float*) ((uintptr_t) i5 + input_increment);
+      i6 = (const float*) ((uintptr_t) i6 + input_increment);
+    }
+
+    xnn_storeu_f32(output, vacc);
+    output += xnn_simd_size_f32;
+    input += xnn_simd_size_f32;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float* i0 = input;
+    const float* i1 = (const float*) ((uintptr_t) input + 1 * input_stride);
+    const float* i2 = (const float*) ((uintptr_t) input + 2 * input_stride);
+    const float* i3 = (const float*) ((uintptr_t) input + 3 * input_stride);
+    const float* i4 = (const float*) ((uintptr_t) input + 4 * input_stride);
+    const float* i5 = (const float*) ((uintptr_t) input + 5 * input_stride);
+    const float* i6 = (const float*) ((uintptr_t) input + 6 * input_stride);
+
+    xnn_simd_f32_t vacc = xnn_load_tail_f32(output, channels);
+    for (int r = rows; r > 0; r -= 7) {
+      if XNN_UNPREDICTABLE(r < 2) {
+        i1 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 2) {
+        i2 = zero;
+      }
+      if XNN_UNPREDICTABLE(r < 4) {
+        i3 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 4) {
+        i4 = zero;
+      }
+      if XNN_UNPREDICTABLE(r < 6) {
+        i5 = zero;
+      }
+      if XNN_UNPREDICTABLE(r <= 6) {
+        i6 = zero;
+      }
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i0, channels));
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i1, channels));
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i2, channels));
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i3, channels));
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i4, channels));
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i5, channels));
+      vacc = xnn_max_f32(vacc, xnn_load_tail_f32(i6, channels));
+      i0 = (const float*) ((uintptr_t) i0 + input_increment);
+      i1 = (const float*) ((uintptr_t) i1 + input_increment);
+      i2 = (const float*) ((uintptr_t) i2 + input_increment);
+      i3 = (const float*) ((uintptr_t) i3 + input_increment);
+      i4 = (const float*) ((uintptr_t) i4 + input_increment);
+      i5 = (const float*) ((uintptr_t) i5 + input_increment);
+      i6 = (const float*) ((uintptr_t) i6 + input_increment);
+    }
+
+    xnn_store_tail_f32(output, vacc, channels);
+  }
+}
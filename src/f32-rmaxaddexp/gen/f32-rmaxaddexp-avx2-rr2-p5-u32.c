@@ -0,0 +1,168 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmaxaddexp/simd-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-avx2.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+#include "xnnpack/rmaxaddexp.h"
+
+
+// Computes exp(x) for x <= 0. Inputs below -88.0 produce a zero scale s and
+// flush to +0.0f, including -inf.
+#ifndef HAVE_XNN_EXP_NONPOSITIVE_RR2_P5_F32
+#define HAVE_XNN_EXP_NONPOSITIVE_RR2_P5_F32
+static XNN_INLINE xnn_simd_f32_t xnn_exp_nonpositive_rr2_p5_f32(xnn_simd_f32_t vx) {
+  XNN_SIMD_CONST_F32(vmin_x, -0x1.6p+6f);
+  XNN_SIMD_CONST_F32(vlog2e, 0x1.715476p+0f);
+  XNN_SIMD_CONST_F32(vmagic_bias, 0x1.8000FEp23f);
+  XNN_SIMD_CONST_F32(vminus_ln2_hi, -0x1.62E400p-1f);
+  XNN_SIMD_CONST_F32(vminus_ln2_lo, -0x1.7F7D1Cp-20f);
+  XNN_SIMD_CONST_F32(vc5, 0x1.0F9F9Cp-7f);
+  XNN_SIMD_CONST_F32(vc4, 0x1.573A1Ap-5f);
+  XNN_SIMD_CONST_F32(vc3, 0x1.555A80p-3f);
+  XNN_SIMD_CONST_F32(vc2, 0x1.FFFDC6p-2f);
+  XNN_SIMD_CONST_F32(vc1, 0x1.FFFFF6p-1f);
+
+  // Clamp x so that n := round(x / log(2)) >= -127. For n == -127 the biased
+  // exponent of s := 2**n is zero, and so is s.
+  vx = xnn_max_f32(vx, vmin_x);
+
+  // Compute reduced argument n := round(x / log(2)), and s := 2**n by shifting
+  // the biased integer n into the exponent bits.
+  xnn_simd_f32_t vn = xnn_fmadd_f32(vx, vlog2e, vmagic_bias);
+  const xnn_simd_f32_t vs = xnn_sll_f32(vn, 23);
+  vn = xnn_sub_f32(vn, vmagic_bias);
+
+  // Compute reduced argument t := x - n * log(2) with Cody-Waite range reduction.
+  xnn_simd_f32_t vt = xnn_fmadd_f32(vn, vminus_ln2_hi, vx);
+  vt = xnn_fmadd_f32(vn, vminus_ln2_lo, vt);
+
+  // Compute degree-5 polynomial approximation for exp(t) on [-log(2)/2, log(2)/2]
+  // and reconstruct f := s + (t * s) * p.
+  xnn_simd_f32_t vp = xnn_fmadd_f32(vc5, vt, vc4);
+  vp = xnn_fmadd_f32(vp, vt, vc3);
+  vp = xnn_fmadd_f32(vp, vt, vc2);
+  vp = xnn_fmadd_f32(vp, vt, vc1);
+  vt = xnn_mul_f32(vt, vs);
+  return xnn_fmadd_f32(vt, vp, vs);
+}
+#endif  // HAVE_XNN_EXP_NONPOSITIVE_RR2_P5_F32
+
+void xnn_f32_rmaxaddexp_ukernel__avx2_rr2_p5_u32(
+    size_t batch,
+    const float* input,
+    float* max,
+    float* sum,
+    const void* params)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(max != NULL);
+  assert(sum != NULL);
+  assert(xnn_simd_size_f32 == 8);
+
+  // Each lane keeps a running maximum and the sum of exp(x - max) over the
+  // elements it has seen. When the maximum grows, the sum is rescaled by
+  // exp(old_max - new_max), once per block of 32 elements.
+  XNN_SIMD_CONST_F32(vlowest, -0x1.FFFFFEp+127f);
+  xnn_simd_f32_t vmax = vlowest;
+  xnn_simd_f32_t vsum = xnn_zero_f32();
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f32(input + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f32(input + 1 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi2 = xnn_loadu_f32(input + 2 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi3 = xnn_loadu_f32(input + 3 * xnn_simd_size_f32);
+    input += 32;
+
+    xnn_simd_f32_t vblock_max0 = xnn_max_f32(vi0, vi1);
+    xnn_simd_f32_t vblock_max2 = xnn_max_f32(vi2, vi3);
+    vblock_max0 = xnn_max_f32(vblock_max0, vblock_max2);
+    const xnn_simd_f32_t vnew_max = xnn_max_f32(vmax, vblock_max0);
+    const xnn_simd_f32_t vrescale = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vmax, vnew_max));
+    vmax = vnew_max;
+
+    xnn_simd_f32_t vf0 = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi0, vmax));
+    xnn_simd_f32_t vf1 = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi1, vmax));
+    xnn_simd_f32_t vf2 = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi2, vmax));
+    xnn_simd_f32_t vf3 = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi3, vmax));
+
+    vf0 = xnn_add_f32(vf0, vf1);
+    vf2 = xnn_add_f32(vf2, vf3);
+    vf0 = xnn_add_f32(vf0, vf2);
+    vsum = xnn_fmadd_f32(vsum, vrescale, vf0);
+  }
+  for (; batch >= xnn_simd_bytes_f32; batch -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vi = xnn_loadu_f32(input);
+    input += xnn_simd_size_f32;
+
+    const xnn_simd_f32_t vnew_max = xnn_max_f32(vmax, vi);
+    const xnn_simd_f32_t vrescale = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vmax, vnew_max));
+    vmax = vnew_max;
+
+    const xnn_simd_f32_t vf = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi, vmax));
+    vsum = xnn_fmadd_f32(vsum, vrescale, vf);
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    // Pad the remaining elements with -inf, which leaves the maximum unchanged
+    // and adds exp(-inf) = 0 to the sum.
+    float vtail[8];
+    vtail[0] = -INFINITY;
+    vtail[1] = -INFINITY;
+    vtail[2] = -INFINITY;
+    vtail[3] = -INFINITY;
+    vtail[4] = -INFINITY;
+    vtail[5] = -INFINITY;
+    vtail[6] = -INFINITY;
+    vtail[7] = -INFINITY;
+    for (size_t i = 0; batch != 0; batch -= sizeof(float)) {
+      vtail[i++] = *input++;
+    }
+    const xnn_simd_f32_t vi = xnn_loadu_f32(vtail);
+
+    const xnn_simd_f32_t vnew_max = xnn_max_f32(vmax, vi);
+    const xnn_simd_f32_t vrescale = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vmax, vnew_max));
+    vmax = vnew_max;
+
+    const xnn_simd_f32_t vf = xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vi, vmax));
+    vsum = xnn_fmadd_f32(vsum, vrescale, vf);
+  }
+
+  // Reduce the lanes: find the overall maximum and rescale the sum of every
+  // lane to it before adding them up.
+  float vmax_lanes[8];
+  xnn_storeu_f32(vmax_lanes, vmax);
+  float vmax_all = vmax_lanes[0];
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[1]);
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[2]);
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[3]);
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[4]);
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[5]);
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[6]);
+  vmax_all = math_max_f32(vmax_all, vmax_lanes[7]);
+  vsum = xnn_mul_f32(vsum, xnn_exp_nonpositive_rr2_p5_f32(xnn_sub_f32(vmax, xnn_set1_f32(vmax_all))));
+
+  float vsum_lanes[8];
+  xnn_storeu_f32(vsum_lanes, vsum);
+  vsum_lanes[0] += vsum_lanes[1];
+  vsum_lanes[2] += vsum_lanes[3];
+  vsum_lanes[4] += vsum_lanes[5];
+  vsum_lanes[6] += vsum_lanes[7];
+  vsum_lanes[0] += vsum_lanes[2];
+  vsum_lanes[4] += vsum_lanes[6];
+  vsum_lanes[0] += vsum_lanes[4];
+  *max = vmax_all;
+  *sum = vsum_lanes[0];
+}
@@ -0,0 +1,108 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmsnorm/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-avx2.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/norm.h"
+
+
+void xnn_f32_rmsnorm_ukernel__avx2_u16(
+    size_t batch,
+    const float* input,
+    const float* scale,
+    float* output,
+    float epsilon) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(scale != NULL);
+  assert(output != NULL);
+  assert(xnn_simd_size_f32 == 8);
+
+  // First pass: sum of squares of the row.
+  const float* i = input;
+  size_t n = batch;
+  xnn_simd_f32_t vacc0 = xnn_zero_f32();
+  xnn_simd_f32_t vacc1 = xnn_zero_f32();
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f32(i + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f32(i + 1 * xnn_simd_size_f32);
+    i += 16;
+
+    vacc0 = xnn_fmadd_f32(vi0, vi0, vacc0);
+    vacc1 = xnn_fmadd_f32(vi1, vi1, vacc1);
+  }
+  vacc0 = xnn_add_f32(vacc0, vacc1);
+  for (; n >= xnn_simd_bytes_f32; n -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vi = xnn_loadu_f32(i);
+    i += xnn_simd_size_f32;
+
+    vacc0 = xnn_fmadd_f32(vi, vi, vacc0);
+  }
+  float vacc_lanes[8];
+  xnn_storeu_f32(vacc_lanes, vacc0);
+  vacc_lanes[0] += vacc_lanes[1];
+  vacc_lanes[2] += vacc_lanes[3];
+  vacc_lanes[4] += vacc_lanes[5];
+  vacc_lanes[6] += vacc_lanes[7];
+  vacc_lanes[0] += vacc_lanes[2];
+  vacc_lanes[4] += vacc_lanes[6];
+  vacc_lanes[0] += vacc_lanes[4];
+  float vsum_sq = vacc_lanes[0];
+  for (; n != 0; n -= sizeof(float)) {
+    const float vi = *i++;
+    vsum_sq += vi * vi;
+  }
+
+  const float vmean_sq = vsum_sq / (float) (batch / sizeof(float));
+  const xnn_simd_f32_t vmultiplier = xnn_set1_f32(1.0f / sqrtf(vmean_sq + epsilon));
+
+  // Second pass: output := input / sqrt(mean(input**2) + epsilon) * scale.
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const xnn_simd_f32_t vi0 = xnn_loadu_f32(input + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vi1 = xnn_loadu_f32(input + 1 * xnn_simd_size_f32);
+    input += 16;
+    const xnn_simd_f32_t vscale0 = xnn_loadu_f32(scale + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vscale1 = xnn_loadu_f32(scale + 1 * xnn_simd_size_f32);
+    scale += 16;
+
+    const xnn_simd_f32_t vy0 = xnn_mul_f32(xnn_mul_f32(vi0, vmultiplier), vscale0);
+    const xnn_simd_f32_t vy1 = xnn_mul_f32(xnn_mul_f32(vi1, vmultiplier), vscale1);
+
+    xnn_storeu_f32(output + 0 * xnn_simd_size_f32, vy0);
+    xnn_storeu_f32(output + 1 * xnn_simd_size_f32, vy1);
+    output += 16;
+  }
+  for (; batch >= xnn_simd_bytes_f32; batch -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vi = xnn_loadu_f32(input);
+    input += xnn_simd_size_f32;
+    const xnn_simd_f32_t vscale = xnn_loadu_f32(scale);
+    scale += xnn_simd_size_f32;
+
+    const xnn_simd_f32_t vy = xnn_mul_f32(xnn_mul_f32(vi, vmultiplier), vscale);
+
+    xnn_storeu_f32(output, vy);
+    output += xnn_simd_size_f32;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const xnn_simd_f32_t vi = xnn_load_tail_f32(input, batch >> XNN_LOG2_SIZEOF_FLOAT);
+    const xnn_simd_f32_t vscale = xnn_load_tail_f32(scale, batch >> XNN_LOG2_SIZEOF_FLOAT);
+
+    const xnn_simd_f32_t vy = xnn_mul_f32(xnn_mul_f32(vi, vmultiplier), vscale);
+
+    xnn_store_tail_f32(output, vy, batch >> XNN_LOG2_SIZEOF_FLOAT);
+  }
+}
@@ -0,0 +1,76 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rprod/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-avx.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/reduce.h"
+
+
+void xnn_f32_rprod_ukernel__avx_u32_acc4(
+    size_t batch,
+    const float* input,
+    float* output,
+    const struct xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+  assert(xnn_simd_size_f32 == 8);
+
+  XNN_SIMD_CONST_F32(vone, 1.0f);
+  xnn_simd_f32_t vacc0 = vone;
+  xnn_simd_f32_t vacc1 = vone;
+  xnn_simd_f32_t vacc2 = vone;
+  xnn_simd_f32_t vacc3 = vone;
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const xnn_simd_f32_t vt0 = xnn_loadu_f32(input + 0 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vt1 = xnn_loadu_f32(input + 1 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vt2 = xnn_loadu_f32(input + 2 * xnn_simd_size_f32);
+    const xnn_simd_f32_t vt3 = xnn_loadu_f32(input + 3 * xnn_simd_size_f32);
+    input += 32;
+
+    vacc0 = xnn_mul_f32(vacc0, vt0);
+    vacc1 = xnn_mul_f32(vacc1, vt1);
+    vacc2 = xnn_mul_f32(vacc2, vt2);
+    vacc3 = xnn_mul_f32(vacc3, vt3);
+  }
+  vacc0 = xnn_mul_f32(vacc0, vacc1);
+  vacc2 = xnn_mul_f32(vacc2, vacc3);
+  vacc0 = xnn_mul_f32(vacc0, vacc2);
+  for (; batch >= xnn_simd_bytes_f32; batch -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vt = xnn_loadu_f32(input);
+    input += xnn_simd_size_f32;
+
+    vacc0 = xnn_mul_f32(vacc0, vt);
+  }
+
+  // Multiply the lanes together, then fold in the remaining elements, which
+  // cannot be loaded as a partial vector without disturbing the product.
+  float vlanes[8];
+  xnn_storeu_f32(vlanes, vacc0);
+  float vprod = vlanes[0];
+  vprod *= vlanes[1];
+  vprod *= vlanes[2];
+  vprod *= vlanes[3];
+  vprod *= vlanes[4];
+  vprod *= vlanes[5];
+  vprod *= vlanes[6];
+  vprod *= vlanes[7];
+  for (; batch != 0; batch -= sizeof(float)) {
+    vprod *= *input++;
+  }
+  output[0] = vprod;
+}
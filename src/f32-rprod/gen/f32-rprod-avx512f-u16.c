@@ -0,0 +1,66 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rprod/simd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/simd/f32-avx512f.h"
+
+#include "xnnpack/common.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/reduce.h"
+
+
+void xnn_f32_rprod_ukernel__avx512f_u16(
+    size_t batch,
+    const float* input,
+    float* output,
+    const struct xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+  assert(xnn_simd_size_f32 == 16);
+
+  XNN_SIMD_CONST_F32(vone, 1.0f);
+  xnn_simd_f32_t vacc0 = vone;
+  for (; batch >= xnn_simd_bytes_f32; batch -= xnn_simd_bytes_f32) {
+    const xnn_simd_f32_t vt = xnn_loadu_f32(input);
+    input += xnn_simd_size_f32;
+
+    vacc0 = xnn_mul_f32(vacc0, vt);
+  }
+
+  // Multiply the lanes together, then fold in the remaining elements, which
+  // cannot be loaded as a partial vector without disturbing the product.
+  float vlanes[16];
+  xnn_storeu_f32(vlanes, vacc0);
+  float vprod = vlanes[0];
+  vprod *= vlanes[1];
+  vprod *= vlanes[2];
+  vprod *= vlanes[3];
+  vprod *= vlanes[4];
+  vprod *= vlanes[5];
+  vprod *= vlanes[6];
+  vprod *= vlanes[7];
+  vprod *= vlanes[8];
+  vprod *= vlanes[9];
+  vprod *= vlanes[10];
+  vprod *= vlanes[11];
+  vprod *= vlanes[12];
+  vprod *= vlanes[13];
+  vprod *= vlanes[14];
+  vprod *= vlanes[15];
+  for (; batch != 0; batch -= sizeof(float)) {
+    vprod *= *input++;
+  }
+  output[0] = vprod;
+}
@@ -0,0 +1,101 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spgemm/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/spmm.h"
+
+
+
+void xnn_f32_spgemm_minmax_ukernel_1x8__fma3(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  const __m256 vmin = _mm256_set1_ps(params->scalar.min);
+  const __m256 vmax = _mm256_set1_ps(params->scalar.max);
+  XNN_FORCE_REALIZATION(vmin);
+  XNN_FORCE_REALIZATION(vmax);
+
+  do {
+    __m256 vacc0x01234567 = _mm256_loadu_ps((const float*) w + 0);
+    w = (const float*) w + 8;
+
+    // Each non-zero block holds the byte offset of its input channel followed
+    // by the 8 weights of that input channel.
+    uint32_t nnz = *((const uint32_t*) w);
+    w = (const uint32_t*) w + 1;
+    for (; nnz != 0; nnz--) {
+      const size_t koffset = (size_t) *((const uint32_t*) w);
+      const __m256 va0 = _mm256_broadcast_ss((const float*) ((uintptr_t) a0 + koffset));
+
+      const __m256 vb01234567 = _mm256_loadu_ps((const float*) w + 1);
+      w = (const float*) w + 9;
+
+      vacc0x01234567 = _mm256_fmadd_ps(va0, vb01234567, vacc0x01234567);
+    }
+
+    vacc0x01234567 = _mm256_max_ps(vmin, vacc0x01234567);
+
+    vacc0x01234567 = _mm256_min_ps(vmax, vacc0x01234567);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+
+      nc -= 8;
+    } else {
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,124 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spgemm/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/spmm.h"
+
+
+static const int32_t mask_table[6] = {-1, -1, -1, 0, 0, 0};
+
+void xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  const __m256 vmin = _mm256_set1_ps(params->scalar.min);
+  const __m256 vmax = _mm256_set1_ps(params->scalar.max);
+  XNN_FORCE_REALIZATION(vmin);
+  XNN_FORCE_REALIZATION(vmax);
+
+  do {
+    __m256 vacc0x01234567 = _mm256_loadu_ps((const float*) w + 0);
+    w = (const float*) w + 8;
+
+    // Each group of 4 input channels holds 2 weights per output channel and
+    // the positions of those weights within the group. The group of inputs is
+    // replicated in both 128-bit lanes and permuted into place.
+    size_t k = kc;
+    for (; k >= 4 * sizeof(float); k -= 4 * sizeof(float)) {
+      const __m256 va0 = _mm256_broadcast_ps((const __m128*) a0);
+      a0 += 4;
+
+      const __m256 vb01234567x0 = _mm256_loadu_ps((const float*) w + 0);
+      const __m256 vb01234567x1 = _mm256_loadu_ps((const float*) w + 8);
+      const __m256i vidx01234567x0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 64)));
+      const __m256i vidx01234567x1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 72)));
+      w = (const uint8_t*) w + 80;
+
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x0), vb01234567x0, vacc0x01234567);
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x1), vb01234567x1, vacc0x01234567);
+    }
+    if XNN_UNLIKELY(k != 0) {
+      // The last group is zero-padded in the packed weights, but A is not, so
+      // only the remaining 1-3 input channels are loaded.
+      const __m128i vmask = _mm_loadu_si128((const __m128i*) ((uintptr_t) &mask_table[3] - k));
+      const __m128 va0x0123 = _mm_maskload_ps(a0, vmask);
+      const __m256 va0 = _mm256_insertf128_ps(_mm256_castps128_ps256(va0x0123), va0x0123, 1);
+      a0 = (const float*) ((uintptr_t) a0 + k);
+
+      const __m256 vb01234567x0 = _mm256_loadu_ps((const float*) w + 0);
+      const __m256 vb01234567x1 = _mm256_loadu_ps((const float*) w + 8);
+      const __m256i vidx01234567x0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 64)));
+      const __m256i vidx01234567x1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 72)));
+      w = (const uint8_t*) w + 80;
+
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x0), vb01234567x0, vacc0x01234567);
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x1), vb01234567x1, vacc0x01234567);
+    }
+
+    vacc0x01234567 = _mm256_max_ps(vmin, vacc0x01234567);
+
+    vacc0x01234567 = _mm256_min_ps(vmax, vacc0x01234567);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 8;
+    } else {
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
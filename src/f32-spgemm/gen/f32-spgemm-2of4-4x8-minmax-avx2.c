@@ -0,0 +1,211 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spgemm/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/spmm.h"
+
+
+static const int32_t mask_table[6] = {-1, -1, -1, 0, 0, 0};
+
+void xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+  const float* a1 = (const float*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const float* a2 = (const float*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const float* a3 = (const float*) ((uintptr_t) a2 + a_stride);
+  float* c3 = (float*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  const __m256 vmin = _mm256_set1_ps(params->scalar.min);
+  const __m256 vmax = _mm256_set1_ps(params->scalar.max);
+  XNN_FORCE_REALIZATION(vmin);
+  XNN_FORCE_REALIZATION(vmax);
+
+  do {
+    __m256 vacc0x01234567 = _mm256_loadu_ps((const float*) w + 0);
+    __m256 vacc1x01234567 = vacc0x01234567;
+    __m256 vacc2x01234567 = vacc0x01234567;
+    __m256 vacc3x01234567 = vacc0x01234567;
+    w = (const float*) w + 8;
+
+    // Each group of 4 input channels holds 2 weights per output channel and
+    // the positions of those weights within the group. The group of inputs is
+    // replicated in both 128-bit lanes and permuted into place.
+    size_t k = kc;
+    for (; k >= 4 * sizeof(float); k -= 4 * sizeof(float)) {
+      const __m256 va0 = _mm256_broadcast_ps((const __m128*) a0);
+      a0 += 4;
+      const __m256 va1 = _mm256_broadcast_ps((const __m128*) a1);
+      a1 += 4;
+      const __m256 va2 = _mm256_broadcast_ps((const __m128*) a2);
+      a2 += 4;
+      const __m256 va3 = _mm256_broadcast_ps((const __m128*) a3);
+      a3 += 4;
+
+      const __m256 vb01234567x0 = _mm256_loadu_ps((const float*) w + 0);
+      const __m256 vb01234567x1 = _mm256_loadu_ps((const float*) w + 8);
+      const __m256i vidx01234567x0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 64)));
+      const __m256i vidx01234567x1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 72)));
+      w = (const uint8_t*) w + 80;
+
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x0), vb01234567x0, vacc0x01234567);
+      vacc1x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va1, vidx01234567x0), vb01234567x0, vacc1x01234567);
+      vacc2x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va2, vidx01234567x0), vb01234567x0, vacc2x01234567);
+      vacc3x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va3, vidx01234567x0), vb01234567x0, vacc3x01234567);
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x1), vb01234567x1, vacc0x01234567);
+      vacc1x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va1, vidx01234567x1), vb01234567x1, vacc1x01234567);
+      vacc2x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va2, vidx01234567x1), vb01234567x1, vacc2x01234567);
+      vacc3x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va3, vidx01234567x1), vb01234567x1, vacc3x01234567);
+    }
+    if XNN_UNLIKELY(k != 0) {
+      // The last group is zero-padded in the packed weights, but A is not, so
+      // only the remaining 1-3 input channels are loaded.
+      const __m128i vmask = _mm_loadu_si128((const __m128i*) ((uintptr_t) &mask_table[3] - k));
+      const __m128 va0x0123 = _mm_maskload_ps(a0, vmask);
+      const __m256 va0 = _mm256_insertf128_ps(_mm256_castps128_ps256(va0x0123), va0x0123, 1);
+      a0 = (const float*) ((uintptr_t) a0 + k);
+      const __m128 va1x0123 = _mm_maskload_ps(a1, vmask);
+      const __m256 va1 = _mm256_insertf128_ps(_mm256_castps128_ps256(va1x0123), va1x0123, 1);
+      a1 = (const float*) ((uintptr_t) a1 + k);
+      const __m128 va2x0123 = _mm_maskload_ps(a2, vmask);
+      const __m256 va2 = _mm256_insertf128_ps(_mm256_castps128_ps256(va2x0123), va2x0123, 1);
+      a2 = (const float*) ((uintptr_t) a2 + k);
+      const __m128 va3x0123 = _mm_maskload_ps(a3, vmask);
+      const __m256 va3 = _mm256_insertf128_ps(_mm256_castps128_ps256(va3x0123), va3x0123, 1);
+      a3 = (const float*) ((uintptr_t) a3 + k);
+
+      const __m256 vb01234567x0 = _mm256_loadu_ps((const float*) w + 0);
+      const __m256 vb01234567x1 = _mm256_loadu_ps((const float*) w + 8);
+      const __m256i vidx01234567x0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 64)));
+      const __m256i vidx01234567x1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) ((const uint8_t*) w + 72)));
+      w = (const uint8_t*) w + 80;
+
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x0), vb01234567x0, vacc0x01234567);
+      vacc1x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va1, vidx01234567x0), vb01234567x0, vacc1x01234567);
+      vacc2x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va2, vidx01234567x0), vb01234567x0, vacc2x01234567);
+      vacc3x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va3, vidx01234567x0), vb01234567x0, vacc3x01234567);
+      vacc0x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va0, vidx01234567x1), vb01234567x1, vacc0x01234567);
+      vacc1x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va1, vidx01234567x1), vb01234567x1, vacc1x01234567);
+      vacc2x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va2, vidx01234567x1), vb01234567x1, vacc2x01234567);
+      vacc3x01234567 = _mm256_fmadd_ps(_mm256_permutevar_ps(va3, vidx01234567x1), vb01234567x1, vacc3x01234567);
+    }
+
+    vacc0x01234567 = _mm256_max_ps(vmin, vacc0x01234567);
+    vacc1x01234567 = _mm256_max_ps(vmin, vacc1x01234567);
+    vacc2x01234567 = _mm256_max_ps(vmin, vacc2x01234567);
+    vacc3x01234567 = _mm256_max_ps(vmin, vacc3x01234567);
+
+    vacc0x01234567 = _mm256_min_ps(vmax, vacc0x01234567);
+    vacc1x01234567 = _mm256_min_ps(vmax, vacc1x01234567);
+    vacc2x01234567 = _mm256_min_ps(vmax, vacc2x01234567);
+    vacc3x01234567 = _mm256_min_ps(vmax, vacc3x01234567);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      _mm256_storeu_ps(c1, vacc1x01234567);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      _mm256_storeu_ps(c2, vacc2x01234567);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+      _mm256_storeu_ps(c3, vacc3x01234567);
+      c3 = (float*) ((uintptr_t) c3 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+      a1 = (const float*) ((uintptr_t) a1 - kc);
+      a2 = (const float*) ((uintptr_t) a2 - kc);
+      a3 = (const float*) ((uintptr_t) a3 - kc);
+
+      nc -= 8;
+    } else {
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      __m128 vacc1x0123 = _mm256_castps256_ps128(vacc1x01234567);
+      __m128 vacc2x0123 = _mm256_castps256_ps128(vacc2x01234567);
+      __m128 vacc3x0123 = _mm256_castps256_ps128(vacc3x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+        _mm_storeu_ps(c1, vacc1x0123);
+        _mm_storeu_ps(c2, vacc2x0123);
+        _mm_storeu_ps(c3, vacc3x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+        vacc1x0123 = _mm256_extractf128_ps(vacc1x01234567, 1);
+        vacc2x0123 = _mm256_extractf128_ps(vacc2x01234567, 1);
+        vacc3x0123 = _mm256_extractf128_ps(vacc3x01234567, 1);
+
+        c0 += 4;
+        c1 += 4;
+        c2 += 4;
+        c3 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+        _mm_storel_pi((__m64*) c1, vacc1x0123);
+        _mm_storel_pi((__m64*) c2, vacc2x0123);
+        _mm_storel_pi((__m64*) c3, vacc3x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+        vacc1x0123 = _mm_movehl_ps(vacc1x0123, vacc1x0123);
+        vacc2x0123 = _mm_movehl_ps(vacc2x0123, vacc2x0123);
+        vacc3x0123 = _mm_movehl_ps(vacc3x0123, vacc3x0123);
+
+        c0 += 2;
+        c1 += 2;
+        c2 += 2;
+        c3 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+        _mm_store_ss(c1, vacc1x0123);
+        _mm_store_ss(c2, vacc2x0123);
+        _mm_store_ss(c3, vacc3x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
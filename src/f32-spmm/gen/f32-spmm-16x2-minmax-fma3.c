@@ -0,0 +1,221 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/fma3.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/spmm.h"
+
+
+static const int32_t mask_table[14] = {-1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0};
+
+void xnn_f32_spmm_minmax_ukernel_16x2__fma3(
+    size_t mc,
+    size_t nc,
+    const float* input,
+    const float* weights,
+    const int32_t* widx_dmap,
+    const uint32_t* nidx_nnzmap,
+    float* output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_set1_ps(params->scalar.min);
+  const __m256 vmax = _mm256_set1_ps(params->scalar.max);
+  XNN_FORCE_REALIZATION(vmin);
+  XNN_FORCE_REALIZATION(vmax);
+
+  while XNN_LIKELY(mc >= 16 * sizeof(float)) {
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    for (; n >= 2; n -= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc0x0 = _mm256_broadcast_ss(w + 0);
+      __m256 vacc0x1 = _mm256_broadcast_ss(w + 1);
+      w += 2;
+      __m256 vacc1x0 = vacc0x0;
+      __m256 vacc1x1 = vacc0x1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi0 = _mm256_loadu_ps(input);
+          const __m256 vi1 = _mm256_loadu_ps(input + 8);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w + 0);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+          vacc0x0 = _mm256_fmadd_ps(vi0, vw0, vacc0x0);
+          vacc1x0 = _mm256_fmadd_ps(vi1, vw0, vacc1x0);
+          vacc0x1 = _mm256_fmadd_ps(vi0, vw1, vacc0x1);
+          vacc1x1 = _mm256_fmadd_ps(vi1, vw1, vacc1x1);
+        } while (--nnz != 0);
+      }
+      __m256 vout0x0 = _mm256_min_ps(vacc0x0, vmax);
+      __m256 vout1x0 = _mm256_min_ps(vacc1x0, vmax);
+      __m256 vout0x1 = _mm256_min_ps(vacc0x1, vmax);
+      __m256 vout1x1 = _mm256_min_ps(vacc1x1, vmax);
+      vout0x0 = _mm256_max_ps(vout0x0, vmin);
+      vout1x0 = _mm256_max_ps(vout1x0, vmin);
+      vout0x1 = _mm256_max_ps(vout0x1, vmin);
+      vout1x1 = _mm256_max_ps(vout1x1, vmin);
+      _mm256_storeu_ps(output, vout0x0);
+      _mm256_storeu_ps(output + 8, vout1x0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout0x1);
+      _mm256_storeu_ps(output + 8, vout1x1);
+      output = (float*) ((uintptr_t) output + output_stride);
+    }
+    // Output channels that do not fill a block of 2 are stored one at a time.
+    while (n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc1 = vacc0;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi0 = _mm256_loadu_ps(input);
+          const __m256 vi1 = _mm256_loadu_ps(input + 8);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc0 = _mm256_fmadd_ps(vi0, vw, vacc0);
+          vacc1 = _mm256_fmadd_ps(vi1, vw, vacc1);
+        } while (--nnz != 0);
+      }
+      __m256 vout0 = _mm256_min_ps(vacc0, vmax);
+      __m256 vout1 = _mm256_min_ps(vacc1, vmax);
+      vout0 = _mm256_max_ps(vout0, vmin);
+      vout1 = _mm256_max_ps(vout1, vmin);
+      _mm256_storeu_ps(output, vout0);
+      _mm256_storeu_ps(output + 8, vout1);
+      output = (float*) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*) ((uintptr_t) output - output_stride * nc) + 16;
+    input += 16;
+    mc -= 16 * sizeof(float);
+  }
+  while (mc >= 8 * sizeof(float)) {
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    for (; n >= 2; n -= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc0x0 = _mm256_broadcast_ss(w + 0);
+      __m256 vacc0x1 = _mm256_broadcast_ss(w + 1);
+      w += 2;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi0 = _mm256_loadu_ps(input);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w + 0);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+          vacc0x0 = _mm256_fmadd_ps(vi0, vw0, vacc0x0);
+          vacc0x1 = _mm256_fmadd_ps(vi0, vw1, vacc0x1);
+        } while (--nnz != 0);
+      }
+      __m256 vout0x0 = _mm256_min_ps(vacc0x0, vmax);
+      __m256 vout0x1 = _mm256_min_ps(vacc0x1, vmax);
+      vout0x0 = _mm256_max_ps(vout0x0, vmin);
+      vout0x1 = _mm256_max_ps(vout0x1, vmin);
+      _mm256_storeu_ps(output, vout0x0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout0x1);
+      output = (float*) ((uintptr_t) output + output_stride);
+    }
+    // Output channels that do not fill a block of 2 are stored one at a time.
+    while (n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc0 = _mm256_broadcast_ss(w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi0 = _mm256_loadu_ps(input);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc0 = _mm256_fmadd_ps(vi0, vw, vacc0);
+        } while (--nnz != 0);
+      }
+      __m256 vout0 = _mm256_min_ps(vacc0, vmax);
+      vout0 = _mm256_max_ps(vout0, vmin);
+      _mm256_storeu_ps(output, vout0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*) ((uintptr_t) output - output_stride * nc) + 8;
+    input += 8;
+    mc -= 8 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    assert(mc >= 1 * sizeof(float));
+    assert(mc <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &mask_table[7] - mc));
+
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    for (; n >= 2; n -= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc0 = _mm256_broadcast_ss(w + 0);
+      __m256 vacc1 = _mm256_broadcast_ss(w + 1);
+      w += 2;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi = _mm256_maskload_ps(input, vmask);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w + 0);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+          vacc0 = _mm256_fmadd_ps(vi, vw0, vacc0);
+          vacc1 = _mm256_fmadd_ps(vi, vw1, vacc1);
+        } while (--nnz != 0);
+      }
+      __m256 vout0 = _mm256_min_ps(vacc0, vmax);
+      __m256 vout1 = _mm256_min_ps(vacc1, vmax);
+      vout0 = _mm256_max_ps(vout0, vmin);
+      vout1 = _mm256_max_ps(vout1, vmin);
+      _mm256_maskstore_ps(output, vmask, vout0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm256_maskstore_ps(output, vmask, vout1);
+      output = (float*) ((uintptr_t) output + output_stride);
+    }
+    while (n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc = _mm256_broadcast_ss(w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi = _mm256_maskload_ps(input, vmask);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc = _mm256_fmadd_ps(vi, vw, vacc);
+        } while (--nnz != 0);
+      }
+      __m256 vout = _mm256_min_ps(vacc, vmax);
+      vout = _mm256_max_ps(vout, vmin);
+      _mm256_maskstore_ps(output, vmask, vout);
+      output = (float*) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+  }
+}
@@ -0,0 +1,273 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/intrinsics-polyfill.h"
+#include "xnnpack/spmm.h"
+
+
+void xnn_f32_spmm_minmax_ukernel_32x4__avx512f(
+    size_t mc,
+    size_t nc,
+    const float* input,
+    const float* weights,
+    const int32_t* widx_dmap,
+    const uint32_t* nidx_nnzmap,
+    float* output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+  const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+  XNN_FORCE_REALIZATION(vmin);
+  XNN_FORCE_REALIZATION(vmax);
+
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    for (; n >= 4; n -= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0x0 = _mm512_set1_ps(w[0]);
+      __m512 vacc0x1 = _mm512_set1_ps(w[1]);
+      __m512 vacc0x2 = _mm512_set1_ps(w[2]);
+      __m512 vacc0x3 = _mm512_set1_ps(w[3]);
+      w += 4;
+      __m512 vacc1x0 = vacc0x0;
+      __m512 vacc1x1 = vacc0x1;
+      __m512 vacc1x2 = vacc0x2;
+      __m512 vacc1x3 = vacc0x3;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0 = _mm512_loadu_ps(input);
+          const __m512 vi1 = _mm512_loadu_ps(input + 16);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw0 = _mm512_set1_ps(w[0]);
+          const __m512 vw1 = _mm512_set1_ps(w[1]);
+          const __m512 vw2 = _mm512_set1_ps(w[2]);
+          const __m512 vw3 = _mm512_set1_ps(w[3]);
+          w += 4;
+          vacc0x0 = _mm512_fmadd_ps(vi0, vw0, vacc0x0);
+          vacc1x0 = _mm512_fmadd_ps(vi1, vw0, vacc1x0);
+          vacc0x1 = _mm512_fmadd_ps(vi0, vw1, vacc0x1);
+          vacc1x1 = _mm512_fmadd_ps(vi1, vw1, vacc1x1);
+          vacc0x2 = _mm512_fmadd_ps(vi0, vw2, vacc0x2);
+          vacc1x2 = _mm512_fmadd_ps(vi1, vw2, vacc1x2);
+          vacc0x3 = _mm512_fmadd_ps(vi0, vw3, vacc0x3);
+          vacc1x3 = _mm512_fmadd_ps(vi1, vw3, vacc1x3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0x0 = _mm512_min_ps(vacc0x0, vmax);
+      __m512 vout1x0 = _mm512_min_ps(vacc1x0, vmax);
+      __m512 vout0x1 = _mm512_min_ps(vacc0x1, vmax);
+      __m512 vout1x1 = _mm512_min_ps(vacc1x1, vmax);
+      __m512 vout0x2 = _mm512_min_ps(vacc0x2, vmax);
+      __m512 vout1x2 = _mm512_min_ps(vacc1x2, vmax);
+      __m512 vout0x3 = _mm512_min_ps(vacc0x3, vmax);
+      __m512 vout1x3 = _mm512_min_ps(vacc1x3, vmax);
+      vout0x0 = _mm512_max_ps(vout0x0, vmin);
+      vout1x0 = _mm512_max_ps(vout1x0, vmin);
+      vout0x1 = _mm512_max_ps(vout0x1, vmin);
+      vout1x1 = _mm512_max_ps(vout1x1, vmin);
+      vout0x2 = _mm512_max_ps(vout0x2, vmin);
+      vout1x2 = _mm512_max_ps(vout1x2, vmin);
+      vout0x3 = _mm512_max_ps(vout0x3, vmin);
+      vout1x3 = _mm512_max_ps(vout1x3, vmin);
+      _mm512_storeu_ps(output, vout0x0);
+      _mm512_storeu_ps(output + 16, vout1x0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0x1);
+      _mm512_storeu_ps(output + 16, vout1x1);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0x2);
+      _mm512_storeu_ps(output + 16, vout1x2);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0x3);
+      _mm512_storeu_ps(output + 16, vout1x3);
+      output = (float*) ((uintptr_t) output + output_stride);
+    }
+    // Output channels that do not fill a block of 4 are stored one at a time.
+    while (n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc1 = vacc0;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0 = _mm512_loadu_ps(input);
+          const __m512 vi1 = _mm512_loadu_ps(input + 16);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+          vacc1 = _mm512_fmadd_ps(vi1, vw, vacc1);
+        } while (--nnz != 0);
+      }
+      __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+      __m512 vout1 = _mm512_min_ps(vacc1, vmax);
+      vout0 = _mm512_max_ps(vout0, vmin);
+      vout1 = _mm512_max_ps(vout1, vmin);
+      _mm512_storeu_ps(output, vout0);
+      _mm512_storeu_ps(output + 16, vout1);
+      output = (float*) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*) ((uintptr_t) output - output_stride * nc) + 32;
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  while (mc >= 16 * sizeof(float)) {
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    for (; n >= 4; n -= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0x0 = _mm512_set1_ps(w[0]);
+      __m512 vacc0x1 = _mm512_set1_ps(w[1]);
+      __m512 vacc0x2 = _mm512_set1_ps(w[2]);
+      __m512 vacc0x3 = _mm512_set1_ps(w[3]);
+      w += 4;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0 = _mm512_loadu_ps(input);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw0 = _mm512_set1_ps(w[0]);
+          const __m512 vw1 = _mm512_set1_ps(w[1]);
+          const __m512 vw2 = _mm512_set1_ps(w[2]);
+          const __m512 vw3 = _mm512_set1_ps(w[3]);
+          w += 4;
+          vacc0x0 = _mm512_fmadd_ps(vi0, vw0, vacc0x0);
+          vacc0x1 = _mm512_fmadd_ps(vi0, vw1, vacc0x1);
+          vacc0x2 = _mm512_fmadd_ps(vi0, vw2, vacc0x2);
+          vacc0x3 = _mm512_fmadd_ps(vi0, vw3, vacc0x3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0x0 = _mm512_min_ps(vacc0x0, vmax);
+      __m512 vout0x1 = _mm512_min_ps(vacc0x1, vmax);
+      __m512 vout0x2 = _mm512_min_ps(vacc0x2, vmax);
+      __m512 vout0x3 = _mm512_min_ps(vacc0x3, vmax);
+      vout0x0 = _mm512_max_ps(vout0x0, vmin);
+      vout0x1 = _mm512_max_ps(vout0x1, vmin);
+      vout0x2 = _mm512_max_ps(vout0x2, vmin);
+      vout0x3 = _mm512_max_ps(vout0x3, vmin);
+      _mm512_storeu_ps(output, vout0x0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0x1);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0x2);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0x3);
+      output = (float*) ((uintptr_t) output + output_stride);
+    }
+    // Output channels that do not fill a block of 4 are stored one at a time.
+    while (n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0 = _mm512_loadu_ps(input);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+        } while (--nnz != 0);
+      }
+      __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+      vout0 = _mm512_max_ps(vout0, vmin);
+      _mm512_storeu_ps(output, vout0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*) ((uintptr_t) output - output_stride * nc) + 16;
+    input += 16;
+    mc -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    assert(mc >= 1 * sizeof(float));
+    assert(mc <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on mc).
+    const __mmask16 vmask = _cvtu32_mask16((uint32_t) ((UINT32_C(1) << (mc >> XNN_LOG2_SIZEOF_FLOAT)) - UINT32_C(1)));
+
+    const float* w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    for (; n >= 4; n -= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0 = _mm512_set1_ps(w[0]);
+      __m512 vacc1 = _mm512_set1_ps(w[1]);
+      __m512 vacc2 = _mm512_set1_ps(w[2]);
+      __m512 vacc3 = _mm512_set1_ps(w[3]);
+      w += 4;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi = _mm512_maskz_loadu_ps(vmask, input);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw0 = _mm512_set1_ps(w[0]);
+          const __m512 vw1 = _mm512_set1_ps(w[1]);
+          const __m512 vw2 = _mm512_set1_ps(w[2]);
+          const __m512 vw3 = _mm512_set1_ps(w[3]);
+          w += 4;
+          vacc0 = _mm512_fmadd_ps(vi, vw0, vacc0);
+          vacc1 = _mm512_fmadd_ps(vi, vw1, vacc1);
+          vacc2 = _mm512_fmadd_ps(vi, vw2, vacc2);
+          vacc3 = _mm512_fmadd_ps(vi, vw3, vacc3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+      __m512 vout1 = _mm512_min_ps(vacc1, vmax);
+      __m512 vout2 = _mm512_min_ps(vacc2, vmax);
+      __m512 vout3 = _mm512_min_ps(vacc3, vmax);
+      vout0 = _mm512_max_ps(vout0, vmin);
+      vout1 = _mm512_max_ps(vout1, vmin);
+      vout2 = _mm512_max_ps(vout2, vmin);
+      vout3 = _mm512_max_ps(vout3, vmin);
+      _mm512_mask_storeu_ps(output, vmask, vout0);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_mask_storeu_ps(output, vmask, vout1);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_mask_storeu_ps(output, vmask, vout2);
+      output = (float*) ((uintptr_t) output + output_stride);
+      _mm512_mask_storeu_ps(output, vmask, vout3);
+      output = (float*) ((uintptr_t) output + output_stride);
+    }
+    while (n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc = _mm512_set1_ps(*w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi = _mm512_maskz_loadu_ps(vmask, input);
+          input = (const float*) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc = _mm512_fmadd_ps(vi, vw, vacc);
+        } while (--nnz != 0);
+      }
+      __m512 vout = _mm512_min_ps(vacc, vmax);
+      vout = _mm512_max_ps(vout, vmin);
+      _mm512_mask_storeu_ps(output, vmask, vout);
+      output = (float*) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+  }
+}
@@ -15,7 +15,20 @@
 #define XNN_DEFINED_UKERNEL
 #endif
 
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__scalar_rr2_p5_u1, 1, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__scalar_rr2_p5_u2, 2, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__scalar_rr2_p5_u4, 4, float, struct xnn_f32_default_params, NULL)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+XNN_UKERNEL_WITH_PARAMS(xnn_arch_arm_neon, xnn_f32_vscaleexpminusmax_ukernel__neon_rr2_p5_u4, 4, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(xnn_arch_arm_neon, xnn_f32_vscaleexpminusmax_ukernel__neon_rr2_p5_u8, 8, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(xnn_arch_arm_neon, xnn_f32_vscaleexpminusmax_ukernel__neon_rr2_p5_u16, 16, float, struct xnn_f32_default_params, NULL)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__sse2_rr2_p5_u4, 4, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__sse2_rr2_p5_u8, 8, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__sse2_rr2_p5_u16, 16, float, struct xnn_f32_default_params, NULL)
 XNN_UKERNEL_WITH_PARAMS(xnn_arch_x86_avx2, xnn_f32_vscaleexpminusmax_ukernel__avx2_p5_u8, 8, float, struct xnn_f32_default_params, NULL)
 XNN_UKERNEL_WITH_PARAMS(xnn_arch_x86_avx2, xnn_f32_vscaleexpminusmax_ukernel__avx2_p5_u16, 16, float, struct xnn_f32_default_params, NULL)
 XNN_UKERNEL_WITH_PARAMS(xnn_arch_x86_avx2, xnn_f32_vscaleexpminusmax_ukernel__avx2_p5_u24, 24, float, struct xnn_f32_default_params, NULL)
@@ -29,6 +42,12 @@ XNN_UKERNEL_WITH_PARAMS(xnn_arch_x86_avx512f, xnn_f32_vscaleexpminusmax_ukernel_
 XNN_UKERNEL_WITH_PARAMS(xnn_arch_x86_avx512f, xnn_f32_vscaleexpminusmax_ukernel__avx512f_p5_scalef_u64, 64, float, struct xnn_f32_default_params, NULL)
 #endif
 
+#if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__wasmsimd_rr2_p5_u4, 4, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__wasmsimd_rr2_p5_u8, 8, float, struct xnn_f32_default_params, NULL)
+XNN_UKERNEL_WITH_PARAMS(0, xnn_f32_vscaleexpminusmax_ukernel__wasmsimd_rr2_p5_u16, 16, float, struct xnn_f32_default_params, NULL)
+#endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+
 #ifdef XNN_DEFINED_UKERNEL_WITH_PARAMS
 #undef XNN_DEFINED_UKERNEL_WITH_PARAMS
 #undef XNN_UKERNEL_WITH_PARAMS
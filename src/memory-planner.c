@@ -32,11 +32,43 @@ static inline int cmp_value_usage_tensor_size(const void* a, const void* b) {
   return (tensor_size_b > tensor_size_a) - (tensor_size_b < tensor_size_a);
 }
 
-static void populate_value_lifecycle(const struct xnn_runtime* runtime, struct xnn_usage_record* usage) {
-  assert(runtime != NULL);
-  if (runtime->num_ops == 0) {
-    return;
+static void populate_value_lifecycle_by_stage(const struct xnn_runtime* runtime, struct xnn_usage_record* usage) {
+  // Operators in the same stage may run concurrently, so lifecycles are measured in stages rather than in operators:
+  // values used by any operator of a stage must not share memory with values used by other operators of that stage.
+  for (uint32_t nid = 0; nid < runtime->num_ops; ++nid) {
+    const struct xnn_operator_data* opdata = runtime->opdata + nid;
+    for (uint32_t i = 0; i < opdata->num_inputs; ++i) {
+      if (opdata->inputs[i] != XNN_INVALID_VALUE_ID) {
+        usage[opdata->inputs[i]].first_node = UINT32_MAX;
+        usage[opdata->inputs[i]].last_node = 0;
+      }
+    }
+    for (uint32_t i = 0; i < opdata->num_outputs; ++i) {
+      if (opdata->outputs[i] != XNN_INVALID_VALUE_ID) {
+        usage[opdata->outputs[i]].first_node = UINT32_MAX;
+        usage[opdata->outputs[i]].last_node = 0;
+      }
+    }
   }
+  for (uint32_t nid = 0; nid < runtime->num_ops; ++nid) {
+    const struct xnn_operator_data* opdata = runtime->opdata + nid;
+    const uint32_t stage = runtime->op_stage[nid];
+    for (uint32_t i = 0; i < opdata->num_inputs + opdata->num_outputs; ++i) {
+      const uint32_t value_id = i < opdata->num_inputs ? opdata->inputs[i] : opdata->outputs[i - opdata->num_inputs];
+      if (value_id == XNN_INVALID_VALUE_ID) {
+        continue;  // Optimized away.
+      }
+      if (stage < usage[value_id].first_node) {
+        usage[value_id].first_node = stage;
+      }
+      if (stage > usage[value_id].last_node) {
+        usage[value_id].last_node = stage;
+      }
+    }
+  }
+}
+
+static void populate_value_lifecycle_by_node(const struct xnn_runtime* runtime, struct xnn_usage_record* usage) {
   // As we initialized first/last_node in each xnn_usage_record to 0 as in 'xnn_init_value_mem_allocation_tracker',
   // we start with the second node to tell whether first/last_node have been set or not, and check the first node last.
   for (uint32_t nid = 1; nid < runtime->num_ops; ++nid) {
@@ -73,10 +105,23 @@ static void populate_value_lifecycle(const struct xnn_runtime* runtime, struct x
     }
     usage[first_node->outputs[i]].first_node = 0;
   }
+}
+
+static void populate_value_lifecycle(const struct xnn_runtime* runtime, struct xnn_usage_record* usage) {
+  assert(runtime != NULL);
+  if (runtime->num_ops == 0) {
+    return;
+  }
+  if (runtime->op_stage != NULL) {
+    populate_value_lifecycle_by_stage(runtime, usage);
+  } else {
+    populate_value_lifecycle_by_node(runtime, usage);
+  }
   // Separate loop over all values to make sure we have usage records properly initialized with invalid reuse_value_id.
   // Some usage records are not associated with any nodes, and they will not be visited by the loops over nodes above.
   for (uint32_t i = 0; i < runtime->num_values + runtime->num_ops; i++) {
     usage[i].reuse_value_id = XNN_INVALID_VALUE_ID;
+    usage[i].reuse_offset = 0;
     usage[i].alloc_offset = SIZE_MAX;
     usage[i].opdata_id = XNN_INVALID_NODE_ID;
   }
@@ -154,6 +199,7 @@ void xnn_init_value_allocation_tracker(
 #endif
   tracker->min_value_id = XNN_INVALID_VALUE_ID;
   tracker->max_value_id = XNN_INVALID_VALUE_ID;
+  tracker->op_stage = runtime->op_stage;
 }
 
 void xnn_mark_tensor_as_reuse(struct xnn_value_allocation_tracker* tracker,
@@ -167,6 +213,33 @@ void xnn_mark_tensor_as_reuse(struct xnn_value_allocation_tracker* tracker,
   tracker->usage[reuse_value_id].last_node = new_last_node;
 }
 
+void xnn_mark_tensor_as_view(struct xnn_value_allocation_tracker* tracker,
+                             uint32_t value_id,
+                             uint32_t base_value_id,
+                             size_t offset) {
+  struct xnn_usage_record* view = &tracker->usage[value_id];
+  assert(view->reuse_value_id == XNN_INVALID_VALUE_ID);
+  // Set tensor_size to 0 so memory planner will not try to find memory for these tensors.
+  view->tensor_size = 0;
+  view->reuse_value_id = base_value_id;
+  view->reuse_offset = offset;
+  view->is_view = true;
+  tracker->usage[base_value_id].has_views = true;
+
+  // The tensor owning the memory must be live for the whole lifecycle of the view.
+  uint32_t root_id = base_value_id;
+  while (tracker->usage[root_id].reuse_value_id != XNN_INVALID_VALUE_ID) {
+    root_id = tracker->usage[root_id].reuse_value_id;
+  }
+  struct xnn_usage_record* root = &tracker->usage[root_id];
+  if (view->first_node < root->first_node) {
+    root->first_node = view->first_node;
+  }
+  if (view->last_node > root->last_node) {
+    root->last_node = view->last_node;
+  }
+}
+
 void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
                                       uint32_t value_id,
                                       size_t tensor_size) {
@@ -197,8 +270,9 @@ void xnn_add_operator_workspace_allocation_tracker(
     assert(operator_workspace_value_id > tracker->max_value_id);
   }
   tracker->max_value_id = operator_workspace_value_id;
-  tracker->usage[operator_workspace_value_id].first_node = opdata_id;
-  tracker->usage[operator_workspace_value_id].last_node = opdata_id;
+  const uint32_t node = tracker->op_stage != NULL ? tracker->op_stage[opdata_id] : opdata_id;
+  tracker->usage[operator_workspace_value_id].first_node = node;
+  tracker->usage[operator_workspace_value_id].last_node = node;
   tracker->usage[operator_workspace_value_id].opdata_id = opdata_id;
 }
 
@@ -242,15 +316,22 @@ void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
     }
   }
 
-  // Walk through all tensors that are reusing memory, and update their usage records.
+  // Walk through all tensors that are reusing memory, and update their usage records. Views can be nested (e.g. an
+  // input of a Concatenate node which is itself an input of another Concatenate node), so follow the chain of reused
+  // tensors up to the one that was actually allocated.
   for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
     struct xnn_usage_record* usage = &tracker->usage[i];
     uint32_t reuse_id = usage->reuse_value_id;
     if (reuse_id == XNN_INVALID_VALUE_ID) {
       continue;
     }
+    size_t offset = usage->reuse_offset;
+    while (tracker->usage[reuse_id].reuse_value_id != XNN_INVALID_VALUE_ID) {
+      offset += tracker->usage[reuse_id].reuse_offset;
+      reuse_id = tracker->usage[reuse_id].reuse_value_id;
+    }
     assert(tracker->usage[reuse_id].alloc_offset != SIZE_MAX);
-    usage->alloc_offset = tracker->usage[reuse_id].alloc_offset;
+    usage->alloc_offset = tracker->usage[reuse_id].alloc_offset + offset;
   }
 
   tracker->mem_arena_size = mem_arena_size;
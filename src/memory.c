@@ -27,7 +27,9 @@
 
 #include <errno.h>
 #if XNN_HAS_MMAP
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 #include <unistd.h>
 #endif  // XNN_PLATFORM_WINDOWS
@@ -37,8 +39,11 @@
 #endif
 
 #include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "xnnpack.h"
@@ -316,3 +321,75 @@ enum xnn_status xnn_finalize_weights_memory(struct xnn_weights_buffer* buffer) {
 
   return set_memory_permission(buffer->start, buffer->size, xnn_memory_permission_read_only);
 }
+
+enum xnn_status xnn_map_weights_memory_from_file(
+  struct xnn_weights_buffer* buffer, const char* path, size_t offset, size_t size, size_t extra_capacity)
+{
+  memset(buffer, 0, sizeof(struct xnn_weights_buffer));
+  const size_t page_aligned_size = round_up_po2(size, get_page_size());
+  const size_t capacity = page_aligned_size + round_up_po2(max(extra_capacity, 1), get_page_size());
+  void* start = allocate_buffer(capacity);
+  if (start == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  if (size != 0) {
+    #if XNN_HAS_MMAP && !XNN_PLATFORM_WINDOWS && !XNN_PLATFORM_QURT && !XNN_PLATFORM_WEB
+      // Map the file over the beginning of the anonymous allocation, so that the pages are shared with other processes
+      // mapping the same file, and the writable space follows the weights.
+      if (offset % get_page_size() != 0) {
+        xnn_log_error("failed to map weights file %s: offset %zu is not page aligned", path, offset);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+      const int fd = open(path, O_RDONLY);
+      if (fd == -1) {
+        xnn_log_error("failed to open weights file %s, error code: %d", path, errno);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+      // Pages of the mapping past the end of the file raise SIGBUS when accessed, so reject truncated files here.
+      struct stat file_stat;
+      if (fstat(fd, &file_stat) != 0) {
+        xnn_log_error("failed to query size of weights file %s, error code: %d", path, errno);
+        close(fd);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+      if ((uint64_t) file_stat.st_size < (uint64_t) offset + (uint64_t) size) {
+        xnn_log_error("failed to map %zu bytes at offset %zu of weights file %s: file has only %" PRIu64 " bytes",
+          size, offset, path, (uint64_t) file_stat.st_size);
+        close(fd);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+      void* p = mmap(start, page_aligned_size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, (off_t) offset);
+      close(fd);
+      if (p == MAP_FAILED) {
+        xnn_log_error("failed to map %zu bytes of weights file %s, error code: %d", size, path, errno);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+    #else
+      // Emulate through reading the file.
+      FILE* file = fopen(path, "rb");
+      if (file == NULL) {
+        xnn_log_error("failed to open weights file %s", path);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+      const bool success = fseek(file, (long) offset, SEEK_SET) == 0 && fread(start, 1, size, file) == size;
+      fclose(file);
+      if (!success) {
+        xnn_log_error("failed to read %zu bytes of weights file %s", size, path);
+        release_memory(start, capacity);
+        return xnn_status_invalid_parameter;
+      }
+    #endif
+  }
+
+  buffer->start = start;
+  buffer->size = page_aligned_size;
+  buffer->capacity = capacity;
+  return xnn_status_success;
+}
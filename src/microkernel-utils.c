@@ -30,6 +30,59 @@ size_t xnn_gemm_best_nc(size_t num_groups, size_t m, size_t n, size_t mr,
   return nc;
 }
 
+void xnn_gemm_best_tile_size(size_t num_groups, size_t m, size_t n,
+                             size_t m_stride, size_t n_stride, size_t mr,
+                             size_t nr, size_t num_threads, size_t cache_size,
+                             size_t* mc, size_t* nc) {
+  size_t best_mc = mr;
+  size_t best_nc = xnn_gemm_best_nc(num_groups, m, n, mr, nr, num_threads);
+  if (cache_size != 0) {
+    const size_t panel_size = cache_size / 2;
+
+    // Shrink `nc` until the weights of a tile fit in the cache, keeping the
+    // tiles in a row balanced.
+    if (n_stride != 0 && best_nc * n_stride > panel_size) {
+      const size_t max_nc = max(nr, panel_size / n_stride / nr * nr);
+      const size_t num_tile_cols = divide_round_up(n, max_nc);
+      best_nc = min(n, round_up(divide_round_up(n, num_tile_cols), nr));
+    }
+
+    // Grow `mc` while the rows of A of a tile fit in the cache and there are
+    // enough tiles for all threads, keeping the tiles in a column balanced.
+    if (m_stride != 0) {
+      size_t max_mc = max(mr, panel_size / m_stride / mr * mr);
+      if (num_threads > 1) {
+        const size_t min_num_tiles = num_threads * XNN_GEMM_TILES_PER_THREAD;
+        const size_t num_tile_cols = num_groups * divide_round_up(n, best_nc);
+        const size_t min_num_tile_rows = divide_round_up(min_num_tiles, num_tile_cols);
+        max_mc = min(max_mc, max(mr, m / min_num_tile_rows / mr * mr));
+      }
+      const size_t num_tile_rows = divide_round_up(m, min(max_mc, round_up(m, mr)));
+      best_mc = round_up(divide_round_up(m, num_tile_rows), mr);
+    }
+  }
+
+  *mc = best_mc;
+  *nc = best_nc;
+}
+
+size_t xnn_gemm_best_k_splits(size_t m, size_t n, size_t k, size_t mr,
+                              size_t nr, size_t num_threads) {
+  if (num_threads <= 1) {
+    return 1;
+  }
+  const size_t min_num_tiles = num_threads * XNN_GEMM_TILES_PER_THREAD;
+  const size_t num_tiles = divide_round_up(m, mr) * divide_round_up(n, nr);
+  if (num_tiles >= min_num_tiles) {
+    return 1;
+  }
+
+  size_t k_splits = divide_round_up(min_num_tiles, num_tiles);
+  k_splits = min(k_splits, k / XNN_GEMM_MIN_K_SPLIT_SIZE);
+  k_splits = min(k_splits, k / (XNN_GEMM_K_SPLIT_MIN_RATIO * round_up(m, mr)));
+  return k_splits < 2 ? 1 : k_splits;
+}
+
 static size_t dwconv_num_middle_pass(
   size_t kernel_size,
   size_t first_pass_tile,
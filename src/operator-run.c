@@ -8,6 +8,7 @@
 
 #include <assert.h>
 #include <limits.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -24,6 +25,7 @@
 #include "xnnpack/microparams.h"
 #include "xnnpack/microparams-init.h"
 #include "xnnpack/operator-type.h"
+#include "xnnpack/operator-utils.h"
 #include "xnnpack/operator.h"
 #include "xnnpack/packq.h"
 #include "xnnpack/quantization.h"
@@ -337,6 +339,28 @@ void xnn_compute_batched_packw_gemm_gio(
       packed_weights, /*extra_bytes=*/0, /*params=*/NULL);
 }
 
+void xnn_compute_batched_packw_gemm_gio_tiled(
+    const struct packw_gemm_gio_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t tile_index,
+    size_t n_block_start,
+    size_t n_block_size)
+{
+  assert(context->bias == NULL);
+  const size_t k_start = tile_index * context->kc_tile;
+  const size_t kc = min(context->kc - k_start, context->kc_tile);
+  const void* kernel = (const void*) ((uintptr_t) context->kernel + n_block_start * context->n_stride +
+                                      batch_index * context->gk_stride +
+                                      k_start * context->k_stride_elements * context->n_stride);
+  void* packed_weights = (void*) ((uintptr_t) context->packed_weights + n_block_start * context->w_stride +
+                                  batch_index * context->gc_stride + tile_index * context->gc_tile_stride);
+
+  context->packw_gemm_gio(
+      /*groups=*/1, n_block_size, kc, context->nr, context->kr,
+      context->sr, context->k_stride_elements, kernel, /*bias=*/NULL, /*scale=*/NULL,
+      packed_weights, /*extra_bytes=*/0, /*params=*/NULL);
+}
+
 void xnn_compute_packw_gemm_goi(
     const struct packw_gemm_goi_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t n_block_start,
@@ -464,18 +488,182 @@ void xnn_compute_gemm(
 {
   const size_t a_stride  = context->a_stride;
   const size_t cm_stride = context->cm_stride;
+  const size_t mr = context->mr;
 
-  context->ukernel.function[XNN_UARCH_DEFAULT](
-      mr_block_size,
-      nr_block_size,
-      context->k_scaled,
-      (const void*) ((uintptr_t) context->a + mr_block_start * a_stride),
-      a_stride,
-      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+  // Tiles may span several blocks of `mr` rows, which reuse the same weights, see xnn_gemm_best_tile_size.
+  while (mr_block_size != 0) {
+    const size_t mr_step = min(mr_block_size, mr);
+    context->ukernel.function[XNN_UARCH_DEFAULT](
+        mr_step,
+        nr_block_size,
+        context->k_scaled,
+        (const void*) ((uintptr_t) context->a + mr_block_start * a_stride),
+        a_stride,
+        (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+        (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+        cm_stride,
+        context->cn_stride,
+        context->fused_params);
+    mr_block_start += mr_step;
+    mr_block_size -= mr_step;
+  }
+}
+
+// Applies the fused epilogue to a [mr_block_size x nr_block_size] FP32 tile of C in place.
+static void apply_gemm_epilogue(
+    const struct xnn_gemm_epilogue* epilogue,
+    void* c,
+    size_t cm_stride,
+    const void* residual,
+    size_t mr_block_size,
+    size_t nr_block_start,
+    size_t nr_block_size)
+{
+  const size_t row_bytes = nr_block_size * sizeof(float);
+  const void* scale = epilogue->scale != NULL ?
+    (const void*) ((uintptr_t) epilogue->scale + nr_block_start * sizeof(float)) : NULL;
+  for (size_t m = 0; m < mr_block_size; m++) {
+    if (epilogue->vmul != NULL) {
+      epilogue->vmul(row_bytes, c, scale, c, &epilogue->binary_params);
+    }
+    if (epilogue->vadd != NULL) {
+      epilogue->vadd(row_bytes, c, residual, c, &epilogue->binary_params);
+      residual = (const void*) ((uintptr_t) residual + epilogue->residual_stride);
+    }
+    if (epilogue->activation != NULL) {
+      epilogue->activation(row_bytes, c, c, &epilogue->activation_params);
+    }
+    if (epilogue->clamp != NULL) {
+      epilogue->clamp(row_bytes, c, c, &epilogue->clamp_params);
+    }
+    c = (void*) ((uintptr_t) c + cm_stride);
+  }
+}
+
+void xnn_compute_gemm_with_epilogue(
+    const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  xnn_compute_gemm(context, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
+
+  const struct xnn_gemm_epilogue* epilogue = context->epilogue;
+  const size_t cm_stride = context->cm_stride;
+  apply_gemm_epilogue(
+      epilogue,
       (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
       cm_stride,
-      context->cn_stride,
-      context->fused_params);
+      (const void*) ((uintptr_t) epilogue->residual + mr_block_start * epilogue->residual_stride +
+                     (nr_block_start << context->log2_csize)),
+      mr_block_size, nr_block_start, nr_block_size);
+}
+
+// Returns the partial accumulator tile of slice `slice_index` for the [mr x nr] block at (mr_block_start, nr_start).
+static void* get_gemm_k_split_tile(
+    const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t slice_index,
+    size_t mr_block_start,
+    size_t nr_start)
+{
+  const size_t mr = context->mr;
+  const size_t nr = context->k_split.nr;
+  return (void*) ((uintptr_t) context->k_split.buffer + slice_index * context->k_split.slice_stride +
+                  (mr_block_start / mr) * context->k_split.tile_row_stride + (nr_start / nr) * (mr * nr * sizeof(float)));
+}
+
+void xnn_compute_gemm_k_split(
+    const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t slice_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t a_stride = context->a_stride;
+  const size_t nr = context->k_split.nr;
+  const size_t kc_scaled = context->k_split.kc_scaled;
+  const size_t tile_cm_stride = nr * sizeof(float);
+  const void* a = (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + slice_index * kc_scaled);
+
+  for (size_t nr_start = nr_block_start; nr_start < nr_block_start + nr_block_size; nr_start += nr) {
+    const size_t nc = min(nr, nr_block_start + nr_block_size - nr_start);
+    const void* w = (const void*) ((uintptr_t) context->packed_w + nr_start * context->w_stride);
+    void* tile = get_gemm_k_split_tile(context, slice_index, mr_block_start, nr_start);
+    if (slice_index == 0) {
+      // The first slice starts from the bias in the packed weights.
+      context->ukernel.function[XNN_UARCH_DEFAULT](
+          mr_block_size, nc, kc_scaled, a, a_stride, w, tile, tile_cm_stride, tile_cm_stride,
+          &context->k_split.unclamped_params);
+    } else {
+      // Skip the bias and the rows of the packed weights consumed by the previous slices.
+      w = (const void*) ((uintptr_t) w + (1 + slice_index * kc_scaled / sizeof(float)) * nr * sizeof(float));
+      context->k_split.ukernel(
+          mr_block_size, nc, kc_scaled, a, a_stride, w, tile, tile_cm_stride, tile_cm_stride,
+          context->k_split.zero, &context->k_split.unclamped_params);
+    }
+  }
+}
+
+void xnn_compute_gemm_k_split_reduce(
+    const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t a_stride = context->a_stride;
+  const size_t cm_stride = context->cm_stride;
+  const size_t nr = context->k_split.nr;
+  const size_t last_slice = context->k_split.num_slices - 1;
+  const size_t kc_scaled = context->k_split.kc_scaled;
+  const size_t last_kc_scaled = context->k_scaled - last_slice * kc_scaled;
+  const size_t tile_bytes = mr_block_size * nr * sizeof(float);
+  const void* a = (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + last_slice * kc_scaled);
+
+  for (size_t nr_start = nr_block_start; nr_start < nr_block_start + nr_block_size; nr_start += nr) {
+    const size_t nc = min(nr, nr_block_start + nr_block_size - nr_start);
+    void* acc = get_gemm_k_split_tile(context, 0, mr_block_start, nr_start);
+    for (size_t slice_index = 1; slice_index < last_slice; slice_index++) {
+      context->k_split.vadd(
+          tile_bytes, acc, get_gemm_k_split_tile(context, slice_index, mr_block_start, nr_start), acc,
+          &context->k_split.vadd_params);
+    }
+
+    // The last slice accumulates on top of the sum of all other slices, and writes the clamped output.
+    const void* w = (const void*) ((uintptr_t) context->packed_w + nr_start * context->w_stride +
+                                   (1 + last_slice * kc_scaled / sizeof(float)) * nr * sizeof(float));
+    void* c = (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_start << context->log2_csize));
+    context->k_split.ukernel(
+        mr_block_size, nc, last_kc_scaled, a, a_stride, w, c, cm_stride, context->cn_stride, acc,
+        context->fused_params);
+
+    if (context->epilogue != NULL) {
+      const struct xnn_gemm_epilogue* epilogue = context->epilogue;
+      apply_gemm_epilogue(
+          epilogue, c, cm_stride,
+          (const void*) ((uintptr_t) epilogue->residual + mr_block_start * epilogue->residual_stride +
+                         (nr_start << context->log2_csize)),
+          mr_block_size, nr_start, nc);
+    }
+  }
+}
+
+void xnn_compute_gemm_multi_output(
+    const struct gemm_multi_output_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  size_t i = context->num_gemms - 1;
+  while (nr_block_start < context->n_offset[i]) {
+    i--;
+  }
+  nr_block_start -= context->n_offset[i];
+  nr_block_size = min(nr_block_size, context->n[i] - nr_block_start);
+  context->task((void*) context->gemm[i], mr_block_start, nr_block_start, mr_block_size, nr_block_size);
 }
 
 void xnn_compute_dqgemm(
@@ -487,19 +675,26 @@ void xnn_compute_dqgemm(
 {
   const size_t a_stride  = context->a_stride;
   const size_t cm_stride = context->cm_stride;
+  const size_t mr = context->mr;
 
-  context->dq_ukernel.function[XNN_UARCH_DEFAULT](
-      mr_block_size,
-      nr_block_size,
-      context->k_scaled,
-      (const void*) ((uintptr_t) context->a + mr_block_start * a_stride),
-      a_stride,
-      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
-      (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
-      cm_stride,
-      context->cn_stride,
-      context->fused_params,
-      (const void*) ((uintptr_t) &context->quantization_params[mr_block_start]));
+  // Tiles may span several blocks of `mr` rows, which reuse the same weights, see xnn_gemm_best_tile_size.
+  while (mr_block_size != 0) {
+    const size_t mr_step = min(mr_block_size, mr);
+    context->dq_ukernel.function[XNN_UARCH_DEFAULT](
+        mr_step,
+        nr_block_size,
+        context->k_scaled,
+        (const void*) ((uintptr_t) context->a + mr_block_start * a_stride),
+        a_stride,
+        (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+        (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+        cm_stride,
+        context->cn_stride,
+        context->fused_params,
+        (const void*) ((uintptr_t) &context->quantization_params[mr_block_start]));
+    mr_block_start += mr_step;
+    mr_block_size -= mr_step;
+  }
 }
 
 void xnn_compute_hmp_qp8gemm(
@@ -547,6 +742,29 @@ void xnn_compute_spmm(
       &context->params);
 }
 
+void xnn_compute_spgemm(
+    const struct spgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t a_stride  = context->a_stride;
+  const size_t cm_stride = context->cm_stride;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      context->k_scaled,
+      (const void*) ((uintptr_t) context->a + mr_block_start * a_stride),
+      a_stride,
+      (const void*) ((uintptr_t) context->packed_w + context->tile_offsets[nr_block_start / context->nr]),
+      (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + nr_block_start * sizeof(float)),
+      cm_stride,
+      context->cn_stride,
+      &context->params);
+}
+
 void xnn_compute_grouped_batch_igemm(
     const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -697,6 +915,28 @@ void xnn_compute_batch_igemm(
       &context->params);
 }
 
+void xnn_compute_batch_igemm_with_epilogue(
+    const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  xnn_compute_batch_igemm(context, batch_index, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
+
+  const struct xnn_gemm_epilogue* epilogue = context->epilogue;
+  const size_t cm_stride = context->cm_stride;
+  apply_gemm_epilogue(
+      epilogue,
+      (void*) ((uintptr_t) context->c + batch_index * context->bc_stride + mr_block_start * cm_stride +
+               (nr_block_start << context->log2_csize)),
+      cm_stride,
+      (const void*) ((uintptr_t) epilogue->residual + batch_index * epilogue->residual_batch_stride +
+                     mr_block_start * epilogue->residual_stride + (nr_block_start << context->log2_csize)),
+      mr_block_size, nr_block_start, nr_block_size);
+}
+
 void xnn_compute_batch_dqigemm(
     const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -750,6 +990,26 @@ void xnn_compute_igemm(
       &context->params);
 }
 
+void xnn_compute_igemm_with_epilogue(
+    const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  xnn_compute_igemm(context, mr_block_start, nr_block_start, mr_block_size, nr_block_size);
+
+  const struct xnn_gemm_epilogue* epilogue = context->epilogue;
+  const size_t cm_stride = context->cm_stride;
+  apply_gemm_epilogue(
+      epilogue,
+      (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+      cm_stride,
+      (const void*) ((uintptr_t) epilogue->residual + mr_block_start * epilogue->residual_stride +
+                     (nr_block_start << context->log2_csize)),
+      mr_block_size, nr_block_start, nr_block_size);
+}
+
 void xnn_compute_dqigemm(
     const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t mr_block_start,
@@ -1509,6 +1769,69 @@ void xnn_compute_pad_5d(
   }
 }
 
+// Returns the number of key/value tokens that the query token attends to.
+static inline size_t scaled_dot_product_attention_visible_tokens(
+  const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+  size_t query_token)
+{
+  if (!context->causal) {
+    return context->key_value_tokens;
+  }
+  return min(context->key_value_tokens, query_token + context->causal_offset + 1);
+}
+
+// P = Softmax(S) for rows of logits with a stride of key_value_tokens. Logits masked by the causal mask are excluded
+// from the softmax and their probabilities are set to zero.
+static inline void compute_scaled_dot_product_attention_softmax(
+  const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+  void* logits,
+  size_t tokens_start,
+  size_t tokens_block_size)
+{
+  const size_t key_value_tokens_scaled = context->key_value_tokens_scaled;
+  void* logits_row = logits;
+  for (size_t i = 0; i < tokens_block_size; i++) {
+    const size_t visible_tokens_scaled =
+      scaled_dot_product_attention_visible_tokens(context, tokens_start + i) * context->element_size;
+
+    // Skip initialization of locals as they will be written to immediately.
+    float rowmax;
+    context->rmax_ukernel(
+      /*batch=*/visible_tokens_scaled,
+      /*input=*/logits_row,
+      /*output=*/&rowmax,
+      /*params=*/&context->rmax_params);
+
+    float rowsum;
+    context->raddstoreexpminusmax_ukernel(
+      /*batch=*/visible_tokens_scaled,
+      /*input=*/logits_row,
+      /*max=*/&rowmax,
+      /*output=*/logits_row,
+      /*sum=*/&rowsum,
+      /*params=*/&context->expminus_params);
+
+    float rowscale;
+    context->compute_reciprocal(
+      /*input=*/&rowsum,
+      /*output=*/&rowscale);
+
+    context->vmulc_ukernel(
+      /*batch=*/visible_tokens_scaled,
+      /*input_x=*/logits_row,
+      /*input_y=*/&rowscale,
+      /*output=*/logits_row,
+      /*params=*/&context->minmax_params);
+
+    if (visible_tokens_scaled != key_value_tokens_scaled) {
+      memset((void*) ((uintptr_t) logits_row + visible_tokens_scaled), 0,
+             key_value_tokens_scaled - visible_tokens_scaled);
+    }
+
+    logits_row = (void*) ((uintptr_t) logits_row + key_value_tokens_scaled);
+  }
+}
+
 void xnn_compute_scaled_dot_product_attention(
   const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
   size_t batch_index,
@@ -1551,11 +1874,12 @@ void xnn_compute_scaled_dot_product_attention(
   {
     void* key = (void*) ((uintptr_t) context->key +
                          batch_index * context->key_batch_stride +
-                         head_index * context->key_head_stride);
-    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens].
+                         (head_index / context->query_heads_per_key_value_head) * context->key_head_stride);
+    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens], but with the causal mask, logits after
+    // the last key/value token visible to the last query token of the block are not computed.
     context->gemm_ukernel.function[XNN_UARCH_DEFAULT](
       /*mr=*/tokens_block_size,
-      /*nr=*/context->key_value_tokens,
+      /*nr=*/scaled_dot_product_attention_visible_tokens(context, tokens_start + tokens_block_size - 1),
       /*k=*/query_key_scaled_channels,
       /*a=*/scaled_query,
       /*a_stride=*/query_key_scaled_channels,
@@ -1590,58 +1914,25 @@ void xnn_compute_scaled_dot_product_attention(
         /*params=*/minmax_params);
     }
 
-    // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
-    // Mask. Overwrites buffer.
-    context->vadd_ukernel(
-      /*batch=*/tokens_block_size_scaled,
-      /*input_x=*/logits,
-      /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
-      /*output=*/logits,
-      /*params=*/minmax_params);
+    if (context->mask != NULL) {
+      // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
+      // Mask. Overwrites buffer.
+      context->vadd_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input_x=*/logits,
+        /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
+        /*output=*/logits,
+        /*params=*/minmax_params);
+    }
   }
 
   // P = Softmax(S). P has dimensions [tokens_block_size, key_value_tokens].
-  {
-    void* logits_row = logits;
-    size_t i = tokens_block_size;
-    do {
-      // Skip initialization of locals as they will be written to immediately.
-      float rowmax;
-      context->rmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*output=*/&rowmax,
-        /*params=*/&context->rmax_params);
-
-      float rowsum;
-      context->raddstoreexpminusmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*max=*/&rowmax,
-        /*output=*/logits_row,
-        /*sum=*/&rowsum,
-        /*params=*/&context->expminus_params);
-
-      float rowscale;
-      context->compute_reciprocal(
-        /*input=*/&rowsum,
-        /*output=*/&rowscale);
-
-      context->vmulc_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input_x=*/logits_row,
-        /*input_y=*/&rowscale,
-        /*output=*/logits_row,
-        /*params=*/minmax_params);
-
-      logits_row = (void*) ((uintptr_t) logits_row + key_value_tokens_scaled);
-    } while (--i != 0);
-  }
+  compute_scaled_dot_product_attention_softmax(context, logits, tokens_start, tokens_block_size);
 
   {
     void* value = (void*) ((uintptr_t) context->value +
                            batch_index * context->value_batch_stride +
-                           head_index * context->value_head_stride);
+                           (head_index / context->query_heads_per_key_value_head) * context->value_head_stride);
     const size_t output_tile_offset =
       batch_index * context->output_batch_stride + head_index * context->output_head_stride +
       tokens_start * context->value_scaled_channels;
@@ -1701,11 +1992,12 @@ void xnn_compute_scaled_dot_product_attention_with_thread(
   {
     void* key = (void*) ((uintptr_t) context->key +
                          batch_index * context->key_batch_stride +
-                         head_index * context->key_head_stride);
-    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens].
+                         (head_index / context->query_heads_per_key_value_head) * context->key_head_stride);
+    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens], but with the causal mask, logits after
+    // the last key/value token visible to the last query token of the block are not computed.
     context->gemm_ukernel.function[XNN_UARCH_DEFAULT](
       /*mr=*/tokens_block_size,
-      /*nr=*/context->key_value_tokens,
+      /*nr=*/scaled_dot_product_attention_visible_tokens(context, tokens_start + tokens_block_size - 1),
       /*k=*/query_key_scaled_channels,
       /*a=*/scaled_query,
       /*a_stride=*/query_key_scaled_channels,
@@ -1740,58 +2032,25 @@ void xnn_compute_scaled_dot_product_attention_with_thread(
         /*params=*/minmax_params);
     }
 
-    // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
-    // Mask. Overwrites buffer.
-    context->vadd_ukernel(
-      /*batch=*/tokens_block_size_scaled,
-      /*input_x=*/logits,
-      /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
-      /*output=*/logits,
-      /*params=*/minmax_params);
+    if (context->mask != NULL) {
+      // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
+      // Mask. Overwrites buffer.
+      context->vadd_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input_x=*/logits,
+        /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
+        /*output=*/logits,
+        /*params=*/minmax_params);
+    }
   }
 
   // P = Softmax(S). P has dimensions [tokens_block_size, key_value_tokens].
-  {
-    void* logits_row = logits;
-    size_t i = tokens_block_size;
-    do {
-      // Skip initialization of locals as they will be written to immediately.
-      float rowmax;
-      context->rmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*output=*/&rowmax,
-        /*params=*/&context->rmax_params);
-
-      float rowsum;
-      context->raddstoreexpminusmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*max=*/&rowmax,
-        /*output=*/logits_row,
-        /*sum=*/&rowsum,
-        /*params=*/&context->expminus_params);
-
-      float rowscale;
-      context->compute_reciprocal(
-        /*input=*/&rowsum,
-        /*output=*/&rowscale);
-
-      context->vmulc_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input_x=*/logits_row,
-        /*input_y=*/&rowscale,
-        /*output=*/logits_row,
-        /*params=*/minmax_params);
-
-      logits_row = (void*) ((uintptr_t) logits_row + key_value_tokens_scaled);
-    } while (--i != 0);
-  }
+  compute_scaled_dot_product_attention_softmax(context, logits, tokens_start, tokens_block_size);
 
   {
     void* value = (void*) ((uintptr_t) context->value +
                            batch_index * context->value_batch_stride +
-                           head_index * context->value_head_stride);
+                           (head_index / context->query_heads_per_key_value_head) * context->value_head_stride);
     const size_t output_tile_offset =
       batch_index * context->output_batch_stride + head_index * context->output_head_stride +
       tokens_start * context->value_scaled_channels;
@@ -1810,29 +2069,257 @@ void xnn_compute_scaled_dot_product_attention_with_thread(
   }
 }
 
-void xnn_compute_slice_1d(
-    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
-    size_t i)
-{
-  const void* input = (const void*) ((uintptr_t) context->input + i * context->input_stride[0]);
-  void* output = (void*) ((uintptr_t) context->output + i * context->output_stride[0]);
-
-  context->ukernel(context->contiguous_size, input, output, NULL);
-}
-
-void xnn_compute_slice_2d(
-    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
-    size_t i, size_t j)
+static inline void compute_tiled_scaled_dot_product_attention(
+  const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+  uint32_t uarch_index,
+  size_t thread_index,
+  size_t batch_index,
+  size_t head_index,
+  size_t tokens_start,
+  size_t tokens_block_size)
 {
-  const void* input =
-      (const void*) ((uintptr_t) context->input +
-                     i * context->input_stride[1] +
-                     j * context->input_stride[0]);
-  void* output =
-      (void*) ((uintptr_t) context->output + i * context->output_stride[1] + j * context->output_stride[0]);
+  const size_t query_key_scaled_channels = context->query_key_scaled_channels;
+  const size_t query_tile_offset =
+    batch_index * context->query_batch_stride + head_index * context->query_head_stride +
+    tokens_start * query_key_scaled_channels;
+  const size_t key_value_tokens = context->key_value_tokens;
+  const size_t key_value_tokens_scaled = context->key_value_tokens_scaled;
+  const size_t value_scaled_channels = context->value_scaled_channels;
+  const size_t element_size = context->element_size;
+  const size_t cn_stride = context->cn_stride;
+  const void* scaled_query =
+    (void*) ((uintptr_t) context->scaled_query + thread_index * context->scaled_query_thread_stride);
+  const void* minmax_params = &context->minmax_params;
 
-  context->ukernel(context->contiguous_size, input, output, NULL);
-}
+  {
+    uintptr_t query = (uintptr_t) context->query + query_tile_offset;
+    uintptr_t query_scaled_current = (uintptr_t) scaled_query;
+    // Q_scaled = Q * Scale (along channels). Q and Q_scaled have dimensions [tokens_block_size, query_key_channels].
+    size_t i = tokens_block_size;
+    do {
+      context->vmul_ukernel(
+        /*batch=*/query_key_scaled_channels,
+        /*input_x=*/(const void*) query,
+        /*input_y=*/context->scale,
+        /*output=*/(void*) query_scaled_current,
+        /*params=*/minmax_params);
+      query += query_key_scaled_channels;
+      query_scaled_current += query_key_scaled_channels;
+    } while (--i != 0);
+  }
+
+  // Per-thread buffers for logits of a block of key/value tokens, accumulated output, output of a block of key/value
+  // tokens, and the running maximum, sum, and rescale factor of each row.
+  void* const logits = (void*) ((uintptr_t) context->logits_buffer + thread_index * context->logits_thread_stride);
+  void* const accumulator = (void*) ((uintptr_t) logits + context->accumulator_offset);
+  void* const block_output = (void*) ((uintptr_t) logits + context->block_output_offset);
+  void* const row_max = (void*) ((uintptr_t) logits + context->row_max_offset);
+  void* const row_sum = (void*) ((uintptr_t) logits + context->row_sum_offset);
+  void* const row_rescale = (void*) ((uintptr_t) logits + context->row_rescale_offset);
+  for (size_t i = 0; i < tokens_block_size; i++) {
+    memcpy((void*) ((uintptr_t) row_max + i * element_size), &context->lowest, element_size);
+  }
+  memset(row_sum, 0, tokens_block_size * element_size);
+
+  // Key/value heads are shared by groups of consecutive query heads.
+  const size_t key_value_head_index = head_index / context->query_heads_per_key_value_head;
+  const void* key = (const void*) ((uintptr_t) context->key +
+                                   batch_index * context->key_batch_stride +
+                                   key_value_head_index * context->key_head_stride);
+  const void* value = (const void*) ((uintptr_t) context->value +
+                                     batch_index * context->value_batch_stride +
+                                     key_value_head_index * context->value_head_stride);
+  const void* mask = context->mask == NULL ? NULL :
+    (const void*) ((uintptr_t) context->mask + tokens_start * key_value_tokens_scaled);
+
+  // With the causal mask, blocks of key/value tokens after the last token visible to the last query token are
+  // skipped.
+  const size_t visible_tokens =
+    scaled_dot_product_attention_visible_tokens(context, tokens_start + tokens_block_size - 1);
+  assert(visible_tokens <= key_value_tokens);
+  for (size_t block_start = 0; block_start < visible_tokens; block_start += context->key_value_tokens_tile) {
+    const size_t block_size = min(key_value_tokens - block_start, context->key_value_tokens_tile);
+    const size_t block_size_scaled = block_size * element_size;
+    const size_t tokens_block_size_scaled = tokens_block_size * block_size_scaled;
+
+    // S = GEMM(Q_scaled, K^t) for this block of key/value tokens. S is [tokens_block_size, block_size], but logits
+    // masked for all query tokens are not computed.
+    context->gemm_ukernel.function[uarch_index](
+      /*mr=*/tokens_block_size,
+      /*nr=*/min(block_size, visible_tokens - block_start),
+      /*k=*/query_key_scaled_channels,
+      /*a=*/scaled_query,
+      /*a_stride=*/query_key_scaled_channels,
+      /*w=*/key,
+      /*c=*/logits,
+      /*cm_stride=*/block_size_scaled,
+      /*cn_stride=*/cn_stride,
+      /*params=*/minmax_params);
+
+    struct attention_logits_cap logits_cap = context->logits_cap;
+    if (logits_cap.type == xnn_attention_logits_cap_type_tanh) {
+      // (Optional) S = TanH(S/Cap) * Cap. Overwrites buffer.
+      context->vmulc_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input_x=*/logits,
+        /*input_y=*/&logits_cap.cap_reciprocal,
+        /*output=*/logits,
+        /*params=*/minmax_params);
+      context->vtanh_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input=*/logits,
+        /*output=*/logits,
+        /*params=*/&context->tanh_params);
+      context->vmulc_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input_x=*/logits,
+        /*input_y=*/&logits_cap.cap,
+        /*output=*/logits,
+        /*params=*/minmax_params);
+    }
+
+    for (size_t i = 0; i < tokens_block_size; i++) {
+      void* logits_row = (void*) ((uintptr_t) logits + i * block_size_scaled);
+      void* row_max_i = (void*) ((uintptr_t) row_max + i * element_size);
+      void* row_rescale_i = (void*) ((uintptr_t) row_rescale + i * element_size);
+      void* row_sum_i = (void*) ((uintptr_t) row_sum + i * element_size);
+
+      const size_t row_visible_tokens = scaled_dot_product_attention_visible_tokens(context, tokens_start + i);
+      if (row_visible_tokens <= block_start) {
+        // The whole block is masked for this row: P = 0, and the running maximum and sum are unchanged.
+        memset(logits_row, 0, block_size_scaled);
+        context->update_max(&context->lowest, row_max_i, row_rescale_i);
+        float block_sum;
+        memset(&block_sum, 0, sizeof(block_sum));
+        context->update_sum(&block_sum, row_rescale_i, row_sum_i);
+        continue;
+      }
+      const size_t row_block_size_scaled = min(block_size, row_visible_tokens - block_start) * element_size;
+
+      if (mask != NULL) {
+        // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
+        context->vadd_ukernel(
+          /*batch=*/row_block_size_scaled,
+          /*input_x=*/logits_row,
+          /*input_y=*/(const void*) ((uintptr_t) mask + i * key_value_tokens_scaled + block_start * element_size),
+          /*output=*/logits_row,
+          /*params=*/minmax_params);
+      }
+
+      // Skip initialization of locals as they will be written to immediately.
+      float block_max;
+      context->rmax_ukernel(
+        /*batch=*/row_block_size_scaled,
+        /*input=*/logits_row,
+        /*output=*/&block_max,
+        /*params=*/&context->rmax_params);
+      context->update_max(&block_max, row_max_i, row_rescale_i);
+
+      // P = Exp(S - Max), where Max is the running maximum of the row.
+      float block_sum;
+      context->raddstoreexpminusmax_ukernel(
+        /*batch=*/row_block_size_scaled,
+        /*input=*/logits_row,
+        /*max=*/row_max_i,
+        /*output=*/logits_row,
+        /*sum=*/&block_sum,
+        /*params=*/&context->expminus_params);
+      context->update_sum(&block_sum, row_rescale_i, row_sum_i);
+      if (row_block_size_scaled != block_size_scaled) {
+        // P = 0 for the masked logits of this row.
+        memset((void*) ((uintptr_t) logits_row + row_block_size_scaled), 0, block_size_scaled - row_block_size_scaled);
+      }
+    }
+
+    // O = O * Rescale + GEMM(P, V) for this block of key/value tokens. O has dimension [tokens_block_size,
+    // value_channels].
+    context->gemm_ukernel.function[uarch_index](
+        /*mr=*/tokens_block_size,
+        /*nc=*/context->value_channels,
+        /*kc=*/block_size_scaled,
+        /*a=*/logits,
+        /*a_stride=*/block_size_scaled,
+        /*w=*/value,
+        /*c=*/block_start == 0 ? accumulator : block_output,
+        /*cm_stride=*/value_scaled_channels,
+        /*cn_stride=*/cn_stride,
+        /*params=*/minmax_params);
+    if (block_start != 0) {
+      for (size_t i = 0; i < tokens_block_size; i++) {
+        void* accumulator_row = (void*) ((uintptr_t) accumulator + i * value_scaled_channels);
+        context->vmulc_ukernel(
+          /*batch=*/value_scaled_channels,
+          /*input_x=*/accumulator_row,
+          /*input_y=*/(const void*) ((uintptr_t) row_rescale + i * element_size),
+          /*output=*/accumulator_row,
+          /*params=*/minmax_params);
+      }
+      context->vadd_ukernel(
+        /*batch=*/tokens_block_size * value_scaled_channels,
+        /*input_x=*/accumulator,
+        /*input_y=*/block_output,
+        /*output=*/accumulator,
+        /*params=*/minmax_params);
+    }
+
+    key = (const void*) ((uintptr_t) key + context->key_tile_stride);
+    value = (const void*) ((uintptr_t) value + context->value_tile_stride);
+  }
+
+  // O = O / Sum.
+  void* output = (void*) ((uintptr_t) context->output +
+                          batch_index * context->output_batch_stride + head_index * context->output_head_stride +
+                          tokens_start * value_scaled_channels);
+  for (size_t i = 0; i < tokens_block_size; i++) {
+    float rowscale;
+    context->compute_reciprocal(
+      /*input=*/(const void*) ((uintptr_t) row_sum + i * element_size),
+      /*output=*/&rowscale);
+    context->vmulc_ukernel(
+      /*batch=*/value_scaled_channels,
+      /*input_x=*/(const void*) ((uintptr_t) accumulator + i * value_scaled_channels),
+      /*input_y=*/&rowscale,
+      /*output=*/output,
+      /*params=*/minmax_params);
+    output = (void*) ((uintptr_t) output + value_scaled_channels);
+  }
+}
+
+void xnn_compute_tiled_scaled_dot_product_attention_with_thread(
+  const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+  size_t thread_index,
+  size_t batch_index,
+  size_t head_index,
+  size_t tokens_start,
+  size_t tokens_block_size)
+{
+  compute_tiled_scaled_dot_product_attention(
+    context, XNN_UARCH_DEFAULT, thread_index, batch_index, head_index, tokens_start, tokens_block_size);
+}
+
+void xnn_compute_slice_1d(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i)
+{
+  const void* input = (const void*) ((uintptr_t) context->input + i * context->input_stride[0]);
+  void* output = (void*) ((uintptr_t) context->output + i * context->output_stride[0]);
+
+  context->ukernel(context->contiguous_size, input, output, NULL);
+}
+
+void xnn_compute_slice_2d(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j)
+{
+  const void* input =
+      (const void*) ((uintptr_t) context->input +
+                     i * context->input_stride[1] +
+                     j * context->input_stride[0]);
+  void* output =
+      (void*) ((uintptr_t) context->output + i * context->output_stride[1] + j * context->output_stride[0]);
+
+  context->ukernel(context->contiguous_size, input, output, NULL);
+}
 
 void xnn_compute_slice_3d(
     const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
@@ -2028,6 +2515,272 @@ void xnn_compute_univector_contiguous(
   context->ukernel(size, x, y, &context->params);
 }
 
+// Applies all steps of the chain to the block of `block_size` bytes at `offset` in the inputs, and writes the result to
+// `y`. Intermediate results stay in `buffer`.
+static void apply_elementwise_chain_block(
+    const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t offset,
+    size_t block_size,
+    float* buffer,
+    void* y)
+{
+  const size_t num_steps = context->num_steps;
+  const void* x = (const void*) ((uintptr_t) context->inputs[0] + offset);
+  for (size_t i = 0; i < num_steps; i++) {
+    const struct elementwise_chain_step* step = &context->steps[i];
+    void* step_output = i + 1 == num_steps ? y : buffer;
+    if (step->unary_ukernel != NULL) {
+      step->unary_ukernel(block_size, x, step_output, &step->params.unary);
+    } else if (step->input_is_scalar) {
+      step->binary_ukernel(block_size, x, context->inputs[step->input_index], step_output, &step->params.binary);
+    } else {
+      const void* input = (const void*) ((uintptr_t) context->inputs[step->input_index] + offset);
+      if (step->input_is_first) {
+        step->binary_ukernel(block_size, input, x, step_output, &step->params.binary);
+      } else {
+        step->binary_ukernel(block_size, x, input, step_output, &step->params.binary);
+      }
+    }
+    x = step_output;
+  }
+}
+
+void xnn_compute_elementwise_chain(
+    const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t offset,
+    size_t size)
+{
+  // Intermediate results stay in this buffer, only the last operation of the chain writes to the output. Microkernels
+  // may read up to XNN_EXTRA_BYTES past the end of the block.
+  XNN_ALIGN(64) float buffer[(XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE + XNN_EXTRA_BYTES) / sizeof(float)];
+  while (size != 0) {
+    const size_t block_size = min(size, XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE);
+    apply_elementwise_chain_block(context, offset, block_size, buffer, (void*) ((uintptr_t) context->output + offset));
+    offset += block_size;
+    size -= block_size;
+  }
+}
+
+typedef struct xnn_qd8_quantization_params(f32_quantization_params_fn)(float min, float max, float* f32_scale);
+
+static void compute_elementwise_chain_qx8(
+    const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+    f32_quantization_params_fn quantization_params_function,
+    size_t thread_index,
+    size_t batch_index)
+{
+  XNN_ALIGN(64) float buffer[(XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE + XNN_EXTRA_BYTES) / sizeof(float)];
+  const size_t row_size = context->row_size;
+  float* row = (float*) ((uintptr_t) context->row_buffer + thread_index * context->row_buffer_stride);
+  float row_min = INFINITY;
+  float row_max = -INFINITY;
+  for (size_t k = 0; k < row_size; k += XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE) {
+    const size_t block_size = min(row_size - k, XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE);
+    void* y = (void*) ((uintptr_t) row + k);
+    apply_elementwise_chain_block(context, batch_index * row_size + k, block_size, buffer, y);
+    float minmax[2];
+    context->rminmax_ukernel(block_size, y, minmax, &context->rminmax_params);
+    row_min = math_min_f32(row_min, minmax[0]);
+    row_max = math_max_f32(row_max, minmax[1]);
+  }
+
+  float scale;
+  context->quantization_params[batch_index] = quantization_params_function(row_min, row_max, &scale);
+  struct xnn_f32_qs8_cvt_params params;
+  params.scalar.scale = scale;
+  params.scalar.output_zero_point = context->quantization_params[batch_index].zero_point;
+  void* output = (void*) ((uintptr_t) context->output + batch_index * (row_size / sizeof(float)));
+  context->convert_ukernel(row_size, row, output, (union xnn_unary_uparams*) &params);
+
+  if (batch_index + 1 == context->batch_size) {
+    // GEMM microkernels may read the quantization parameters of up to XNN_EXTRA_QUANTIZATION_PARAMS rows past the end.
+    for (size_t i = 0; i < XNN_EXTRA_QUANTIZATION_PARAMS; i++) {
+      context->quantization_params[batch_index + 1 + i] = context->quantization_params[batch_index];
+    }
+  }
+}
+
+void xnn_compute_elementwise_chain_qd8(
+    const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t thread_index,
+    size_t batch_index)
+{
+  compute_elementwise_chain_qx8(context, xnn_f32_qd8_asymmetric_quantization_params, thread_index, batch_index);
+}
+
+void xnn_compute_elementwise_chain_qdu8(
+    const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t thread_index,
+    size_t batch_index)
+{
+  compute_elementwise_chain_qx8(context, xnn_f32_qdu8_asymmetric_quantization_params, thread_index, batch_index);
+}
+
+// Reads a half- or single-precision reduction element as a float.
+static float load_reduce_element(const void* element, size_t element_size)
+{
+  if (element_size == sizeof(xnn_float16)) {
+    return xnn_float16_to_float(*((const xnn_float16*) element));
+  }
+  return *((const float*) element);
+}
+
+// Fills `count` reduction elements with the identity of the reduction.
+static void fill_reduce_identity(void* output, size_t count, size_t element_size, uint32_t identity)
+{
+  if (element_size == sizeof(uint16_t)) {
+    uint16_t* o = (uint16_t*) output;
+    for (size_t i = 0; i < count; i++) {
+      o[i] = (uint16_t) identity;
+    }
+  } else {
+    assert(element_size == sizeof(uint32_t));
+    uint32_t* o = (uint32_t*) output;
+    for (size_t i = 0; i < count; i++) {
+      o[i] = identity;
+    }
+  }
+}
+
+// Max, min and prod microkernels overwrite their output rather than
+// accumulating into it. Every partial result after the first is combined with
+// the running result by reducing the pair of them with the same microkernel.
+static void compute_contiguous_reduce_in_place(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t input_offset,
+    void* output,
+    size_t output2_block_size)
+{
+  const size_t* input_stride = context->input_stride;
+  const size_t element_size = context->accumulation_element_size;
+  const size_t input_shape1 = context->input_shape[1];
+  const size_t input_shape3 = context->input_shape[3];
+  XNN_ALIGN(XNN_ALLOCATION_ALIGNMENT) uint32_t pair[2 + XNN_EXTRA_BYTES / sizeof(uint32_t)];
+  void* partial = (void*) ((uintptr_t) pair + element_size);
+
+  for (size_t i = 0; i < input_shape1; ++i) {
+    for (size_t j = 0; j < input_shape3; ++j) {
+      const void* input_row = (const void*) ((uintptr_t) context->input + input_offset +
+                                             i * input_stride[1] + j * input_stride[3]);
+      void* o = output;
+      for (size_t k = 0; k < output2_block_size; ++k) {
+        if (i == 0 && j == 0) {
+          context->ukernel.rsum(context->channels, input_row, o, &context->params);
+        } else {
+          context->ukernel.rsum(context->channels, input_row, partial, &context->params);
+          memcpy(pair, o, element_size);
+          context->ukernel.rsum(2 * element_size, pair, o, &context->params);
+        }
+        input_row = (const void*) ((uintptr_t) input_row + input_stride[4]);
+        o = (void*) ((uintptr_t) o + element_size);
+      }
+    }
+  }
+}
+
+// Finds the maximum of every reduced row with the max microkernel, then scans
+// the row holding the overall maximum for its first occurrence. Indices are
+// flattened in row-major order over the reduced dimensions 1, 3 and 5.
+static void compute_contiguous_argmax(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t input_offset,
+    int32_t* output,
+    size_t output2_block_size)
+{
+  const size_t* input_stride = context->input_stride;
+  const size_t element_size = context->accumulation_element_size;
+  const size_t input_shape1 = context->input_shape[1];
+  const size_t input_shape3 = context->input_shape[3];
+  const size_t input_shape5 = context->input_shape[5];
+
+  for (size_t k = 0; k < output2_block_size; ++k) {
+    const uintptr_t input = (uintptr_t) context->input + input_offset + k * input_stride[4];
+    uint32_t max_bits = 0;
+    float max_value = 0.0f;
+    size_t max_row = 0;
+    for (size_t i = 0; i < input_shape1; ++i) {
+      for (size_t j = 0; j < input_shape3; ++j) {
+        const void* input_row = (const void*) (input + i * input_stride[1] + j * input_stride[3]);
+        uint32_t row_max = 0;
+        context->ukernel.rsum(context->channels, input_row, &row_max, &context->params);
+        const float row_max_value = load_reduce_element(&row_max, element_size);
+        // Ties keep the earlier row.
+        if ((i == 0 && j == 0) || row_max_value > max_value) {
+          max_bits = row_max;
+          max_value = row_max_value;
+          max_row = i * input_shape3 + j;
+        }
+      }
+    }
+
+    const size_t i = max_row / input_shape3;
+    const size_t j = max_row % input_shape3;
+    const void* input_row = (const void*) (input + i * input_stride[1] + j * input_stride[3]);
+    size_t m = 0;
+    for (; m < input_shape5; ++m) {
+      if (memcmp((const void*) ((uintptr_t) input_row + m * element_size), &max_bits, element_size) == 0) {
+        break;
+      }
+    }
+    output[k] = (int32_t) (max_row * input_shape5 + (m < input_shape5 ? m : 0));
+  }
+}
+
+// Reduces tiles of channels to their maxima with the max microkernel, then
+// scans the reduced rows in order for the first occurrence of each maximum.
+// Indices are flattened in row-major order over the reduced dimensions 0, 2
+// and 4.
+static void compute_discontiguous_argmax(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t input_offset,
+    int32_t* output,
+    size_t output2_block_size)
+{
+  enum { tile_size = 64 };
+  const size_t* input_stride = context->input_stride;
+  const size_t element_size = context->accumulation_element_size;
+  const size_t input_shape0 = context->input_shape[0];
+  const size_t input_shape2 = context->input_shape[2];
+  const size_t input_shape4 = context->input_shape[4];
+  XNN_ALIGN(XNN_ALLOCATION_ALIGNMENT) uint32_t max[tile_size + XNN_EXTRA_BYTES / sizeof(uint32_t)];
+  bool found[tile_size];
+
+  for (size_t c0 = 0; c0 < output2_block_size; c0 += tile_size) {
+    const size_t tile = min(output2_block_size - c0, tile_size);
+    const uintptr_t input = (uintptr_t) context->input + input_offset + c0 * element_size;
+    fill_reduce_identity(max, tile, element_size, context->identity);
+    for (size_t i = 0; i < input_shape0; ++i) {
+      for (size_t j = 0; j < input_shape2; ++j) {
+        context->ukernel.rdsum(
+            input_shape4, tile, (const void*) (input + i * input_stride[0] + j * input_stride[2]),
+            input_stride[4], context->zero, max, &context->params);
+      }
+    }
+
+    for (size_t c = 0; c < tile; ++c) {
+      output[c0 + c] = 0;
+      found[c] = false;
+    }
+    size_t remaining = tile;
+    for (size_t i = 0; i < input_shape0 && remaining != 0; ++i) {
+      for (size_t j = 0; j < input_shape2 && remaining != 0; ++j) {
+        for (size_t r = 0; r < input_shape4 && remaining != 0; ++r) {
+          const uintptr_t input_row = input + i * input_stride[0] + j * input_stride[2] + r * input_stride[4];
+          for (size_t c = 0; c < tile; ++c) {
+            if (!found[c] &&
+                memcmp((const void*) (input_row + c * element_size),
+                       (const void*) ((uintptr_t) max + c * element_size), element_size) == 0) {
+              found[c] = true;
+              output[c0 + c] = (int32_t) ((i * input_shape2 + j) * input_shape4 + r);
+              remaining -= 1;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_compute_contiguous_reduce(
     const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t output_idx0,
@@ -2051,6 +2804,22 @@ void xnn_compute_contiguous_reduce(
   int input_shape1 = context->input_shape[1];
   int input_shape3 = context->input_shape[3];
 
+  switch (context->reduce_operator) {
+    case xnn_reduce_argmax:
+      compute_contiguous_argmax(
+          context, input_offset, (int32_t*) ((uintptr_t) context->output + output_offset), output2_block_size);
+      return;
+    case xnn_reduce_max:
+    case xnn_reduce_min:
+    case xnn_reduce_prod:
+      assert(context->workspace == NULL);
+      compute_contiguous_reduce_in_place(
+          context, input_offset, (void*) ((uintptr_t) context->output + output_offset), output2_block_size);
+      return;
+    default:
+      break;
+  }
+
   void* output_ptr = NULL;
   if (context->workspace) {
     output_ptr = context->workspace;
@@ -2139,6 +2908,12 @@ void xnn_compute_discontiguous_reduce(
   int input_shape0 = context->input_shape[0];
   int input_shape2 = context->input_shape[2];
 
+  if (context->reduce_operator == xnn_reduce_argmax) {
+    compute_discontiguous_argmax(
+        context, input_offset, (int32_t*) ((uintptr_t) context->output + output_offset), output2_block_size);
+    return;
+  }
+
   void* output_ptr = NULL;
   if (context->workspace) {
     output_ptr = context->workspace;
@@ -2146,8 +2921,13 @@ void xnn_compute_discontiguous_reduce(
     output_ptr = context->output;
   }
   void* output = (void*) ((uintptr_t) output_ptr + workspace_offset);
-  // RDsum microkernels accumulate into the output buffer.
-  memset(output, 0, context->accumulation_element_size * output2_block_size);
+  // RDsum microkernels accumulate into the output buffer, and the max, min and
+  // prod microkernels update it in place, so start from the identity.
+  if (context->identity != 0) {
+    fill_reduce_identity(output, output2_block_size, context->accumulation_element_size, context->identity);
+  } else {
+    memset(output, 0, context->accumulation_element_size * output2_block_size);
+  }
 
   // Input dimension 0 is reduced.
   for (size_t i = 0; i < input_shape0; ++i) {
@@ -2212,7 +2992,6 @@ void xnn_compute_pad_qd8_params(
 }
 
 typedef struct xnn_qd8_quantization_params(f16_quantization_params_fn)(xnn_float16 min, xnn_float16 max, xnn_float16* f32_scale);
-typedef struct xnn_qd8_quantization_params(f32_quantization_params_fn)(float min, float max, float* f32_scale);
 
 void xnn_compute_f16_qx8_convert(
     const struct f16_qd8_convert_context context[restrict XNN_MIN_ELEMENTS(1)],
@@ -2286,6 +3065,117 @@ void xnn_compute_f32_qdu8_convert(
   return xnn_compute_f32_qx8_convert(context, xnn_f32_qdu8_asymmetric_quantization_params, batch_index);
 }
 
+static void normalize_row(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    void* output)
+{
+  const void* input = (const void*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  if (context->layernorm_ukernel != NULL) {
+    context->layernorm_ukernel(context->n, input, context->scale, context->bias, output, context->epsilon);
+  } else {
+    context->rmsnorm_ukernel(context->n, input, context->scale, output, context->epsilon);
+  }
+}
+
+void xnn_compute_norm(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  normalize_row(context, batch_index, (void*) ((uintptr_t) context->y + context->y_stride * batch_index));
+}
+
+// Pads the quantization parameters after the last row, GEMM microkernels may read up to XNN_EXTRA_QUANTIZATION_PARAMS
+// rows past the end.
+static void pad_norm_quantization_params(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  if (batch_index + 1 == context->batch_size) {
+    for (size_t i = 0; i < XNN_EXTRA_QUANTIZATION_PARAMS; i++) {
+      context->quantization_params[batch_index + 1 + i] = context->quantization_params[batch_index];
+    }
+  }
+}
+
+static void compute_f16_norm_qx8(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    f16_quantization_params_fn quantization_params_function,
+    size_t thread_index,
+    size_t batch_index)
+{
+  void* row = (void*) ((uintptr_t) context->row_buffer + thread_index * context->row_buffer_stride);
+  normalize_row(context, batch_index, row);
+
+  const size_t n = context->n;
+  xnn_float16 minmax[2];
+  context->rminmax_ukernel(n, row, minmax, &context->rminmax_params.f16_default);
+  xnn_float16 f16_scale;
+  context->quantization_params[batch_index] = quantization_params_function(minmax[0], minmax[1], &f16_scale);
+
+  struct xnn_f16_qs8_cvt_params params;
+  params.scalar.scale = f16_scale;
+  params.scalar.output_zero_point = context->quantization_params[batch_index].zero_point;
+  void* output = (void*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->convert_ukernel(n, row, output, (union xnn_unary_uparams*) &params);
+  pad_norm_quantization_params(context, batch_index);
+}
+
+void xnn_compute_f16_norm_qd8(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t thread_index,
+    size_t batch_index)
+{
+  compute_f16_norm_qx8(context, xnn_f16_qd8_asymmetric_quantization_params, thread_index, batch_index);
+}
+
+void xnn_compute_f16_norm_qdu8(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t thread_index,
+    size_t batch_index)
+{
+  compute_f16_norm_qx8(context, xnn_f16_qdu8_asymmetric_quantization_params, thread_index, batch_index);
+}
+
+static void compute_f32_norm_qx8(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    f32_quantization_params_fn quantization_params_function,
+    size_t thread_index,
+    size_t batch_index)
+{
+  void* row = (void*) ((uintptr_t) context->row_buffer + thread_index * context->row_buffer_stride);
+  normalize_row(context, batch_index, row);
+
+  const size_t n = context->n;
+  float minmax[2];
+  context->rminmax_ukernel(n, row, minmax, &context->rminmax_params.f32_default);
+  float scale;
+  context->quantization_params[batch_index] = quantization_params_function(minmax[0], minmax[1], &scale);
+
+  struct xnn_f32_qs8_cvt_params params;
+  params.scalar.scale = scale;
+  params.scalar.output_zero_point = context->quantization_params[batch_index].zero_point;
+  void* output = (void*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->convert_ukernel(n, row, output, (union xnn_unary_uparams*) &params);
+  pad_norm_quantization_params(context, batch_index);
+}
+
+void xnn_compute_f32_norm_qd8(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t thread_index,
+    size_t batch_index)
+{
+  compute_f32_norm_qx8(context, xnn_f32_qd8_asymmetric_quantization_params, thread_index, batch_index);
+}
+
+void xnn_compute_f32_norm_qdu8(
+    const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t thread_index,
+    size_t batch_index)
+{
+  compute_f32_norm_qx8(context, xnn_f32_qdu8_asymmetric_quantization_params, thread_index, batch_index);
+}
+
 void xnn_compute_x32_pack_lh(
     const struct x32_pack_lh_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t m_idx_start, size_t tile) {
@@ -2337,6 +3227,17 @@ void xnn_compute_floating_point_softmax(
   void* y = (void*) ((uintptr_t) context->y + context->y_stride * batch_index);
   const size_t n = context->n;
 
+  if (context->rmaxaddexp_ukernel != NULL) {
+    // First pass: reduce-max and reduce-add exp(x-x_max) with online rescaling
+    float x_max;
+    float y_sum;
+    context->rmaxaddexp_ukernel(n, x, &x_max, &y_sum, /*params=*/NULL);
+
+    // Second pass: store exp(x-x_max) / y_sum
+    context->vscaleexpminusmax_ukernel(n, x, y, 1.0f / y_sum, x_max);
+    return;
+  }
+
   // First pass: reduce-max
   union {
     float as_float;
@@ -2709,11 +3610,12 @@ void xnn_compute_hmp_scaled_dot_product_attention(
   {
     void* key = (void*) ((uintptr_t) context->key +
                          batch_index * context->key_batch_stride +
-                         head_index * context->key_head_stride);
-    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens].
+                         (head_index / context->query_heads_per_key_value_head) * context->key_head_stride);
+    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens], but with the causal mask, logits after
+    // the last key/value token visible to the last query token of the block are not computed.
     context->gemm_ukernel.function[uarch_index](
       /*mr=*/tokens_block_size,
-      /*nr=*/context->key_value_tokens,
+      /*nr=*/scaled_dot_product_attention_visible_tokens(context, tokens_start + tokens_block_size - 1),
       /*k=*/query_key_scaled_channels,
       /*a=*/scaled_query,
       /*a_stride=*/query_key_scaled_channels,
@@ -2748,58 +3650,25 @@ void xnn_compute_hmp_scaled_dot_product_attention(
         /*params=*/minmax_params);
     }
 
-    // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
-    // Mask. Overwrites buffer.
-    context->vadd_ukernel(
-      /*batch=*/tokens_block_size_scaled,
-      /*input_x=*/logits,
-      /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
-      /*output=*/logits,
-      /*params=*/minmax_params);
+    if (context->mask != NULL) {
+      // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
+      // Mask. Overwrites buffer.
+      context->vadd_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input_x=*/logits,
+        /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
+        /*output=*/logits,
+        /*params=*/minmax_params);
+    }
   }
 
   // P = Softmax(S). P has dimensions [tokens_block_size, key_value_tokens].
-  {
-    void* logits_row = logits;
-    size_t i = tokens_block_size;
-    do {
-      // Skip initialization of locals as they will be written to immediately.
-      float rowmax;
-      context->rmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*output=*/&rowmax,
-        /*params=*/&context->rmax_params);
-
-      float rowsum;
-      context->raddstoreexpminusmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*max=*/&rowmax,
-        /*output=*/logits_row,
-        /*sum=*/&rowsum,
-        /*params=*/&context->expminus_params);
-
-      float rowscale;
-      context->compute_reciprocal(
-        /*input=*/&rowsum,
-        /*output=*/&rowscale);
-
-      context->vmulc_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input_x=*/logits_row,
-        /*input_y=*/&rowscale,
-        /*output=*/logits_row,
-        /*params=*/minmax_params);
-
-      logits_row = (void*) ((uintptr_t) logits_row + key_value_tokens_scaled);
-    } while (--i != 0);
-  }
+  compute_scaled_dot_product_attention_softmax(context, logits, tokens_start, tokens_block_size);
 
   {
     void* value = (void*) ((uintptr_t) context->value +
                            batch_index * context->value_batch_stride +
-                           head_index * context->value_head_stride);
+                           (head_index / context->query_heads_per_key_value_head) * context->value_head_stride);
     const size_t output_tile_offset =
       batch_index * context->output_batch_stride + head_index * context->output_head_stride +
       tokens_start * context->value_scaled_channels;
@@ -2860,11 +3729,12 @@ void xnn_compute_hmp_scaled_dot_product_attention_with_thread(
   {
     void* key = (void*) ((uintptr_t) context->key +
                          batch_index * context->key_batch_stride +
-                         head_index * context->key_head_stride);
-    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens].
+                         (head_index / context->query_heads_per_key_value_head) * context->key_head_stride);
+    // S = GEMM(Q_scaled, K^t). S is [tokens_block_size, key_value_tokens], but with the causal mask, logits after
+    // the last key/value token visible to the last query token of the block are not computed.
     context->gemm_ukernel.function[uarch_index](
       /*mr=*/tokens_block_size,
-      /*nr=*/context->key_value_tokens,
+      /*nr=*/scaled_dot_product_attention_visible_tokens(context, tokens_start + tokens_block_size - 1),
       /*k=*/query_key_scaled_channels,
       /*a=*/scaled_query,
       /*a_stride=*/query_key_scaled_channels,
@@ -2899,58 +3769,25 @@ void xnn_compute_hmp_scaled_dot_product_attention_with_thread(
         /*params=*/minmax_params);
     }
 
-    // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
-    // Mask. Overwrites buffer.
-    context->vadd_ukernel(
-      /*batch=*/tokens_block_size_scaled,
-      /*input_x=*/logits,
-      /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
-      /*output=*/logits,
-      /*params=*/minmax_params);
+    if (context->mask != NULL) {
+      // S = S + Mask. Mask has dimensions [query_tokens, key_value_tokens].
+      // Mask. Overwrites buffer.
+      context->vadd_ukernel(
+        /*batch=*/tokens_block_size_scaled,
+        /*input_x=*/logits,
+        /*input_y=*/(void*) ((uintptr_t) context->mask + key_value_tokens_start_scaled),
+        /*output=*/logits,
+        /*params=*/minmax_params);
+    }
   }
 
   // P = Softmax(S). P has dimensions [tokens_block_size, key_value_tokens].
-  {
-    void* logits_row = logits;
-    size_t i = tokens_block_size;
-    do {
-      // Skip initialization of locals as they will be written to immediately.
-      float rowmax;
-      context->rmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*output=*/&rowmax,
-        /*params=*/&context->rmax_params);
-
-      float rowsum;
-      context->raddstoreexpminusmax_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input=*/logits_row,
-        /*max=*/&rowmax,
-        /*output=*/logits_row,
-        /*sum=*/&rowsum,
-        /*params=*/&context->expminus_params);
-
-      float rowscale;
-      context->compute_reciprocal(
-        /*input=*/&rowsum,
-        /*output=*/&rowscale);
-
-      context->vmulc_ukernel(
-        /*batch=*/key_value_tokens_scaled,
-        /*input_x=*/logits_row,
-        /*input_y=*/&rowscale,
-        /*output=*/logits_row,
-        /*params=*/minmax_params);
-
-      logits_row = (void*) ((uintptr_t) logits_row + key_value_tokens_scaled);
-    } while (--i != 0);
-  }
+  compute_scaled_dot_product_attention_softmax(context, logits, tokens_start, tokens_block_size);
 
   {
     void* value = (void*) ((uintptr_t) context->value +
                            batch_index * context->value_batch_stride +
-                           head_index * context->value_head_stride);
+                           (head_index / context->query_heads_per_key_value_head) * context->value_head_stride);
     const size_t output_tile_offset =
       batch_index * context->output_batch_stride + head_index * context->output_head_stride +
       tokens_start * context->value_scaled_channels;
@@ -2968,6 +3805,19 @@ void xnn_compute_hmp_scaled_dot_product_attention_with_thread(
         /*params=*/minmax_params);
   }
 }
+
+void xnn_compute_hmp_tiled_scaled_dot_product_attention_with_thread(
+  const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+  uint32_t uarch_index,
+  size_t thread_index,
+  size_t batch_index,
+  size_t head_index,
+  size_t tokens_start,
+  size_t tokens_block_size)
+{
+  compute_tiled_scaled_dot_product_attention(
+    context, uarch_index, thread_index, batch_index, head_index, tokens_start, tokens_block_size);
+}
 #endif  // XNN_MAX_UARCH_TYPES > 1
 
 enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
@@ -2975,11 +3825,10 @@ enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
   return xnn_run_operator_with_index(op, 0, 0, threadpool);
 }
 
-enum xnn_status xnn_run_operator_with_index(
+static enum xnn_status check_operator_run_state(
   xnn_operator_t op,
   size_t opdata_index,
-  size_t operator_object_index,
-  pthreadpool_t threadpool)
+  size_t operator_object_index)
 {
   switch (op->state) {
     case xnn_run_state_invalid:
@@ -3003,6 +3852,19 @@ enum xnn_status xnn_run_operator_with_index(
         operator_object_index, xnn_operator_type_to_string(op->type), xnn_microkernel_type_to_string(op->ukernel.type));
       return xnn_status_invalid_state;
   }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_run_operator_with_index(
+  xnn_operator_t op,
+  size_t opdata_index,
+  size_t operator_object_index,
+  pthreadpool_t threadpool)
+{
+  const enum xnn_status status = check_operator_run_state(op, opdata_index, operator_object_index);
+  if (status != xnn_status_success || op->state == xnn_run_state_skip) {
+    return status;
+  }
 
   uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
   if (op->flags & XNN_FLAG_YIELD_WORKERS) {
@@ -3307,3 +4169,235 @@ enum xnn_status xnn_run_operator_with_index(
   }
   return xnn_status_success;
 }
+
+struct profiled_compute_context {
+  const struct compute_parameters* compute;
+  void* context;
+  size_t num_dims;
+  size_t tile[6];
+  size_t num_tiles[6];
+  uint64_t* thread_busy_ns;
+};
+
+// Runs a single tile of a compute invocation, which has been flattened to a 1D range of tiles, and accounts the time it
+// took to the thread running it.
+static void compute_profiled_tile(
+    const struct profiled_compute_context* context,
+    size_t thread_index,
+    size_t tile_index)
+{
+  const uint64_t start_ns = xnn_read_timer_ns();
+
+  const struct compute_parameters* compute = context->compute;
+  size_t index[6] = {0};
+  size_t size[6] = {0};
+  for (size_t d = context->num_dims; d-- != 0;) {
+    index[d] = (tile_index % context->num_tiles[d]) * context->tile[d];
+    size[d] = min(context->tile[d], compute->range[d] - index[d]);
+    tile_index /= context->num_tiles[d];
+  }
+
+  void* task_context = context->context;
+  switch (compute->type) {
+    case xnn_parallelization_type_1d:
+      compute->task_1d(task_context, index[0]);
+      break;
+    case xnn_parallelization_type_1d_with_thread:
+      compute->task_1d_with_thread(task_context, thread_index, index[0]);
+      break;
+    case xnn_parallelization_type_1d_tile_1d:
+      compute->task_1d_tile_1d(task_context, index[0], size[0]);
+      break;
+    case xnn_parallelization_type_2d:
+      compute->task_2d(task_context, index[0], index[1]);
+      break;
+    case xnn_parallelization_type_2d_with_thread:
+      compute->task_2d_with_thread(task_context, thread_index, index[0], index[1]);
+      break;
+    case xnn_parallelization_type_2d_tile_1d:
+      compute->task_2d_tile_1d(task_context, index[0], index[1], size[1]);
+      break;
+    case xnn_parallelization_type_2d_tile_2d:
+      compute->task_2d_tile_2d(task_context, index[0], index[1], size[0], size[1]);
+      break;
+    case xnn_parallelization_type_3d:
+      compute->task_3d(task_context, index[0], index[1], index[2]);
+      break;
+    case xnn_parallelization_type_3d_tile_1d:
+      compute->task_3d_tile_1d(task_context, index[0], index[1], index[2], size[2]);
+      break;
+    case xnn_parallelization_type_3d_tile_1d_with_thread:
+      compute->task_3d_tile_1d_with_thread(task_context, thread_index, index[0], index[1], index[2], size[2]);
+      break;
+    case xnn_parallelization_type_3d_tile_2d:
+      compute->task_3d_tile_2d(task_context, index[0], index[1], index[2], size[1], size[2]);
+      break;
+    case xnn_parallelization_type_4d:
+      compute->task_4d(task_context, index[0], index[1], index[2], index[3]);
+      break;
+    case xnn_parallelization_type_4d_tile_2d:
+      compute->task_4d_tile_2d(task_context, index[0], index[1], index[2], index[3], size[2], size[3]);
+      break;
+    case xnn_parallelization_type_5d:
+      compute->task_5d(task_context, index[0], index[1], index[2], index[3], index[4]);
+      break;
+    case xnn_parallelization_type_5d_tile_2d:
+      compute->task_5d_tile_2d(task_context, index[0], index[1], index[2], index[3], index[4], size[3], size[4]);
+      break;
+    case xnn_parallelization_type_6d_tile_2d:
+      compute->task_6d_tile_2d(
+        task_context, index[0], index[1], index[2], index[3], index[4], index[5], size[4], size[5]);
+      break;
+  #if XNN_MAX_UARCH_TYPES > 1
+    // Tiles are not dispatched by the uarch-aware thread pool functions, so all of them run the default uarch kernels.
+    case xnn_parallelization_type_2d_tile_1d_with_uarch:
+      compute->task_2d_tile_1d_with_id(task_context, XNN_UARCH_DEFAULT, index[0], index[1], size[1]);
+      break;
+    case xnn_parallelization_type_2d_tile_2d_with_uarch:
+      compute->task_2d_tile_2d_with_id(task_context, XNN_UARCH_DEFAULT, index[0], index[1], size[0], size[1]);
+      break;
+    case xnn_parallelization_type_3d_tile_1d_with_uarch:
+      compute->task_3d_tile_1d_with_id(task_context, XNN_UARCH_DEFAULT, index[0], index[1], index[2], size[2]);
+      break;
+    case xnn_parallelization_type_3d_tile_1d_with_uarch_with_thread:
+      compute->task_3d_tile_1d_with_id_with_thread(
+        task_context, XNN_UARCH_DEFAULT, thread_index, index[0], index[1], index[2], size[2]);
+      break;
+    case xnn_parallelization_type_3d_tile_2d_with_uarch:
+      compute->task_3d_tile_2d_with_id(
+        task_context, XNN_UARCH_DEFAULT, index[0], index[1], index[2], size[1], size[2]);
+      break;
+    case xnn_parallelization_type_4d_tile_2d_with_uarch:
+      compute->task_4d_tile_2d_with_id(
+        task_context, XNN_UARCH_DEFAULT, index[0], index[1], index[2], index[3], size[2], size[3]);
+      break;
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+    default:
+      XNN_UNREACHABLE;
+  }
+
+  context->thread_busy_ns[thread_index] += xnn_read_timer_ns() - start_ns;
+}
+
+enum xnn_status xnn_run_operator_with_profile(
+  xnn_operator_t op,
+  size_t opdata_index,
+  size_t operator_object_index,
+  pthreadpool_t threadpool,
+  uint64_t* thread_busy_ns,
+  size_t* num_tiles)
+{
+  *num_tiles = 0;
+  const enum xnn_status status = check_operator_run_state(op, opdata_index, operator_object_index);
+  if (status != xnn_status_success || op->state == xnn_run_state_skip) {
+    return status;
+  }
+
+  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
+    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+  }
+  for (size_t i = 0; i < XNN_MAX_COMPUTE_INVOCATIONS; i++) {
+    // The number of dimensions of the parallelization, and how many of the innermost dimensions are tiled.
+    size_t num_dims = 0;
+    size_t num_tiled_dims = 0;
+    switch (op->compute[i].type) {
+      case xnn_parallelization_type_invalid:
+        continue;
+      case xnn_parallelization_type_1d:
+      case xnn_parallelization_type_1d_with_thread:
+        num_dims = 1;
+        break;
+      case xnn_parallelization_type_1d_tile_1d:
+        num_dims = 1;
+        num_tiled_dims = 1;
+        break;
+      case xnn_parallelization_type_2d:
+      case xnn_parallelization_type_2d_with_thread:
+        num_dims = 2;
+        break;
+      case xnn_parallelization_type_2d_tile_1d:
+  #if XNN_MAX_UARCH_TYPES > 1
+      case xnn_parallelization_type_2d_tile_1d_with_uarch:
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+        num_dims = 2;
+        num_tiled_dims = 1;
+        break;
+      case xnn_parallelization_type_2d_tile_2d:
+  #if XNN_MAX_UARCH_TYPES > 1
+      case xnn_parallelization_type_2d_tile_2d_with_uarch:
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+        num_dims = 2;
+        num_tiled_dims = 2;
+        break;
+      case xnn_parallelization_type_3d:
+        num_dims = 3;
+        break;
+      case xnn_parallelization_type_3d_tile_1d:
+      case xnn_parallelization_type_3d_tile_1d_with_thread:
+  #if XNN_MAX_UARCH_TYPES > 1
+      case xnn_parallelization_type_3d_tile_1d_with_uarch:
+      case xnn_parallelization_type_3d_tile_1d_with_uarch_with_thread:
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+        num_dims = 3;
+        num_tiled_dims = 1;
+        break;
+      case xnn_parallelization_type_3d_tile_2d:
+  #if XNN_MAX_UARCH_TYPES > 1
+      case xnn_parallelization_type_3d_tile_2d_with_uarch:
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+        num_dims = 3;
+        num_tiled_dims = 2;
+        break;
+      case xnn_parallelization_type_4d:
+        num_dims = 4;
+        break;
+      case xnn_parallelization_type_4d_tile_2d:
+  #if XNN_MAX_UARCH_TYPES > 1
+      case xnn_parallelization_type_4d_tile_2d_with_uarch:
+  #endif  // XNN_MAX_UARCH_TYPES > 1
+        num_dims = 4;
+        num_tiled_dims = 2;
+        break;
+      case xnn_parallelization_type_5d:
+        num_dims = 5;
+        break;
+      case xnn_parallelization_type_5d_tile_2d:
+        num_dims = 5;
+        num_tiled_dims = 2;
+        break;
+      case xnn_parallelization_type_6d_tile_2d:
+        num_dims = 6;
+        num_tiled_dims = 2;
+        break;
+      default:
+        XNN_UNREACHABLE;
+    }
+
+    struct profiled_compute_context context = {
+      .compute = &op->compute[i],
+      .context = (void*) ((uintptr_t) &op->context + op->compute[i].context_offset),
+      .num_dims = num_dims,
+      .thread_busy_ns = thread_busy_ns,
+    };
+    size_t num_compute_tiles = 1;
+    for (size_t d = 0; d < num_dims; d++) {
+      assert(op->compute[i].range[d] != 0);
+      context.tile[d] = 1;
+      if (d + num_tiled_dims >= num_dims) {
+        context.tile[d] = op->compute[i].tile[d + num_tiled_dims - num_dims];
+        assert(context.tile[d] != 0);
+      }
+      context.num_tiles[d] = divide_round_up(op->compute[i].range[d], context.tile[d]);
+      num_compute_tiles *= context.num_tiles[d];
+    }
+    pthreadpool_parallelize_1d_with_thread(
+        threadpool,
+        (pthreadpool_task_1d_with_thread_t) compute_profiled_tile,
+        &context,
+        num_compute_tiles,
+        flags);
+    *num_tiles += num_compute_tiles;
+  }
+  return xnn_status_success;
+}
@@ -3,6 +3,10 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#ifndef __MACH__
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -17,6 +21,15 @@
 #include "xnnpack/operator.h"  // For xnn_operator definition.
 #include "xnnpack/operator-type.h"
 
+#if defined(__EMSCRIPTEN__)
+#include <emscripten/emscripten.h>
+#elif XNN_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <errno.h>
+#include <time.h>
+#endif
+
 void* xnn_get_pointer_to_write_weights(
   xnn_operator_t op,
   size_t aligned_weights_size,
@@ -160,10 +173,13 @@ enum xnn_status xnn_destroy_operator(xnn_operator_t op)
   }
 
   xnn_release_memory(op->indirection_buffer);
-  if (op->weights_cache == NULL) {
+  if (op->weights_cache == NULL && !op->shares_weights) {
     xnn_release_simd_memory(op->packed_weights.pointer);
   }
-  xnn_release_simd_memory(op->zero_buffer);
+  // Zero buffers of a known size are allocated at creation, other zero buffers are allocated when reshaping.
+  if (!op->shares_weights || op->zero_size == 0) {
+    xnn_release_simd_memory(op->zero_buffer);
+  }
   if (op->zero_buffers) {
     for (size_t i = 1; i < op->batch_size; ++i) {
       xnn_release_simd_memory(op->zero_buffers[i]);
@@ -171,8 +187,99 @@ enum xnn_status xnn_destroy_operator(xnn_operator_t op)
     xnn_release_memory(op->zero_buffers);
   }
   xnn_release_memory(op->pixelwise_buffer);
+  xnn_release_simd_memory(op->k_split_buffer);
   xnn_release_memory(op->subconvolution_buffer);
-  xnn_release_simd_memory(op->lookup_table);
+  if (!op->shares_weights) {
+    xnn_release_simd_memory(op->lookup_table);
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_clone_operator(const struct xnn_operator* op, xnn_operator_t* clone_out)
+{
+  xnn_operator_t clone = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (clone == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(op->type));
+    return xnn_status_out_of_memory;
+  }
+  memcpy(clone, op, sizeof(struct xnn_operator));
+  clone->shares_weights = true;
+
+  // Reset the state computed when reshaping, so that the clone allocates its own buffers when it is reshaped.
+  clone->input_height = 0;
+  clone->input_width = 0;
+  clone->indirection_buffer = NULL;
+  clone->last_input_height = 0;
+  clone->last_input_width = 0;
+  clone->last_input_channels = 0;
+  clone->last_input = NULL;
+  clone->last_output_height = 0;
+  clone->last_output_width = 0;
+  clone->last_output = NULL;
+  clone->last_mr = 0;
+  clone->zero_buffers = NULL;
+  clone->pixelwise_buffer = NULL;
+  clone->k_split_buffer = NULL;
+  clone->k_split_buffer_size = 0;
+  clone->state = xnn_run_state_invalid;
+  if (op->zero_size == 0) {
+    clone->zero_buffer = NULL;
+  }
+  switch (op->type) {
+    case xnn_operator_type_argmax_nd:
+    case xnn_operator_type_max_nd:
+    case xnn_operator_type_mean_nd:
+    case xnn_operator_type_min_nd:
+    case xnn_operator_type_prod_nd:
+    case xnn_operator_type_sum_nd:
+      // The zero buffer is reallocated when the number of reduced channels changes.
+      clone->channels = 0;
+      break;
+    case xnn_operator_type_resize_bilinear_nchw_f16:
+    case xnn_operator_type_resize_bilinear_nchw_f32:
+    case xnn_operator_type_resize_bilinear_nhwc_f16:
+    case xnn_operator_type_resize_bilinear_nhwc_f32:
+    case xnn_operator_type_resize_bilinear_nhwc_s8:
+    case xnn_operator_type_resize_bilinear_nhwc_u8:
+      // Resize weights depend on the input and output sizes, and are packed when reshaping.
+      clone->packed_weights.pointer = NULL;
+      clone->shares_weights = false;
+      break;
+    case xnn_operator_type_softmax_nc_qu8:
+      // The lookup table depends on the number of channels, and is computed when reshaping.
+      clone->lookup_table = xnn_allocate_simd_memory(256 * sizeof(uint32_t));
+      if (clone->lookup_table == NULL) {
+        xnn_log_error(
+          "failed to allocate 256 bytes for %s operator lookup table",
+          xnn_operator_type_to_string(op->type));
+        xnn_release_simd_memory(clone);
+        return xnn_status_out_of_memory;
+      }
+      clone->shares_weights = false;
+      break;
+    default:
+      break;
+  }
+
+  // Subconvolution parameters hold pointers into the packed weights set at creation, and into the indirection buffer
+  // set when reshaping.
+  if (op->subconvolution_buffer != NULL) {
+    const size_t subconvolution_buffer_size =
+      sizeof(struct subconvolution_params) * op->stride_height * op->stride_width;
+    clone->subconvolution_buffer = xnn_allocate_memory(subconvolution_buffer_size);
+    if (clone->subconvolution_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator subconvolution buffer",
+        subconvolution_buffer_size, xnn_operator_type_to_string(op->type));
+      xnn_delete_operator(clone);
+      return xnn_status_out_of_memory;
+    }
+    memcpy(clone->subconvolution_buffer, op->subconvolution_buffer, subconvolution_buffer_size);
+  }
+
+  *clone_out = clone;
   return xnn_status_success;
 }
 
@@ -290,7 +397,46 @@ enum xnn_operator_type xnn_reduce_operator_to_operator_type(enum xnn_reduce_oper
       return xnn_operator_type_mean_nd;
     case xnn_reduce_sum:
       return xnn_operator_type_sum_nd;
+    case xnn_reduce_max:
+      return xnn_operator_type_max_nd;
+    case xnn_reduce_min:
+      return xnn_operator_type_min_nd;
+    case xnn_reduce_prod:
+      return xnn_operator_type_prod_nd;
+    case xnn_reduce_argmax:
+      return xnn_operator_type_argmax_nd;
     default:
       return xnn_operator_type_invalid;
   }
 }
+
+uint64_t xnn_read_timer_ns(void) {
+#ifdef __MACH__
+  const uint64_t timestamp = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+  if (timestamp == 0) {
+    xnn_log_warning("clock_gettime failed: error code %d", errno);
+  }
+  return timestamp;
+#elif __EMSCRIPTEN__
+  const double kNanosInMilli = 1.0e6;
+  return (uint64_t) (emscripten_get_now() * kNanosInMilli);
+#elif XNN_PLATFORM_WINDOWS
+  LARGE_INTEGER counter;
+  LARGE_INTEGER frequency;
+  if (!QueryPerformanceCounter(&counter) || !QueryPerformanceFrequency(&frequency)) {
+    xnn_log_error("QueryPerformanceCounter failed: error code %u", GetLastError());
+    return 0;
+  }
+  const uint64_t kNanosInSec = UINT64_C(1000000000);
+  const uint64_t seconds = (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart;
+  const uint64_t remainder = (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart;
+  return seconds * kNanosInSec + remainder * kNanosInSec / (uint64_t) frequency.QuadPart;
+#else
+  struct timespec timestamp;
+  if (clock_gettime(CLOCK_MONOTONIC, &timestamp) != 0) {
+    xnn_log_error("clock_gettime failed: error code %d", errno);
+    return 0;
+  }
+  return (uint64_t) timestamp.tv_sec * UINT64_C(1000000000) + (uint64_t) timestamp.tv_nsec;
+#endif
+}
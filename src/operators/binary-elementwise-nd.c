@@ -128,6 +128,17 @@ static const struct xnn_binary_elementwise_config* init_config(
   }
 }
 
+const struct xnn_binary_elementwise_config* xnn_init_f32_binary_elementwise_config(
+    enum xnn_binary_operator type) {
+  int sign_b = 1;
+  const struct xnn_binary_elementwise_config* config =
+      init_config(type, xnn_datatype_fp32, &sign_b);
+  if (config == NULL) {
+    config = xnn_init_binary_reference_config(type, xnn_datatype_fp32);
+  }
+  return config;
+}
+
 static enum xnn_status init_binary_elementwise_nd(
     xnn_operator_t op, enum xnn_binary_operator type,
     enum xnn_datatype datatype,
@@ -2083,6 +2083,7 @@ static enum xnn_status reshape_gemm(
       .log2_csize = log2_output_element_size,
       .num_batch_dims = 1,
       .ukernel = gemm_ukernel,
+      .mr = mr,
   };
   convolution_op->context.gemm.gemm.gemm.batch_dims_a[0] = groups;
   convolution_op->context.gemm.gemm.gemm.batch_dims_b[0] = groups;
@@ -2090,12 +2091,18 @@ static enum xnn_status reshape_gemm(
   memcpy(&convolution_op->context.gemm.gemm.gemm.params, &convolution_op->params, sizeof(convolution_op->context.gemm.gemm.gemm.params));
   convolution_op->context.gemm.gemm.gemm.fused_params = &convolution_op->context.gemm.gemm.gemm.params;
 
-  size_t nc = xnn_gemm_best_nc(groups, batch_output_size, group_output_channels,
-                               mr, nr, num_threads);
+  size_t mc;
+  size_t nc;
+  xnn_gemm_best_tile_size(
+      groups, batch_output_size, group_output_channels,
+      /*m_stride=*/group_input_channels << log2_input_element_size, /*n_stride=*/w_stride,
+      mr, nr, num_threads, xnn_init_hardware_config()->l2_cache_size, &mc, &nc);
 
   if (groups == 1) {
     #if XNN_MAX_UARCH_TYPES > 1
       if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
+        // Heterogeneous microkernels compute a single block of `mr` rows per tile.
+        mc = mr;
         convolution_op->compute[0].type = xnn_parallelization_type_2d_tile_2d_with_uarch;
         convolution_op->compute[0].task_2d_tile_2d_with_id = (pthreadpool_task_2d_tile_2d_with_id_t) xnn_compute_hmp_gemm;
       } else {
@@ -2106,9 +2113,14 @@ static enum xnn_status reshape_gemm(
       convolution_op->compute[0].type = xnn_parallelization_type_2d_tile_2d;
       convolution_op->compute[0].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
     #endif
+    if (convolution_op->has_gemm_epilogue) {
+      convolution_op->context.gemm.gemm.gemm.epilogue = &convolution_op->gemm_epilogue;
+      convolution_op->compute[0].type = xnn_parallelization_type_2d_tile_2d;
+      convolution_op->compute[0].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm_with_epilogue;
+    }
     convolution_op->compute[0].range[0] = batch_output_size;
     convolution_op->compute[0].range[1] = group_output_channels;
-    convolution_op->compute[0].tile[0] = mr;
+    convolution_op->compute[0].tile[0] = mc;
     convolution_op->compute[0].tile[1] = nc;
   } else {
     #if XNN_MAX_UARCH_TYPES > 1
@@ -2338,6 +2350,20 @@ static enum xnn_status reshape_igemm(
         }
       }
     #endif
+    if (convolution_op->has_gemm_epilogue) {
+      assert(!dynamic_quantization);
+      convolution_op->gemm_epilogue.residual_batch_stride = output_size * convolution_op->gemm_epilogue.residual_stride;
+      convolution_op->context.igemm.igemm.epilogue = &convolution_op->gemm_epilogue;
+      if (batch_size > 1) {
+        convolution_op->compute[igemm_compute_index].type = xnn_parallelization_type_3d_tile_2d;
+        convolution_op->compute[igemm_compute_index].task_3d_tile_2d =
+          (pthreadpool_task_3d_tile_2d_t) xnn_compute_batch_igemm_with_epilogue;
+      } else {
+        convolution_op->compute[igemm_compute_index].type = xnn_parallelization_type_2d_tile_2d;
+        convolution_op->compute[igemm_compute_index].task_2d_tile_2d =
+          (pthreadpool_task_2d_tile_2d_t) xnn_compute_igemm_with_epilogue;
+      }
+    }
     if (batch_size > 1) {
       convolution_op->compute[igemm_compute_index].range[0] = batch_size;
       convolution_op->compute[igemm_compute_index].range[1] = output_size;
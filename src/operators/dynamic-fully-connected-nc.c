@@ -383,6 +383,7 @@ static enum xnn_status reshape_dynamic_fully_connected_nc(
     .cn_stride = nr << log2_output_element_size,
     .log2_csize = log2_output_element_size,
     .ukernel = gemm_ukernel,
+    .mr = mr,
   };
   memcpy(&dynamic_fully_connected_op->context.gemm.gemm.gemm.params, params, params_size);
   dynamic_fully_connected_op->context.gemm.gemm.gemm.fused_params = &dynamic_fully_connected_op->context.gemm.gemm.gemm.params;
@@ -0,0 +1,344 @@
+// Copyright 2026 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "xnnpack.h"
+#include "xnnpack/allocator.h"
+#include "xnnpack/common.h"
+#include "xnnpack/compute.h"
+#include "xnnpack/config-types.h"
+#include "xnnpack/config.h"
+#include "xnnpack/internal.h"
+#include "xnnpack/log.h"
+#include "xnnpack/math.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator-utils.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/params.h"
+#include "pthreadpool.h"
+
+static enum xnn_status init_elementwise_chain_step(
+  const struct xnn_elementwise_chain_op* chain_op,
+  size_t index,
+  struct elementwise_chain_step* step)
+{
+  memset(step, 0, sizeof(struct elementwise_chain_step));
+  if (chain_op->unary_operator != xnn_unary_invalid) {
+    const struct xnn_unary_elementwise_config* config =
+      chain_op->unary_operator != xnn_unary_convert ?
+        xnn_init_f32_unary_elementwise_config(chain_op->unary_operator) : NULL;
+    if (config == NULL) {
+      xnn_log_error(
+        "failed to create %s operator: unsupported operation #%zu (%s)",
+        xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32), index,
+        xnn_unary_operator_to_string(chain_op->unary_operator));
+      return xnn_status_unsupported_parameter;
+    }
+    step->unary_ukernel = config->ukernel;
+    if (config->init != NULL) {
+      config->init(&step->params.unary, &chain_op->unary_params, NULL, NULL);
+    }
+    return xnn_status_success;
+  }
+
+  if (chain_op->input_index >= XNN_MAX_ELEMENTWISE_CHAIN_INPUTS) {
+    xnn_log_error(
+      "failed to create %s operator with input #%" PRIu32 " in operation #%zu: "
+      "the number of inputs must not exceed %d",
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32), chain_op->input_index, index,
+      XNN_MAX_ELEMENTWISE_CHAIN_INPUTS);
+    return xnn_status_invalid_parameter;
+  }
+  const struct xnn_binary_elementwise_config* config =
+    xnn_init_f32_binary_elementwise_config(chain_op->binary_operator);
+  if (config == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: unsupported operation #%zu (%s)",
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32), index,
+      xnn_binary_operator_to_string(chain_op->binary_operator));
+    return xnn_status_unsupported_parameter;
+  }
+  if (chain_op->input_is_scalar) {
+    // The reversed microkernel computes (scalar op x) from x and the scalar.
+    step->binary_ukernel = chain_op->input_is_first ? config->ropc_ukernel : config->opc_ukernel;
+  } else {
+    step->binary_ukernel = config->op_ukernel;
+  }
+  step->input_index = chain_op->input_index;
+  step->input_is_first = chain_op->input_is_first;
+  step->input_is_scalar = chain_op->input_is_scalar;
+  if (config->init != NULL) {
+    config->init(&step->params.binary, NULL, NULL, NULL);
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status create_elementwise_chain_nc(
+  size_t num_ops,
+  const struct xnn_elementwise_chain_op* ops,
+  uint32_t flags,
+  enum xnn_operator_type operator_type,
+  xnn_operator_t* elementwise_chain_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_ops == 0 || num_ops > XNN_MAX_ELEMENTWISE_CHAIN_OPS) {
+    xnn_log_error(
+      "failed to create %s operator with %zu operations: the number of operations must be between 1 and %d",
+      xnn_operator_type_to_string(operator_type), num_ops, XNN_MAX_ELEMENTWISE_CHAIN_OPS);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_reduce_config* rminmax_config = NULL;
+  const struct xnn_unary_elementwise_config* cvt_config = NULL;
+  if (operator_type != xnn_operator_type_elementwise_chain_nc_f32) {
+    rminmax_config = xnn_init_f32_rminmax_config();
+    cvt_config = operator_type == xnn_operator_type_elementwise_chain_nc_f32_qd8 ?
+      xnn_init_f32_to_qs8_cvt_config() : xnn_init_f32_to_qu8_cvt_config();
+    if (rminmax_config == NULL || cvt_config == NULL) {
+      xnn_log_error("failed to create %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(operator_type));
+      return xnn_status_unsupported_hardware;
+    }
+  }
+
+  xnn_operator_t elementwise_chain_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (elementwise_chain_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    return xnn_status_out_of_memory;
+  }
+
+  // Input 0 is always read by the first operation.
+  size_t num_inputs = 1;
+  struct elementwise_chain_context* context = &elementwise_chain_op->context.elementwise_chain;
+  for (size_t i = 0; i < num_ops; i++) {
+    const enum xnn_status status = init_elementwise_chain_step(&ops[i], i, &context->steps[i]);
+    if (status != xnn_status_success) {
+      xnn_delete_operator(elementwise_chain_op);
+      return status;
+    }
+    if (context->steps[i].binary_ukernel != NULL) {
+      num_inputs = max(num_inputs, (size_t) ops[i].input_index + 1);
+    }
+  }
+  context->num_inputs = num_inputs;
+  context->num_steps = num_ops;
+  if (rminmax_config != NULL) {
+    context->rminmax_ukernel = rminmax_config->ukernel;
+    context->convert_ukernel = cvt_config->ukernel;
+  }
+
+  elementwise_chain_op->type = operator_type;
+  elementwise_chain_op->flags = flags;
+  elementwise_chain_op->state = xnn_run_state_invalid;
+
+  *elementwise_chain_op_out = elementwise_chain_op;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_elementwise_chain_nc_f32(
+  size_t num_ops,
+  const struct xnn_elementwise_chain_op* ops,
+  uint32_t flags,
+  xnn_operator_t* elementwise_chain_op_out)
+{
+  return create_elementwise_chain_nc(
+    num_ops, ops, flags, xnn_operator_type_elementwise_chain_nc_f32, elementwise_chain_op_out);
+}
+
+enum xnn_status xnn_create_elementwise_chain_nc_f32_qd8(
+  size_t num_ops,
+  const struct xnn_elementwise_chain_op* ops,
+  uint32_t flags,
+  xnn_operator_t* elementwise_chain_op_out)
+{
+  return create_elementwise_chain_nc(
+    num_ops, ops, flags, xnn_operator_type_elementwise_chain_nc_f32_qd8, elementwise_chain_op_out);
+}
+
+enum xnn_status xnn_create_elementwise_chain_nc_f32_qdu8(
+  size_t num_ops,
+  const struct xnn_elementwise_chain_op* ops,
+  uint32_t flags,
+  xnn_operator_t* elementwise_chain_op_out)
+{
+  return create_elementwise_chain_nc(
+    num_ops, ops, flags, xnn_operator_type_elementwise_chain_nc_f32_qdu8, elementwise_chain_op_out);
+}
+
+enum xnn_status xnn_reshape_elementwise_chain_nc_f32(
+  xnn_operator_t elementwise_chain_op,
+  size_t batch_size,
+  size_t channels,
+  pthreadpool_t threadpool)
+{
+  if (elementwise_chain_op->type != xnn_operator_type_elementwise_chain_nc_f32) {
+    xnn_log_error("failed to reshape operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32),
+      xnn_operator_type_to_string(elementwise_chain_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  elementwise_chain_op->state = xnn_run_state_invalid;
+
+  if (batch_size == 0 || channels == 0) {
+    elementwise_chain_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  elementwise_chain_op->batch_size = batch_size;
+  elementwise_chain_op->channels = channels;
+
+  const size_t range = batch_size * channels * sizeof(float);
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  elementwise_chain_op->compute[0].type = xnn_parallelization_type_1d_tile_1d;
+  elementwise_chain_op->compute[0].task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_elementwise_chain;
+  elementwise_chain_op->compute[0].range[0] = range;
+  elementwise_chain_op->compute[0].tile[0] = num_threads == 1 ? range :
+    max(XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE, round_up_po2(range / num_threads, XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE));
+  elementwise_chain_op->state = xnn_run_state_needs_setup;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_elementwise_chain_nc_f32(
+  xnn_operator_t elementwise_chain_op,
+  const float* const* inputs,
+  float* output)
+{
+  if (elementwise_chain_op->type != xnn_operator_type_elementwise_chain_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32),
+      xnn_operator_type_to_string(elementwise_chain_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (elementwise_chain_op->state) {
+    case xnn_run_state_skip:
+      return xnn_status_success;
+    case xnn_run_state_invalid:
+      xnn_log_error(
+        "failed to setup %s operator: operator has not been reshaped yet",
+        xnn_operator_type_to_string(elementwise_chain_op->type));
+      return xnn_status_invalid_state;
+    case xnn_run_state_needs_setup:
+      // Operator has been reshaped, but not setup, continue with setup.
+    case xnn_run_state_ready:
+      // Operator has been reshaped, and we are setting up with different pointers.
+      break;
+  }
+
+  struct elementwise_chain_context* context = &elementwise_chain_op->context.elementwise_chain;
+  for (size_t i = 0; i < context->num_inputs; i++) {
+    context->inputs[i] = inputs[i];
+  }
+  context->output = output;
+  elementwise_chain_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reshape_elementwise_chain_nc_f32_qx8(
+  xnn_operator_t elementwise_chain_op,
+  size_t batch_size,
+  size_t channels,
+  size_t* workspace_size,
+  size_t* workspace_alignment,
+  pthreadpool_t threadpool)
+{
+  if (elementwise_chain_op->type != xnn_operator_type_elementwise_chain_nc_f32_qd8 &&
+      elementwise_chain_op->type != xnn_operator_type_elementwise_chain_nc_f32_qdu8) {
+    xnn_log_error("failed to reshape operator: operator type mismatch (expected %s or %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32_qd8),
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32_qdu8),
+      xnn_operator_type_to_string(elementwise_chain_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  elementwise_chain_op->state = xnn_run_state_invalid;
+
+  if (batch_size == 0 || channels == 0) {
+    *workspace_size = 0;
+    *workspace_alignment = 1;
+    elementwise_chain_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  elementwise_chain_op->batch_size = batch_size;
+  elementwise_chain_op->channels = channels;
+
+  // Each thread keeps the FP32 result of its current row until the row's quantization parameters are known.
+  struct elementwise_chain_context* context = &elementwise_chain_op->context.elementwise_chain;
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  context->batch_size = batch_size;
+  context->row_size = channels * sizeof(float);
+  context->row_buffer_stride = round_up_po2(context->row_size + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+  *workspace_size = num_threads * context->row_buffer_stride;
+  *workspace_alignment = XNN_ALLOCATION_ALIGNMENT;
+
+  elementwise_chain_op->compute[0].type = xnn_parallelization_type_1d_with_thread;
+  elementwise_chain_op->compute[0].task_1d_with_thread =
+    elementwise_chain_op->type == xnn_operator_type_elementwise_chain_nc_f32_qd8 ?
+      (pthreadpool_task_1d_with_thread_t) xnn_compute_elementwise_chain_qd8 :
+      (pthreadpool_task_1d_with_thread_t) xnn_compute_elementwise_chain_qdu8;
+  elementwise_chain_op->compute[0].range[0] = batch_size;
+  elementwise_chain_op->state = xnn_run_state_needs_setup;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_elementwise_chain_nc_f32_qx8(
+  xnn_operator_t elementwise_chain_op,
+  void* workspace,
+  const float* const* inputs,
+  void* output,
+  struct xnn_quantization_params* quantization_params)
+{
+  if (elementwise_chain_op->type != xnn_operator_type_elementwise_chain_nc_f32_qd8 &&
+      elementwise_chain_op->type != xnn_operator_type_elementwise_chain_nc_f32_qdu8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s or %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32_qd8),
+      xnn_operator_type_to_string(xnn_operator_type_elementwise_chain_nc_f32_qdu8),
+      xnn_operator_type_to_string(elementwise_chain_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (elementwise_chain_op->state) {
+    case xnn_run_state_skip:
+      return xnn_status_success;
+    case xnn_run_state_invalid:
+      xnn_log_error(
+        "failed to setup %s operator: operator has not been reshaped yet",
+        xnn_operator_type_to_string(elementwise_chain_op->type));
+      return xnn_status_invalid_state;
+    case xnn_run_state_needs_setup:
+      // Operator has been reshaped, but not setup, continue with setup.
+    case xnn_run_state_ready:
+      // Operator has been reshaped, and we are setting up with different pointers.
+      break;
+  }
+
+  struct elementwise_chain_context* context = &elementwise_chain_op->context.elementwise_chain;
+  for (size_t i = 0; i < context->num_inputs; i++) {
+    context->inputs[i] = inputs[i];
+  }
+  context->output = output;
+  context->row_buffer = workspace;
+  context->quantization_params = (struct xnn_qd8_quantization_params*) quantization_params;
+  elementwise_chain_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
@@ -324,6 +324,7 @@ static enum xnn_status create_fully_connected_nc(
   assert(XNN_MAX_MR >= mr);
   for (size_t i = 0; i < mr; i++) {
     fully_connected_op->ukernel.gemm.gemm_cases[i] = gemm_ukernels->gemm[i];
+    fully_connected_op->ukernel.gemm.gemminc_cases[i] = gemm_config->gemminc[i];
   }
 
   fully_connected_op->state = xnn_run_state_invalid;
@@ -336,6 +337,82 @@ error:
   return status;
 }
 
+enum xnn_status xnn_create_fully_connected_nc_bf16(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_code_cache_t code_cache,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16));
+    return xnn_status_invalid_parameter;
+  }
+
+  const xnn_bfloat16 bf16_output_min = xnn_bfloat16_from_float(output_min);
+  const xnn_bfloat16 bf16_output_max = xnn_bfloat16_from_float(output_max);
+  const float rounded_output_min = xnn_bfloat16_to_float(bf16_output_min);
+  const float rounded_output_max = xnn_bfloat16_to_float(bf16_output_max);
+  if (rounded_output_min >= rounded_output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16), rounded_output_min, rounded_output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_gemm_config* gemm_config = xnn_init_bf16_gemm_config();
+  if (gemm_config == NULL) {
+    xnn_log_error("failed to create %s operator: unsupported hardware configuration",
+                  xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  struct xnn_bf16_minmax_params params;
+  if XNN_LIKELY(gemm_config->init.bf16 != NULL) {
+    gemm_config->init.bf16(&params, bf16_output_min, bf16_output_max);
+  }
+  return create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias, flags,
+    /*block_size=*/0,
+    /*extra_bl_bytes=*/0,
+    /*blockwise_kernel_scale_params=*/NULL,
+    /*log2_input_element_size=*/XNN_LOG2_SIZEOF_HALF,
+    /*log2_filter_element_size=*/XNN_LOG2_SIZEOF_HALF,
+    /*filter_is_nibble=*/false,
+    /*bias_element_size=*/sizeof(uint16_t),
+    (xnn_packw_gemm_gio_ukernel_fn) gemm_config->pack_gemm_gio,
+    (xnn_packw_gemm_goi_ukernel_fn) gemm_config->pack_gemm_goi,
+    /*pack_gemm_goi_bl_w=*/NULL,
+    /*packing_params=*/NULL,
+    /*packed_weights_padding_byte=*/0,
+    /*extra_weights_bytes=*/0,
+    /*init_scale_params=*/NULL, /*scale_params=*/NULL,
+    /*init_kernel_scale_params=*/NULL, /*kernel_scale_params=*/NULL,
+    &params, sizeof(params),
+    gemm_config, &gemm_config->minmax,
+    xnn_operator_type_fully_connected_nc_bf16,
+    /*weights_cache=*/weights_cache,
+    fully_connected_op_out);
+}
+
 enum xnn_status xnn_create_fully_connected_nc_f16(
     size_t input_channels,
     size_t output_channels,
@@ -1595,6 +1672,131 @@ enum xnn_status create_fully_connected_nc_f32(
     fully_connected_op_out);
 }
 
+// Number of output channels used to time GEMM configs, to bound the autotuning time of large layers.
+#define XNN_AUTOTUNE_MAX_OUTPUT_CHANNELS 512
+// Number of timed runs of each GEMM config, the fastest run is used.
+#define XNN_AUTOTUNE_REPETITIONS 3
+
+static uint64_t time_f32_gemm_config(
+    const struct xnn_gemm_config* gemm_config,
+    size_t batch_size,
+    size_t input_channels,
+    size_t output_channels,
+    const float* input,
+    const float* packed_weights,
+    float* output)
+{
+  const size_t mr = gemm_config->mr;
+  const size_t nr = gemm_config->nr;
+  const xnn_gemm_ukernel_fn ukernel = gemm_config->minmax.gemm[mr - 1].function[XNN_UARCH_DEFAULT];
+  union xnn_f32_minmax_params params;
+  if XNN_LIKELY(gemm_config->init.f32 != NULL) {
+    gemm_config->init.f32(&params, -INFINITY, INFINITY);
+  }
+
+  uint64_t best_time = UINT64_MAX;
+  // The first run warms up the caches and is not timed.
+  for (size_t r = 0; r <= XNN_AUTOTUNE_REPETITIONS; r++) {
+    const uint64_t start = xnn_read_timer_ns();
+    for (size_t m = 0; m < batch_size; m += mr) {
+      ukernel(
+        min(batch_size - m, mr), output_channels, input_channels * sizeof(float),
+        input + m * input_channels, input_channels * sizeof(float), packed_weights,
+        output + m * output_channels, output_channels * sizeof(float), nr * sizeof(float), &params);
+    }
+    const uint64_t end = xnn_read_timer_ns();
+    if (r != 0 && end - start < best_time) {
+      best_time = end - start;
+    }
+  }
+  return best_time;
+}
+
+// Times the F32 GEMM configs supported on this hardware on the shape of a fully connected operator, and returns the
+// fastest. The choice is recorded in (and looked up from) the weights cache. Finalized weights caches hold weights
+// packed for the recorded config, or for the default config if there is none, so they are never timed again.
+static const struct xnn_gemm_config* autotune_f32_gemm_config(
+    size_t input_channels,
+    size_t output_channels,
+    xnn_weights_cache_t weights_cache,
+    const struct xnn_gemm_config* default_config)
+{
+  size_t num_configs = 0;
+  const struct xnn_gemm_config* configs = xnn_init_f32_gemm_candidate_configs(&num_configs);
+  if (num_configs <= 1) {
+    return default_config;
+  }
+
+  struct xnn_gemm_tuning_record record = {
+    .input_channels = input_channels,
+    .output_channels = output_channels,
+    .operator_type = xnn_operator_type_fully_connected_nc_f32,
+  };
+  if (xnn_weights_cache_look_up_gemm_tuning(weights_cache, &record)) {
+    for (size_t i = 0; i < num_configs; i++) {
+      if (configs[i].mr == record.mr && configs[i].nr == record.nr && configs[i].log2_kr == record.log2_kr &&
+          configs[i].log2_sr == record.log2_sr) {
+        return &configs[i];
+      }
+    }
+  }
+  if (weights_cache != NULL && xnn_weights_cache_is_finalized(weights_cache)) {
+    xnn_log_debug("skipping autotuning of %s operator with %zu input channels and %zu output channels: "
+      "weights cache is finalized",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32), input_channels, output_channels);
+    return default_config;
+  }
+
+  // Time a few tiles of rows of every config. Packed weights of zeros are as fast as the actual weights, so the
+  // weights don't need to be packed for every config.
+  size_t max_mr = 1;
+  size_t max_packed_weights_size = 0;
+  const size_t tuning_output_channels = min(output_channels, XNN_AUTOTUNE_MAX_OUTPUT_CHANNELS);
+  for (size_t i = 0; i < num_configs; i++) {
+    const size_t kr = UINT32_C(1) << configs[i].log2_kr;
+    const size_t sr = UINT32_C(1) << configs[i].log2_sr;
+    const size_t packed_weights_size = round_up(tuning_output_channels, configs[i].nr) *
+      (round_up_po2(input_channels, kr * sr) + 1) * sizeof(float);
+    max_mr = max(max_mr, configs[i].mr);
+    max_packed_weights_size = max(max_packed_weights_size, packed_weights_size);
+  }
+  const size_t batch_size = 2 * max_mr;
+  const size_t input_size = batch_size * input_channels * sizeof(float) + XNN_EXTRA_BYTES;
+  const size_t output_size = batch_size * tuning_output_channels * sizeof(float);
+  float* input = xnn_allocate_zero_simd_memory(input_size);
+  float* packed_weights = xnn_allocate_zero_simd_memory(max_packed_weights_size);
+  float* output = xnn_allocate_simd_memory(output_size);
+  const struct xnn_gemm_config* best_config = default_config;
+  if (input != NULL && packed_weights != NULL && output != NULL) {
+    uint64_t best_time = UINT64_MAX;
+    for (size_t i = 0; i < num_configs; i++) {
+      const uint64_t time = time_f32_gemm_config(
+        &configs[i], batch_size, input_channels, tuning_output_channels, input, packed_weights, output);
+      xnn_log_debug("autotuning %s operator with %zu input channels and %zu output channels: "
+        "%" PRIu32 "x%" PRIu32 " GEMM config took %" PRIu64 " ns",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32), input_channels, output_channels,
+        (uint32_t) configs[i].mr, (uint32_t) configs[i].nr, time);
+      if (time < best_time) {
+        best_time = time;
+        best_config = &configs[i];
+      }
+    }
+
+    record.mr = best_config->mr;
+    record.nr = best_config->nr;
+    record.log2_kr = best_config->log2_kr;
+    record.log2_sr = best_config->log2_sr;
+    xnn_weights_cache_insert_gemm_tuning(weights_cache, &record);
+  } else {
+    xnn_log_warning("failed to allocate memory to autotune %s operator, using the default GEMM config",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32));
+  }
+  xnn_release_simd_memory(input);
+  xnn_release_simd_memory(packed_weights);
+  xnn_release_simd_memory(output);
+  return best_config;
+}
+
 enum xnn_status xnn_create_fully_connected_nc_f32(
     size_t input_channels,
     size_t output_channels,
@@ -1616,7 +1818,9 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
   }
 
   const struct xnn_gemm_config* gemm_nr2_config = xnn_init_f32_gemm_nr2_config();
-  if (gemm_config->nr > output_channels) {
+  if (flags & XNN_FLAG_AUTOTUNE_GEMM) {
+    gemm_config = autotune_f32_gemm_config(input_channels, output_channels, weights_cache, gemm_config);
+  } else if (gemm_config->nr > output_channels) {
     // Default microkernel is suboptimal, use a microkernel that better supports less output channels.
     if (gemm_nr2_config != NULL && gemm_nr2_config->minmax.gemm[gemm_nr2_config->mr-1].function[XNN_UARCH_DEFAULT] != NULL) {
       gemm_config = gemm_nr2_config;
@@ -2140,6 +2344,99 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     fully_connected_op_out);
 }
 
+// Splits K between threads when there are too few output tiles to keep all threads busy. The first pass computes
+// partial accumulators of all slices of K but the last, and the second pass sums them and accumulates the last slice
+// into the output.
+static enum xnn_status reshape_fully_connected_nc_f32_k_split(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  uint32_t mr,
+  uint32_t nr,
+  size_t num_threads)
+{
+  const xnn_f32_gemminc_minmax_ukernel_fn gemminc_ukernel = fully_connected_op->ukernel.gemm.gemminc_cases[mr - 1];
+  if (gemminc_ukernel == NULL) {
+    return xnn_status_success;
+  }
+  const struct xnn_binary_elementwise_config* vadd_config = xnn_init_f32_vadd_config();
+  if (vadd_config == NULL) {
+    return xnn_status_success;
+  }
+
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const size_t k_splits =
+    xnn_gemm_best_k_splits(batch_size, output_channels, input_channels, mr, nr, num_threads);
+  if (k_splits < 2) {
+    return xnn_status_success;
+  }
+  // All slices but the last must start at a multiple of `kr * sr` in the packed weights.
+  const size_t kr_sr = fully_connected_op->ukernel.gemm.kr * fully_connected_op->ukernel.gemm.sr;
+  const size_t kc = round_up(divide_round_up(input_channels, k_splits), kr_sr);
+  const size_t num_slices = divide_round_up(input_channels, kc);
+  if (num_slices < 2) {
+    return xnn_status_success;
+  }
+
+  const size_t tile_size = mr * nr * sizeof(float);
+  // The zero tile is sized for the largest MR, so that the partial accumulators of reshapes with any MR never overwrite
+  // it, and it only needs to be cleared when the buffer is allocated.
+  assert(mr <= fully_connected_op->ukernel.gemm.mr);
+  const size_t zero_size =
+    round_up_po2(fully_connected_op->ukernel.gemm.mr * nr * sizeof(float), XNN_ALLOCATION_ALIGNMENT);
+  const size_t tile_row_stride = divide_round_up(output_channels, nr) * tile_size;
+  const size_t slice_stride = divide_round_up(batch_size, mr) * tile_row_stride;
+  const size_t k_split_buffer_size = zero_size + (num_slices - 1) * slice_stride;
+  if (k_split_buffer_size > fully_connected_op->k_split_buffer_size) {
+    xnn_release_simd_memory(fully_connected_op->k_split_buffer);
+    fully_connected_op->k_split_buffer_size = 0;
+    fully_connected_op->k_split_buffer = xnn_allocate_zero_simd_memory(k_split_buffer_size);
+    if (fully_connected_op->k_split_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator partial accumulators",
+        k_split_buffer_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->k_split_buffer_size = k_split_buffer_size;
+    xnn_log_debug("allocated %zu bytes for %s operator partial accumulators",
+      k_split_buffer_size, xnn_operator_type_to_string(fully_connected_op->type));
+  }
+
+  struct gemm_context* context = &fully_connected_op->context.gemm.gemm.gemm;
+  context->k_split.ukernel = gemminc_ukernel;
+  context->k_split.vadd = vadd_config->op_ukernel;
+  context->k_split.nr = nr;
+  context->k_split.num_slices = num_slices;
+  context->k_split.kc_scaled = kc * sizeof(float);
+  context->k_split.zero = fully_connected_op->k_split_buffer;
+  context->k_split.buffer = (void*) ((uintptr_t) fully_connected_op->k_split_buffer + zero_size);
+  context->k_split.slice_stride = slice_stride;
+  context->k_split.tile_row_stride = tile_row_stride;
+  context->k_split.unclamped_params.scalar.min = -INFINITY;
+  context->k_split.unclamped_params.scalar.max = +INFINITY;
+  memset(&context->k_split.vadd_params, 0, sizeof(context->k_split.vadd_params));
+  if (fully_connected_op->has_gemm_epilogue) {
+    context->epilogue = &fully_connected_op->gemm_epilogue;
+  }
+
+  const size_t nc = xnn_gemm_best_nc(num_slices - 1, batch_size, output_channels, mr, nr, num_threads);
+  fully_connected_op->compute[0].type = xnn_parallelization_type_3d_tile_2d;
+  fully_connected_op->compute[0].task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_gemm_k_split;
+  fully_connected_op->compute[0].range[0] = num_slices - 1;
+  fully_connected_op->compute[0].range[1] = batch_size;
+  fully_connected_op->compute[0].range[2] = output_channels;
+  fully_connected_op->compute[0].tile[0] = mr;
+  fully_connected_op->compute[0].tile[1] = nc;
+
+  fully_connected_op->compute[1].type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute[1].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm_k_split_reduce;
+  fully_connected_op->compute[1].range[0] = batch_size;
+  fully_connected_op->compute[1].range[1] = output_channels;
+  fully_connected_op->compute[1].tile[0] = mr;
+  fully_connected_op->compute[1].tile[1] = xnn_gemm_best_nc(1, batch_size, output_channels, mr, nr, num_threads);
+  return xnn_status_success;
+}
+
 static enum xnn_status reshape_fully_connected_nc(
   xnn_operator_t fully_connected_op,
   enum xnn_operator_type expected_operator_type,
@@ -2217,12 +2514,23 @@ static enum xnn_status reshape_fully_connected_nc(
   memcpy(&fully_connected_op->context.gemm.gemm.gemm.params, params, params_size);
   fully_connected_op->context.gemm.gemm.gemm.fused_params = &fully_connected_op->context.gemm.gemm.gemm.params;
 
-  size_t nc =
-      xnn_gemm_best_nc(/*num_groups=*/1, batch_size, output_channels, mr, nr,
-                       pthreadpool_get_threads_count(threadpool));
+  size_t mc;
+  size_t nc;
+  xnn_gemm_best_tile_size(
+      /*num_groups=*/1, batch_size, output_channels,
+      /*m_stride=*/fully_connected_op->context.gemm.gemm.gemm.k_scaled,
+      /*n_stride=*/fully_connected_op->weights_stride, mr, nr,
+      pthreadpool_get_threads_count(threadpool),
+      xnn_init_hardware_config()->l2_cache_size, &mc, &nc);
+  if (is_qp8_ukernel) {
+    // The packed left-hand side is laid out in blocks of `mr` rows.
+    mc = mr;
+  }
 
 #if XNN_MAX_UARCH_TYPES > 1
     if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
+      // Heterogeneous microkernels compute a single block of `mr` rows per tile.
+      mc = mr;
       fully_connected_op->compute[0].type = xnn_parallelization_type_2d_tile_2d_with_uarch;
       if (dynamic_quantization) {
         fully_connected_op->compute[0].task_2d_tile_2d_with_id = (pthreadpool_task_2d_tile_2d_with_id_t) xnn_compute_hmp_dqgemm;
@@ -2254,15 +2562,47 @@ static enum xnn_status reshape_fully_connected_nc(
       fully_connected_op->compute[0].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
     }
 #endif
+    if (fully_connected_op->has_gemm_epilogue) {
+      fully_connected_op->context.gemm.gemm.gemm.epilogue = &fully_connected_op->gemm_epilogue;
+      fully_connected_op->compute[0].type = xnn_parallelization_type_2d_tile_2d;
+      fully_connected_op->compute[0].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm_with_epilogue;
+    }
+    fully_connected_op->compute[0].context_offset = 0;
     fully_connected_op->compute[0].range[0] = batch_size;
     fully_connected_op->compute[0].range[1] = output_channels;
-    fully_connected_op->compute[0].tile[0] = mr;
+    fully_connected_op->compute[0].tile[0] = mc;
     fully_connected_op->compute[0].tile[1] = nc;
+    fully_connected_op->compute[1].type = xnn_parallelization_type_invalid;
+    if (expected_operator_type == xnn_operator_type_fully_connected_nc_f32) {
+      const enum xnn_status status = reshape_fully_connected_nc_f32_k_split(
+        fully_connected_op, batch_size, mr, nr, pthreadpool_get_threads_count(threadpool));
+      if (status != xnn_status_success) {
+        return status;
+      }
+    }
     fully_connected_op->state = xnn_run_state_needs_setup;
 
     return xnn_status_success;
 }
 
+enum xnn_status xnn_reshape_fully_connected_nc_bf16(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    pthreadpool_t threadpool)
+{
+  return reshape_fully_connected_nc(
+    fully_connected_op, xnn_operator_type_fully_connected_nc_bf16,
+    batch_size,
+    /*log2_input_element_size=*/XNN_LOG2_SIZEOF_HALF,
+    /*log2_filter_element_size=*/XNN_LOG2_SIZEOF_HALF,
+    /*filter_is_nibble=*/false,
+    /*dynamic_quantization=*/false,
+    /*log2_output_element_size=*/XNN_LOG2_SIZEOF_HALF,
+    &fully_connected_op->params.bf16_minmax,
+    sizeof(fully_connected_op->params.bf16_minmax),
+    threadpool);
+}
+
 enum xnn_status xnn_reshape_fully_connected_nc_f16(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -2637,6 +2977,99 @@ enum xnn_status xnn_reshape_fully_connected_nc_qu8(
     threadpool);
 }
 
+// Returns the task computing a tile of the GEMM of a reshaped Fully Connected operator, or NULL if the GEMM is not
+// computed by a single 2D-tiled task.
+static pthreadpool_task_2d_tile_2d_t get_fully_connected_gemm_task(const struct xnn_operator* fully_connected_op)
+{
+  if (fully_connected_op->has_gemm_epilogue) {
+    return NULL;
+  }
+  // K-split reshapes (xnn_compute_gemm_k_split followed by a reduction) are not a single 2D-tiled task, so they are
+  // kept as separate operators rather than losing the K-split.
+  const struct compute_parameters* compute = &fully_connected_op->compute[0];
+  if (compute->type != xnn_parallelization_type_2d_tile_2d ||
+      fully_connected_op->compute[1].type != xnn_parallelization_type_invalid) {
+    return NULL;
+  }
+  if (compute->task_2d_tile_2d == (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm ||
+      compute->task_2d_tile_2d == (pthreadpool_task_2d_tile_2d_t) xnn_compute_dqgemm ||
+      compute->task_2d_tile_2d == (pthreadpool_task_2d_tile_2d_t) xnn_compute_qp8gemm) {
+    return compute->task_2d_tile_2d;
+  }
+  return NULL;
+}
+
+enum xnn_status xnn_fuse_fully_connected_nc_outputs(
+  xnn_operator_t* fully_connected_ops,
+  size_t num_ops,
+  pthreadpool_t threadpool)
+{
+  assert(num_ops >= 1);
+  assert(num_ops <= XNN_MAX_GEMM_MULTI_OUTPUTS);
+  xnn_operator_t first_op = fully_connected_ops[0];
+  if (num_ops < 2 || first_op->state != xnn_run_state_needs_setup) {
+    return xnn_status_success;
+  }
+
+  const struct gemm_context* first_context = &first_op->context.gemm.gemm.gemm;
+  const pthreadpool_task_2d_tile_2d_t task = get_fully_connected_gemm_task(first_op);
+  if (task == NULL) {
+    return xnn_status_success;
+  }
+  const size_t batch_size = first_op->compute[0].range[0];
+  const uint32_t nr = first_op->ukernel.gemm.nr;
+  size_t output_channels = 0;
+  for (size_t i = 0; i < num_ops; i++) {
+    const struct xnn_operator* op = fully_connected_ops[i];
+    if (op->type != first_op->type || op->state != xnn_run_state_needs_setup ||
+        get_fully_connected_gemm_task(op) != task || op->compute[0].range[0] != batch_size ||
+        op->ukernel.gemm.nr != nr || op->context.gemm.gemm.gemm.mr != first_context->mr ||
+        op->context.gemm.gemm.gemm.k_scaled != first_context->k_scaled) {
+      return xnn_status_success;
+    }
+    output_channels += op->group_output_channels;
+  }
+
+  const size_t mr = first_context->mr;
+  size_t mc;
+  size_t nc;
+  xnn_gemm_best_tile_size(
+      /*num_groups=*/1, batch_size, output_channels,
+      /*m_stride=*/first_context->k_scaled,
+      /*n_stride=*/first_context->w_stride, mr, nr,
+      pthreadpool_get_threads_count(threadpool),
+      xnn_init_hardware_config()->l2_cache_size, &mc, &nc);
+  if (task == (pthreadpool_task_2d_tile_2d_t) xnn_compute_qp8gemm) {
+    // The packed left-hand side is laid out in blocks of `mr` rows.
+    mc = mr;
+  }
+
+  struct gemm_multi_output_context* context = &first_op->context.gemm.multi_output;
+  context->task = task;
+  context->num_gemms = num_ops;
+  size_t n_offset = 0;
+  for (size_t i = 0; i < num_ops; i++) {
+    xnn_operator_t op = fully_connected_ops[i];
+    context->gemm[i] = &op->context.gemm.gemm.gemm;
+    context->n[i] = op->group_output_channels;
+    context->n_offset[i] = n_offset;
+    n_offset += round_up(op->group_output_channels, nc);
+    op->compute[0].type = xnn_parallelization_type_invalid;
+    op->compute[1].type = xnn_parallelization_type_invalid;
+  }
+
+  first_op->compute[0].type = xnn_parallelization_type_2d_tile_2d;
+  first_op->compute[0].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm_multi_output;
+  first_op->compute[0].context_offset =
+    offsetof(struct xnn_operator, context.gemm.multi_output) - offsetof(struct xnn_operator, context);
+  first_op->compute[0].range[0] = batch_size;
+  first_op->compute[0].range[1] =
+    context->n_offset[num_ops - 1] + fully_connected_ops[num_ops - 1]->group_output_channels;
+  first_op->compute[0].tile[0] = mc;
+  first_op->compute[0].tile[1] = nc;
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_fully_connected_nc(
   xnn_operator_t fully_connected_op,
   enum xnn_operator_type expected_operator_type,
@@ -2682,6 +3115,16 @@ static enum xnn_status setup_fully_connected_nc(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_setup_fully_connected_nc_bf16(
+    xnn_operator_t fully_connected_op,
+    const void* input,
+    void* output)
+{
+  return setup_fully_connected_nc(
+    fully_connected_op, xnn_operator_type_fully_connected_nc_bf16,
+    input, output, /*quantization_params=*/NULL);
+}
+
 enum xnn_status xnn_setup_fully_connected_nc_f16(
     xnn_operator_t fully_connected_op,
     const void* input,
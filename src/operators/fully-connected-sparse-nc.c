@@ -0,0 +1,370 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "xnnpack.h"
+#include "xnnpack/allocator.h"
+#include "xnnpack/cache.h"
+#include "xnnpack/common.h"
+#include "xnnpack/compute.h"
+#include "xnnpack/config-types.h"
+#include "xnnpack/config.h"
+#include "xnnpack/log.h"
+#include "xnnpack/math.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/microkernel-type.h"
+#include "xnnpack/microkernel-utils.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator-utils.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/pack.h"
+#include "xnnpack/params.h"
+#include "pthreadpool.h"
+
+// Estimated cost of the dense and sparse representations of the weights, in
+// units of 1/20 of a dense multiply-add per output column. A non-zero 1xNR block
+// costs more than a dense multiply-add because the input channel is loaded from
+// an arbitrary offset, and a 2:4 group of 4 input channels costs 2 permuted
+// multiply-adds instead of 4 dense ones. The costs are measured with the x86
+// FMA3/AVX2 microkernels, the only ones in the sparse GEMM config.
+#define XNN_SPGEMM_DENSE_COST 20
+#define XNN_SPGEMM_1XN_BLOCK_COST 24
+#define XNN_SPGEMM_2OF4_GROUP_COST 52
+
+enum xnn_status xnn_create_fully_connected_sparse_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_code_cache_t code_cache,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* fully_connected_op_out)
+{
+  const enum xnn_operator_type operator_type = xnn_operator_type_fully_connected_sparse_nc_f32;
+  xnn_operator_t fully_connected_op = NULL;
+  float* transposed_kernel = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu input channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), input_channels);
+    goto error;
+  }
+
+  if (output_channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu output channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), output_channels);
+    goto error;
+  }
+
+  if (input_stride < input_channels) {
+    xnn_log_error(
+      "failed to create %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of input channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_stride, input_channels);
+    goto error;
+  }
+
+  if (output_stride < output_channels) {
+    xnn_log_error(
+      "failed to create %s operator with output element stride of %zu: "
+      "stride must be at least as large as the number of output channels (%zu)",
+      xnn_operator_type_to_string(operator_type), output_stride, output_channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (output_min > output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be less than or equal to upper bound",
+      xnn_operator_type_to_string(operator_type), output_min, output_max);
+    goto error;
+  }
+
+  const struct xnn_spgemm_config* spgemm_config = xnn_init_f32_spgemm_config();
+  if (spgemm_config == NULL) {
+    xnn_log_debug("using dense weights for %s operator: no sparse GEMM microkernels for this hardware",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_stride, output_stride, kernel, bias, output_min, output_max, flags,
+      code_cache, weights_cache, fully_connected_op_out);
+  }
+
+  status = xnn_status_out_of_memory;
+
+  // Sparse packing works on [output_channels, input_channels] weights.
+  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    const size_t transposed_kernel_size = output_channels * input_channels * sizeof(float);
+    transposed_kernel = xnn_allocate_memory(transposed_kernel_size);
+    if (transposed_kernel == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator transposed weights",
+        transposed_kernel_size, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    for (size_t oc = 0; oc < output_channels; oc++) {
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        transposed_kernel[oc * input_channels + ic] = kernel[ic * output_channels + oc];
+      }
+    }
+  }
+  const float* oi_kernel = transposed_kernel != NULL ? transposed_kernel : kernel;
+
+  const size_t nr = spgemm_config->nr;
+  const size_t num_tiles = divide_round_up(output_channels, nr);
+  struct xnn_spgemm_packing_params packing_params;
+  xnn_analyze_f32_spgemm_w(output_channels, input_channels, nr, oi_kernel, &packing_params);
+
+  const size_t num_groups = divide_round_up(input_channels, 4);
+  const size_t dense_cost = XNN_SPGEMM_DENSE_COST * input_channels * num_tiles;
+  const size_t block_cost = XNN_SPGEMM_1XN_BLOCK_COST * packing_params.num_nonzero_blocks;
+  const bool use_2of4 = packing_params.is_2of4 && spgemm_config->ukernel_2of4 != NULL &&
+    XNN_SPGEMM_2OF4_GROUP_COST * num_groups * num_tiles < block_cost;
+  const size_t sparse_cost = use_2of4 ? XNN_SPGEMM_2OF4_GROUP_COST * num_groups * num_tiles : block_cost;
+  const size_t tiles_size = use_2of4 ?
+    num_tiles * (nr * sizeof(float) + num_groups * 2 * nr * (sizeof(float) + sizeof(uint8_t))) :
+    num_tiles * (nr * sizeof(float) + sizeof(uint32_t)) +
+      packing_params.num_nonzero_blocks * (sizeof(uint32_t) + nr * sizeof(float));
+  // The byte offsets of input channels and of tiles are stored as 32-bit values.
+  const bool fits_offsets = input_channels <= UINT32_MAX / sizeof(float) && tiles_size <= UINT32_MAX;
+  if (sparse_cost >= dense_cost || !fits_offsets) {
+    xnn_log_debug("using dense weights for %s operator with %zu non-zero blocks of %zu",
+      xnn_operator_type_to_string(operator_type), packing_params.num_nonzero_blocks, input_channels * num_tiles);
+    xnn_release_memory(transposed_kernel);
+    return xnn_create_fully_connected_nc_f32(
+      input_channels, output_channels, input_stride, output_stride, kernel, bias, output_min, output_max, flags,
+      code_cache, weights_cache, fully_connected_op_out);
+  }
+
+  fully_connected_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (fully_connected_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  fully_connected_op->weights_cache = weights_cache;
+
+  // Packed weights consist of an array of byte offsets of the tiles, followed by
+  // the tiles of NR output channels, see xnn_pack_f32_spgemm_w and
+  // xnn_pack_f32_spgemm_2of4_w.
+  const size_t tile_offsets_size = round_up_po2(num_tiles * sizeof(uint32_t), XNN_ALLOCATION_ALIGNMENT);
+  const size_t packed_weights_size = tile_offsets_size + tiles_size + XNN_EXTRA_BYTES;
+  const size_t aligned_total_weights_size = round_up_po2(packed_weights_size, XNN_ALLOCATION_ALIGNMENT);
+
+  uint32_t cache_seed = output_channels ^ input_channels ^ nr ^ use_2of4 ^ operator_type;
+  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    cache_seed = ~cache_seed;
+  }
+  size_t cache_offset = XNN_CACHE_NOT_FOUND;
+  struct xnn_weights_cache_look_up_key cache_key;
+  cache_key.seed = cache_seed;
+  cache_key.kernel = kernel;
+  cache_key.bias = bias;
+  if (use_weights_cache(fully_connected_op)) {
+    cache_offset = xnn_weights_cache_look_up(
+      fully_connected_op->weights_cache, &cache_key);
+  }
+
+  if (cache_offset == XNN_CACHE_NOT_FOUND) {
+    void* weights_ptr = xnn_get_pointer_to_write_weights(
+        fully_connected_op, aligned_total_weights_size, 0);
+    if (weights_ptr == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        packed_weights_size, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    xnn_log_debug("allocated %zu bytes for packed weights in %s operator",
+      aligned_total_weights_size, xnn_operator_type_to_string(operator_type));
+
+    uint32_t* tile_offsets = (uint32_t*) weights_ptr;
+    void* tiles = (void*) ((uintptr_t) weights_ptr + tile_offsets_size);
+    if (use_2of4) {
+      xnn_pack_f32_spgemm_2of4_w(output_channels, input_channels, nr, oi_kernel, bias, tile_offsets, tiles);
+    } else {
+      xnn_pack_f32_spgemm_w(output_channels, input_channels, nr, oi_kernel, bias, tile_offsets, tiles);
+    }
+
+    if (use_weights_cache(fully_connected_op)) {
+      fully_connected_op->packed_weights.offset = xnn_look_up_or_insert_weights_cache(
+          fully_connected_op->weights_cache, &cache_key, weights_ptr, aligned_total_weights_size);
+    }
+  } else {
+    fully_connected_op->packed_weights.offset = cache_offset;
+  }
+  xnn_release_memory(transposed_kernel);
+  transposed_kernel = NULL;
+
+  fully_connected_op->group_input_channels = input_channels;
+  fully_connected_op->group_output_channels = output_channels;
+  fully_connected_op->input_pixel_stride = input_stride;
+  fully_connected_op->output_pixel_stride = output_stride;
+  fully_connected_op->num_nonzero_blocks = packing_params.num_nonzero_blocks;
+  fully_connected_op->num_output_channel_blocks = num_tiles;
+
+  spgemm_config->init.f32(&fully_connected_op->params.f32_minmax, output_min, output_max);
+
+  fully_connected_op->type = operator_type;
+  fully_connected_op->flags = flags;
+  fully_connected_op->ukernel.type = xnn_microkernel_type_spgemm;
+  fully_connected_op->ukernel.spgemm = (struct xnn_ukernel_spgemm) {
+    .function = use_2of4 ? spgemm_config->ukernel_2of4 : spgemm_config->ukernel,
+    .mr = spgemm_config->mr,
+    .nr = spgemm_config->nr,
+  };
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  *fully_connected_op_out = fully_connected_op;
+  return xnn_status_success;
+
+error:
+  xnn_release_memory(transposed_kernel);
+  xnn_delete_operator(fully_connected_op);
+  return status;
+}
+
+enum xnn_status xnn_reshape_fully_connected_sparse_nc_f32(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    pthreadpool_t threadpool)
+{
+  // Weights which are not sparse enough use a dense Fully Connected operator.
+  if (fully_connected_op->type == xnn_operator_type_fully_connected_nc_f32) {
+    return xnn_reshape_fully_connected_nc_f32(fully_connected_op, batch_size, threadpool);
+  }
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_sparse_nc_f32) {
+    xnn_log_error("failed to reshape operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_sparse_nc_f32),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to reshape %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    fully_connected_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const size_t num_tiles = fully_connected_op->num_output_channel_blocks;
+  const size_t mr = fully_connected_op->ukernel.spgemm.mr;
+  const size_t nr = fully_connected_op->ukernel.spgemm.nr;
+  const size_t tile_offsets_size = round_up_po2(num_tiles * sizeof(uint32_t), XNN_ALLOCATION_ALIGNMENT);
+  const void* weights = packed_weights(fully_connected_op);
+
+  fully_connected_op->context.spgemm = (struct spgemm_context) {
+    .k_scaled = fully_connected_op->group_input_channels * sizeof(float),
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .packed_w = (const void*) ((uintptr_t) weights + tile_offsets_size),
+    .tile_offsets = (const uint32_t*) weights,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .nr = nr,
+    .ukernel = fully_connected_op->ukernel.spgemm.function,
+  };
+  memcpy(&fully_connected_op->context.spgemm.params, &fully_connected_op->params.f32_minmax,
+    sizeof(fully_connected_op->params.f32_minmax));
+
+  const size_t nc = xnn_gemm_best_nc(
+    /*num_groups=*/1, batch_size, output_channels, mr, nr, pthreadpool_get_threads_count(threadpool));
+
+  fully_connected_op->compute[0].type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute[0].task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_spgemm;
+  fully_connected_op->compute[0].range[0] = batch_size;
+  fully_connected_op->compute[0].range[1] = output_channels;
+  fully_connected_op->compute[0].tile[0] = mr;
+  fully_connected_op->compute[0].tile[1] = nc;
+  fully_connected_op->compute[1].type = xnn_parallelization_type_invalid;
+  fully_connected_op->state = xnn_run_state_needs_setup;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_fully_connected_sparse_nc_f32(
+    xnn_operator_t fully_connected_op,
+    const float* input,
+    float* output)
+{
+  if (fully_connected_op->type == xnn_operator_type_fully_connected_nc_f32) {
+    return xnn_setup_fully_connected_nc_f32(fully_connected_op, input, output);
+  }
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_sparse_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_sparse_nc_f32),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (fully_connected_op->weights_cache != NULL &&
+      !xnn_weights_cache_is_finalized(fully_connected_op->weights_cache)) {
+    xnn_log_error("failed to setup %s operator: weights cache is not finalized",
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_state;
+  }
+
+  switch (fully_connected_op->state) {
+    case xnn_run_state_skip:
+      return xnn_status_success;
+    case xnn_run_state_invalid:
+      xnn_log_error(
+        "failed to setup %s operator: operator has not been reshaped yet",
+        xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_invalid_state;
+    case xnn_run_state_needs_setup:
+      // Operator has been reshaped, but not setup, continue with setup.
+    case xnn_run_state_ready:
+      // Operator has been reshaped, and we are setting up with different pointers.
+      break;
+  }
+
+  fully_connected_op->context.spgemm.a = input;
+  fully_connected_op->context.spgemm.c = output;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,156 @@
+// Copyright 2026 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "xnnpack.h"
+#include "xnnpack/common.h"
+#include "xnnpack/compute.h"
+#include "xnnpack/config-types.h"
+#include "xnnpack/config.h"
+#include "xnnpack/log.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator-utils.h"
+#include "xnnpack/operator.h"
+
+static const struct xnn_unary_elementwise_config* get_f32_activation_config(enum xnn_unary_operator activation)
+{
+  switch (activation) {
+    case xnn_unary_elu:
+      return xnn_init_f32_elu_config();
+    case xnn_unary_gelu:
+      return xnn_init_f32_gelu_config();
+    case xnn_unary_hardswish:
+      return xnn_init_f32_hswish_config();
+    case xnn_unary_leaky_relu:
+      return xnn_init_f32_lrelu_config();
+    case xnn_unary_sigmoid:
+      return xnn_init_f32_sigmoid_config();
+    case xnn_unary_tanh:
+      return xnn_init_f32_tanh_config();
+    default:
+      return NULL;
+  }
+}
+
+bool xnn_gemm_epilogue_supports_activation_f32(enum xnn_unary_operator activation)
+{
+  return get_f32_activation_config(activation) != NULL;
+}
+
+enum xnn_status xnn_fuse_gemm_epilogue_f32(
+  xnn_operator_t op,
+  bool has_scale,
+  bool has_residual,
+  enum xnn_unary_operator activation,
+  const union xnn_unary_params* activation_params,
+  float output_min,
+  float output_max)
+{
+  switch (op->type) {
+    case xnn_operator_type_fully_connected_nc_f32:
+      break;
+    case xnn_operator_type_convolution_nhwc_f32:
+      if (op->groups == 1 &&
+          (op->ukernel.type == xnn_microkernel_type_gemm || op->ukernel.type == xnn_microkernel_type_igemm)) {
+        break;
+      }
+      xnn_log_error(
+        "failed to fuse epilogue into %s operator: only non-grouped GEMM and IGEMM convolutions are supported",
+        xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_parameter;
+    default:
+      xnn_log_error(
+        "failed to fuse epilogue into %s operator: unsupported operator type",
+        xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_parameter;
+  }
+
+  if (isnan(output_min) || isnan(output_max) || output_min > output_max) {
+    xnn_log_error(
+      "failed to fuse epilogue into %s operator with [%.7g, %.7g] output range: invalid range",
+      xnn_operator_type_to_string(op->type), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_gemm_epilogue epilogue;
+  memset(&epilogue, 0, sizeof(epilogue));
+  if (has_scale) {
+    const struct xnn_binary_elementwise_config* vmul_config = xnn_init_f32_vmul_config();
+    if (vmul_config == NULL) {
+      xnn_log_error("failed to fuse epilogue into %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_hardware;
+    }
+    epilogue.vmul = vmul_config->op_ukernel;
+  }
+  if (has_residual) {
+    const struct xnn_binary_elementwise_config* vadd_config = xnn_init_f32_vadd_config();
+    if (vadd_config == NULL) {
+      xnn_log_error("failed to fuse epilogue into %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_hardware;
+    }
+    epilogue.vadd = vadd_config->op_ukernel;
+    epilogue.residual_stride = op->group_output_channels * sizeof(float);
+  }
+  if (activation != xnn_unary_invalid) {
+    const struct xnn_unary_elementwise_config* activation_config = get_f32_activation_config(activation);
+    if (activation_config == NULL) {
+      xnn_log_error("failed to fuse %s activation into epilogue of %s operator: unsupported activation",
+        xnn_unary_operator_to_string(activation), xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_parameter;
+    }
+    epilogue.activation = activation_config->ukernel;
+    if (activation_config->init != NULL) {
+      activation_config->init(&epilogue.activation_params, activation_params, NULL, NULL);
+    }
+  }
+  if (output_min != -INFINITY || output_max != INFINITY) {
+    const struct xnn_unary_elementwise_config* clamp_config = xnn_init_f32_clamp_config();
+    if (clamp_config == NULL) {
+      xnn_log_error("failed to fuse epilogue into %s operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(op->type));
+      return xnn_status_unsupported_hardware;
+    }
+    union xnn_unary_params clamp_params;
+    clamp_params.clamp.min = output_min;
+    clamp_params.clamp.max = output_max;
+    epilogue.clamp = clamp_config->ukernel;
+    clamp_config->init(&epilogue.clamp_params, &clamp_params, NULL, NULL);
+  }
+
+  op->gemm_epilogue = epilogue;
+  op->has_gemm_epilogue = true;
+  op->state = xnn_run_state_invalid;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_gemm_epilogue_f32(
+  xnn_operator_t op,
+  const float* scale,
+  const float* residual)
+{
+  if (!op->has_gemm_epilogue) {
+    xnn_log_error("failed to setup epilogue of %s operator: operator has no fused epilogue",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_state;
+  }
+  if ((op->gemm_epilogue.vmul != NULL) != (scale != NULL) ||
+      (op->gemm_epilogue.vadd != NULL) != (residual != NULL)) {
+    xnn_log_error("failed to setup epilogue of %s operator: scale and residual must be provided iff they were fused",
+      xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  op->gemm_epilogue.scale = scale;
+  op->gemm_epilogue.residual = residual;
+  return xnn_status_success;
+}
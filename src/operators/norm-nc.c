@@ -0,0 +1,340 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack.h"
+#include "xnnpack/allocator.h"
+#include "xnnpack/common.h"
+#include "xnnpack/compute.h"
+#include "xnnpack/config-types.h"
+#include "xnnpack/config.h"
+#include "xnnpack/log.h"
+#include "xnnpack/math.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/params.h"
+#include "pthreadpool.h"
+
+static bool is_quantized_output(enum xnn_datatype datatype) {
+  return datatype == xnn_datatype_qdint8 || datatype == xnn_datatype_qduint8;
+}
+
+static enum xnn_status create_norm_nc(
+    enum xnn_operator_type operator_type,
+    enum xnn_datatype input_datatype,
+    enum xnn_datatype output_datatype,
+    float epsilon,
+    uint32_t flags,
+    xnn_operator_t* norm_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_datatype != xnn_datatype_fp16 && input_datatype != xnn_datatype_fp32) {
+    xnn_log_error(
+      "failed to create %s operator with %s input: only %s and %s inputs are supported",
+      xnn_operator_type_to_string(operator_type), xnn_datatype_to_string(input_datatype),
+      xnn_datatype_to_string(xnn_datatype_fp16), xnn_datatype_to_string(xnn_datatype_fp32));
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (output_datatype != input_datatype && !is_quantized_output(output_datatype)) {
+    xnn_log_error(
+      "failed to create %s operator with %s input and %s output: "
+      "output must have the same datatype as the input, or be dynamically quantized",
+      xnn_operator_type_to_string(operator_type), xnn_datatype_to_string(input_datatype),
+      xnn_datatype_to_string(output_datatype));
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (!isfinite(epsilon) || epsilon < 0.0f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g epsilon: epsilon must be finite and non-negative",
+      xnn_operator_type_to_string(operator_type), epsilon);
+    return xnn_status_invalid_parameter;
+  }
+
+  const bool is_fp16 = input_datatype == xnn_datatype_fp16;
+  const struct xnn_norm_config* norm_config = is_fp16 ? xnn_init_f16_norm_config() : xnn_init_f32_norm_config();
+  const struct xnn_reduce_config* rminmax_config = NULL;
+  const struct xnn_unary_elementwise_config* cvt_config = NULL;
+  if (is_quantized_output(output_datatype)) {
+    rminmax_config = is_fp16 ? xnn_init_f16_rminmax_config() : xnn_init_f32_rminmax_config();
+    if (output_datatype == xnn_datatype_qdint8) {
+      cvt_config = is_fp16 ? xnn_init_f16_to_qs8_cvt_config() : xnn_init_f32_to_qs8_cvt_config();
+    } else {
+      cvt_config = is_fp16 ? xnn_init_f16_to_qu8_cvt_config() : xnn_init_f32_to_qu8_cvt_config();
+    }
+    if (rminmax_config == NULL || cvt_config == NULL) {
+      norm_config = NULL;
+    }
+  }
+  if (norm_config == NULL ||
+      (operator_type == xnn_operator_type_rms_norm_nc ? norm_config->rmsnorm == NULL : norm_config->layernorm == NULL)) {
+    xnn_log_error("failed to create %s operator: unsupported hardware configuration",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  xnn_operator_t norm_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (norm_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    return xnn_status_out_of_memory;
+  }
+
+  norm_op->norm.config = norm_config;
+  norm_op->norm.rminmax_config = rminmax_config;
+  norm_op->norm.cvt_config = cvt_config;
+  norm_op->norm.epsilon = epsilon;
+  norm_op->norm.input_datatype = input_datatype;
+  norm_op->norm.output_datatype = output_datatype;
+
+  norm_op->type = operator_type;
+  norm_op->flags = flags;
+  norm_op->state = xnn_run_state_invalid;
+
+  *norm_op_out = norm_op;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_layer_norm_nc(
+    enum xnn_datatype input_datatype,
+    enum xnn_datatype output_datatype,
+    float epsilon,
+    uint32_t flags,
+    xnn_operator_t* layer_norm_op_out)
+{
+  return create_norm_nc(
+    xnn_operator_type_layer_norm_nc, input_datatype, output_datatype, epsilon, flags, layer_norm_op_out);
+}
+
+enum xnn_status xnn_create_rms_norm_nc(
+    enum xnn_datatype input_datatype,
+    enum xnn_datatype output_datatype,
+    float epsilon,
+    uint32_t flags,
+    xnn_operator_t* rms_norm_op_out)
+{
+  return create_norm_nc(
+    xnn_operator_type_rms_norm_nc, input_datatype, output_datatype, epsilon, flags, rms_norm_op_out);
+}
+
+static enum xnn_status reshape_norm_nc(
+    xnn_operator_t norm_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    size_t batch_size,
+    size_t* workspace_size,
+    size_t* workspace_alignment,
+    pthreadpool_t threadpool)
+{
+  if (norm_op->type != expected_operator_type) {
+    xnn_log_error("failed to reshape operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(norm_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  norm_op->state = xnn_run_state_invalid;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to reshape %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(expected_operator_type), channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to reshape %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(expected_operator_type), input_stride, channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to reshape %s operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(expected_operator_type), output_stride, channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  norm_op->channels = channels;
+  norm_op->input_pixel_stride = input_stride;
+  norm_op->output_pixel_stride = output_stride;
+
+  *workspace_size = 0;
+  *workspace_alignment = 1;
+  if (batch_size == 0) {
+    norm_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  norm_op->batch_size = batch_size;
+
+  const bool is_fp16 = norm_op->norm.input_datatype == xnn_datatype_fp16;
+  const uint32_t log2_element_size = is_fp16 ? XNN_LOG2_SIZEOF_HALF : XNN_LOG2_SIZEOF_FLOAT;
+  const enum xnn_datatype output_datatype = norm_op->norm.output_datatype;
+  const bool quantized_output = is_quantized_output(output_datatype);
+  const uint32_t log2_output_element_size = quantized_output ? XNN_LOG2_SIZEOF_INT8_T : log2_element_size;
+  const bool is_layer_norm = expected_operator_type == xnn_operator_type_layer_norm_nc;
+  norm_op->context.norm = (struct norm_context) {
+    .n = channels << log2_element_size,
+    .x_stride = input_stride << log2_element_size,
+    .y_stride = output_stride << log2_output_element_size,
+    .epsilon = norm_op->norm.epsilon,
+    .rmsnorm_ukernel = is_layer_norm ? NULL : norm_op->norm.config->rmsnorm,
+    .layernorm_ukernel = is_layer_norm ? norm_op->norm.config->layernorm : NULL,
+    .batch_size = batch_size,
+  };
+
+  if (!quantized_output) {
+    norm_op->compute[0].type = xnn_parallelization_type_1d;
+    norm_op->compute[0].task_1d = (pthreadpool_task_1d_t) xnn_compute_norm;
+    norm_op->compute[0].range[0] = batch_size;
+    norm_op->state = xnn_run_state_needs_setup;
+    return xnn_status_success;
+  }
+
+  // Each thread normalizes its current row into its own row buffer, and quantizes the row from there while it is still
+  // in cache.
+  struct norm_context* context = &norm_op->context.norm;
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  context->row_buffer_stride = round_up_po2(context->n + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+  context->rminmax_ukernel = norm_op->norm.rminmax_config->ukernel;
+  context->convert_ukernel = norm_op->norm.cvt_config->ukernel;
+  *workspace_size = num_threads * context->row_buffer_stride;
+  *workspace_alignment = XNN_ALLOCATION_ALIGNMENT;
+
+  norm_op->compute[0].type = xnn_parallelization_type_1d_with_thread;
+  if (is_fp16) {
+    norm_op->compute[0].task_1d_with_thread = output_datatype == xnn_datatype_qdint8 ?
+      (pthreadpool_task_1d_with_thread_t) xnn_compute_f16_norm_qd8 :
+      (pthreadpool_task_1d_with_thread_t) xnn_compute_f16_norm_qdu8;
+  } else {
+    norm_op->compute[0].task_1d_with_thread = output_datatype == xnn_datatype_qdint8 ?
+      (pthreadpool_task_1d_with_thread_t) xnn_compute_f32_norm_qd8 :
+      (pthreadpool_task_1d_with_thread_t) xnn_compute_f32_norm_qdu8;
+  }
+  norm_op->compute[0].range[0] = batch_size;
+  norm_op->state = xnn_run_state_needs_setup;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reshape_layer_norm_nc(
+    xnn_operator_t layer_norm_op,
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    size_t batch_size,
+    size_t* workspace_size,
+    size_t* workspace_alignment,
+    pthreadpool_t threadpool)
+{
+  return reshape_norm_nc(
+    layer_norm_op, xnn_operator_type_layer_norm_nc, channels, input_stride, output_stride, batch_size,
+    workspace_size, workspace_alignment, threadpool);
+}
+
+enum xnn_status xnn_reshape_rms_norm_nc(
+    xnn_operator_t rms_norm_op,
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    size_t batch_size,
+    size_t* workspace_size,
+    size_t* workspace_alignment,
+    pthreadpool_t threadpool)
+{
+  return reshape_norm_nc(
+    rms_norm_op, xnn_operator_type_rms_norm_nc, channels, input_stride, output_stride, batch_size,
+    workspace_size, workspace_alignment, threadpool);
+}
+
+static enum xnn_status setup_norm_nc(
+    xnn_operator_t norm_op,
+    enum xnn_operator_type expected_operator_type,
+    void* workspace,
+    const void* input,
+    const void* scale,
+    const void* bias,
+    void* output,
+    struct xnn_quantization_params* quantization_params)
+{
+  if (norm_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(norm_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (norm_op->state) {
+    case xnn_run_state_skip:
+      return xnn_status_success;
+    case xnn_run_state_invalid:
+      xnn_log_error(
+        "failed to setup %s operator: operator has not been reshaped yet",
+        xnn_operator_type_to_string(norm_op->type));
+      return xnn_status_invalid_state;
+    case xnn_run_state_needs_setup:
+      // Operator has been reshaped, but not setup, continue with setup.
+    case xnn_run_state_ready:
+      // Operator has been reshaped, and we are setting up with different pointers.
+      break;
+  }
+
+  struct norm_context* context = &norm_op->context.norm;
+  context->x = input;
+  context->scale = scale;
+  context->bias = bias;
+  context->y = output;
+  if (is_quantized_output(norm_op->norm.output_datatype)) {
+    context->row_buffer = workspace;
+    context->quantization_params = (struct xnn_qd8_quantization_params*) quantization_params;
+  }
+  norm_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_layer_norm_nc(
+    xnn_operator_t layer_norm_op,
+    void* workspace,
+    const void* input,
+    const void* scale,
+    const void* bias,
+    void* output,
+    struct xnn_quantization_params* quantization_params)
+{
+  return setup_norm_nc(
+    layer_norm_op, xnn_operator_type_layer_norm_nc, workspace, input, scale, bias, output, quantization_params);
+}
+
+enum xnn_status xnn_setup_rms_norm_nc(
+    xnn_operator_t rms_norm_op,
+    void* workspace,
+    const void* input,
+    const void* scale,
+    void* output,
+    struct xnn_quantization_params* quantization_params)
+{
+  return setup_norm_nc(
+    rms_norm_op, xnn_operator_type_rms_norm_nc, workspace, input, scale, /*bias=*/NULL, output, quantization_params);
+}
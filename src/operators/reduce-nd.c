@@ -5,6 +5,7 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -27,6 +28,7 @@
 #include "pthreadpool.h"
 
 static enum xnn_status create_reduce_nd(
+    enum xnn_reduce_operator reduce_operator,
     uint32_t flags,
     uint32_t log2_data_element_size,
     uint32_t log2_accumulator_element_size,
@@ -68,6 +70,7 @@ static enum xnn_status create_reduce_nd(
   reduce_op->u32_f32_cvt_config = u32_f32_cvt_config;
   reduce_op->reduce.log2_data_element_size = log2_data_element_size;
   reduce_op->reduce.log2_accumulator_element_size = log2_accumulator_element_size;
+  reduce_op->reduce.reduce_operator = reduce_operator;
   if (params_size != 0) {
     memcpy(&reduce_op->params, params, params_size);
   }
@@ -88,6 +91,29 @@ static int cmp_value_size_t(const void* a_ptr, const void* b_ptr) {
   return (b < a) - (b > a);
 }
 
+// Returns the bit pattern of the identity element of a reduction, which pads
+// the rows read past the end of the input and seeds the discontiguous output.
+static uint32_t reduce_identity(
+    enum xnn_reduce_operator reduce_operator,
+    uint32_t log2_data_element_size)
+{
+  const bool is_f16 = log2_data_element_size == 1;
+  switch (reduce_operator) {
+    case xnn_reduce_max:
+    case xnn_reduce_argmax:
+      // -infinity
+      return is_f16 ? UINT32_C(0xFC00) : UINT32_C(0xFF800000);
+    case xnn_reduce_min:
+      // +infinity
+      return is_f16 ? UINT32_C(0x7C00) : UINT32_C(0x7F800000);
+    case xnn_reduce_prod:
+      // 1.0
+      return is_f16 ? UINT32_C(0x3C00) : UINT32_C(0x3F800000);
+    default:
+      return 0;
+  }
+}
+
 static enum xnn_status reshape_reduce_nd(
     xnn_operator_t reduce_op, size_t num_reduction_axes,
     const int64_t* reduction_axes, size_t num_input_dims,
@@ -189,6 +215,11 @@ static enum xnn_status reshape_reduce_nd(
   }
   const uint32_t log2_data_element_size = reduce_op->reduce.log2_data_element_size;
   const uint32_t log2_accumulator_element_size = reduce_op->reduce.log2_accumulator_element_size;
+  const enum xnn_reduce_operator reduce_operator = reduce_op->reduce.reduce_operator;
+  const uint32_t identity = reduce_identity(reduce_operator, log2_data_element_size);
+  // ArgMax writes int32 indices rather than elements of the input type.
+  const size_t output_element_size = reduce_operator == xnn_reduce_argmax
+      ? sizeof(int32_t) : UINT32_C(1) << log2_data_element_size;
   reduce_op->compute[0].type = xnn_parallelization_type_3d_tile_2d;
   reduce_op->ukernel.type = xnn_microkernel_type_mean;
   // Reduction along the innermost dimension.
@@ -198,7 +229,7 @@ static enum xnn_status reshape_reduce_nd(
   if (normalized_reduction_axes[num_reduction_axes - 1] == num_input_dims - 1) {
     if (workspace_size != NULL) {
       const size_t num_output_elements = normalized_input_shape[0] * normalized_input_shape[2] * normalized_input_shape[4];
-      *workspace_size = (num_output_elements << log2_accumulator_element_size) + XNN_EXTRA_BYTES;
+      *workspace_size = reduce_op->cvt_config != NULL ? (num_output_elements << log2_accumulator_element_size) + XNN_EXTRA_BYTES : 0;
     }
     const size_t scale_dim = normalized_input_shape[1] * normalized_input_shape[3] * normalized_input_shape[5];
     const size_t axis_dim = normalized_input_shape[5];
@@ -215,7 +246,9 @@ static enum xnn_status reshape_reduce_nd(
       .channels = axis_dim << log2_data_element_size,
       .ukernel.rsum = reduce_op->rsum_config->ukernel,
       .accumulation_element_size = UINT32_C(1) << log2_accumulator_element_size,
-      .output_element_size = UINT32_C(1) << log2_data_element_size,
+      .output_element_size = output_element_size,
+      .reduce_operator = reduce_operator,
+      .identity = identity,
     };
     memcpy(&reduce_op->context.reduce.params, &reduce_op->params.reduce, sizeof(reduce_op->params.reduce));
 
@@ -241,7 +274,7 @@ static enum xnn_status reshape_reduce_nd(
     const size_t channel_like_dim = normalized_input_shape[XNN_MAX_TENSOR_DIMS - 1];
     if (workspace_size != NULL) {
       const size_t num_output_elements = normalized_input_shape[1] * normalized_input_shape[3] * normalized_input_shape[5];
-      *workspace_size = (num_output_elements << log2_accumulator_element_size) + XNN_EXTRA_BYTES;
+      *workspace_size = reduce_op->cvt_config != NULL ? (num_output_elements << log2_accumulator_element_size) + XNN_EXTRA_BYTES : 0;
     }
     const size_t scale_dim = normalized_input_shape[0] * normalized_input_shape[2] * normalized_input_shape[4];
     const size_t axis_dim = normalized_input_shape[4];
@@ -264,6 +297,20 @@ static enum xnn_status reshape_reduce_nd(
           zero_size, xnn_operator_type_to_string(reduce_op->type));
         return xnn_status_out_of_memory;
       }
+      if (identity != 0) {
+        if (log2_data_element_size == 1) {
+          uint16_t* zero = (uint16_t*) reduce_op->zero_buffer;
+          for (size_t i = 0; i < channel_like_dim; i++) {
+            zero[i] = (uint16_t) identity;
+          }
+        } else {
+          assert(log2_data_element_size == 2);
+          uint32_t* zero = (uint32_t*) reduce_op->zero_buffer;
+          for (size_t i = 0; i < channel_like_dim; i++) {
+            zero[i] = identity;
+          }
+        }
+      }
       reduce_op->channels = channel_like_dim;
     }
 
@@ -272,7 +319,9 @@ static enum xnn_status reshape_reduce_nd(
       .channels = axis_dim,
       .ukernel.rdsum = reduce_op->rdsum_config->rd_ukernel,
       .accumulation_element_size = UINT32_C(1) << log2_accumulator_element_size,
-      .output_element_size = UINT32_C(1) << log2_data_element_size,
+      .output_element_size = output_element_size,
+      .reduce_operator = reduce_operator,
+      .identity = identity,
     };
     memcpy(&reduce_op->context.reduce.params, &reduce_op->params.reduce, sizeof(reduce_op->params.reduce));
     reduce_op->compute[0].task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_discontiguous_reduce;
@@ -336,12 +385,80 @@ static enum xnn_status setup_reduce_nd(
 
   reduce_op->context.reduce.input = input;
   reduce_op->context.reduce.output = output;
-  reduce_op->context.reduce.workspace = workspace;
+  // Only reductions which convert the accumulators to the output type use the
+  // workspace.
+  reduce_op->context.reduce.workspace = reduce_op->cvt_config != NULL ? workspace : NULL;
   reduce_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
 }
 
+// Max, min, prod and argmax reductions accumulate in the input type, and their
+// microkernels update the output in place, so no conversion is needed.
+static enum xnn_status create_minmax_prod_reduce_nd(
+    enum xnn_reduce_operator reduce_operator_type,
+    enum xnn_datatype datatype,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  enum xnn_operator_type operator_type = xnn_reduce_operator_to_operator_type(reduce_operator_type);
+
+  const struct xnn_reduce_config* config = NULL;
+  switch (datatype) {
+    case xnn_datatype_fp16:
+      switch (reduce_operator_type) {
+        case xnn_reduce_max:
+        case xnn_reduce_argmax:
+          config = xnn_init_f16_reduce_max_config();
+          break;
+        case xnn_reduce_min:
+          config = xnn_init_f16_reduce_min_config();
+          break;
+        default:
+          xnn_log_error("failed to create %s operator: unsupported data type: %s",
+                        xnn_operator_type_to_string(operator_type),
+                        xnn_datatype_to_string(datatype));
+          return xnn_status_unsupported_parameter;
+      }
+      break;
+    case xnn_datatype_fp32:
+      switch (reduce_operator_type) {
+        case xnn_reduce_max:
+        case xnn_reduce_argmax:
+          config = xnn_init_f32_reduce_max_config();
+          break;
+        case xnn_reduce_min:
+          config = xnn_init_f32_reduce_min_config();
+          break;
+        default:
+          assert(reduce_operator_type == xnn_reduce_prod);
+          config = xnn_init_f32_reduce_prod_config();
+          break;
+      }
+      break;
+    default:
+      xnn_log_error("failed to create %s operator: unsupported data type: %s",
+                    xnn_operator_type_to_string(operator_type),
+                    xnn_datatype_to_string(datatype));
+      return xnn_status_unsupported_parameter;
+  }
+
+  if (config == NULL) {
+    xnn_log_error(
+        "failed to create %s (%s) operator: unsupported hardware configuration",
+        xnn_operator_type_to_string(operator_type), xnn_datatype_to_string(datatype));
+    return xnn_status_unsupported_hardware;
+  }
+
+  const uint32_t log2_data_element_size = xnn_datatype_log2_size_bytes(datatype);
+  return create_reduce_nd(
+    reduce_operator_type, flags, log2_data_element_size,
+    /*log2_accumulator_element_size=*/log2_data_element_size, operator_type,
+    /*rdsum_config=*/config, /*rsum_config=*/config, /*cvt_config=*/NULL,
+    /*s32_f32_cvt_config=*/NULL, /*u32_f32_cvt_config=*/NULL,
+    /*params=*/NULL, /*params_size=*/0, reduce_op_out);
+}
+
 enum xnn_status xnn_create_reduce_nd(
     const enum xnn_reduce_operator reduce_operator_type,
     const enum xnn_datatype datatype,
@@ -350,6 +467,16 @@ enum xnn_status xnn_create_reduce_nd(
     uint32_t flags,
     xnn_operator_t* reduce_op_out)
 {
+  switch (reduce_operator_type) {
+    case xnn_reduce_max:
+    case xnn_reduce_min:
+    case xnn_reduce_prod:
+    case xnn_reduce_argmax:
+      return create_minmax_prod_reduce_nd(reduce_operator_type, datatype, flags, reduce_op_out);
+    default:
+      break;
+  }
+
   enum xnn_operator_type operator_type = xnn_reduce_operator_to_operator_type(reduce_operator_type);
 
   // The config initialization functions return NULL on error. Because each
@@ -433,7 +560,7 @@ enum xnn_status xnn_create_reduce_nd(
   }
 
   return create_reduce_nd(
-    flags, log2_data_element_size, log2_accumulator_element_size, operator_type,
+    reduce_operator_type, flags, log2_data_element_size, log2_accumulator_element_size, operator_type,
     rdsum_config, rsum_config, cvt_config, s32_f32_cvt_config,
     u32_f32_cvt_config, &params, params_size, reduce_op_out);
 }
@@ -4,7 +4,9 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <float.h>
 #include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -15,6 +17,7 @@
 #include "xnnpack/compute.h"
 #include "xnnpack/config-types.h"
 #include "xnnpack/config.h"
+#include "xnnpack/internal.h"
 #include "xnnpack/log.h"
 #include "xnnpack/math.h"
 #include "xnnpack/microkernel-type.h"
@@ -340,6 +343,45 @@ static void compute_reciprocal_f32(
   *output = 1.0f / *input;
 }
 
+static void update_online_softmax_max_f16(
+  const xnn_float16 block_max[XNN_MIN_ELEMENTS(1)],
+  xnn_float16 max[XNN_MIN_ELEMENTS(1)],
+  xnn_float16 rescale[XNN_MIN_ELEMENTS(1)])
+{
+  const float old_max = xnn_float16_to_float(*max);
+  const float new_max = math_max_f32(old_max, xnn_float16_to_float(*block_max));
+  *max = xnn_float16_from_float(new_max);
+  *rescale = xnn_float16_from_float(expf(old_max - new_max));
+}
+
+static void update_online_softmax_max_f32(
+  const float block_max[XNN_MIN_ELEMENTS(1)],
+  float max[XNN_MIN_ELEMENTS(1)],
+  float rescale[XNN_MIN_ELEMENTS(1)])
+{
+  const float old_max = *max;
+  const float new_max = math_max_f32(old_max, *block_max);
+  *max = new_max;
+  *rescale = expf(old_max - new_max);
+}
+
+static void update_online_softmax_sum_f16(
+  const xnn_float16 block_sum[XNN_MIN_ELEMENTS(1)],
+  const xnn_float16 rescale[XNN_MIN_ELEMENTS(1)],
+  xnn_float16 sum[XNN_MIN_ELEMENTS(1)])
+{
+  *sum = xnn_float16_from_float(
+    xnn_float16_to_float(*sum) * xnn_float16_to_float(*rescale) + xnn_float16_to_float(*block_sum));
+}
+
+static void update_online_softmax_sum_f32(
+  const float block_sum[XNN_MIN_ELEMENTS(1)],
+  const float rescale[XNN_MIN_ELEMENTS(1)],
+  float sum[XNN_MIN_ELEMENTS(1)])
+{
+  *sum = *sum * *rescale + *block_sum;
+}
+
 static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
   xnn_operator_t attention_op,
   enum xnn_operator_type expected_operator_type,
@@ -348,6 +390,7 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
   size_t query_tokens,
   size_t key_value_heads,
   size_t key_value_tokens,
+  size_t key_value_tokens_stride,
   size_t query_key_channels,
   size_t value_channels,
   size_t* workspace_size,
@@ -355,6 +398,9 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
   size_t log2_element_size,
   size_t element_size,
   xnn_compute_reciprocal_fn compute_reciprocal,
+  xnn_update_online_softmax_max_fn update_max,
+  xnn_update_online_softmax_sum_fn update_sum,
+  const void* lowest,
   void* cap,
   void* cap_reciprocal,
   size_t cap_size,
@@ -403,10 +449,11 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     return xnn_status_invalid_parameter;
   }
 
-  if (key_value_heads != 1 && key_value_heads != query_heads) {
+  if (query_heads % key_value_heads != 0) {
     xnn_log_error(
-      "failed to create %s operator with number of key/value heads %zu: number of key/value heads must be either 1 or "
-      "equal to number of query heads", xnn_operator_type_to_string(expected_operator_type), key_value_heads);
+      "failed to create %s operator with number of key/value heads %zu: number of query heads (%zu) must be divisible "
+      "by number of key/value heads", xnn_operator_type_to_string(expected_operator_type), key_value_heads,
+      query_heads);
     return xnn_status_invalid_parameter;
   }
 
@@ -424,6 +471,14 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     return xnn_status_invalid_parameter;
   }
 
+  if (key_value_tokens_stride < key_value_tokens) {
+    xnn_log_error(
+      "failed to create %s operator with key/value tokens stride of %zu: key/value tokens stride must be greater than "
+      "or equal to key/value tokens (%zu)", xnn_operator_type_to_string(expected_operator_type),
+      key_value_tokens_stride, key_value_tokens);
+    return xnn_status_invalid_parameter;
+  }
+
   if (query_key_channels == 0) {
     xnn_log_error(
       "failed to create %s operator with %zu channels: query/key channels must be non-zero",
@@ -438,6 +493,15 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     return xnn_status_invalid_parameter;
   }
 
+  const bool causal = (attention_op->flags & XNN_FLAG_CAUSAL_MASK) != 0;
+  if (causal && key_value_tokens < query_tokens) {
+    xnn_log_error(
+      "failed to reshape %s operator with causal mask, %zu query tokens and %zu key/value tokens: key/value tokens must "
+      "be greater than or equal to query tokens", xnn_operator_type_to_string(expected_operator_type), query_tokens,
+      key_value_tokens);
+    return xnn_status_invalid_parameter;
+  }
+
   const uint32_t mr = attention_op->ukernel.gemm.mr;
   const uint32_t nr = attention_op->ukernel.gemm.nr;
   const uint32_t kr = attention_op->ukernel.gemm.kr;
@@ -446,7 +510,15 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
   const size_t num_threads = pthreadpool_get_threads_count(threadpool);
   const size_t size_using_threads = num_threads * mr;
   const size_t size_using_batch = batch_size * query_heads * query_tokens;
-  const bool use_threads_workspace_size = size_using_threads < size_using_batch;
+
+  // With many key/value tokens, process them in blocks with online softmax (as in FlashAttention), so that each
+  // thread only needs space for the logits of a block of key/value tokens, rather than for all key/value tokens.
+  const size_t key_value_tokens_tile = round_up(256, nr);
+  const bool use_tiled_attention = key_value_tokens > 2 * key_value_tokens_tile;
+  const size_t num_key_value_tiles = use_tiled_attention ? divide_round_up(key_value_tokens, key_value_tokens_tile) : 1;
+
+  // The tiled implementation always sizes the workspace using the number of threads.
+  const bool use_threads_workspace_size = use_tiled_attention || size_using_threads < size_using_batch;
   const size_t workspace_multiplier = use_threads_workspace_size ? size_using_threads : size_using_batch;
   // Calculate size required for workspace.
   // 1. Workspace for Q scaled, each thread computes a maximum of mr * query_key_channels.
@@ -460,15 +532,32 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
   // 2. Workspace for packed key.
   const size_t packed_key_size = round_up_po2(batch_size * key_value_heads * key_head_stride, XNN_ALLOCATION_ALIGNMENT);
 
-  // Value is [key_value_tokens (input channel), channels (output channel)].
+  // Value is [key_value_tokens (input channel), channels (output channel)]. The tiled implementation packs each block
+  // of key_value_tokens_tile tokens as a separate matrix.
   const size_t value_n_stride = round_up(value_channels, nr);
-  const size_t value_k_stride = round_up_po2(key_value_tokens, kr * sr);
-  const size_t value_head_stride = value_n_stride * (element_size + (value_k_stride << log2_element_size));
+  const size_t value_k_stride =
+    round_up_po2(use_tiled_attention ? key_value_tokens_tile : key_value_tokens, kr * sr);
+  const size_t value_tile_stride = value_n_stride * (element_size + (value_k_stride << log2_element_size));
+  const size_t value_head_stride = num_key_value_tiles * value_tile_stride;
   // 3. Workspace for packed key.
   const size_t packed_value_size = round_up_po2(batch_size * key_value_heads * value_head_stride, XNN_ALLOCATION_ALIGNMENT);
 
   // 4. Workspace for logits (Q*K), each thread computes mr * key_value_tokens.
-  const size_t logits_size =
+  // The tiled implementation only needs mr * key_value_tokens_tile logits, but also needs space for the accumulated
+  // output, the output of a block, and the running maximum, sum, and rescale factor of each row.
+  size_t logits_thread_stride = mr * key_value_tokens * element_size;
+  const size_t accumulator_offset = round_up_po2(mr * key_value_tokens_tile * element_size, XNN_ALLOCATION_ALIGNMENT);
+  const size_t block_output_offset =
+    accumulator_offset + round_up_po2(mr * value_channels * element_size, XNN_ALLOCATION_ALIGNMENT);
+  const size_t row_max_offset =
+    block_output_offset + round_up_po2(mr * value_channels * element_size, XNN_ALLOCATION_ALIGNMENT);
+  const size_t row_sum_offset = row_max_offset + mr * element_size;
+  const size_t row_rescale_offset = row_sum_offset + mr * element_size;
+  if (use_tiled_attention) {
+    logits_thread_stride = round_up_po2(row_rescale_offset + mr * element_size, XNN_ALLOCATION_ALIGNMENT);
+  }
+  const size_t logits_size = use_tiled_attention ?
+    round_up_po2(num_threads * logits_thread_stride + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT) :
     round_up_po2(workspace_multiplier * key_value_tokens * element_size + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
 
   const size_t total_workspace_size = scaled_query_size + packed_key_size + packed_value_size + logits_size;
@@ -486,7 +575,7 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     // b_stride and gb_stride not needed because we do not have bias.
     .w_stride = element_size + (key_k_stride << log2_element_size),
     .packw_gemm_goi = attention_op->ukernel.gemm.packw_gemm_goi,
-    .gk_stride = key_value_tokens * (query_key_channels << log2_element_size),
+    .gk_stride = key_value_tokens_stride * (query_key_channels << log2_element_size),
     .gc_stride = key_head_stride,
   };
   attention_op->compute[0].type = xnn_parallelization_type_2d_tile_1d;
@@ -510,17 +599,29 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     // b_stride and gb_stride not needed because we do not have bias.
     .w_stride = element_size + (value_k_stride << log2_element_size),
     .packw_gemm_gio = attention_op->ukernel.gemm.packw_gemm_gio,
-    .gk_stride = key_value_tokens * (value_channels << log2_element_size),
+    .gk_stride = key_value_tokens_stride * (value_channels << log2_element_size),
     .gb_stride = value_channels * element_size,
     .gc_stride = value_head_stride,
   };
-  attention_op->compute[1].type = xnn_parallelization_type_2d_tile_1d;
-  attention_op->compute[1].task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_batched_packw_gemm_gio;
   attention_op->compute[1].context_offset =
     offsetof(struct xnn_operator, context.gemm.packw_gemm_gio) - offsetof(struct xnn_operator, context);
-  attention_op->compute[1].range[0] = batch_size * key_value_heads;
-  attention_op->compute[1].range[1] = value_channels;
-  attention_op->compute[1].tile[0] = value_channels;
+  if (use_tiled_attention) {
+    attention_op->context.gemm.packw_gemm_gio.kc_tile = key_value_tokens_tile;
+    attention_op->context.gemm.packw_gemm_gio.gc_tile_stride = value_tile_stride;
+    attention_op->compute[1].type = xnn_parallelization_type_3d_tile_1d;
+    attention_op->compute[1].task_3d_tile_1d =
+      (pthreadpool_task_3d_tile_1d_t) xnn_compute_batched_packw_gemm_gio_tiled;
+    attention_op->compute[1].range[0] = batch_size * key_value_heads;
+    attention_op->compute[1].range[1] = num_key_value_tiles;
+    attention_op->compute[1].range[2] = value_channels;
+    attention_op->compute[1].tile[0] = value_channels;
+  } else {
+    attention_op->compute[1].type = xnn_parallelization_type_2d_tile_1d;
+    attention_op->compute[1].task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_batched_packw_gemm_gio;
+    attention_op->compute[1].range[0] = batch_size * key_value_heads;
+    attention_op->compute[1].range[1] = value_channels;
+    attention_op->compute[1].tile[0] = value_channels;
+  }
 
   struct xnn_hmp_gemm_ukernel gemm_ukernel = attention_op->ukernel.gemm.gemm_cases[mr - 1];
 
@@ -531,19 +632,33 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     .query_key_scaled_channels = query_key_channels * element_size,
     .value_channels = value_channels,
     .value_scaled_channels = value_channels * element_size,
+    .causal = causal,
+    .causal_offset = causal ? key_value_tokens - query_tokens : 0,
     .cn_stride = nr << log2_element_size,
     .query_batch_stride = query_heads * query_tokens * query_key_channels * element_size,
     .query_head_stride = query_tokens * query_key_channels * element_size,
     .key_batch_stride = key_value_heads * key_head_stride,
-    .key_head_stride = key_value_heads == 1 ? 0 : key_head_stride,
+    .key_head_stride = key_head_stride,
     .value_batch_stride = key_value_heads * value_head_stride,
-    .value_head_stride = key_value_heads == 1 ? 0 : value_head_stride,
+    .value_head_stride = value_head_stride,
+    .query_heads_per_key_value_head = query_heads / key_value_heads,
     .logits_batch_stride = query_heads * query_tokens * key_value_tokens * element_size,
     .logits_head_stride = query_tokens * key_value_tokens * element_size,
     .output_batch_stride = query_heads * query_tokens * value_channels * element_size,
     .output_head_stride = query_tokens * value_channels * element_size,
     .scaled_query_thread_stride = mr * query_key_channels * element_size,
-    .logits_thread_stride = mr * key_value_tokens * element_size,
+    .logits_thread_stride = logits_thread_stride,
+    .element_size = element_size,
+    .key_value_tokens_tile = key_value_tokens_tile,
+    .key_tile_stride = key_value_tokens_tile * (element_size + (key_k_stride << log2_element_size)),
+    .value_tile_stride = value_tile_stride,
+    .accumulator_offset = accumulator_offset,
+    .block_output_offset = block_output_offset,
+    .row_max_offset = row_max_offset,
+    .row_sum_offset = row_sum_offset,
+    .row_rescale_offset = row_rescale_offset,
+    .update_max = update_max,
+    .update_sum = update_sum,
     .gemm_ukernel = gemm_ukernel,
     .compute_reciprocal = compute_reciprocal,
     .raddstoreexpminusmax_ukernel = attention_op->attention.raddstoreexpminusmax_config->ukernel,
@@ -554,6 +669,8 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
     .vtanh_ukernel = attention_op->attention.vtanh_config->ukernel,
   };
 
+  memcpy(&attention_op->context.gemm.gemm.attention.lowest, lowest, element_size);
+
   if (attention_op->attention.cap_type == xnn_attention_logits_cap_type_tanh) {
     attention_op->context.gemm.gemm.attention.logits_cap.type = xnn_attention_logits_cap_type_tanh;
     memcpy(&attention_op->context.gemm.gemm.attention.logits_cap.cap, cap, cap_size);
@@ -562,7 +679,11 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
 
   #if XNN_MAX_UARCH_TYPES > 1
     if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
-      if (use_threads_workspace_size) {
+      if (use_tiled_attention) {
+        attention_op->compute[2].type = xnn_parallelization_type_3d_tile_1d_with_uarch_with_thread;
+        attention_op->compute[2].task_3d_tile_1d_with_id_with_thread =
+          (pthreadpool_task_3d_tile_1d_with_id_with_thread_t) xnn_compute_hmp_tiled_scaled_dot_product_attention_with_thread;
+      } else if (use_threads_workspace_size) {
         attention_op->compute[2].type = xnn_parallelization_type_3d_tile_1d_with_uarch_with_thread;
         attention_op->compute[2].task_3d_tile_1d_with_id_with_thread =
           (pthreadpool_task_3d_tile_1d_with_id_with_thread_t) xnn_compute_hmp_scaled_dot_product_attention_with_thread;
@@ -572,7 +693,11 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
           (pthreadpool_task_3d_tile_1d_with_id_t) xnn_compute_hmp_scaled_dot_product_attention;
       }
     } else {
-      if (use_threads_workspace_size) {
+      if (use_tiled_attention) {
+        attention_op->compute[2].type = xnn_parallelization_type_3d_tile_1d_with_thread;
+        attention_op->compute[2].task_3d_tile_1d_with_thread =
+          (pthreadpool_task_3d_tile_1d_with_thread_t) xnn_compute_tiled_scaled_dot_product_attention_with_thread;
+      } else if (use_threads_workspace_size) {
         attention_op->compute[2].type = xnn_parallelization_type_3d_tile_1d_with_thread;
         attention_op->compute[2].task_3d_tile_1d_with_thread =
           (pthreadpool_task_3d_tile_1d_with_thread_t) xnn_compute_scaled_dot_product_attention_with_thread;
@@ -583,7 +708,11 @@ static enum xnn_status reshape_scaled_dot_product_attention_nhtc(
       }
     }
   #else
-    if (use_threads_workspace_size) {
+    if (use_tiled_attention) {
+      attention_op->compute[2].type = xnn_parallelization_type_3d_tile_1d_with_thread;
+      attention_op->compute[2].task_3d_tile_1d_with_thread =
+        (pthreadpool_task_3d_tile_1d_with_thread_t) xnn_compute_tiled_scaled_dot_product_attention_with_thread;
+    } else if (use_threads_workspace_size) {
       attention_op->compute[2].type = xnn_parallelization_type_3d_tile_1d_with_thread;
       attention_op->compute[2].task_3d_tile_1d_with_thread =
         (pthreadpool_task_3d_tile_1d_with_thread_t) xnn_compute_scaled_dot_product_attention_with_thread;
@@ -627,9 +756,30 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f16(
   size_t* workspace_size,
   size_t* workspace_alignment,
   pthreadpool_t threadpool)
+{
+  return xnn_reshape_scaled_dot_product_attention_nhtc_f16_with_kv_stride(
+    attention_op, batch_size, heads, query_tokens, key_value_heads, key_value_tokens,
+    /*key_value_tokens_stride=*/key_value_tokens, query_key_channels, value_channels,
+    workspace_size, workspace_alignment, threadpool);
+}
+
+enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f16_with_kv_stride(
+  xnn_operator_t attention_op,
+  size_t batch_size,
+  size_t heads,
+  size_t query_tokens,
+  size_t key_value_heads,
+  size_t key_value_tokens,
+  size_t key_value_tokens_stride,
+  size_t query_key_channels,
+  size_t value_channels,
+  size_t* workspace_size,
+  size_t* workspace_alignment,
+  pthreadpool_t threadpool)
 {
   xnn_float16 cap = xnn_float16_from_float(attention_op->attention.cap_params.cap);
   xnn_float16 cap_reciprocal = xnn_float16_from_float(1.0f / attention_op->attention.cap_params.cap);
+  const xnn_float16 lowest = xnn_float16_from_float(-65504.0f);
 
   return reshape_scaled_dot_product_attention_nhtc(
     attention_op,
@@ -639,12 +789,16 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f16(
     query_tokens,
     key_value_heads,
     key_value_tokens,
+    key_value_tokens_stride,
     query_key_channels,
     value_channels,
     workspace_size, workspace_alignment,
     /*log2_element_size=*/XNN_LOG2_SIZEOF_UINT16_T,
     /*element_size=*/sizeof(uint16_t),
     (xnn_compute_reciprocal_fn) compute_reciprocal_f16,
+    (xnn_update_online_softmax_max_fn) update_online_softmax_max_f16,
+    (xnn_update_online_softmax_sum_fn) update_online_softmax_sum_f16,
+    &lowest,
     &cap, &cap_reciprocal, sizeof(uint16_t),
     &attention_op->params.f16_minmax, sizeof(attention_op->params.f16_minmax),
     &attention_op->params2.f16_default, sizeof(attention_op->params2.f16_default),
@@ -665,9 +819,30 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f32(
   size_t* workspace_size,
   size_t* workspace_alignment,
   pthreadpool_t threadpool)
+{
+  return xnn_reshape_scaled_dot_product_attention_nhtc_f32_with_kv_stride(
+    attention_op, batch_size, query_heads, query_tokens, key_value_heads, key_value_tokens,
+    /*key_value_tokens_stride=*/key_value_tokens, query_key_channels, value_channels,
+    workspace_size, workspace_alignment, threadpool);
+}
+
+enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f32_with_kv_stride(
+  xnn_operator_t attention_op,
+  size_t batch_size,
+  size_t query_heads,
+  size_t query_tokens,
+  size_t key_value_heads,
+  size_t key_value_tokens,
+  size_t key_value_tokens_stride,
+  size_t query_key_channels,
+  size_t value_channels,
+  size_t* workspace_size,
+  size_t* workspace_alignment,
+  pthreadpool_t threadpool)
 {
   float cap = attention_op->attention.cap_params.cap;
   float cap_reciprocal = 1 / attention_op->attention.cap_params.cap;
+  const float lowest = -FLT_MAX;
 
   return reshape_scaled_dot_product_attention_nhtc(
     attention_op,
@@ -677,12 +852,16 @@ enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f32(
     query_tokens,
     key_value_heads,
     key_value_tokens,
+    key_value_tokens_stride,
     query_key_channels,
     value_channels,
     workspace_size, workspace_alignment,
     /*log2_element_size=*/XNN_LOG2_SIZEOF_FLOAT,
     /*element_size=*/sizeof(float),
     (xnn_compute_reciprocal_fn) compute_reciprocal_f32,
+    (xnn_update_online_softmax_max_fn) update_online_softmax_max_f32,
+    (xnn_update_online_softmax_sum_fn) update_online_softmax_sum_f32,
+    &lowest,
     &cap, &cap_reciprocal, sizeof(float),
     &attention_op->params.f32_minmax, sizeof(attention_op->params.f32_minmax),
     &attention_op->params2.f32_default, sizeof(attention_op->params2.f32_default),
@@ -725,6 +904,13 @@ static enum xnn_status setup_scaled_dot_product_attention_nhtc(
       break;
   }
 
+  if (mask == NULL && (attention_op->flags & XNN_FLAG_CAUSAL_MASK) == 0) {
+    xnn_log_error(
+      "failed to setup %s operator: mask must be non-NULL without the causal mask flag",
+      xnn_operator_type_to_string(attention_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
   attention_op->context.gemm.packw_gemm_goi.kernel = key;
   attention_op->context.gemm.packw_gemm_goi.packed_weights =
     (void*) ((uintptr_t) workspace + attention_op->context.gemm.gemm.attention.packed_k_offset);
@@ -29,6 +29,12 @@
 #include "xnnpack/params.h"
 #include "pthreadpool.h"
 
+// Rows of at least this many bytes use the two-pass online softmax, when the
+// architecture provides micro-kernels for it. Smaller rows stay in cache between
+// passes, and the three-pass softmax, which computes each exponential once, is
+// faster for them.
+#define XNN_ONLINE_SOFTMAX_MIN_ROW_BYTES 1048576
+
 enum xnn_status xnn_create_softmax_nc_qu8(
     float input_scale,
     uint8_t output_zero_point,
@@ -233,6 +239,7 @@ enum xnn_status xnn_setup_softmax_nc_qu8(
 static enum xnn_status create_softmax_nc_floating_point(
     uint32_t flags,
     const struct xnn_raddstoreexpminusmax_config* raddstoreexpminusmax_config,
+    const struct xnn_rmaxaddexp_config* rmaxaddexp_config,
     const struct xnn_rmax_config* rmax_config,
     const struct xnn_binary_elementwise_config* vmul_config,
     enum xnn_operator_type operator_type,
@@ -262,6 +269,7 @@ static enum xnn_status create_softmax_nc_floating_point(
   softmax_op->raddstoreexpminusmax_config = raddstoreexpminusmax_config;
   softmax_op->rmax_config = rmax_config;
   softmax_op->vmul_config = vmul_config;
+  softmax_op->rmaxaddexp_config = rmaxaddexp_config;
 
   softmax_op->state = xnn_run_state_invalid;
 
@@ -300,9 +308,13 @@ enum xnn_status xnn_create_softmax_nc_f16(
     return xnn_status_unsupported_hardware;
   }
 
+  // Optional: without it, rows are always processed in three passes.
+  const struct xnn_rmaxaddexp_config* rmaxaddexp_config = xnn_init_f16_rmaxaddexp_config();
+
   return create_softmax_nc_floating_point(
     flags,
     raddstoreexpminusmax_config,
+    rmaxaddexp_config,
     rmax_config,
     vmul_config,
     xnn_operator_type_softmax_nc_f16,
@@ -338,9 +350,13 @@ enum xnn_status xnn_create_softmax_nc_f32(
     return xnn_status_unsupported_hardware;
   }
 
+  // Optional: without it, rows are always processed in three passes.
+  const struct xnn_rmaxaddexp_config* rmaxaddexp_config = xnn_init_f32_rmaxaddexp_config();
+
   return create_softmax_nc_floating_point(
     flags,
     raddstoreexpminusmax_config,
+    rmaxaddexp_config,
     rmax_config,
     vmul_config,
     xnn_operator_type_softmax_nc_f32,
@@ -429,6 +445,14 @@ static enum xnn_status reshape_softmax_nc_floating_point(
   if (vmul->opc_ukernel != NULL) {
     softmax_op->context.floating_point_softmax.vmulc_ukernel = vmul->opc_ukernel;
   };
+  // Online softmax reads each row twice instead of three times, but computes
+  // the exponentials twice. It pays off once rows no longer fit in cache.
+  const struct xnn_rmaxaddexp_config* rmaxaddexp_config = softmax_op->rmaxaddexp_config;
+  if (rmaxaddexp_config != NULL && rmaxaddexp_config->ukernel != NULL &&
+      (channels << log2_element_size) >= XNN_ONLINE_SOFTMAX_MIN_ROW_BYTES) {
+    softmax_op->context.floating_point_softmax.rmaxaddexp_ukernel = rmaxaddexp_config->ukernel;
+    softmax_op->context.floating_point_softmax.vscaleexpminusmax_ukernel = rmaxaddexp_config->vscale_ukernel;
+  }
   memcpy(&softmax_op->context.floating_point_softmax.rmax_params, rmax_params, rmax_params_size);
   memcpy(&softmax_op->context.floating_point_softmax.expminus_params, expminus_params, expminus_params_size);
   memcpy(&softmax_op->context.floating_point_softmax.minmax_params, minmax_params, minmax_params_size);
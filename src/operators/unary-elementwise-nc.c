@@ -213,6 +213,16 @@ static const struct xnn_unary_elementwise_config* get_config(
   return NULL;
 }
 
+const struct xnn_unary_elementwise_config* xnn_init_f32_unary_elementwise_config(
+    enum xnn_unary_operator op_type) {
+  const struct xnn_unary_elementwise_config* config =
+      get_config(op_type, xnn_datatype_fp32, xnn_datatype_fp32, NULL, NULL);
+  if (config == NULL) {
+    config = xnn_init_unary_reference_config(op_type, xnn_datatype_fp32, xnn_datatype_fp32);
+  }
+  return config;
+}
+
 static enum xnn_status init_op(
     xnn_operator_t op,
     enum xnn_unary_operator op_type,
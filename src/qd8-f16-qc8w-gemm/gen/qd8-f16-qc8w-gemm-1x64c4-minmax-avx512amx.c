@@ -85,8 +85,14 @@ void xnn_qd8_f16_qc8w_gemm_minmax_ukernel_1x64c4__avx512amx(
   tile_data.colsb[6] = kremainder;  // tmm6 = input remainder
   tile_data.colsb[7] = 64;          // tmm7 = weights remainder
 
-  //_tile_loadconfig(&tile_data);
-  __asm__ volatile ("ldtilecfg %0" :: "m" (tile_data));
+  // ldtilecfg is expensive, so skip it when the tile configuration left
+  // behind by the previous call on this thread already matches.
+  __attribute__((aligned(64))) struct __tile_config tile_current;
+  __asm__ volatile ("sttilecfg %0" : "=m" (tile_current));
+  if (_mm512_cmpneq_epi32_mask(_mm512_load_si512(&tile_current), _mm512_load_si512(&tile_data)) != 0) {
+    //_tile_loadconfig(&tile_data);
+    __asm__ volatile ("ldtilecfg %0" :: "m" (tile_data));
+  }
 
   xnn_float16* c0 = c;
 
@@ -231,8 +237,7 @@ void xnn_qd8_f16_qc8w_gemm_minmax_ukernel_1x64c4__avx512amx(
       nc = 0;
     }
   } while (nc != 0);
-  // Release tile config
-  //  _tile_release();
-  __asm__ volatile ("tilerelease" ::);
+  // The tile configuration is deliberately not released, so that the next
+  // call on this thread can reuse it.
   #endif  // defined(__x86_64__)
 }
@@ -90,8 +90,14 @@ void xnn_qd8_f16_qc8w_igemm_minmax_ukernel_16x64c4__avx512amx_prfm(
   tile_data.colsb[6] = kremainder;  // tmm6 = input remainder
   tile_data.colsb[7] = 64;          // tmm7 = weights remainder
 
-  //_tile_loadconfig(&tile_data);
-  __asm__ volatile ("ldtilecfg %0" :: "m" (tile_data));
+  // ldtilecfg is expensive, so skip it when the tile configuration left
+  // behind by the previous call on this thread already matches.
+  __attribute__((aligned(64))) struct __tile_config tile_current;
+  __asm__ volatile ("sttilecfg %0" : "=m" (tile_current));
+  if (_mm512_cmpneq_epi32_mask(_mm512_load_si512(&tile_current), _mm512_load_si512(&tile_data)) != 0) {
+    //_tile_loadconfig(&tile_data);
+    __asm__ volatile ("ldtilecfg %0" :: "m" (tile_data));
+  }
 
   xnn_float16* c0 = c;
   xnn_float16* c1 = (xnn_float16*) ((uintptr_t) c0 + cm_stride);
@@ -1289,8 +1295,7 @@ void xnn_qd8_f16_qc8w_igemm_minmax_ukernel_16x64c4__avx512amx_prfm(
     }
   } while (nc != 0);
 
-  // Release tile config
-  //  _tile_release();
-  __asm__ volatile ("tilerelease" ::);
+  // The tile configuration is deliberately not released, so that the next
+  // call on this thread can reuse it.
   #endif  // defined(__x86_64__)
 }
@@ -166,6 +166,56 @@ void xnn_pack_f16_gemm_goi_w(
   } while (--g != 0);
 }
 
+void xnn_pack_bf16_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const xnn_bfloat16* k,
+  const xnn_bfloat16* b,
+  const void* scale,
+  xnn_bfloat16* packed_weights,
+  size_t extra_bytes,
+  const void* params)
+{
+  assert(g != 0);
+  assert(nr >= sr);
+  assert(k != nullptr);
+  assert(packed_weights != nullptr);
+
+  const xnn_bfloat16 zero(0.0f);
+  const size_t skr = sr * kr;
+  do {
+    for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+      const size_t nr_block_size = min(nc - nr_block_start, nr);
+      copy_bias(b, nr_block_start, nr_block_size, packed_weights);
+      std::fill_n(packed_weights + nr_block_size, nr - nr_block_size, zero);
+      packed_weights += nr;
+
+      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          const size_t kc_begin = round_down_po2(kr_block_start, skr) + ((kr_block_start + nr_block_offset * kr) & (skr - 1));
+          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+            const size_t kc_idx = kc_begin + kr_block_offset;
+            packed_weights[kr_block_offset] =
+              kc_idx < kc ? k[(nr_block_start + nr_block_offset) * kc + kc_idx] : zero;
+          }
+          packed_weights += kr;
+        }
+        std::fill_n(packed_weights, (nr - nr_block_size) * kr, zero);
+        packed_weights += (nr - nr_block_size) * kr;
+      }
+      packed_weights = (xnn_bfloat16*) ((uintptr_t) packed_weights + extra_bytes);
+    }
+    k += nc * kc;
+    if XNN_UNPREDICTABLE(b != nullptr) {
+      b += nc;
+    }
+  } while (--g != 0);
+}
+
 void xnn_pack_f32_to_f16_gemm_goi_w(
   size_t g,
   size_t nc,
@@ -1116,6 +1166,57 @@ void xnn_pack_f16_gemm_gio_w(size_t g, size_t nc, size_t kc, size_t nr,
   } while (--g != 0);
 }
 
+void xnn_pack_bf16_gemm_gio_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  size_t k_stride,
+  const xnn_bfloat16* k,
+  const xnn_bfloat16* b,
+  const void* scale,
+  xnn_bfloat16* packed_weights,
+  size_t extra_bytes,
+  const void* params)
+{
+  assert(g != 0);
+  assert(nr >= sr);
+  assert(k != nullptr);
+  assert(packed_weights != nullptr);
+
+  const xnn_bfloat16 zero(0.0f);
+  const size_t skr = sr * kr;
+  do {
+    for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+      const size_t nr_block_size = min(nc - nr_block_start, nr);
+      copy_bias(b, nr_block_start, nr_block_size, packed_weights);
+      std::fill_n(packed_weights + nr_block_size, nr - nr_block_size, zero);
+      packed_weights += nr;
+
+      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          const size_t kc_begin = round_down_po2(kr_block_start, skr) + ((kr_block_start + nr_block_offset * kr) & (skr - 1));
+          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+            const size_t kc_idx = kc_begin + kr_block_offset;
+            packed_weights[kr_block_offset] =
+              kc_idx < kc ? k[kc_idx * k_stride + nr_block_start + nr_block_offset] : zero;
+          }
+          packed_weights += kr;
+        }
+        std::fill_n(packed_weights, (nr - nr_block_size) * kr, zero);
+        packed_weights += (nr - nr_block_size) * kr;
+      }
+      packed_weights = (xnn_bfloat16*) ((uintptr_t) packed_weights + extra_bytes);
+    }
+    k += nc * kc;
+    if XNN_UNPREDICTABLE(b != nullptr) {
+      b += nc;
+    }
+  } while (--g != 0);
+}
+
 void xnn_pack_f32_to_f16_gemm_gio_w(
   size_t g,
   size_t nc,
@@ -5369,4 +5470,143 @@ enum xnn_status xnn_pack_f16_spmm_w(
   return xnn_status_success;
 }
 
+void xnn_analyze_f32_spgemm_w(
+  size_t output_channels,
+  size_t input_channels,
+  size_t nr,
+  const float* kernel,
+  struct xnn_spgemm_packing_params* params)
+{
+  assert(nr != 0);
+  assert(kernel != nullptr);
+  assert(params != nullptr);
+
+  size_t num_nonzero_blocks = 0;
+  for (size_t nr_block_start = 0; nr_block_start < output_channels; nr_block_start += nr) {
+    const size_t nr_block_size = std::min(output_channels - nr_block_start, nr);
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      bool is_nonzero_block = false;
+      for (size_t oco = 0; oco < nr_block_size; oco++) {
+        is_nonzero_block |= (kernel[(nr_block_start + oco) * input_channels + ic] != 0.0f);
+      }
+      num_nonzero_blocks += (size_t) is_nonzero_block;
+    }
+  }
+
+  bool is_2of4 = true;
+  for (size_t oc = 0; oc < output_channels && is_2of4; oc++) {
+    for (size_t ic = 0; ic < input_channels; ic += 4) {
+      const size_t group_size = std::min(input_channels - ic, (size_t) 4);
+      size_t num_group_nonzeroes = 0;
+      for (size_t i = 0; i < group_size; i++) {
+        num_group_nonzeroes += (size_t) (kernel[oc * input_channels + ic + i] != 0.0f);
+      }
+      if (num_group_nonzeroes > 2) {
+        is_2of4 = false;
+        break;
+      }
+    }
+  }
+
+  params->num_nonzero_blocks = num_nonzero_blocks;
+  params->is_2of4 = is_2of4;
+}
+
+void xnn_pack_f32_spgemm_w(
+  size_t output_channels,
+  size_t input_channels,
+  size_t nr,
+  const float* kernel,
+  const float* bias,
+  uint32_t* tile_offsets,
+  void* packed_weights)
+{
+  assert(nr != 0);
+  assert(kernel != nullptr);
+  assert(tile_offsets != nullptr);
+  assert(packed_weights != nullptr);
+
+  char* out = (char*) packed_weights;
+  for (size_t nr_block_start = 0; nr_block_start < output_channels; nr_block_start += nr) {
+    const size_t nr_block_size = std::min(output_channels - nr_block_start, nr);
+    *tile_offsets++ = (uint32_t) (out - (char*) packed_weights);
+
+    float* packed_bias = (float*) out;
+    for (size_t oco = 0; oco < nr; oco++) {
+      packed_bias[oco] = (bias != nullptr && oco < nr_block_size) ? bias[nr_block_start + oco] : 0.0f;
+    }
+    out += nr * sizeof(float);
+    uint32_t* packed_nnz = (uint32_t*) out;
+    *packed_nnz = 0;
+    out += sizeof(uint32_t);
+
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      bool is_nonzero_block = false;
+      for (size_t oco = 0; oco < nr_block_size; oco++) {
+        is_nonzero_block |= (kernel[(nr_block_start + oco) * input_channels + ic] != 0.0f);
+      }
+      if (!is_nonzero_block) {
+        continue;
+      }
+      *((uint32_t*) out) = (uint32_t) (ic * sizeof(float));
+      out += sizeof(uint32_t);
+      float* packed_block = (float*) out;
+      for (size_t oco = 0; oco < nr; oco++) {
+        packed_block[oco] = oco < nr_block_size ? kernel[(nr_block_start + oco) * input_channels + ic] : 0.0f;
+      }
+      out += nr * sizeof(float);
+      *packed_nnz += 1;
+    }
+  }
+}
+
+void xnn_pack_f32_spgemm_2of4_w(
+  size_t output_channels,
+  size_t input_channels,
+  size_t nr,
+  const float* kernel,
+  const float* bias,
+  uint32_t* tile_offsets,
+  void* packed_weights)
+{
+  assert(nr != 0);
+  assert(kernel != nullptr);
+  assert(tile_offsets != nullptr);
+  assert(packed_weights != nullptr);
+
+  char* out = (char*) packed_weights;
+  for (size_t nr_block_start = 0; nr_block_start < output_channels; nr_block_start += nr) {
+    const size_t nr_block_size = std::min(output_channels - nr_block_start, nr);
+    *tile_offsets++ = (uint32_t) (out - (char*) packed_weights);
+
+    float* packed_bias = (float*) out;
+    for (size_t oco = 0; oco < nr; oco++) {
+      packed_bias[oco] = (bias != nullptr && oco < nr_block_size) ? bias[nr_block_start + oco] : 0.0f;
+    }
+    out += nr * sizeof(float);
+
+    for (size_t ic = 0; ic < input_channels; ic += 4) {
+      const size_t group_size = std::min(input_channels - ic, (size_t) 4);
+      float* packed_values = (float*) out;
+      uint8_t* packed_indices = (uint8_t*) (packed_values + 2 * nr);
+      // Unused slots multiply the first input channel of the group by zero.
+      std::fill(packed_values, packed_values + 2 * nr, 0.0f);
+      std::fill(packed_indices, packed_indices + 2 * nr, 0);
+      for (size_t oco = 0; oco < nr_block_size; oco++) {
+        size_t slot = 0;
+        for (size_t i = 0; i < group_size; i++) {
+          const float weight = kernel[(nr_block_start + oco) * input_channels + ic + i];
+          if (weight != 0.0f) {
+            assert(slot < 2);
+            packed_values[slot * nr + oco] = weight;
+            packed_indices[slot * nr + oco] = (uint8_t) i;
+            slot += 1;
+          }
+        }
+      }
+      out += 2 * nr * sizeof(float) + 2 * nr * sizeof(uint8_t);
+    }
+  }
+}
+
 }  // extern "C"
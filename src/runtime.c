@@ -3,12 +3,9 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
-#ifndef __MACH__
-#define _POSIX_C_SOURCE 199309L
-#endif
-
 #include <assert.h>
 #include <inttypes.h>
+#include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>  // For snprintf.
@@ -26,20 +23,12 @@
 #include "xnnpack/microkernel-type.h"
 #include "xnnpack/node-type.h"
 #include "xnnpack/operator-type.h"
+#include "xnnpack/operator-utils.h"
 #include "xnnpack/operator.h"
 #include "xnnpack/params.h"
 #include "xnnpack/subgraph.h"
 #include "pthreadpool.h"
 
-#if defined(__EMSCRIPTEN__)
-#include <emscripten/emscripten.h>
-#elif XNN_PLATFORM_WINDOWS
-#include <windows.h>
-#else
-#include <errno.h>
-#include <time.h>
-#endif
-
 enum xnn_status xnn_reshape_external_value(
     xnn_runtime_t runtime,
     uint32_t external_id,
@@ -65,6 +54,29 @@ enum xnn_status xnn_reshape_external_value(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_set_kv_cache_position(
+    xnn_runtime_t runtime,
+    uint32_t cache_id,
+    size_t position) {
+  if (cache_id >= runtime->num_values) {
+    xnn_log_error("failed to set KV cache position: out-of-bounds ID %" PRIu32 " in cache value", cache_id);
+    return xnn_status_invalid_parameter;
+  }
+  struct xnn_value* value = &runtime->values[cache_id];
+  if (!xnn_value_is_persistent(value)) {
+    xnn_log_error("failed to set KV cache position: Value %" PRIu32 " is not persistent (%d)",
+                  cache_id, value->allocation_type);
+    return xnn_status_invalid_parameter;
+  }
+  if (value->shape.num_dims < 2 || position > value->shape.dim[value->shape.num_dims - 2]) {
+    xnn_log_error("failed to set KV cache position: position %zu is out of range for Value %" PRIu32,
+                  position, cache_id);
+    return xnn_status_invalid_parameter;
+  }
+  value->kv_cache_position = position;
+  return xnn_status_success;
+}
+
 enum xnn_status
 xnn_get_external_value_shape(xnn_runtime_t runtime, uint32_t external_id, size_t* num_dims, size_t* dims)
 {
@@ -121,7 +133,10 @@ enum xnn_status xnn_release_workspace(xnn_workspace_t workspace)
   return xnn_status_success;
 }
 
-enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cache_t* weights_cache_out)
+static enum xnn_status create_weights_cache(
+  enum xnn_status (*init)(struct xnn_internal_weights_cache*, const void*),
+  const void* init_arg,
+  xnn_weights_cache_t* weights_cache_out)
 {
   struct xnn_weights_cache_provider* cache_provider = NULL;
   enum xnn_status status = xnn_status_uninitialized;
@@ -131,6 +146,7 @@ enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cach
     goto error;
   }
 
+  status = xnn_status_out_of_memory;
   cache_provider = xnn_allocate_zero_memory(sizeof(struct xnn_weights_cache_provider));
   if (cache_provider == NULL) {
     xnn_log_error("failed to allocate %zu bytes for weights cache provider descriptor", sizeof(struct xnn_weights_cache_provider));
@@ -143,7 +159,7 @@ enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cach
     goto error;
   }
 
-  status = xnn_internal_init_weights_cache_with_size(cache_provider->context, size);
+  status = init(cache_provider->context, init_arg);
   if (status != xnn_status_success) {
     goto error;
   }
@@ -158,11 +174,41 @@ enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cach
 
 error:
   if (cache_provider != NULL) {
-    xnn_internal_release_weights_cache(cache_provider->context);
+    xnn_release_memory(cache_provider->context);
+    xnn_release_memory(cache_provider);
   }
   return status;
 }
 
+static enum xnn_status init_weights_cache_with_size(struct xnn_internal_weights_cache* cache, const void* size)
+{
+  return xnn_internal_init_weights_cache_with_size(cache, *(const size_t*) size);
+}
+
+static enum xnn_status init_weights_cache_from_file(struct xnn_internal_weights_cache* cache, const void* path)
+{
+  return xnn_internal_init_weights_cache_from_file(cache, (const char*) path);
+}
+
+enum xnn_status xnn_create_weights_cache_with_size(size_t size, xnn_weights_cache_t* weights_cache_out)
+{
+  return create_weights_cache(init_weights_cache_with_size, &size, weights_cache_out);
+}
+
+enum xnn_status xnn_create_weights_cache_from_file(const char* path, xnn_weights_cache_t* weights_cache_out)
+{
+  return create_weights_cache(init_weights_cache_from_file, path, weights_cache_out);
+}
+
+enum xnn_status xnn_save_weights_cache(xnn_weights_cache_t weights_cache, const char* path)
+{
+  if (weights_cache->delete_cache != (enum xnn_status (*)(void*)) xnn_internal_delete_weights_cache) {
+    xnn_log_error("failed to save weights cache: only weights caches created by XNNPACK can be saved");
+    return xnn_status_unsupported_parameter;
+  }
+  return xnn_internal_save_weights_cache(weights_cache->context, path);
+}
+
 enum xnn_status xnn_create_weights_cache(xnn_weights_cache_t* weights_cache_out)
 {
   return xnn_create_weights_cache_with_size(XNN_DEFAULT_WEIGHTS_BUFFER_SIZE, weights_cache_out);
@@ -362,7 +408,13 @@ static enum xnn_status initialize_workspace_values(
 // Output can reuse input memory if both are allocated in the workspace.
 // If input has more than 1 consumer, we can't track all the consumers and update the first_consumer, so bail out.
 // Output memory fits in input memory. One of the inputs to a binary node could be implicitly broadcasted.
-static bool input_memory_can_be_reused(const xnn_runtime_t runtime, size_t input_id, size_t output_id)
+// Neither input nor output can take part in a view (see optimize_tensor_allocation_for_views), as writing in place
+// would clobber memory which is shared with other values.
+static bool input_memory_can_be_reused(
+  const struct xnn_value_allocation_tracker* tracker,
+  const xnn_runtime_t runtime,
+  size_t input_id,
+  size_t output_id)
 {
   if (input_id == XNN_INVALID_VALUE_ID || output_id == XNN_INVALID_VALUE_ID) {
     return false;
@@ -371,9 +423,16 @@ static bool input_memory_can_be_reused(const xnn_runtime_t runtime, size_t input
   const struct xnn_value* output = &runtime->values[output_id];
   const bool output_memory_fits = xnn_tensor_get_size(input) == xnn_tensor_get_size(output);
   assert(input->num_consumers != 0);
-  return input->allocation_type == xnn_allocation_type_workspace &&
-      output->allocation_type == xnn_allocation_type_workspace &&
-      input->num_consumers == 1 && output_memory_fits;
+  if (input->allocation_type != xnn_allocation_type_workspace ||
+      output->allocation_type != xnn_allocation_type_workspace) {
+    return false;
+  }
+  const struct xnn_usage_record* input_usage = &tracker->usage[input_id];
+  const struct xnn_usage_record* output_usage = &tracker->usage[output_id];
+  if (input_usage->is_view || input_usage->has_views || output_usage->is_view || output_usage->has_views) {
+    return false;
+  }
+  return input->num_consumers == 1 && output_memory_fits;
 }
 
 // An in-place operation reuses the input tensor's memory for its output. Examples are element-wise unary operations
@@ -391,6 +450,7 @@ static void optimize_tensor_allocation_for_in_place_operations(
     switch (node->type) {
       case xnn_node_type_unary_elementwise:
       case xnn_node_type_binary_elementwise:
+      case xnn_node_type_elementwise_chain:
       case xnn_node_type_copy:
       case xnn_node_type_softmax:
       case xnn_node_type_static_reshape:
@@ -403,7 +463,7 @@ static void optimize_tensor_allocation_for_in_place_operations(
     // Check all of the node's input to see which we can reuse.
     uint32_t input_id = XNN_INVALID_VALUE_ID;
     for (size_t i = 0; i < node->num_inputs; i++) {
-      if (input_memory_can_be_reused(runtime, node->inputs[i], node->outputs[0])) {
+      if (input_memory_can_be_reused(tracker, runtime, node->inputs[i], node->outputs[0])) {
         input_id = node->inputs[i];
         break;  // Found an input we can reuse, early exit.
       }
@@ -431,6 +491,134 @@ static void optimize_tensor_allocation_for_in_place_operations(
   }
 }
 
+// A value can be a view into another value's memory if both are allocated in the workspace, and it is not already
+// sharing memory with another value.
+static bool value_can_be_view(
+  const struct xnn_value_allocation_tracker* tracker,
+  const xnn_runtime_t runtime,
+  uint32_t value_id)
+{
+  if (value_id == XNN_INVALID_VALUE_ID) {
+    return false;
+  }
+  const struct xnn_value* value = &runtime->values[value_id];
+  if (!xnn_value_is_valid(value) || value->allocation_type != xnn_allocation_type_workspace) {
+    return false;
+  }
+  // Dynamically quantized values keep their quantization parameters right after the tensor data.
+  if (value->datatype == xnn_datatype_qdint8 || value->datatype == xnn_datatype_qduint8) {
+    return false;
+  }
+  if (value->layout != xnn_layout_type_nhwc) {
+    return false;
+  }
+  const struct xnn_usage_record* usage = &tracker->usage[value_id];
+  return usage->tensor_size != 0 && usage->reuse_value_id == XNN_INVALID_VALUE_ID;
+}
+
+// A value can own the memory of views if it is allocated in the workspace.
+static bool value_can_have_views(
+  const struct xnn_value_allocation_tracker* tracker,
+  const xnn_runtime_t runtime,
+  uint32_t value_id)
+{
+  if (value_id == XNN_INVALID_VALUE_ID) {
+    return false;
+  }
+  const struct xnn_value* value = &runtime->values[value_id];
+  if (!xnn_value_is_valid(value) || value->allocation_type != xnn_allocation_type_workspace) {
+    return false;
+  }
+  if (value->datatype == xnn_datatype_qdint8 || value->datatype == xnn_datatype_qduint8) {
+    return false;
+  }
+  if (value->layout != xnn_layout_type_nhwc) {
+    return false;
+  }
+  // Views may be nested, e.g. the input of an Even Split node can itself be an input of a Concatenate node.
+  const struct xnn_usage_record* usage = &tracker->usage[value_id];
+  return usage->tensor_size != 0 || usage->is_view;
+}
+
+// Concatenate and Even Split nodes along an axis where all leading dimensions are 1 only move contiguous blocks of
+// memory. Instead of copying, we let the producers of the Concatenate inputs write directly at the right offset of the
+// output, and let the consumers of the Even Split outputs read directly from the right offset of the input, i.e. the
+// inputs (resp. outputs) become views into the output (resp. input). The copy operators then find that their input and
+// output pointers are the same, and skip themselves at setup.
+static void optimize_tensor_allocation_for_views(
+  struct xnn_value_allocation_tracker* tracker,
+  const xnn_runtime_t runtime)
+{
+  runtime->has_views = false;
+  for (uint32_t n = 0; n < runtime->num_ops; n++) {
+    const struct xnn_operator_data* node = &runtime->opdata[n];
+    if (node->operator_objects[0] == NULL) {
+      // Operator was removed during optimization
+      continue;
+    }
+    switch (node->type) {
+      case xnn_node_type_concatenate2:
+      case xnn_node_type_concatenate3:
+      case xnn_node_type_concatenate4:
+      case xnn_node_type_concatenate5:
+      {
+        const uint32_t output_id = node->outputs[0];
+        if (node->batch_size != 1 || !value_can_have_views(tracker, runtime, output_id)) {
+          continue;
+        }
+        size_t offset = 0;
+        for (size_t i = 0; i < node->num_inputs; i++) {
+          const uint32_t input_id = node->inputs[i];
+          const size_t input_size = xnn_tensor_get_size(&runtime->values[input_id]);
+          bool is_duplicate = false;
+          for (size_t j = 0; j < node->num_inputs; j++) {
+            is_duplicate |= j != i && node->inputs[j] == input_id;
+          }
+          if (!is_duplicate && input_id != output_id && value_can_be_view(tracker, runtime, input_id)) {
+            xnn_log_debug("placing tensor id #%" PRIu32 " at offset %zu of tensor id #%" PRIu32 " Node #%" PRIu32 " %s",
+                          input_id, offset, output_id, node->id, xnn_node_type_to_string(node->type));
+            xnn_mark_tensor_as_view(tracker, input_id, output_id, offset);
+            runtime->has_views = true;
+          }
+          offset += input_size;
+        }
+        assert(offset == xnn_tensor_get_size(&runtime->values[output_id]));
+        break;
+      }
+      case xnn_node_type_even_split2:
+      case xnn_node_type_even_split3:
+      case xnn_node_type_even_split4:
+      {
+        const uint32_t input_id = node->inputs[0];
+        if (node->batch_size != 1 || !value_can_have_views(tracker, runtime, input_id)) {
+          continue;
+        }
+        // Outputs which were optimized away still occupy their slice of the input.
+        size_t split_size = 0;
+        for (size_t i = 0; i < node->num_outputs; i++) {
+          if (xnn_value_is_valid(&runtime->values[node->outputs[i]])) {
+            split_size = xnn_tensor_get_size(&runtime->values[node->outputs[i]]);
+            break;
+          }
+        }
+        for (size_t i = 0; i < node->num_outputs; i++) {
+          const uint32_t output_id = node->outputs[i];
+          if (output_id != input_id && value_can_be_view(tracker, runtime, output_id)) {
+            assert(xnn_tensor_get_size(&runtime->values[output_id]) == split_size);
+            xnn_log_debug("reading tensor id #%" PRIu32 " at offset %zu of tensor id #%" PRIu32 " Node #%" PRIu32 " %s",
+                          output_id, i * split_size, input_id, node->id, xnn_node_type_to_string(node->type));
+            xnn_mark_tensor_as_view(tracker, output_id, input_id, i * split_size);
+            runtime->has_views = true;
+          }
+        }
+        break;
+      }
+      default:
+        continue;
+    }
+  }
+}
+
 // Propagtes the rank through the subgraph so that each tensor's rank is
 // correctly set.
 void propagate_rank(
@@ -462,7 +650,11 @@ void propagate_rank(
       case xnn_node_type_global_average_pooling_2d:
       case xnn_node_type_global_sum_pooling_1d:
       case xnn_node_type_global_sum_pooling_2d:
+      case xnn_node_type_static_argmax:
+      case xnn_node_type_static_max:
       case xnn_node_type_static_mean:
+      case xnn_node_type_static_min:
+      case xnn_node_type_static_prod:
       case xnn_node_type_static_sum:
         if (flags & XNN_FLAG_KEEP_DIMS) {
           output_value->shape.num_dims = input_value->shape.num_dims;
@@ -484,7 +676,9 @@ void propagate_rank(
       case xnn_node_type_even_split4:
       case xnn_node_type_unary_elementwise:
       case xnn_node_type_convert:
+      case xnn_node_type_layer_norm:
       case xnn_node_type_pack_lh:
+      case xnn_node_type_rms_norm:
       case xnn_node_type_scaled_dot_product_attention:
       case xnn_node_type_softmax:
       case xnn_node_type_static_transpose:
@@ -506,12 +700,114 @@ void propagate_rank(
       case xnn_node_type_static_reshape:
         output_value->shape.num_dims = node->params.static_reshape.new_shape.num_dims;
         break;
+      case xnn_node_type_kv_cache_append:
+        // The output is the persistent cache, whose rank is fixed when it is defined.
+        break;
       default:
         XNN_UNREACHABLE;
     }
   }
 }
 
+// Allocate the operator traces for XNN_FLAG_DETAILED_PROFILING, with busy times for every thread of the thread pool.
+static enum xnn_status create_operator_traces(xnn_runtime_t runtime, pthreadpool_t threadpool)
+{
+  const size_t num_operator_objects = runtime->num_ops * XNN_MAX_OPERATOR_OBJECTS;
+  runtime->num_profiled_threads = pthreadpool_get_threads_count(threadpool);
+  runtime->operator_traces = xnn_allocate_zero_memory(sizeof(struct xnn_operator_trace) * num_operator_objects);
+  if (runtime->operator_traces == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for operator traces",
+      sizeof(struct xnn_operator_trace) * num_operator_objects);
+    return xnn_status_out_of_memory;
+  }
+  runtime->thread_busy_ns =
+    xnn_allocate_zero_memory(sizeof(uint64_t) * num_operator_objects * runtime->num_profiled_threads);
+  if (runtime->thread_busy_ns == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for thread busy times",
+      sizeof(uint64_t) * num_operator_objects * runtime->num_profiled_threads);
+    return xnn_status_out_of_memory;
+  }
+  return xnn_status_success;
+}
+
+// Group operators in execution stages for XNN_FLAG_INTER_OPERATOR_PARALLELISM. The stage of an operator is the
+// earliest stage after the stages of the producers of its inputs, and after the stages of all preceding operators that
+// read its outputs, so operators in the same stage can run concurrently.
+static enum xnn_status create_execution_stages(xnn_runtime_t runtime)
+{
+  const size_t num_ops = runtime->num_ops;
+  runtime->op_stage = xnn_allocate_zero_memory(sizeof(uint32_t) * (num_ops * 3 + 1));
+  runtime->stage_status = xnn_allocate_zero_memory(sizeof(enum xnn_status) * num_ops);
+  // Earliest stage in which each value can be written without racing with operators reading it.
+  uint32_t* value_write_stage = xnn_allocate_zero_memory(sizeof(uint32_t) * runtime->num_values);
+  if (runtime->op_stage == NULL || runtime->stage_status == NULL || value_write_stage == NULL) {
+    xnn_log_error("failed to allocate execution stages for %zu operators", num_ops);
+    xnn_release_memory(value_write_stage);
+    return xnn_status_out_of_memory;
+  }
+  runtime->stage_ops = runtime->op_stage + num_ops;
+  runtime->stage_offsets = runtime->stage_ops + num_ops;
+
+  size_t num_stages = 0;
+  for (uint32_t opdata_id = 0; opdata_id < num_ops; opdata_id++) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[opdata_id];
+    if (opdata->operator_objects[0] == NULL) {
+      // Operator was removed during optimization
+      continue;
+    }
+    uint32_t stage = 0;
+    for (uint32_t i = 0; i < opdata->num_inputs; i++) {
+      const uint32_t input_id = opdata->inputs[i];
+      if (input_id == XNN_INVALID_VALUE_ID) {
+        continue;
+      }
+      const uint32_t producer = runtime->values[input_id].producer;
+      if (producer != XNN_INVALID_NODE_ID && producer < opdata_id) {
+        stage = max(stage, runtime->op_stage[producer] + 1);
+      }
+    }
+    for (uint32_t i = 0; i < opdata->num_outputs; i++) {
+      const uint32_t output_id = opdata->outputs[i];
+      if (output_id != XNN_INVALID_VALUE_ID) {
+        stage = max(stage, value_write_stage[output_id]);
+      }
+    }
+    for (uint32_t i = 0; i < opdata->num_inputs; i++) {
+      const uint32_t input_id = opdata->inputs[i];
+      if (input_id != XNN_INVALID_VALUE_ID) {
+        value_write_stage[input_id] = max(value_write_stage[input_id], stage + 1);
+      }
+    }
+    runtime->op_stage[opdata_id] = stage;
+    num_stages = max(num_stages, (size_t) stage + 1);
+  }
+  xnn_release_memory(value_write_stage);
+
+  // Counting sort of operators by stage.
+  uint32_t* stage_offsets = runtime->stage_offsets;
+  for (uint32_t opdata_id = 0; opdata_id < num_ops; opdata_id++) {
+    if (runtime->opdata[opdata_id].operator_objects[0] != NULL) {
+      stage_offsets[runtime->op_stage[opdata_id] + 1] += 1;
+    }
+  }
+  for (size_t stage = 0; stage < num_stages; stage++) {
+    stage_offsets[stage + 1] += stage_offsets[stage];
+  }
+  for (uint32_t opdata_id = 0; opdata_id < num_ops; opdata_id++) {
+    if (runtime->opdata[opdata_id].operator_objects[0] != NULL) {
+      runtime->stage_ops[stage_offsets[runtime->op_stage[opdata_id]]++] = opdata_id;
+    }
+  }
+  // The loop above advanced each offset to the start of the next stage, shift them back.
+  for (size_t stage = num_stages; stage != 0; stage--) {
+    stage_offsets[stage] = stage_offsets[stage - 1];
+  }
+  stage_offsets[0] = 0;
+  runtime->num_stages = num_stages;
+  xnn_log_debug("created %zu execution stages for %zu operators", num_stages, num_ops);
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_create_runtime_v4(
   xnn_subgraph_t subgraph,
   xnn_weights_cache_t weights_cache,
@@ -549,6 +845,14 @@ enum xnn_status xnn_create_runtime_v4(
     xnn_log_error("failed to allocate %zu bytes for runtime descriptor", sizeof(struct xnn_runtime));
     goto error;
   }
+  status = xnn_mutex_init(&runtime->clones_mutex);
+  if (status != xnn_status_success) {
+    xnn_log_error("failed to initialize runtime mutex");
+    xnn_release_memory(runtime);
+    runtime = NULL;
+    goto error;
+  }
+  status = xnn_status_out_of_memory;
 
   runtime->opdata = xnn_allocate_zero_memory(sizeof(struct xnn_operator_data) * subgraph->num_nodes);
   if (runtime->opdata == NULL) {
@@ -612,9 +916,14 @@ enum xnn_status xnn_create_runtime_v4(
     // Initialize common fields we need for analysis.
     runtime->opdata[i].type = node->type;
     runtime->opdata[i].flags = node->flags;
+    if ((flags & XNN_FLAG_AUTOTUNE_GEMM) && node->type == xnn_node_type_fully_connected) {
+      // Autotuning is a property of the runtime, not of the node, and must not leak into the subgraph.
+      runtime->opdata[i].flags |= XNN_FLAG_AUTOTUNE_GEMM;
+    }
     runtime->opdata[i].id = node->id;
     runtime->opdata[i].num_inputs = node->num_inputs;
     runtime->opdata[i].num_outputs = node->num_outputs;
+    runtime->opdata[i].epilogue = node->epilogue;
     // Copy all inputs (not just num_inputs) to get all invalid ID (e.g. no bias).
     for (size_t input_i = 0; input_i < node->num_inputs; input_i++) {
       runtime->opdata[i].inputs[input_i] = node->inputs[input_i];
@@ -671,8 +980,36 @@ enum xnn_status xnn_create_runtime_v4(
   runtime->next_workspace_user = runtime->workspace->first_user;
   runtime->workspace->first_user = runtime;
 
-  if (flags & XNN_FLAG_BASIC_PROFILING) {
+  if (flags & XNN_FLAG_DETAILED_PROFILING) {
+    runtime->profiling = true;
+    status = create_operator_traces(runtime, threadpool);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  } else if (flags & XNN_FLAG_BASIC_PROFILING) {
     runtime->profiling = true;
+  } else if (flags & XNN_FLAG_INTER_OPERATOR_PARALLELISM) {
+    status = create_execution_stages(runtime);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+
+  if (flags & XNN_FLAG_CACHE_RESHAPE_PLANS) {
+    runtime->reshape_plans = xnn_allocate_zero_memory(sizeof(struct xnn_reshape_plan) * XNN_MAX_RESHAPE_PLANS);
+    if (runtime->reshape_plans == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for reshape plans",
+        sizeof(struct xnn_reshape_plan) * (size_t) XNN_MAX_RESHAPE_PLANS);
+      status = xnn_status_out_of_memory;
+      goto error;
+    }
+    for (size_t i = 0; i < runtime->num_ops; i++) {
+      for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+        if (runtime->opdata[i].operator_objects[j] != NULL) {
+          runtime->num_operator_objects++;
+        }
+      }
+    }
   }
 
   runtime->threadpool = threadpool;
@@ -685,6 +1022,152 @@ error:
   return status;
 }
 
+enum xnn_status xnn_clone_runtime(
+  xnn_runtime_t source,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  xnn_runtime_t* runtime_out)
+{
+  struct xnn_runtime* runtime = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to clone runtime: XNNPACK is not initialized");
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+  if (source == NULL) {
+    xnn_log_error("failed to clone runtime: runtime is NULL");
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+  if (workspace == NULL) {
+    xnn_log_debug("Allocating non-shared workspace");
+    workspace = xnn_allocate_zero_simd_memory(sizeof(struct xnn_workspace));
+    if (workspace == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for workspace descriptor", sizeof(struct xnn_workspace));
+      goto error;
+    }
+  }
+
+  runtime = xnn_allocate_zero_memory(sizeof(struct xnn_runtime));
+  if (runtime == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for runtime descriptor", sizeof(struct xnn_runtime));
+    goto error;
+  }
+  status = xnn_mutex_init(&runtime->clones_mutex);
+  if (status != xnn_status_success) {
+    xnn_log_error("failed to initialize runtime mutex");
+    xnn_release_memory(runtime);
+    runtime = NULL;
+    goto error;
+  }
+  status = xnn_status_out_of_memory;
+  runtime->num_external_values = source->num_external_values;
+
+  runtime->opdata = xnn_allocate_zero_memory(sizeof(struct xnn_operator_data) * source->num_ops);
+  if (runtime->opdata == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for opdata descriptors",
+      sizeof(struct xnn_operator_data) * source->num_ops);
+    goto error;
+  }
+  runtime->num_ops = source->num_ops;
+
+  runtime->values = xnn_allocate_zero_memory(sizeof(struct xnn_value) * source->num_values);
+  if (runtime->values == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for runtime's value descriptors",
+      sizeof(struct xnn_value) * source->num_values);
+    goto error;
+  }
+  runtime->num_values = source->num_values;
+  status = xnn_mutex_lock(&source->clones_mutex);
+  if (status != xnn_status_success) {
+    xnn_log_error("failed to lock mutex of the cloned runtime");
+    goto error;
+  }
+  source->num_clones++;
+  xnn_mutex_unlock(&source->clones_mutex);
+  runtime->clone_source = source;
+  status = xnn_status_out_of_memory;
+
+  // Static and FP16-converted static data is shared with the source, data in the workspace and external data are set
+  // when the clone is planned and set up.
+  memcpy(runtime->values, source->values, sizeof(struct xnn_value) * source->num_values);
+  for (size_t i = 0; i < runtime->num_values; i++) {
+    struct xnn_value* value = &runtime->values[i];
+    if (value->allocation_type != xnn_allocation_type_static && value->allocation_type != xnn_allocation_type_dynamic) {
+      value->data = NULL;
+    }
+  }
+
+  // Operator data only points to operator objects and to the workspace.
+  memcpy(runtime->opdata, source->opdata, sizeof(struct xnn_operator_data) * source->num_ops);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    struct xnn_operator_data* opdata = &runtime->opdata[i];
+    opdata->workspace = NULL;
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      opdata->operator_objects[j] = NULL;
+    }
+  }
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      const struct xnn_operator* op = source->opdata[i].operator_objects[j];
+      if (op != NULL) {
+        status = xnn_clone_operator(op, &runtime->opdata[i].operator_objects[j]);
+        if (status != xnn_status_success) {
+          xnn_log_error("failed to clone operator #%zu", i);
+          goto error;
+        }
+      }
+    }
+  }
+
+  xnn_retain_workspace(workspace);
+  runtime->workspace = workspace;
+  runtime->next_workspace_user = runtime->workspace->first_user;
+  runtime->workspace->first_user = runtime;
+  workspace = NULL;
+
+  runtime->profiling = source->profiling;
+  if (source->operator_traces != NULL) {
+    status = create_operator_traces(runtime, threadpool);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+  if (source->op_stage != NULL) {
+    status = create_execution_stages(runtime);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+
+  if (source->reshape_plans != NULL) {
+    runtime->reshape_plans = xnn_allocate_zero_memory(sizeof(struct xnn_reshape_plan) * XNN_MAX_RESHAPE_PLANS);
+    if (runtime->reshape_plans == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for reshape plans",
+        sizeof(struct xnn_reshape_plan) * (size_t) XNN_MAX_RESHAPE_PLANS);
+      status = xnn_status_out_of_memory;
+      goto error;
+    }
+    runtime->num_operator_objects = source->num_operator_objects;
+  }
+
+  runtime->threadpool = threadpool;
+
+  *runtime_out = runtime;
+  return xnn_status_success;
+
+error:
+  if (workspace != NULL && workspace->ref_count == 0) {
+    xnn_release_simd_memory(workspace);
+  }
+  xnn_delete_runtime(runtime);
+  return status;
+}
+
 enum xnn_status xnn_plan_memory(
     xnn_runtime_t runtime) {
   enum xnn_status status = xnn_status_invalid_state;
@@ -720,7 +1203,14 @@ enum xnn_status xnn_plan_memory(
         opdata_id);
   }
 
-  optimize_tensor_allocation_for_in_place_operations(&mem_alloc_tracker, runtime);
+#if XNN_ENABLE_MEMOPT
+  optimize_tensor_allocation_for_views(&mem_alloc_tracker, runtime);
+#endif
+  if (runtime->op_stage == NULL) {
+    // In-place operations extend the lifecycle of their input by node, which is not valid if operators of the same
+    // stage run concurrently.
+    optimize_tensor_allocation_for_in_place_operations(&mem_alloc_tracker, runtime);
+  }
   xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
 
   status = initialize_workspace_values(runtime, &mem_alloc_tracker, old_persistent_size);
@@ -738,9 +1228,223 @@ error:
   return status;
 }
 
+static bool shapes_are_equal(const struct xnn_shape* a, const struct xnn_shape* b)
+{
+  if (a->num_dims != b->num_dims) {
+    return false;
+  }
+  for (size_t i = 0; i < a->num_dims; i++) {
+    if (a->dim[i] != b->dim[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void release_reshape_plan(struct xnn_reshape_plan* plan)
+{
+  xnn_release_memory(plan->values);
+  xnn_release_memory(plan->opdata);
+  xnn_release_memory(plan->workspace_offsets);
+  xnn_release_memory(plan->operators);
+  memset(plan, 0, sizeof(struct xnn_reshape_plan));
+}
+
+static void release_reshape_plans(xnn_runtime_t runtime)
+{
+  for (size_t i = 0; i < XNN_MAX_RESHAPE_PLANS; i++) {
+    release_reshape_plan(&runtime->reshape_plans[i]);
+  }
+  xnn_release_memory(runtime->reshape_plans);
+  runtime->reshape_plans = NULL;
+}
+
+// The reshaped state of an operator can be restored from a snapshot only if it doesn't own memory with shape-dependent
+// contents, i.e. indirection buffers and the buffers derived from them.
+static bool operator_reshape_can_be_restored(const struct xnn_operator* op)
+{
+  return op->indirection_buffer == NULL && op->zero_buffers == NULL && op->pixelwise_buffer == NULL &&
+    op->subconvolution_buffer == NULL;
+}
+
+static struct xnn_reshape_plan* find_reshape_plan(xnn_runtime_t runtime)
+{
+  for (size_t i = 0; i < XNN_MAX_RESHAPE_PLANS; i++) {
+    struct xnn_reshape_plan* plan = &runtime->reshape_plans[i];
+    if (plan->values == NULL) {
+      continue;
+    }
+    bool matches = true;
+    for (size_t j = 0; j < runtime->num_values && matches; j++) {
+      const struct xnn_value* value = &runtime->values[j];
+      if (!xnn_value_is_valid(value)) {
+        continue;
+      }
+      if (value->flags & XNN_VALUE_FLAG_EXTERNAL_INPUT) {
+        matches = shapes_are_equal(&value->shape, &plan->values[j].shape);
+      } else if (value->allocation_type == xnn_allocation_type_persistent) {
+        matches = value->kv_cache_position == plan->values[j].kv_cache_position;
+      }
+    }
+    if (matches) {
+      return plan;
+    }
+  }
+  return NULL;
+}
+
+// Restores the state of the Runtime from a reshape plan, returns false if the plan is stale.
+static bool restore_reshape_plan(xnn_runtime_t runtime, const struct xnn_reshape_plan* plan)
+{
+  // Operators may reallocate their zero buffers and K-split buffers when reshaped for larger shapes, in which case the
+  // snapshots refer to freed memory.
+  size_t k = 0;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      const struct xnn_operator* op = runtime->opdata[i].operator_objects[j];
+      if (op != NULL) {
+        const struct xnn_operator* snapshot = &plan->operators[k++];
+        if (op->zero_buffer != snapshot->zero_buffer || op->k_split_buffer != snapshot->k_split_buffer) {
+          return false;
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < runtime->num_values; i++) {
+    struct xnn_value* value = &runtime->values[i];
+    if (!xnn_value_is_valid(value)) {
+      continue;
+    }
+    const struct xnn_reshape_plan_value* plan_value = &plan->values[i];
+    value->shape = plan_value->shape;
+    value->size = plan_value->size;
+    value->kv_cache_tokens = plan_value->kv_cache_tokens;
+  }
+  memcpy(runtime->opdata, plan->opdata, sizeof(struct xnn_operator_data) * runtime->num_ops);
+  k = 0;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      struct xnn_operator* op = runtime->opdata[i].operator_objects[j];
+      if (op != NULL) {
+        memcpy(op, &plan->operators[k++], sizeof(struct xnn_operator));
+      }
+    }
+  }
+  assert(k == runtime->num_operator_objects);
+
+  struct xnn_workspace* workspace = runtime->workspace;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const size_t offset = plan->workspace_offsets[i];
+    runtime->opdata[i].workspace = offset == SIZE_MAX ? NULL : (void*) ((uintptr_t) workspace->data + offset);
+  }
+  if (workspace->persistent_size != plan->persistent_size || workspace->size < plan->workspace_size) {
+    // Another Runtime sharing the workspace changed its layout, the offsets in the plan are not valid anymore.
+    return xnn_plan_memory(runtime) == xnn_status_success;
+  }
+  for (size_t i = 0; i < runtime->num_values; i++) {
+    struct xnn_value* value = &runtime->values[i];
+    if (!xnn_value_is_valid(value) || value->allocation_type != xnn_allocation_type_workspace) {
+      continue;
+    }
+    value->data = (void*) ((uintptr_t) workspace->data + plan->values[i].data_offset);
+    if (value->datatype == xnn_datatype_qdint8 || value->datatype == xnn_datatype_qduint8) {
+      value->quantization.dynamic_params =
+        (void*) ((uintptr_t) workspace->data + plan->values[i].dynamic_params_offset);
+    }
+  }
+  return true;
+}
+
+static void save_reshape_plan(xnn_runtime_t runtime, struct xnn_reshape_plan* plan)
+{
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      const struct xnn_operator* op = runtime->opdata[i].operator_objects[j];
+      if (op != NULL && !operator_reshape_can_be_restored(op)) {
+        xnn_log_debug("disabling reshape plans: operator #%zu (%s) has shape-dependent buffers",
+                      i, xnn_operator_type_to_string(op->type));
+        release_reshape_plans(runtime);
+        return;
+      }
+    }
+  }
+
+  if (plan == NULL) {
+    // Use an unused plan, or evict the least recently used one.
+    plan = &runtime->reshape_plans[0];
+    for (size_t i = 0; i < XNN_MAX_RESHAPE_PLANS && plan->values != NULL; i++) {
+      if (runtime->reshape_plans[i].values == NULL || runtime->reshape_plans[i].last_used < plan->last_used) {
+        plan = &runtime->reshape_plans[i];
+      }
+    }
+  }
+  if (plan->values == NULL) {
+    plan->values = xnn_allocate_memory(sizeof(struct xnn_reshape_plan_value) * runtime->num_values);
+    plan->opdata = xnn_allocate_memory(sizeof(struct xnn_operator_data) * runtime->num_ops);
+    plan->workspace_offsets = xnn_allocate_memory(sizeof(size_t) * runtime->num_ops);
+    plan->operators = xnn_allocate_memory(sizeof(struct xnn_operator) * runtime->num_operator_objects);
+    if (plan->values == NULL || plan->opdata == NULL || plan->workspace_offsets == NULL ||
+        (plan->operators == NULL && runtime->num_operator_objects != 0)) {
+      // Memoization is an optimization, failing to allocate a plan is not an error.
+      xnn_log_debug("failed to allocate reshape plan");
+      release_reshape_plan(plan);
+      return;
+    }
+  }
+
+  const struct xnn_workspace* workspace = runtime->workspace;
+  for (size_t i = 0; i < runtime->num_values; i++) {
+    const struct xnn_value* value = &runtime->values[i];
+    struct xnn_reshape_plan_value* plan_value = &plan->values[i];
+    plan_value->shape = value->shape;
+    plan_value->size = value->size;
+    plan_value->kv_cache_position = value->kv_cache_position;
+    plan_value->kv_cache_tokens = value->kv_cache_tokens;
+    plan_value->data_offset = 0;
+    plan_value->dynamic_params_offset = 0;
+    if (xnn_value_is_valid(value) && value->allocation_type == xnn_allocation_type_workspace) {
+      plan_value->data_offset = (uintptr_t) value->data - (uintptr_t) workspace->data;
+      if (value->datatype == xnn_datatype_qdint8 || value->datatype == xnn_datatype_qduint8) {
+        plan_value->dynamic_params_offset =
+          (uintptr_t) value->quantization.dynamic_params - (uintptr_t) workspace->data;
+      }
+    }
+  }
+  memcpy(plan->opdata, runtime->opdata, sizeof(struct xnn_operator_data) * runtime->num_ops);
+  size_t k = 0;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[i];
+    plan->workspace_offsets[i] =
+      opdata->workspace == NULL ? SIZE_MAX : (size_t) ((uintptr_t) opdata->workspace - (uintptr_t) workspace->data);
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      if (opdata->operator_objects[j] != NULL) {
+        memcpy(&plan->operators[k++], opdata->operator_objects[j], sizeof(struct xnn_operator));
+      }
+    }
+  }
+  assert(k == runtime->num_operator_objects);
+  plan->workspace_size = workspace->size;
+  plan->persistent_size = workspace->persistent_size;
+  plan->last_used = runtime->reshape_plan_clock;
+}
+
 enum xnn_status xnn_reshape_runtime(
   xnn_runtime_t runtime)
 {
+  struct xnn_reshape_plan* plan = NULL;
+  if (runtime->reshape_plans != NULL) {
+    runtime->reshape_plan_clock++;
+    plan = find_reshape_plan(runtime);
+    if (plan != NULL) {
+      if (restore_reshape_plan(runtime, plan)) {
+        plan->last_used = runtime->reshape_plan_clock;
+        return xnn_status_success;
+      }
+      // The plan is stale, reshape every operator and replace it.
+    }
+  }
+
   bool reallocation_required = false;
 
   for (uint32_t opdata_id = 0; opdata_id < runtime->num_ops; opdata_id++) {
@@ -760,9 +1464,15 @@ enum xnn_status xnn_reshape_runtime(
       return status;
     }
   }
-  if (reallocation_required || !runtime->memory_planned) {
+  if (reallocation_required || !runtime->memory_planned || runtime->has_views) {
     runtime->memory_planned = true;
-    return xnn_plan_memory(runtime);
+    const enum xnn_status status = xnn_plan_memory(runtime);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  if (runtime->reshape_plans != NULL) {
+    save_reshape_plan(runtime, plan);
   }
   return xnn_status_success;
 }
@@ -899,54 +1609,73 @@ enum xnn_status xnn_setup_runtime_v2(
   return xnn_status_success;
 }
 
-static xnn_timestamp xnn_read_timer() {
-  xnn_timestamp timestamp;
-#ifdef __MACH__
-  timestamp = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
-  if (timestamp == 0) {
-    xnn_log_warning("clock_gettime failed: error code %d", errno);
-  }
-#elif __EMSCRIPTEN__
-  timestamp = emscripten_get_now();
-#elif XNN_PLATFORM_WINDOWS
-  BOOL res = QueryPerformanceCounter(&timestamp);
-  if (!res) {
-    xnn_log_error("QueryPerformanceCounter failed: error code %u", GetLastError());
-    memset(&timestamp, 0, sizeof(timestamp));
-  }
-#else
-  int res = clock_gettime(CLOCK_MONOTONIC, &timestamp);
-  if (res != 0) {
-    xnn_log_error("clock_gettime failed: error code %d", errno);
-    memset(&timestamp, 0, sizeof(timestamp));
+// Appends formatted text at the given offset of a buffer of the given capacity, and returns the offset past the text.
+// Text which does not fit is dropped, but still counted in the returned offset.
+static size_t append_trace_text(char* buffer, size_t capacity, size_t offset, const char* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int length;
+  if (offset < capacity) {
+    length = vsnprintf(buffer + offset, capacity - offset, format, args);
+  } else {
+    length = vsnprintf(NULL, 0, format, args);
   }
-#endif
-  return timestamp;
+  va_end(args);
+  assert(length >= 0);
+  return offset + (size_t) length;
 }
 
-static inline uint64_t xnn_get_elapsed_time(const xnn_timestamp* start, const xnn_timestamp* end) {
-#ifdef __MACH__
-  const uint64_t kMicrosInNanos = 1000;
-  return (*end - *start) / kMicrosInNanos;
-#elif __EMSCRIPTEN__
-  const double kMillisInMicros = 1.0e3;
-  return (uint64_t) ((*end - *start) * kMillisInMicros);
-#elif XNN_PLATFORM_WINDOWS
-  const uint64_t kMicrosInSec = 1000 * 1000;
-  LARGE_INTEGER frequency;
-  BOOL res = QueryPerformanceFrequency(&frequency);
-  if (!res) {
-    xnn_log_error("QueryPerformanceFrequency failed: error code %u", GetLastError());
-    return 0;
-  }
-  return ((end->QuadPart - start->QuadPart) * kMicrosInSec) / frequency.QuadPart;
-#else
-  const uint64_t kNanosInMicro = UINT64_C(1000);
-  const uint64_t kNanosInSec = UINT64_C(1000000000);
-  const uint64_t secs = (end->tv_sec - start->tv_sec) * kNanosInSec;
-  const uint64_t ns_secs = (end->tv_nsec - start->tv_nsec);
-  return (secs + ns_secs) / kNanosInMicro;
-#endif
+// Writes the Chrome trace of the last invocation of the runtime to a buffer of the given capacity (which can be 0), and
+// returns the length of the trace, excluding the terminating null character.
+static size_t write_chrome_trace(xnn_runtime_t runtime, char* buffer, size_t capacity)
+{
+  const size_t num_threads = runtime->num_profiled_threads;
+  size_t offset = append_trace_text(buffer, capacity, 0, "{\"traceEvents\":[");
+  offset = append_trace_text(buffer, capacity, offset,
+    "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"operators\"}}");
+  for (size_t t = 0; t < num_threads; t++) {
+    offset = append_trace_text(buffer, capacity, offset,
+      ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"args\":{\"name\":\"worker %zu\"}}",
+      t + 1, t);
+  }
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      const struct xnn_operator* op = runtime->opdata[i].operator_objects[j];
+      if (op == NULL) {
+        continue;
+      }
+      const size_t trace_index = i * XNN_MAX_OPERATOR_OBJECTS + j;
+      const struct xnn_operator_trace* trace = &runtime->operator_traces[trace_index];
+      const uint64_t* thread_busy_ns = runtime->thread_busy_ns + trace_index * num_threads;
+      const char* op_name = xnn_operator_type_to_string(op->type);
+      const char* ukernel_type = xnn_microkernel_type_to_string(op->ukernel.type);
+      // Timestamps are in microseconds with nanosecond precision.
+      offset = append_trace_text(buffer, capacity, offset,
+        ",{\"name\":\"%s\",\"cat\":\"operator\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+        "\"ts\":%" PRIu64 ".%03" PRIu64 ",\"dur\":%" PRIu64 ".%03" PRIu64 ","
+        "\"args\":{\"node\":%zu,\"operator\":%zu,\"ukernel\":\"%s\",\"tiles\":%zu,\"thread_busy_us\":[",
+        op_name, trace->start_ns / 1000, trace->start_ns % 1000,
+        (trace->end_ns - trace->start_ns) / 1000, (trace->end_ns - trace->start_ns) % 1000,
+        i, j, ukernel_type, trace->num_tiles);
+      for (size_t t = 0; t < num_threads; t++) {
+        offset = append_trace_text(buffer, capacity, offset, "%s%" PRIu64 ".%03" PRIu64, t == 0 ? "" : ",",
+          thread_busy_ns[t] / 1000, thread_busy_ns[t] % 1000);
+      }
+      offset = append_trace_text(buffer, capacity, offset, "]}}");
+      for (size_t t = 0; t < num_threads; t++) {
+        if (thread_busy_ns[t] == 0) {
+          continue;
+        }
+        offset = append_trace_text(buffer, capacity, offset,
+          ",{\"name\":\"%s\",\"cat\":\"worker\",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,"
+          "\"ts\":%" PRIu64 ".%03" PRIu64 ",\"dur\":%" PRIu64 ".%03" PRIu64 "}",
+          op_name, t + 1, trace->start_ns / 1000, trace->start_ns % 1000,
+          thread_busy_ns[t] / 1000, thread_busy_ns[t] % 1000);
+      }
+    }
+  }
+  return append_trace_text(buffer, capacity, offset, "],\"displayTimeUnit\":\"ns\"}");
 }
 
 enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
@@ -1022,14 +1751,15 @@ enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
         *param_value_size_ret = required_size;
         status = xnn_status_out_of_memory;
       } else {
-        xnn_timestamp previous_ts = runtime->start_ts;
+        const uint64_t kNanosInMicro = UINT64_C(1000);
+        uint64_t previous_ts = runtime->start_ts;
         uint64_t* data = (uint64_t*) param_value;
         for (size_t i = 0; i < runtime->num_ops; ++i) {
           if (opdata[i].operator_objects[0] != NULL) {
             uint64_t op_time = 0;
             for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
               if (opdata[i].operator_objects[j] != NULL) {
-                op_time += xnn_get_elapsed_time(&previous_ts, &opdata[i].end_ts[j]);
+                op_time += (opdata[i].end_ts[j] - previous_ts) / kNanosInMicro;
                 previous_ts = opdata[i].end_ts[j];
               }
             }
@@ -1039,12 +1769,84 @@ enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
       }
       break;
     }
+    case xnn_profile_info_chrome_trace:
+      if (runtime->operator_traces == NULL) {
+        xnn_log_error("failed to get Chrome trace: runtime was not created with XNN_FLAG_DETAILED_PROFILING");
+        return xnn_status_invalid_state;
+      }
+      required_size = write_chrome_trace(runtime, NULL, 0) + 1;
+      if (param_value_size < required_size) {
+        *param_value_size_ret = required_size;
+        status = xnn_status_out_of_memory;
+      } else {
+        write_chrome_trace(runtime, (char*) param_value, param_value_size);
+      }
+      break;
     default:
       status = xnn_status_invalid_parameter;
   }
   return status;
 }
 
+struct stage_context {
+  xnn_runtime_t runtime;
+  const uint32_t* ops;
+};
+
+static void run_stage_operator(
+  const struct stage_context* context,
+  size_t i)
+{
+  const uint32_t opdata_id = context->ops[i];
+  struct xnn_operator_data* opdata = &context->runtime->opdata[opdata_id];
+  enum xnn_status status = xnn_status_success;
+  for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS && status == xnn_status_success; j++) {
+    if (opdata->operator_objects[j] != NULL) {
+      // Operators of the stage share the thread pool, so each one runs single-threaded.
+      status = xnn_run_operator_with_index(opdata->operator_objects[j], opdata_id, j, /*threadpool=*/NULL);
+    }
+  }
+  context->runtime->stage_status[i] = status;
+}
+
+static enum xnn_status invoke_runtime_by_stages(
+  xnn_runtime_t runtime)
+{
+  const bool concurrent = pthreadpool_get_threads_count(runtime->threadpool) > 1;
+  for (size_t stage = 0; stage < runtime->num_stages; stage++) {
+    const uint32_t* ops = runtime->stage_ops + runtime->stage_offsets[stage];
+    const size_t num_ops = runtime->stage_offsets[stage + 1] - runtime->stage_offsets[stage];
+    if (num_ops > 1 && concurrent) {
+      struct stage_context context = {
+        .runtime = runtime,
+        .ops = ops,
+      };
+      pthreadpool_parallelize_1d(runtime->threadpool, (pthreadpool_task_1d_t) run_stage_operator, &context, num_ops,
+                                 /*flags=*/0);
+      for (size_t i = 0; i < num_ops; i++) {
+        if (runtime->stage_status[i] != xnn_status_success) {
+          return runtime->stage_status[i];
+        }
+      }
+    } else {
+      for (size_t i = 0; i < num_ops; i++) {
+        const uint32_t opdata_id = ops[i];
+        for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+          if (runtime->opdata[opdata_id].operator_objects[j] == NULL) {
+            continue;
+          }
+          const enum xnn_status status = xnn_run_operator_with_index(
+            runtime->opdata[opdata_id].operator_objects[j], opdata_id, j, runtime->threadpool);
+          if (status != xnn_status_success) {
+            return status;
+          }
+        }
+      }
+    }
+  }
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime)
 {
@@ -1053,8 +1855,15 @@ enum xnn_status xnn_invoke_runtime(
   // if (slinky_evaluate(runtime, &status)) return status;
   #endif
 
+  if (runtime->op_stage != NULL) {
+    return invoke_runtime_by_stages(runtime);
+  }
+
   if (runtime->profiling) {
-    runtime->start_ts = xnn_read_timer();
+    runtime->start_ts = xnn_read_timer_ns();
+  }
+  if (runtime->operator_traces != NULL) {
+    runtime->trace_start_ns = xnn_read_timer_ns();
   }
   for (size_t i = 0; i < runtime->num_ops; i++) {
     for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
@@ -1063,12 +1872,24 @@ enum xnn_status xnn_invoke_runtime(
         continue;
       }
 
-      const enum xnn_status status = xnn_run_operator_with_index(runtime->opdata[i].operator_objects[j], i, j, runtime->threadpool);
+      enum xnn_status status;
+      if (runtime->operator_traces != NULL) {
+        const size_t trace_index = i * XNN_MAX_OPERATOR_OBJECTS + j;
+        struct xnn_operator_trace* trace = &runtime->operator_traces[trace_index];
+        uint64_t* thread_busy_ns = runtime->thread_busy_ns + trace_index * runtime->num_profiled_threads;
+        memset(thread_busy_ns, 0, sizeof(uint64_t) * runtime->num_profiled_threads);
+        trace->start_ns = xnn_read_timer_ns() - runtime->trace_start_ns;
+        status = xnn_run_operator_with_profile(
+          runtime->opdata[i].operator_objects[j], i, j, runtime->threadpool, thread_busy_ns, &trace->num_tiles);
+        trace->end_ns = xnn_read_timer_ns() - runtime->trace_start_ns;
+      } else {
+        status = xnn_run_operator_with_index(runtime->opdata[i].operator_objects[j], i, j, runtime->threadpool);
+      }
       if (status != xnn_status_success) {
         return status;
       }
       if (runtime->profiling) {
-        runtime->opdata[i].end_ts[j] = xnn_read_timer();
+        runtime->opdata[i].end_ts[j] = xnn_read_timer_ns();
       }
     }
   }
@@ -1079,23 +1900,51 @@ enum xnn_status xnn_delete_runtime(
   xnn_runtime_t runtime)
 {
   if (runtime != NULL) {
+    enum xnn_status status = xnn_mutex_lock(&runtime->clones_mutex);
+    if (status != xnn_status_success) {
+      return status;
+    }
+    const size_t num_clones = runtime->num_clones;
+    xnn_mutex_unlock(&runtime->clones_mutex);
+    if (num_clones != 0) {
+      xnn_log_error("failed to delete runtime: %zu clones of the runtime must be deleted first", num_clones);
+      return xnn_status_invalid_state;
+    }
+    if (runtime->clone_source != NULL) {
+      struct xnn_runtime* source = runtime->clone_source;
+      status = xnn_mutex_lock(&source->clones_mutex);
+      if (status != xnn_status_success) {
+        return status;
+      }
+      assert(source->num_clones != 0);
+      source->num_clones--;
+      xnn_mutex_unlock(&source->clones_mutex);
+    }
+
     #ifdef XNN_SLINKY_AVAILABLE
     // slinky_destroy_pipeline(runtime);
     #endif
 
     if (runtime->opdata != NULL) {
+      if (runtime->reshape_plans != NULL) {
+        release_reshape_plans(runtime);
+      }
       for (size_t i = 0; i < runtime->num_ops; i++) {
         for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
           xnn_delete_operator(runtime->opdata[i].operator_objects[j]);
         }
       }
       xnn_release_memory(runtime->opdata);
+      xnn_release_memory(runtime->op_stage);
+      xnn_release_memory(runtime->stage_status);
+      xnn_release_memory(runtime->operator_traces);
+      xnn_release_memory(runtime->thread_busy_ns);
 
       if (runtime->values != NULL) {
-        // Release the buffers created during FP16 rewrite.
+        // Release the buffers created during FP16 rewrite, which clones share with their source.
         for (size_t i = 0; i < runtime->num_values; i++) {
           struct xnn_value* value = &runtime->values[i];
-          if (value->allocation_type == xnn_allocation_type_dynamic) {
+          if (value->allocation_type == xnn_allocation_type_dynamic && runtime->clone_source == NULL) {
             xnn_release_memory(value->data);
           }
         }
@@ -1120,6 +1969,7 @@ enum xnn_status xnn_delete_runtime(
         xnn_release_workspace(runtime->workspace);
       }
     }
+    xnn_mutex_destroy(&runtime->clones_mutex);
     xnn_release_memory(runtime);
   }
   return xnn_status_success;
@@ -24,6 +24,7 @@
 #include "xnnpack/log.h"
 #include "xnnpack/math.h"
 #include "xnnpack/node-type.h"
+#include "xnnpack/operator.h"
 #include "xnnpack/params.h"
 
 #ifndef XNN_ENABLE_SPARSE
@@ -201,6 +202,8 @@ void xnn_value_copy(
   dst_value->fp32_id = src_value->fp32_id;
   dst_value->fp16_temp_data = src_value->fp16_temp_data;
   dst_value->fp32_data = src_value->fp32_data;
+  dst_value->kv_cache_position = src_value->kv_cache_position;
+  dst_value->kv_cache_tokens = src_value->kv_cache_tokens;
 }
 
 struct xnn_node* xnn_subgraph_new_node(xnn_subgraph_t subgraph)
@@ -875,11 +878,15 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_fully_connected:
       case xnn_node_type_global_average_pooling_2d:
       case xnn_node_type_global_sum_pooling_2d:
+      case xnn_node_type_layer_norm:
       case xnn_node_type_max_pooling_2d:
+      case xnn_node_type_rms_norm:
       case xnn_node_type_softmax:
       case xnn_node_type_space_to_depth_2d:
       case xnn_node_type_static_constant_pad:
+      case xnn_node_type_static_max:
       case xnn_node_type_static_mean:
+      case xnn_node_type_static_min:
       case xnn_node_type_static_slice:
       case xnn_node_type_static_sum:
       case xnn_node_type_static_reshape:
@@ -1385,6 +1392,761 @@ enum xnn_status xnn_subgraph_fusion(
   return xnn_status_success;
 }
 
+// Elementwise operations in a GEMM epilogue, in the order in which they are applied.
+enum gemm_epilogue_stage {
+  gemm_epilogue_stage_none = 0,
+  gemm_epilogue_stage_scale,
+  gemm_epilogue_stage_residual,
+  gemm_epilogue_stage_activation,
+  gemm_epilogue_stage_clamp,
+};
+
+static enum gemm_epilogue_stage get_gemm_epilogue_stage(const struct xnn_node* node)
+{
+  const struct xnn_node_epilogue* epilogue = &node->epilogue;
+  if (!epilogue->enabled) {
+    return gemm_epilogue_stage_none;
+  } else if (epilogue->output_min != -INFINITY || epilogue->output_max != INFINITY) {
+    return gemm_epilogue_stage_clamp;
+  } else if (epilogue->activation != xnn_unary_invalid) {
+    return gemm_epilogue_stage_activation;
+  } else if (epilogue->residual_id != XNN_INVALID_VALUE_ID) {
+    return gemm_epilogue_stage_residual;
+  } else if (epilogue->scale_id != XNN_INVALID_VALUE_ID) {
+    return gemm_epilogue_stage_scale;
+  }
+  return gemm_epilogue_stage_none;
+}
+
+// Returns true if the Node runs as a FP32 GEMM or IGEMM operator that can apply an epilogue to its output tiles.
+static bool supports_gemm_epilogue(xnn_subgraph_t subgraph, const struct xnn_node* node)
+{
+  switch (node->type) {
+    case xnn_node_type_fully_connected:
+      break;
+    case xnn_node_type_convolution_2d:
+      // Grouped convolutions and depthwise convolutions in disguise use other microkernels.
+      if (node->params.convolution_2d.groups != 1 ||
+          (node->params.convolution_2d.group_input_channels == 1 &&
+           node->params.convolution_2d.group_output_channels == 1)) {
+        return false;
+      }
+      break;
+    default:
+      return false;
+  }
+
+  const uint32_t num_gemm_inputs = node->num_inputs - node->epilogue.num_inputs;
+  const struct xnn_value* input = &subgraph->values[node->inputs[0]];
+  const struct xnn_value* filter = &subgraph->values[node->inputs[1]];
+  const struct xnn_value* output = &subgraph->values[node->outputs[0]];
+  if (input->datatype != xnn_datatype_fp32 || filter->datatype != xnn_datatype_fp32 ||
+      output->datatype != xnn_datatype_fp32 || !xnn_value_is_static(filter) ||
+      input->layout != xnn_layout_type_nhwc || output->layout != xnn_layout_type_nhwc) {
+    return false;
+  }
+  if (num_gemm_inputs > 2) {
+    const struct xnn_value* bias = &subgraph->values[node->inputs[2]];
+    if (bias->datatype != xnn_datatype_fp32 || !xnn_value_is_static(bias)) {
+      return false;
+    }
+  }
+
+  // The shape of the output Value is only a hint until the Runtime is reshaped, but it must at least agree with the
+  // number of output channels of the Node for elementwise consumers to be fused against it.
+  size_t output_channels;
+  if (node->type == xnn_node_type_fully_connected) {
+    output_channels = filter->shape.dim[(node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS) ? 1 : 0];
+  } else {
+    output_channels = node->params.convolution_2d.group_output_channels;
+  }
+  return output->shape.num_dims != 0 && output->shape.dim[output->shape.num_dims - 1] == output_channels;
+}
+
+static bool shapes_are_equal(const struct xnn_shape* a, const struct xnn_shape* b)
+{
+  if (a->num_dims != b->num_dims) {
+    return false;
+  }
+  for (size_t i = 0; i < a->num_dims; i++) {
+    if (a->dim[i] != b->dim[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void enable_gemm_epilogue(struct xnn_node* node)
+{
+  if (!node->epilogue.enabled) {
+    node->epilogue = (struct xnn_node_epilogue) {
+      .enabled = true,
+      .scale_id = XNN_INVALID_VALUE_ID,
+      .residual_id = XNN_INVALID_VALUE_ID,
+      .activation = xnn_unary_invalid,
+      .output_min = -INFINITY,
+      .output_max = INFINITY,
+    };
+  }
+}
+
+static void add_gemm_epilogue_input(
+  xnn_subgraph_t subgraph, struct xnn_node* producer, uint32_t producer_id, uint32_t consumer_id, uint32_t input_id)
+{
+  assert(producer->num_inputs < XNN_MAX_INPUTS);
+  producer->inputs[producer->num_inputs++] = input_id;
+  producer->epilogue.num_inputs += 1;
+  struct xnn_value* input = &subgraph->values[input_id];
+  if (input->first_consumer == consumer_id || input->first_consumer > producer_id) {
+    input->first_consumer = producer_id;
+  }
+}
+
+// Tries to fuse the consumer of the output of a GEMM-based producer into the epilogue of the producer. The epilogue
+// applies a fixed sequence of operations (see enum gemm_epilogue_stage), so a consumer can be fused only if it comes
+// after all operations fused so far.
+static bool fuse_into_gemm_epilogue(
+  xnn_subgraph_t subgraph, struct xnn_node* producer, uint32_t producer_id, const struct xnn_value* value,
+  const struct xnn_node* consumer, uint32_t consumer_id)
+{
+  if (consumer->num_outputs != 1) {
+    return false;
+  }
+  const struct xnn_value* fused_output = &subgraph->values[consumer->outputs[0]];
+  if (fused_output->datatype != xnn_datatype_fp32 || fused_output->layout != xnn_layout_type_nhwc ||
+      !shapes_are_equal(&value->shape, &fused_output->shape)) {
+    return false;
+  }
+
+  const enum gemm_epilogue_stage stage = get_gemm_epilogue_stage(producer);
+  switch (consumer->type) {
+    case xnn_node_type_unary_elementwise:
+      if (consumer->unary_operator == xnn_unary_clamp) {
+        enable_gemm_epilogue(producer);
+        producer->epilogue.output_min = math_max_f32(producer->epilogue.output_min, consumer->params.unary.clamp.min);
+        producer->epilogue.output_max = math_min_f32(producer->epilogue.output_max, consumer->params.unary.clamp.max);
+        return true;
+      }
+      if (stage >= gemm_epilogue_stage_activation ||
+          !xnn_gemm_epilogue_supports_activation_f32(consumer->unary_operator)) {
+        return false;
+      }
+      enable_gemm_epilogue(producer);
+      producer->epilogue.activation = consumer->unary_operator;
+      producer->epilogue.activation_params = consumer->params.unary;
+      return true;
+    case xnn_node_type_binary_elementwise:
+    {
+      if (consumer->num_inputs != 2 || producer->num_inputs >= XNN_MAX_INPUTS) {
+        return false;
+      }
+      const uint32_t other_id = consumer->inputs[0] == value->id ? consumer->inputs[1] : consumer->inputs[0];
+      if (other_id == value->id) {
+        return false;
+      }
+      const struct xnn_value* other = &subgraph->values[other_id];
+      if (other->datatype != xnn_datatype_fp32 || other->layout != xnn_layout_type_nhwc) {
+        return false;
+      }
+      switch (consumer->binary_operator) {
+        case xnn_binary_multiply:
+        {
+          // Multiplication by static per-channel scales, e.g. a folded normalization.
+          if (stage >= gemm_epilogue_stage_scale || !xnn_value_is_static(other) ||
+              value->shape.num_dims == 0 || other->shape.num_dims == 0) {
+            return false;
+          }
+          const size_t channels = value->shape.dim[value->shape.num_dims - 1];
+          if (channels == 0 || other->shape.dim[other->shape.num_dims - 1] != channels ||
+              xnn_shape_multiply_all_dims(&other->shape) != channels || other->shape.num_dims > value->shape.num_dims) {
+            return false;
+          }
+          enable_gemm_epilogue(producer);
+          producer->epilogue.scale_id = other_id;
+          add_gemm_epilogue_input(subgraph, producer, producer_id, consumer_id, other_id);
+          return true;
+        }
+        case xnn_binary_add:
+          // Addition of a residual tensor of the same shape, which must be available when the producer runs. Persistent
+          // Values may be overwritten between the producer and the consumer.
+          if (stage >= gemm_epilogue_stage_residual || !shapes_are_equal(&value->shape, &other->shape) ||
+              xnn_value_is_persistent(other) ||
+              (other->producer != XNN_INVALID_NODE_ID && other->producer >= producer_id)) {
+            return false;
+          }
+          enable_gemm_epilogue(producer);
+          producer->epilogue.residual_id = other_id;
+          add_gemm_epilogue_input(subgraph, producer, producer_id, consumer_id, other_id);
+          return true;
+        default:
+          return false;
+      }
+    }
+    default:
+      return false;
+  }
+}
+
+// Fuses chains of elementwise Nodes following FP32 Fully Connected and Convolution 2D Nodes into their epilogues, so
+// that they are applied to each output tile while it is still in cache instead of in separate passes over the whole
+// tensor.
+static void fuse_gemm_epilogues(xnn_subgraph_t subgraph)
+{
+  for (uint32_t producer_id = 0; producer_id < subgraph->num_nodes; producer_id++) {
+    struct xnn_node* producer = &subgraph->nodes[producer_id];
+    if (!supports_gemm_epilogue(subgraph, producer)) {
+      continue;
+    }
+    for (;;) {
+      struct xnn_value* value = &subgraph->values[producer->outputs[0]];
+      if (!xnn_value_is_internal(value) || value->num_consumers != 1 ||
+          value->first_consumer == XNN_INVALID_NODE_ID) {
+        break;
+      }
+      const uint32_t consumer_id = value->first_consumer;
+      struct xnn_node* consumer = &subgraph->nodes[consumer_id];
+      if (!fuse_into_gemm_epilogue(subgraph, producer, producer_id, value, consumer, consumer_id)) {
+        break;
+      }
+      xnn_log_info("fuse %s Node #%" PRIu32 " into epilogue of %s Node #%" PRIu32,
+        xnn_node_type_to_string(consumer->type), consumer_id, xnn_node_type_to_string(producer->type), producer_id);
+
+      const uint32_t fused_output_id = consumer->outputs[0];
+      assert(fused_output_id < subgraph->num_values);
+      subgraph->values[fused_output_id].producer = producer_id;
+      producer->outputs[0] = fused_output_id;
+      xnn_node_clear(consumer);
+      xnn_value_clear(value);
+    }
+  }
+}
+
+enum xnn_status xnn_create_node_epilogue(
+  const struct xnn_node_epilogue* epilogue,
+  struct xnn_operator* op)
+{
+  if (!epilogue->enabled) {
+    return xnn_status_success;
+  }
+  return xnn_fuse_gemm_epilogue_f32(
+    op, epilogue->scale_id != XNN_INVALID_VALUE_ID, epilogue->residual_id != XNN_INVALID_VALUE_ID,
+    epilogue->activation, &epilogue->activation_params, epilogue->output_min, epilogue->output_max);
+}
+
+enum xnn_status xnn_reshape_node_epilogue(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values)
+{
+  if (!opdata->epilogue.enabled || opdata->epilogue.residual_id == XNN_INVALID_VALUE_ID) {
+    return xnn_status_success;
+  }
+  const struct xnn_value* residual = &values[opdata->epilogue.residual_id];
+  const struct xnn_value* output = &values[opdata->outputs[0]];
+  if (!shapes_are_equal(&residual->shape, &output->shape)) {
+    xnn_log_error(
+      "failed to reshape %s operator with fused residual addition: residual Value #%" PRIu32
+      " must have the shape of output Value #%" PRIu32,
+      xnn_node_type_to_string(opdata->type), opdata->epilogue.residual_id, opdata->outputs[0]);
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_node_epilogue(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values)
+{
+  if (!opdata->epilogue.enabled) {
+    return xnn_status_success;
+  }
+  const float* scale = opdata->epilogue.scale_id != XNN_INVALID_VALUE_ID ?
+    values[opdata->epilogue.scale_id].data : NULL;
+  const float* residual = opdata->epilogue.residual_id != XNN_INVALID_VALUE_ID ?
+    values[opdata->epilogue.residual_id].data : NULL;
+  return xnn_setup_gemm_epilogue_f32(opdata->operator_objects[0], scale, residual);
+}
+
+// Returns true if the Value is a single element broadcasted to all elements by an Elementwise Chain operation.
+static bool is_elementwise_chain_scalar(const struct xnn_value* value)
+{
+  return xnn_value_is_static(value) && xnn_shape_multiply_all_dims(&value->shape) == 1;
+}
+
+// Returns true if the Node is a FP32 unary or binary elementwise Node that can be a part of an Elementwise Chain: each
+// of its inputs either has the shape of its output or is a single-element static Value.
+static bool is_chainable_elementwise_node(xnn_subgraph_t subgraph, const struct xnn_node* node)
+{
+  switch (node->type) {
+    case xnn_node_type_unary_elementwise:
+      if (node->unary_operator == xnn_unary_convert ||
+          xnn_init_f32_unary_elementwise_config(node->unary_operator) == NULL) {
+        return false;
+      }
+      break;
+    case xnn_node_type_binary_elementwise:
+      if (xnn_init_f32_binary_elementwise_config(node->binary_operator) == NULL) {
+        return false;
+      }
+      break;
+    default:
+      return false;
+  }
+  if (node->num_outputs != 1) {
+    return false;
+  }
+
+  const struct xnn_value* output = &subgraph->values[node->outputs[0]];
+  if (output->datatype != xnn_datatype_fp32 || output->layout != xnn_layout_type_nhwc) {
+    return false;
+  }
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    // Persistent Values may be overwritten before the Elementwise Chain Node runs.
+    const struct xnn_value* input = &subgraph->values[node->inputs[i]];
+    if (input->datatype != xnn_datatype_fp32 || input->layout != xnn_layout_type_nhwc ||
+        xnn_value_is_persistent(input)) {
+      return false;
+    }
+    if (!is_elementwise_chain_scalar(input) && !shapes_are_equal(&input->shape, &output->shape)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Appends the operation of an elementwise Node to an Elementwise Chain Node, where input acc_index of the Node is the
+// result of the chain so far. Returns false if the chain has no room left for the operation or its other operand.
+static bool append_elementwise_chain_op(
+  xnn_subgraph_t subgraph, struct xnn_node* chain, const struct xnn_node* node, uint32_t acc_index)
+{
+  if (chain->params.elementwise_chain.num_ops == XNN_MAX_ELEMENTWISE_CHAIN_OPS) {
+    return false;
+  }
+
+  struct xnn_elementwise_chain_op op = {
+    .unary_operator = xnn_unary_invalid,
+    .binary_operator = xnn_binary_invalid,
+  };
+  if (node->type == xnn_node_type_unary_elementwise) {
+    op.unary_operator = node->unary_operator;
+    op.unary_params = node->params.unary;
+  } else {
+    assert(node->type == xnn_node_type_binary_elementwise);
+    const uint32_t other_id = node->inputs[1 - acc_index];
+    uint32_t input_index = 0;
+    while (input_index < chain->num_inputs && chain->inputs[input_index] != other_id) {
+      input_index++;
+    }
+    if (input_index == chain->num_inputs) {
+      if (chain->num_inputs == XNN_MAX_ELEMENTWISE_CHAIN_INPUTS) {
+        return false;
+      }
+      chain->inputs[chain->num_inputs++] = other_id;
+    }
+    op.binary_operator = node->binary_operator;
+    op.input_index = input_index;
+    op.input_is_first = acc_index == 1;
+    op.input_is_scalar = is_elementwise_chain_scalar(&subgraph->values[other_id]);
+  }
+  chain->params.elementwise_chain.ops[chain->params.elementwise_chain.num_ops++] = op;
+  return true;
+}
+
+// Replaces runs of FP32 elementwise Nodes, where each Node consumes the result of the previous one, with Elementwise
+// Chain Nodes that apply all operations to one cache-sized block at a time instead of streaming every intermediate
+// result through memory. The chain Node takes the place of the last Node of the run, where all of its inputs are
+// available.
+static void fuse_elementwise_chains(xnn_subgraph_t subgraph)
+{
+  bool fused_any = false;
+  for (uint32_t head_id = 0; head_id < subgraph->num_nodes; head_id++) {
+    const struct xnn_node* head = &subgraph->nodes[head_id];
+    if (!is_chainable_elementwise_node(subgraph, head)) {
+      continue;
+    }
+
+    // The first input of the chain determines the shape of the output, so it must not be broadcasted.
+    uint32_t acc_index = 0;
+    if (head->type == xnn_node_type_binary_elementwise &&
+        is_elementwise_chain_scalar(&subgraph->values[head->inputs[0]])) {
+      acc_index = 1;
+    }
+    if (xnn_value_is_static(&subgraph->values[head->inputs[acc_index]])) {
+      continue;
+    }
+
+    struct xnn_node chain;
+    memset(&chain, 0, sizeof(chain));
+    chain.inputs[0] = head->inputs[acc_index];
+    chain.num_inputs = 1;
+    uint32_t chain_node_ids[XNN_MAX_ELEMENTWISE_CHAIN_OPS];
+    chain_node_ids[0] = head_id;
+    bool appended = append_elementwise_chain_op(subgraph, &chain, head, acc_index);
+    assert(appended);
+    (void) appended;
+
+    uint32_t tail_id = head_id;
+    for (;;) {
+      const uint32_t value_id = subgraph->nodes[tail_id].outputs[0];
+      const struct xnn_value* value = &subgraph->values[value_id];
+      if (!xnn_value_is_internal(value) || value->num_consumers != 1 ||
+          value->first_consumer == XNN_INVALID_NODE_ID) {
+        break;
+      }
+      const uint32_t consumer_id = value->first_consumer;
+      const struct xnn_node* consumer = &subgraph->nodes[consumer_id];
+      if (!is_chainable_elementwise_node(subgraph, consumer) ||
+          !shapes_are_equal(&value->shape, &subgraph->values[consumer->outputs[0]].shape)) {
+        break;
+      }
+      acc_index = consumer->inputs[0] == value_id ? 0 : 1;
+      if (!append_elementwise_chain_op(subgraph, &chain, consumer, acc_index)) {
+        break;
+      }
+      chain_node_ids[chain.params.elementwise_chain.num_ops - 1] = consumer_id;
+      tail_id = consumer_id;
+    }
+
+    const size_t num_ops = chain.params.elementwise_chain.num_ops;
+    if (num_ops < 2) {
+      continue;
+    }
+    xnn_log_info("fuse %zu elementwise Nodes #%" PRIu32 "-#%" PRIu32 " into Elementwise Chain Node #%" PRIu32,
+      num_ops, head_id, tail_id, tail_id);
+
+    struct xnn_node* tail = &subgraph->nodes[tail_id];
+    chain.id = tail_id;
+    chain.outputs[0] = tail->outputs[0];
+    chain.num_outputs = 1;
+    chain.activation.output_min = -INFINITY;
+    chain.activation.output_max = INFINITY;
+    chain.cluster_leader = tail->cluster_leader;
+    xnn_init_elementwise_chain_node(&chain);
+    for (size_t i = 0; i + 1 < num_ops; i++) {
+      struct xnn_node* node = &subgraph->nodes[chain_node_ids[i]];
+      xnn_value_clear(&subgraph->values[node->outputs[0]]);
+      xnn_node_clear(node);
+    }
+    *tail = chain;
+    fused_any = true;
+  }
+
+  if (fused_any) {
+    // Inputs of the fused Nodes are now consumed by the chain Nodes.
+    xnn_subgraph_analyze_consumers_and_producers(subgraph);
+  }
+}
+
+// Fuses Convert Nodes from FP32 to QD8 or QDU8 into the elementwise Node or Elementwise Chain Node producing their
+// input, so that the FP32 result is quantized while it is still in cache instead of being written to memory and read
+// back twice (once to find the range of each row, once to quantize it). The fused Node takes the place of the Convert
+// Node.
+static void fuse_quantization_into_elementwise_chains(xnn_subgraph_t subgraph)
+{
+  bool fused_any = false;
+  for (uint32_t convert_id = 0; convert_id < subgraph->num_nodes; convert_id++) {
+    struct xnn_node* convert = &subgraph->nodes[convert_id];
+    if (convert->type != xnn_node_type_convert) {
+      continue;
+    }
+    const struct xnn_value* output = &subgraph->values[convert->outputs[0]];
+    if (output->datatype != xnn_datatype_qdint8 && output->datatype != xnn_datatype_qduint8) {
+      continue;
+    }
+    const uint32_t value_id = convert->inputs[0];
+    const struct xnn_value* value = &subgraph->values[value_id];
+    if (value->datatype != xnn_datatype_fp32 || value->layout != xnn_layout_type_nhwc ||
+        !xnn_value_is_internal(value) || value->num_consumers != 1 || value->producer == XNN_INVALID_NODE_ID) {
+      continue;
+    }
+
+    const uint32_t producer_id = value->producer;
+    struct xnn_node* producer = &subgraph->nodes[producer_id];
+    struct xnn_node chain;
+    if (producer->type == xnn_node_type_elementwise_chain) {
+      chain = *producer;
+    } else if (is_chainable_elementwise_node(subgraph, producer)) {
+      uint32_t acc_index = 0;
+      if (producer->type == xnn_node_type_binary_elementwise &&
+          is_elementwise_chain_scalar(&subgraph->values[producer->inputs[0]])) {
+        acc_index = 1;
+      }
+      if (xnn_value_is_static(&subgraph->values[producer->inputs[acc_index]])) {
+        continue;
+      }
+      memset(&chain, 0, sizeof(chain));
+      chain.inputs[0] = producer->inputs[acc_index];
+      chain.num_inputs = 1;
+      bool appended = append_elementwise_chain_op(subgraph, &chain, producer, acc_index);
+      assert(appended);
+      (void) appended;
+      chain.activation.output_min = -INFINITY;
+      chain.activation.output_max = INFINITY;
+      xnn_init_elementwise_chain_node(&chain);
+    } else {
+      continue;
+    }
+    xnn_log_info("fuse Convert Node #%" PRIu32 " into %s Node #%" PRIu32,
+      convert_id, xnn_node_type_to_string(producer->type), producer_id);
+
+    chain.id = convert_id;
+    chain.outputs[0] = convert->outputs[0];
+    chain.num_outputs = 1;
+    chain.cluster_leader = convert->cluster_leader;
+    xnn_value_clear(&subgraph->values[value_id]);
+    xnn_node_clear(producer);
+    *convert = chain;
+    fused_any = true;
+  }
+
+  if (fused_any) {
+    xnn_subgraph_analyze_consumers_and_producers(subgraph);
+  }
+}
+
+// Fuses Convert Nodes from FP32 or FP16 to QD8 or QDU8 into the Layer Norm or RMS Norm Node producing their input, so
+// that each row is quantized right after it is normalized. The fused Node takes the place of the Convert Node.
+static void fuse_quantization_into_norms(xnn_subgraph_t subgraph)
+{
+  bool fused_any = false;
+  for (uint32_t convert_id = 0; convert_id < subgraph->num_nodes; convert_id++) {
+    struct xnn_node* convert = &subgraph->nodes[convert_id];
+    if (convert->type != xnn_node_type_convert) {
+      continue;
+    }
+    const struct xnn_value* output = &subgraph->values[convert->outputs[0]];
+    if ((output->datatype != xnn_datatype_qdint8 && output->datatype != xnn_datatype_qduint8) ||
+        output->quantization.num_nonbatch_dims != 1) {
+      continue;
+    }
+    const uint32_t value_id = convert->inputs[0];
+    const struct xnn_value* value = &subgraph->values[value_id];
+    if ((value->datatype != xnn_datatype_fp32 && value->datatype != xnn_datatype_fp16) ||
+        !xnn_value_is_internal(value) || value->num_consumers != 1 || value->producer == XNN_INVALID_NODE_ID) {
+      continue;
+    }
+
+    const uint32_t producer_id = value->producer;
+    struct xnn_node* producer = &subgraph->nodes[producer_id];
+    if (producer->type != xnn_node_type_layer_norm && producer->type != xnn_node_type_rms_norm) {
+      continue;
+    }
+    xnn_log_info("fuse Convert Node #%" PRIu32 " into %s Node #%" PRIu32,
+      convert_id, xnn_node_type_to_string(producer->type), producer_id);
+
+    struct xnn_node norm = *producer;
+    norm.id = convert_id;
+    norm.outputs[0] = convert->outputs[0];
+    norm.cluster_leader = convert->cluster_leader;
+    xnn_value_clear(&subgraph->values[value_id]);
+    xnn_node_clear(producer);
+    *convert = norm;
+    fused_any = true;
+  }
+
+  if (fused_any) {
+    xnn_subgraph_analyze_consumers_and_producers(subgraph);
+  }
+}
+
+// Returns true if the Node is a Fully Connected Node with static weights, which can be computed together with other
+// Fully Connected Nodes with the same input.
+static bool is_fully_connected_multi_output_candidate(xnn_subgraph_t subgraph, const struct xnn_node* node)
+{
+  if (node->type != xnn_node_type_fully_connected || node->epilogue.enabled || node->num_outputs != 1) {
+    return false;
+  }
+  for (uint32_t i = 1; i < node->num_inputs; i++) {
+    if (!xnn_value_is_static(&subgraph->values[node->inputs[i]])) {
+      return false;
+    }
+  }
+  // The fused Node runs in place of the first of the fused Nodes, so its outputs are written earlier than before.
+  // Persistent Values may be read by Nodes in between.
+  return !xnn_value_is_persistent(&subgraph->values[node->outputs[0]]);
+}
+
+static bool can_fuse_fully_connected_outputs(
+  xnn_subgraph_t subgraph, const struct xnn_node* first, const struct xnn_node* node)
+{
+  if (node->inputs[0] != first->inputs[0] || node->num_inputs != first->num_inputs || node->flags != first->flags ||
+      node->activation.output_min != first->activation.output_min ||
+      node->activation.output_max != first->activation.output_max) {
+    return false;
+  }
+  for (uint32_t i = 1; i < node->num_inputs; i++) {
+    if (subgraph->values[node->inputs[i]].datatype != subgraph->values[first->inputs[i]].datatype) {
+      return false;
+    }
+  }
+  const struct xnn_value* filter = &subgraph->values[node->inputs[1]];
+  const struct xnn_value* first_filter = &subgraph->values[first->inputs[1]];
+  const size_t input_channels_index = (node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS) ? 0 : 1;
+  return filter->shape.num_dims == 2 && first_filter->shape.num_dims == 2 &&
+         filter->shape.dim[input_channels_index] == first_filter->shape.dim[input_channels_index] &&
+         subgraph->values[node->outputs[0]].datatype == subgraph->values[first->outputs[0]].datatype;
+}
+
+// Fuses Fully Connected Nodes which read the same input, e.g. the Q, K and V projections of an attention block or the
+// gate and up projections of a gated MLP, into Multi-Output Fully Connected Nodes. These compute all outputs in a single
+// parallel region, which keeps more threads busy when the batch is small.
+static void fuse_fully_connected_outputs(xnn_subgraph_t subgraph)
+{
+  bool fused_any = false;
+  for (uint32_t first_id = 0; first_id < subgraph->num_nodes; first_id++) {
+    struct xnn_node* first = &subgraph->nodes[first_id];
+    if (!is_fully_connected_multi_output_candidate(subgraph, first) ||
+        subgraph->values[first->inputs[0]].num_consumers < 2) {
+      continue;
+    }
+
+    uint32_t node_ids[XNN_MAX_GEMM_MULTI_OUTPUTS];
+    node_ids[0] = first_id;
+    size_t num_fused = 1;
+    for (uint32_t node_id = first_id + 1; node_id < subgraph->num_nodes && num_fused < XNN_MAX_GEMM_MULTI_OUTPUTS;
+         node_id++) {
+      const struct xnn_node* node = &subgraph->nodes[node_id];
+      if (is_fully_connected_multi_output_candidate(subgraph, node) &&
+          can_fuse_fully_connected_outputs(subgraph, first, node)) {
+        node_ids[num_fused++] = node_id;
+      }
+    }
+    if (num_fused < 2) {
+      continue;
+    }
+    xnn_log_info("fuse %zu Fully Connected Nodes #%" PRIu32 "-#%" PRIu32 " into Multi-Output Fully Connected Node #%" PRIu32,
+      num_fused, first_id, node_ids[num_fused - 1], first_id);
+
+    const uint32_t num_weights = first->num_inputs - 1;
+    assert(1 + num_fused * num_weights <= XNN_MAX_INPUTS);
+    assert(num_fused <= XNN_MAX_OUTPUTS);
+    struct xnn_node fused = *first;
+    fused.num_inputs = 1 + num_fused * num_weights;
+    fused.num_outputs = num_fused;
+    for (size_t i = 0; i < num_fused; i++) {
+      struct xnn_node* node = &subgraph->nodes[node_ids[i]];
+      for (uint32_t j = 0; j < num_weights; j++) {
+        fused.inputs[1 + i * num_weights + j] = node->inputs[1 + j];
+      }
+      fused.outputs[i] = node->outputs[0];
+      subgraph->values[node->outputs[0]].producer = first_id;
+      if (i != 0) {
+        xnn_node_clear(node);
+      }
+    }
+    xnn_init_fully_connected_multi_output_node(&fused);
+    *first = fused;
+    fused_any = true;
+  }
+
+  if (fused_any) {
+    xnn_subgraph_analyze_consumers_and_producers(subgraph);
+  }
+}
+
+// Returns true if the Node quantizes or packs its input for GEMM-like consumers, and its output may be shared with other
+// such Nodes reading the same input.
+static bool is_shareable_activation_quantization(xnn_subgraph_t subgraph, const struct xnn_node* node)
+{
+  if (node->num_inputs != 1 || node->num_outputs != 1) {
+    return false;
+  }
+  const struct xnn_value* input = &subgraph->values[node->inputs[0]];
+  const struct xnn_value* output = &subgraph->values[node->outputs[0]];
+  if (xnn_value_is_external(output) || xnn_value_is_persistent(output) || output->num_consumers == 0) {
+    return false;
+  }
+  switch (node->type) {
+    case xnn_node_type_convert:
+      return output->datatype == xnn_datatype_qdint8 &&
+             (input->datatype == xnn_datatype_fp32 || input->datatype == xnn_datatype_fp16);
+    case xnn_node_type_pack_lh:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns true if all consumers of the dynamically quantized Value have the same type and filter datatype as the
+// reference Node, so that the choice of quantized datatype in `xnn_subgraph_optimize_dynamic_quantization_ops` suits
+// all of them.
+static bool dynamic_quantization_consumers_match(
+  xnn_subgraph_t subgraph, uint32_t value_id, const struct xnn_node* reference)
+{
+  const struct xnn_value* value = &subgraph->values[value_id];
+  if (!value->all_consumers_types_same || subgraph->nodes[value->first_consumer].type != reference->type) {
+    return false;
+  }
+  for (uint32_t n = value->first_consumer; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      if (node->inputs[i] == value_id &&
+          (node->num_inputs < 2 || reference->num_inputs < 2 ||
+           subgraph->values[node->inputs[1]].datatype != subgraph->values[reference->inputs[1]].datatype)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Converts to `qdint8` are defined per consumer, and `pack_lh` Nodes are inserted per Fully Connected Node, so an
+// activation feeding several quantized layers would be quantized (and its per-row quantization parameters computed)
+// once per layer. Instead, the first quantization of an activation is shared with all compatible consumers, and the
+// duplicates are removed. The memory planner then keeps the shared Value alive until its last consumer.
+static void share_activation_quantization(xnn_subgraph_t subgraph)
+{
+  bool shared_any = false;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    if (!is_shareable_activation_quantization(subgraph, node)) {
+      continue;
+    }
+    const uint32_t output_id = node->outputs[0];
+    const struct xnn_value* output = &subgraph->values[output_id];
+    const struct xnn_node* reference_consumer = &subgraph->nodes[output->first_consumer];
+    if (node->type == xnn_node_type_convert &&
+        !dynamic_quantization_consumers_match(subgraph, output_id, reference_consumer)) {
+      continue;
+    }
+
+    for (uint32_t m = n + 1; m < subgraph->num_nodes; m++) {
+      struct xnn_node* other = &subgraph->nodes[m];
+      if (other->type != node->type || other->inputs[0] != node->inputs[0] || other->flags != node->flags ||
+          !is_shareable_activation_quantization(subgraph, other)) {
+        continue;
+      }
+      const uint32_t other_output_id = other->outputs[0];
+      struct xnn_value* other_output = &subgraph->values[other_output_id];
+      if (other_output->datatype != output->datatype) {
+        continue;
+      }
+      if (node->type == xnn_node_type_convert &&
+          (other_output->quantization.num_nonbatch_dims != output->quantization.num_nonbatch_dims ||
+           !dynamic_quantization_consumers_match(subgraph, other_output_id, reference_consumer))) {
+        continue;
+      }
+
+      xnn_log_info("share output Value #%" PRIu32 " of %s Node #%" PRIu32 " with consumers of Value #%" PRIu32,
+        output_id, xnn_node_type_to_string(node->type), n, other_output_id);
+      for (uint32_t c = m + 1; c < subgraph->num_nodes; c++) {
+        struct xnn_node* consumer = &subgraph->nodes[c];
+        for (uint32_t i = 0; i < consumer->num_inputs; i++) {
+          if (consumer->inputs[i] == other_output_id) {
+            consumer->inputs[i] = output_id;
+          }
+        }
+      }
+      xnn_node_clear(other);
+      xnn_value_clear(other_output);
+      shared_any = true;
+    }
+  }
+
+  if (shared_any) {
+    xnn_subgraph_analyze_consumers_and_producers(subgraph);
+  }
+}
+
 void xnn_subgraph_optimize_dynamic_quantization_ops(xnn_subgraph_t subgraph) {
   enum xnn_weights_type {
     xnn_weights_type_invalid = 0,
@@ -1442,7 +2204,9 @@ void xnn_subgraph_optimize_dynamic_quantization_ops(xnn_subgraph_t subgraph) {
           XNN_UNREACHABLE;
       }
       bool pack_activations = false;
-      if (input->datatype == xnn_datatype_fp32) {
+      // Only Convert Nodes can be rewritten to pack the activations, other Nodes producing dynamically quantized
+      // outputs (e.g. normalizations) keep their own parameters.
+      if (node->type == xnn_node_type_convert && input->datatype == xnn_datatype_fp32) {
         // Coerce the input from `xnn_datatype_qdint8` to `xnn_datatype_qpint8` if we
         // know that we're converting for a GEMM and `qp8_f32_*` kernels are
         // available.
@@ -1578,8 +2342,21 @@ enum xnn_status xnn_subgraph_optimize(
     }
   #endif
 
+  if (!(optimization_flags & XNN_FLAG_NO_OPERATOR_FUSION)) {
+    share_activation_quantization(subgraph);
+  }
   xnn_subgraph_optimize_dynamic_quantization_ops(subgraph);
 
+  // Epilogues, elementwise chains, dynamic quantization and Fully Connected Nodes with shared inputs are fused last, when
+  // it is known which Nodes remain FP32 and NHWC and which datatypes dynamically quantized Values have.
+  if (!(optimization_flags & XNN_FLAG_NO_OPERATOR_FUSION)) {
+    fuse_gemm_epilogues(subgraph);
+    fuse_elementwise_chains(subgraph);
+    fuse_quantization_into_elementwise_chains(subgraph);
+    fuse_quantization_into_norms(subgraph);
+    fuse_fully_connected_outputs(subgraph);
+  }
+
   return xnn_status_success;
 }
 
@@ -1621,6 +2398,14 @@ enum xnn_node_type xnn_reduce_operator_to_node_type(enum xnn_reduce_operator typ
       return xnn_node_type_static_mean;
     case xnn_reduce_sum:
       return xnn_node_type_static_sum;
+    case xnn_reduce_max:
+      return xnn_node_type_static_max;
+    case xnn_reduce_min:
+      return xnn_node_type_static_min;
+    case xnn_reduce_prod:
+      return xnn_node_type_static_prod;
+    case xnn_reduce_argmax:
+      return xnn_node_type_static_argmax;
     default:
       return xnn_node_type_invalid;
   }
@@ -1633,6 +2418,14 @@ enum xnn_reduce_operator xnn_node_type_to_reduce_operator(enum xnn_node_type typ
       return xnn_reduce_mean;
     case xnn_node_type_static_sum:
       return xnn_reduce_sum;
+    case xnn_node_type_static_max:
+      return xnn_reduce_max;
+    case xnn_node_type_static_min:
+      return xnn_reduce_min;
+    case xnn_node_type_static_prod:
+      return xnn_reduce_prod;
+    case xnn_node_type_static_argmax:
+      return xnn_reduce_argmax;
     default:
       return xnn_reduce_invalid;
   }
@@ -254,17 +254,9 @@ static enum xnn_status setup_concatenate_operator_helper(
   void* output_data,
   const struct xnn_operator_data *opdata,
   size_t index,
+  size_t channels,
   pthreadpool_t threadpool)
 {
-  // The output pointer of this operator is the sum of all channels of the earlier operators.
-  size_t channels = 0;
-  for (size_t i = 0; i < index; i++) {
-    if (opdata->operator_objects[i]->state == xnn_run_state_skip) {
-      continue;
-    }
-    channels += opdata->operator_objects[i]->channels;
-  }
-
   switch (opdata->operator_objects[index]->type) {
     case xnn_operator_type_copy_nc_x16:
       return xnn_setup_copy_nc_x16(
@@ -316,12 +308,22 @@ static enum xnn_status setup_concatenate_n_operator(
   void* output_data = output_value->data;
   assert(output_data != NULL);
 
+  int32_t axis = opdata->axis;
+  if (axis < 0) {
+    axis += input_value[0]->shape.num_dims;
+  }
+
   enum xnn_status status;
+  // The output pointer of each operator is offset by the sum of all channels of the earlier inputs. Compute the channels
+  // from the input shapes rather than the operators, as the operators of empty inputs (or inputs that were placed
+  // directly into the output by the memory planner) skip themselves.
+  size_t channels = 0;
   for (size_t i = 0; i < num_inputs; ++i) {
-    status = setup_concatenate_operator_helper(input_data[i], output_data, opdata, i, threadpool);
+    status = setup_concatenate_operator_helper(input_data[i], output_data, opdata, i, channels, threadpool);
     if (status != xnn_status_success) {
       return status;
     }
+    channels += xnn_shape_multiply_trailing_dims(&input_value[i]->shape, axis);
   }
   return xnn_status_success;
 }
@@ -30,8 +30,9 @@ static enum xnn_status create_convolution_operator(
   struct xnn_code_cache* code_cache,
   xnn_weights_cache_t weights_cache)
 {
-  assert(node->num_inputs >= 2);
-  assert(node->num_inputs <= 3);
+  const uint32_t num_gemm_inputs = node->num_inputs - node->epilogue.num_inputs;
+  assert(num_gemm_inputs >= 2);
+  assert(num_gemm_inputs <= 3);
   const uint32_t input_id = node->inputs[0];
   assert(input_id != XNN_INVALID_VALUE_ID);
   assert(input_id < num_values);
@@ -49,7 +50,7 @@ static enum xnn_status create_convolution_operator(
 
   const void* bias_data = NULL;
   uint32_t bias_id = XNN_INVALID_VALUE_ID;
-  if (node->num_inputs > 2) {
+  if (num_gemm_inputs > 2) {
     bias_id = node->inputs[2];
     assert(bias_id != XNN_INVALID_VALUE_ID);
     assert(bias_id < num_values);
@@ -500,7 +501,10 @@ static enum xnn_status create_convolution_operator(
         XNN_UNREACHABLE;
     }
   }
-  return status;
+  if (status != xnn_status_success) {
+    return status;
+  }
+  return xnn_create_node_epilogue(&node->epilogue, opdata->operator_objects[0]);
 }
 
 static enum xnn_status reshape_convolution_operator(
@@ -667,6 +671,10 @@ static enum xnn_status reshape_convolution_operator(
   output_value->shape.dim[3] = output_pixel_stride;
 
   output_value->shape.num_dims = 4;
+  status = xnn_reshape_node_epilogue(opdata, values);
+  if (status != xnn_status_success) {
+    return status;
+  }
   const size_t new_size = xnn_tensor_get_size(output_value);
   if (new_size > output_value->size || opdata->workspace_size > old_workspace_size) {
     output_value->size = new_size;
@@ -711,12 +719,17 @@ static enum xnn_status setup_convolution_operator(
         output_data);
       break;
     case xnn_operator_type_convolution_nhwc_f32:
-      return xnn_setup_convolution2d_nhwc_f32(
+    {
+      const enum xnn_status status = xnn_setup_convolution2d_nhwc_f32(
         opdata->operator_objects[0],
         opdata->workspace,
         input_data,
         output_data);
-      break;
+      if (status != xnn_status_success) {
+        return status;
+      }
+      return xnn_setup_node_epilogue(opdata, values);
+    }
     case xnn_operator_type_convolution_nhwc_f16:
       return xnn_setup_convolution2d_nhwc_f16(
         opdata->operator_objects[0],
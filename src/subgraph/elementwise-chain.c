@@ -0,0 +1,147 @@
+// Copyright 2026 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack.h"
+#include "xnnpack/internal.h"
+#include "xnnpack/log.h"
+#include "xnnpack/node-type.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/reshape-helpers.h"
+#include "xnnpack/subgraph.h"
+#include "pthreadpool.h"
+
+static enum xnn_status create_elementwise_chain_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  struct xnn_code_cache* code_cache,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_inputs >= 1);
+  assert(node->num_inputs <= XNN_MAX_ELEMENTWISE_CHAIN_INPUTS);
+  assert(node->num_outputs == 1);
+
+  const struct xnn_value* output_value = &values[node->outputs[0]];
+  switch (output_value->datatype) {
+    case xnn_datatype_qdint8:
+      return xnn_create_elementwise_chain_nc_f32_qd8(
+        node->params.elementwise_chain.num_ops,
+        node->params.elementwise_chain.ops,
+        node->flags,
+        &opdata->operator_objects[0]);
+    case xnn_datatype_qduint8:
+      return xnn_create_elementwise_chain_nc_f32_qdu8(
+        node->params.elementwise_chain.num_ops,
+        node->params.elementwise_chain.ops,
+        node->flags,
+        &opdata->operator_objects[0]);
+    default:
+      assert(output_value->datatype == xnn_datatype_fp32);
+      return xnn_create_elementwise_chain_nc_f32(
+        node->params.elementwise_chain.num_ops,
+        node->params.elementwise_chain.ops,
+        node->flags,
+        &opdata->operator_objects[0]);
+  }
+}
+
+static enum xnn_status reshape_elementwise_chain_operator(
+  struct xnn_operator_data* opdata,
+  struct xnn_value* values,
+  size_t num_values,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id < num_values);
+  const struct xnn_value* input_value = &values[input_id];
+
+  // Single-element static inputs are broadcasted, all other inputs are read elementwise alongside the first input.
+  for (uint32_t i = 1; i < opdata->num_inputs; i++) {
+    const struct xnn_value* value = &values[opdata->inputs[i]];
+    if (xnn_value_is_static(value) && xnn_shape_multiply_all_dims(&value->shape) == 1) {
+      continue;
+    }
+    bool shapes_match = value->shape.num_dims == input_value->shape.num_dims;
+    for (size_t d = 0; shapes_match && d < value->shape.num_dims; d++) {
+      shapes_match = value->shape.dim[d] == input_value->shape.dim[d];
+    }
+    if (!shapes_match) {
+      xnn_log_error(
+        "failed to reshape %s operator: input Value #%" PRIu32 " must have the shape of input Value #%" PRIu32,
+        xnn_node_type_to_string(xnn_node_type_elementwise_chain), opdata->inputs[i], input_id);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  const size_t old_workspace_size = opdata->workspace_size;
+  enum xnn_status status;
+  if (opdata->operator_objects[0]->type == xnn_operator_type_elementwise_chain_nc_f32) {
+    const size_t batch_size = xnn_shape_multiply_non_channel_dims(&input_value->shape);
+    const size_t channel_dim = num_input_dims == 0 ? 1 : input_value->shape.dim[num_input_dims - 1];
+    status = xnn_reshape_elementwise_chain_nc_f32(
+      opdata->operator_objects[0], batch_size, channel_dim, threadpool);
+  } else {
+    // Rows are quantized the same way as by a Convert Node producing the output Value.
+    const size_t num_nonbatch_dims = values[opdata->outputs[0]].quantization.num_nonbatch_dims;
+    const size_t dq_batch_size = xnn_shape_multiply_batch_dims(&input_value->shape, num_nonbatch_dims);
+    const size_t dq_channel_stride =
+      xnn_shape_multiply_trailing_dims(&input_value->shape, num_input_dims - num_nonbatch_dims);
+    status = xnn_reshape_elementwise_chain_nc_f32_qx8(
+      opdata->operator_objects[0], dq_batch_size, dq_channel_stride,
+      &opdata->workspace_size, &opdata->workspace_alignment, threadpool);
+  }
+  if (status != xnn_status_success) {
+    return status;
+  }
+  return resize_unary_elementwise_output_tensor(opdata, values, num_values, old_workspace_size, threadpool);
+}
+
+static enum xnn_status setup_elementwise_chain_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values,
+  size_t num_values,
+  pthreadpool_t threadpool)
+{
+  const float* inputs[XNN_MAX_ELEMENTWISE_CHAIN_INPUTS];
+  for (uint32_t i = 0; i < opdata->num_inputs; i++) {
+    const uint32_t input_id = opdata->inputs[i];
+    assert(input_id != XNN_INVALID_VALUE_ID);
+    assert(input_id < num_values);
+    inputs[i] = values[input_id].data;
+    assert(inputs[i] != NULL);
+  }
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+  const struct xnn_value* output_value = &values[output_id];
+  void* output_data = output_value->data;
+  assert(output_data != NULL);
+
+  if (opdata->operator_objects[0]->type != xnn_operator_type_elementwise_chain_nc_f32) {
+    void* quantization_params = output_value->quantization.dynamic_params;
+    assert(quantization_params != NULL);
+    return xnn_setup_elementwise_chain_nc_f32_qx8(
+      opdata->operator_objects[0], opdata->workspace, inputs, output_data, quantization_params);
+  }
+  return xnn_setup_elementwise_chain_nc_f32(opdata->operator_objects[0], inputs, output_data);
+}
+
+void xnn_init_elementwise_chain_node(struct xnn_node* node)
+{
+  node->type = xnn_node_type_elementwise_chain;
+  node->create = create_elementwise_chain_operator;
+  node->reshape = reshape_elementwise_chain_operator;
+  node->setup = setup_elementwise_chain_operator;
+}
@@ -5,11 +5,14 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include "xnnpack.h"
+#include "xnnpack/allocator.h"
 #include "xnnpack/common.h"
+#include "xnnpack/config.h"
 #include "xnnpack/log.h"
 #include "xnnpack/node-type.h"
 #include "xnnpack/operator-type.h"
@@ -39,6 +42,10 @@ static enum xnn_status create_fully_connected_operator(
 
   size_t output_channels = values[node->inputs[1]].shape.dim[0];
   size_t input_channels = values[node->inputs[1]].shape.dim[1];
+  if (node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    output_channels = values[node->inputs[1]].shape.dim[1];
+    input_channels = values[node->inputs[1]].shape.dim[0];
+  }
 
   const void* kernel_data = values[filter_id].fp32_data != NULL ? values[filter_id].fp32_data : values[filter_id].data;
   assert(kernel_data != NULL);
@@ -53,8 +60,35 @@ static enum xnn_status create_fully_connected_operator(
     assert(bias_data != NULL);
   }
 
-  enum xnn_status status;
   enum xnn_datatype input_datatype = values[input_id].datatype;
+  const bool use_spgemm = input_datatype == xnn_datatype_fp32 && xnn_init_f32_spgemm_config() != NULL;
+
+  // The NCHW 1x1 convolution only takes [output_channels, input_channels] weights. The weights cache is keyed on the
+  // kernel pointer, so it is not used for the temporary copy.
+  uint32_t convolution_flags = node->flags;
+  float* untransposed_kernel = NULL;
+  if (!use_spgemm && (node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS)) {
+    assert(values[filter_id].datatype == xnn_datatype_fp32);
+    const size_t untransposed_kernel_size = output_channels * input_channels * sizeof(float);
+    untransposed_kernel = xnn_allocate_memory(untransposed_kernel_size);
+    if (untransposed_kernel == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator weights",
+        untransposed_kernel_size, xnn_node_type_to_string(xnn_node_type_fully_connected_sparse));
+      return xnn_status_out_of_memory;
+    }
+    const float* transposed_kernel = (const float*) kernel_data;
+    for (size_t oc = 0; oc < output_channels; oc++) {
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        untransposed_kernel[oc * input_channels + ic] = transposed_kernel[ic * output_channels + oc];
+      }
+    }
+    kernel_data = untransposed_kernel;
+    convolution_flags &= ~XNN_FLAG_TRANSPOSE_WEIGHTS;
+    weights_cache = NULL;
+  }
+
+  enum xnn_status status;
   switch (input_datatype) {
     case xnn_datatype_fp16:
     {
@@ -78,7 +112,7 @@ static enum xnn_status create_fully_connected_operator(
         bias_data,
         node->activation.output_min,
         node->activation.output_max,
-        node->flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
+        convolution_flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
         code_cache,
         weights_cache,
         &opdata->operator_objects[0]);
@@ -87,22 +121,41 @@ static enum xnn_status create_fully_connected_operator(
     case xnn_datatype_fp32:
     {
       assert(values[filter_id].datatype == xnn_datatype_fp32);
-      status = xnn_create_convolution2d_nchw_f32(
-        /*input_padding_top=*/0,
-        /*input_padding_right=*/0,
-        /*input_padding_bottom=*/0,
-        /*input_padding_left=*/0,
-        /*kernel_height=*/1,
-        /*kernel_width=*/1,
-        /*subsampling_height=*/1,
-        /*subsampling_width=*/1,
-        /*dilation_height=*/1,
-        /*dilation_width=*/1,
-        /*groups=*/1,
-        /*group_input_channels=*/input_channels,
-        /*group_output_channels=*/output_channels,
-        /*input_channel_stride=*/input_channels,
-        /*output_channel_stride=*/output_channels,
+      if (!use_spgemm) {
+        // No block-sparse GEMM microkernels for this hardware, use the sparse NCHW 1x1 convolution instead.
+        status = xnn_create_convolution2d_nchw_f32(
+          /*input_padding_top=*/0,
+          /*input_padding_right=*/0,
+          /*input_padding_bottom=*/0,
+          /*input_padding_left=*/0,
+          /*kernel_height=*/1,
+          /*kernel_width=*/1,
+          /*subsampling_height=*/1,
+          /*subsampling_width=*/1,
+          /*dilation_height=*/1,
+          /*dilation_width=*/1,
+          /*groups=*/1,
+          /*group_input_channels=*/input_channels,
+          /*group_output_channels=*/output_channels,
+          /*input_channel_stride=*/input_channels,
+          /*output_channel_stride=*/output_channels,
+          kernel_data,
+          bias_data,
+          node->activation.output_min,
+          node->activation.output_max,
+          convolution_flags,
+          code_cache,
+          weights_cache,
+          &opdata->operator_objects[0]);
+        break;
+      }
+      // FP32 weights use block-sparse GEMM microkernels on the NC input directly, or fall back to a dense Fully
+      // Connected operator when the weights are not sparse enough.
+      status = xnn_create_fully_connected_sparse_nc_f32(
+        input_channels,
+        output_channels,
+        /*input_stride=*/input_channels,
+        /*output_stride=*/output_channels,
         kernel_data,
         bias_data,
         node->activation.output_min,
@@ -116,6 +169,7 @@ static enum xnn_status create_fully_connected_operator(
     default:
       XNN_UNREACHABLE;
   }
+  xnn_release_memory(untransposed_kernel);
   return status;
 }
 
@@ -127,9 +181,7 @@ static enum xnn_status reshape_fully_connected_operator(
 {
   const uint32_t input_id = opdata->inputs[0];
   assert(input_id < num_values);
-  const uint32_t filter_id = opdata->inputs[0];
-  assert(filter_id < num_values);
-  const size_t input_channels = values[filter_id].shape.dim[1];
+  const size_t input_channels = opdata->operator_objects[0]->group_input_channels;
   const size_t num_input_elements = xnn_shape_multiply_all_dims(&values[input_id].shape);
   const size_t batch_size = num_input_elements / input_channels;
   const size_t old_workspace_size = opdata->workspace_size;
@@ -149,6 +201,13 @@ static enum xnn_status reshape_fully_connected_operator(
         1, 1, NULL, NULL,
         threadpool);
       break;
+    case xnn_operator_type_fully_connected_nc_f32:
+    case xnn_operator_type_fully_connected_sparse_nc_f32:
+      status = xnn_reshape_fully_connected_sparse_nc_f32(
+        opdata->operator_objects[0],
+        batch_size,
+        threadpool);
+      break;
     default:
       XNN_UNREACHABLE;
   }
@@ -191,6 +250,12 @@ static enum xnn_status setup_fully_connected_operator(
         opdata->operator_objects[0],
         input_data,
         output_data);
+    case xnn_operator_type_fully_connected_nc_f32:
+    case xnn_operator_type_fully_connected_sparse_nc_f32:
+      return xnn_setup_fully_connected_sparse_nc_f32(
+        opdata->operator_objects[0],
+        input_data,
+        output_data);
     default:
       XNN_UNREACHABLE;
   }
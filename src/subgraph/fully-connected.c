@@ -7,6 +7,7 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "xnnpack.h"
 #include "xnnpack/allocation-type.h"
@@ -53,6 +54,7 @@ enum fully_connected_op_type {
   fc_type_qdu8_f32_qc4w = 24,
   fc_type_qdu8_f32_qb4w = 26,
   fc_type_qdu8_f16_qc4w = 27,
+  fc_type_bf16_bf16_bf16 = 28,
 };
 
 enum fully_connected_op_type get_fully_connected_op_type(
@@ -73,6 +75,9 @@ enum fully_connected_op_type get_fully_connected_op_type(
   const enum xnn_datatype filter_datatype = filter_value->datatype;
   const enum xnn_datatype output_datatype = output_value->datatype;
   switch (output_datatype) {
+    case xnn_datatype_bf16:
+      assert(!has_non_static_weights);
+      return fc_type_bf16_bf16_bf16;
     case xnn_datatype_fp16:
       switch (filter_datatype) {
         case xnn_datatype_fp16:
@@ -197,8 +202,9 @@ static enum xnn_status create_fully_connected_operator(
     const struct xnn_node* node, const struct xnn_value* values,
     size_t num_values, struct xnn_operator_data* opdata,
     struct xnn_code_cache* code_cache, xnn_weights_cache_t weights_cache) {
-  assert(node->num_inputs >= 2);
-  assert(node->num_inputs <= 3);
+  const uint32_t num_gemm_inputs = node->num_inputs - node->epilogue.num_inputs;
+  assert(num_gemm_inputs >= 2);
+  assert(num_gemm_inputs <= 3);
   const uint32_t input_id = node->inputs[0];
   assert(input_id != XNN_INVALID_VALUE_ID);
   assert(input_id < num_values);
@@ -227,7 +233,7 @@ static enum xnn_status create_fully_connected_operator(
 
   const void* bias_data = NULL;
   const struct xnn_value* bias_value = NULL;
-  if (node->num_inputs > 2) {
+  if (num_gemm_inputs > 2) {
     const uint32_t bias_id = node->inputs[2];
     assert(bias_id != XNN_INVALID_VALUE_ID);
     assert(bias_id < num_values);
@@ -242,6 +248,14 @@ static enum xnn_status create_fully_connected_operator(
   enum fully_connected_op_type op_type = get_fully_connected_op_type(
       &values[input_id], &values[filter_id], bias_value, &values[output_id]);
   switch (op_type) {
+    case fc_type_bf16_bf16_bf16:
+      status = xnn_create_fully_connected_nc_bf16(
+          input_channels, output_channels,
+          /*input_stride=*/input_channels,
+          /*output_stride=*/output_channels, kernel_data, bias_data,
+          node->activation.output_min, node->activation.output_max, node->flags,
+          code_cache, weights_cache, &opdata->operator_objects[0]);
+      break;
     case fc_type_f16_f16_f16_dynamic:
       status = xnn_create_dynamic_fully_connected_nc_f16(
           node->activation.output_min, node->activation.output_max,
@@ -331,8 +345,8 @@ static enum xnn_status create_fully_connected_operator(
           /*input_stride=*/input_channels,
           /*output_stride=*/output_channels, kernel_data, bias_data,
           node->activation.output_min, node->activation.output_max,
-          /*flags=*/node->flags, code_cache, weights_cache,
-          &opdata->operator_objects[0]);
+          /*flags=*/node->flags | (opdata->flags & XNN_FLAG_AUTOTUNE_GEMM),
+          code_cache, weights_cache, &opdata->operator_objects[0]);
       break;
     case fc_type_pf32_f32_f32:
       status = xnn_create_fully_connected_nc_pf32(
@@ -531,7 +545,10 @@ static enum xnn_status create_fully_connected_operator(
     default:
       XNN_UNREACHABLE;
   }
-  return status;
+  if (status != xnn_status_success) {
+    return status;
+  }
+  return xnn_create_node_epilogue(&node->epilogue, opdata->operator_objects[0]);
 }
 
 enum xnn_status resize_fully_connected_output_tensor(
@@ -616,6 +633,10 @@ static enum xnn_status reshape_fully_connected_operator(
           output_channels, input_channels, output_channels,
           &opdata->workspace_size, &opdata->workspace_alignment, threadpool);
       break;
+    case xnn_operator_type_fully_connected_nc_bf16:
+      status = xnn_reshape_fully_connected_nc_bf16(opdata->operator_objects[0],
+                                                   batch_size, threadpool);
+      break;
     case xnn_operator_type_fully_connected_nc_f16:
       status = xnn_reshape_fully_connected_nc_f16(opdata->operator_objects[0],
                                                   batch_size, threadpool);
@@ -705,8 +726,13 @@ static enum xnn_status reshape_fully_connected_operator(
   if (status != xnn_status_success) {
     return status;
   }
-  return resize_fully_connected_output_tensor(opdata, values, num_values,
-                                              old_workspace_size, threadpool);
+  status = resize_fully_connected_output_tensor(opdata, values, num_values,
+                                                old_workspace_size, threadpool);
+  if (status != xnn_status_success && status != xnn_status_reallocation_required) {
+    return status;
+  }
+  const enum xnn_status epilogue_status = xnn_reshape_node_epilogue(opdata, values);
+  return epilogue_status != xnn_status_success ? epilogue_status : status;
 }
 
 static enum xnn_status setup_fully_connected_operator(
@@ -739,7 +765,7 @@ static enum xnn_status setup_fully_connected_operator(
           : kernel_value->data;
 
   const void* bias_data = NULL;
-  if (opdata->num_inputs > 2) {
+  if (opdata->num_inputs - opdata->epilogue.num_inputs > 2) {
     assert(bias_id != XNN_INVALID_VALUE_ID);
     assert(bias_id < num_values);
     const struct xnn_value* bias_value = values + bias_id;
@@ -766,16 +792,27 @@ static enum xnn_status setup_fully_connected_operator(
       return xnn_setup_dynamic_fully_connected_nc_f32(
           opdata->operator_objects[0], opdata->workspace, input_data,
           kernel_data, bias_data, output_data);
+    case xnn_operator_type_fully_connected_nc_bf16:
+      assert(kernel_data == NULL);
+      assert(bias_data == NULL);
+      return xnn_setup_fully_connected_nc_bf16(opdata->operator_objects[0],
+                                               input_data, output_data);
     case xnn_operator_type_fully_connected_nc_f16:
       assert(kernel_data == NULL);
       assert(bias_data == NULL);
       return xnn_setup_fully_connected_nc_f16(opdata->operator_objects[0],
                                               input_data, output_data);
     case xnn_operator_type_fully_connected_nc_f32:
+    {
       assert(kernel_data == NULL);
       assert(bias_data == NULL);
-      return xnn_setup_fully_connected_nc_f32(opdata->operator_objects[0],
-                                              input_data, output_data);
+      const enum xnn_status status = xnn_setup_fully_connected_nc_f32(
+          opdata->operator_objects[0], input_data, output_data);
+      if (status != xnn_status_success) {
+        return status;
+      }
+      return xnn_setup_node_epilogue(opdata, values);
+    }
     case xnn_operator_type_fully_connected_nc_f32_qc4w:
       assert(kernel_data == NULL);
       assert(bias_data == NULL);
@@ -935,6 +972,13 @@ static inline bool validate_datatypes_with_bias(
     enum xnn_datatype input_datatype, enum xnn_datatype kernel_datatype,
     enum xnn_datatype bias_datatype, enum xnn_datatype output_datatype) {
   switch (kernel_datatype) {
+    case xnn_datatype_bf16:
+      if (input_datatype == xnn_datatype_bf16 &&
+          bias_datatype == xnn_datatype_bf16 &&
+          output_datatype == xnn_datatype_bf16) {
+        return true;
+      }
+      break;
     case xnn_datatype_fp32:
       if (input_datatype == xnn_datatype_fp32 &&
           bias_datatype == xnn_datatype_fp32 &&
@@ -1045,6 +1089,12 @@ static inline bool validate_datatypes_without_bias(
     enum xnn_datatype input_datatype, enum xnn_datatype kernel_datatype,
     enum xnn_datatype output_datatype) {
   switch (kernel_datatype) {
+    case xnn_datatype_bf16:
+      if (input_datatype == xnn_datatype_bf16 &&
+          output_datatype == xnn_datatype_bf16) {
+        return true;
+      }
+      break;
     case xnn_datatype_fp32:
       if (input_datatype == xnn_datatype_fp32 &&
           output_datatype == xnn_datatype_fp32) {
@@ -1157,6 +1207,7 @@ enum xnn_status xnn_define_fully_connected(xnn_subgraph_t subgraph,
   }
 
   switch (input_value->datatype) {
+    case xnn_datatype_bf16:
     case xnn_datatype_fp16:
     case xnn_datatype_fp32:
     case xnn_datatype_qint8:
@@ -1218,6 +1269,7 @@ enum xnn_status xnn_define_fully_connected(xnn_subgraph_t subgraph,
 
   // Non-static kernel is supported, but only for some data types
   switch (kernel_value->datatype) {
+    case xnn_datatype_bf16:
     case xnn_datatype_fp16:
     case xnn_datatype_fp32:
       break;
@@ -1347,6 +1399,7 @@ enum xnn_status xnn_define_fully_connected(xnn_subgraph_t subgraph,
     }
 
     switch (bias_value->datatype) {
+      case xnn_datatype_bf16:
       case xnn_datatype_fp16:
       case xnn_datatype_fp32:
       case xnn_datatype_qint32:
@@ -1376,6 +1429,7 @@ enum xnn_status xnn_define_fully_connected(xnn_subgraph_t subgraph,
   }
 
   switch (output_value->datatype) {
+    case xnn_datatype_bf16:
     case xnn_datatype_fp16:
     case xnn_datatype_fp32:
     case xnn_datatype_qint8:
@@ -1457,3 +1511,102 @@ enum xnn_status xnn_define_fully_connected(xnn_subgraph_t subgraph,
 
   return xnn_status_success;
 }
+
+// Gets the inputs of the Fully Connected Node computing the index-th output of a Multi-Output Fully Connected Node, and
+// returns their number.
+static uint32_t get_fully_connected_part_inputs(
+    uint32_t num_inputs, const uint32_t* inputs, uint32_t num_outputs,
+    size_t index, uint32_t part_inputs[XNN_MAX_INPUTS]) {
+  const uint32_t num_weights = (num_inputs - 1) / num_outputs;
+  part_inputs[0] = inputs[0];
+  part_inputs[2] = XNN_INVALID_VALUE_ID;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    part_inputs[1 + i] = inputs[1 + index * num_weights + i];
+  }
+  return 1 + num_weights;
+}
+
+static void get_fully_connected_part_opdata(
+    const struct xnn_operator_data* opdata, size_t index,
+    struct xnn_operator_data* part) {
+  *part = *opdata;
+  memset(part->operator_objects, 0, sizeof(part->operator_objects));
+  part->operator_objects[0] = opdata->operator_objects[index];
+  part->type = xnn_node_type_fully_connected;
+  part->num_inputs = get_fully_connected_part_inputs(
+      opdata->num_inputs, opdata->inputs, opdata->num_outputs, index,
+      part->inputs);
+  part->num_outputs = 1;
+  part->outputs[0] = opdata->outputs[index];
+}
+
+static enum xnn_status create_fully_connected_multi_output_operator(
+    const struct xnn_node* node, const struct xnn_value* values,
+    size_t num_values, struct xnn_operator_data* opdata,
+    struct xnn_code_cache* code_cache, xnn_weights_cache_t weights_cache) {
+  assert(node->num_outputs >= 2);
+  assert(node->num_outputs <= XNN_MAX_GEMM_MULTI_OUTPUTS);
+  assert(!node->epilogue.enabled);
+
+  for (uint32_t i = 0; i < node->num_outputs; i++) {
+    struct xnn_node part = *node;
+    part.type = xnn_node_type_fully_connected;
+    part.num_inputs = get_fully_connected_part_inputs(
+        node->num_inputs, node->inputs, node->num_outputs, i, part.inputs);
+    part.num_outputs = 1;
+    part.outputs[0] = node->outputs[i];
+
+    struct xnn_operator_data part_opdata;
+    memset(&part_opdata, 0, sizeof(part_opdata));
+    const enum xnn_status status = create_fully_connected_operator(
+        &part, values, num_values, &part_opdata, code_cache, weights_cache);
+    opdata->operator_objects[i] = part_opdata.operator_objects[0];
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status reshape_fully_connected_multi_output_operator(
+    struct xnn_operator_data* opdata, struct xnn_value* values,
+    size_t num_values, pthreadpool_t threadpool) {
+  enum xnn_status status = xnn_status_success;
+  for (uint32_t i = 0; i < opdata->num_outputs; i++) {
+    struct xnn_operator_data part;
+    get_fully_connected_part_opdata(opdata, i, &part);
+    const enum xnn_status part_status = reshape_fully_connected_operator(
+        &part, values, num_values, threadpool);
+    if (part_status == xnn_status_reallocation_required) {
+      status = xnn_status_reallocation_required;
+    } else if (part_status != xnn_status_success) {
+      return part_status;
+    }
+  }
+
+  const enum xnn_status fuse_status = xnn_fuse_fully_connected_nc_outputs(
+      opdata->operator_objects, opdata->num_outputs, threadpool);
+  return fuse_status != xnn_status_success ? fuse_status : status;
+}
+
+static enum xnn_status setup_fully_connected_multi_output_operator(
+    const struct xnn_operator_data* opdata, const struct xnn_value* values,
+    size_t num_values, pthreadpool_t threadpool) {
+  for (uint32_t i = 0; i < opdata->num_outputs; i++) {
+    struct xnn_operator_data part;
+    get_fully_connected_part_opdata(opdata, i, &part);
+    const enum xnn_status status = setup_fully_connected_operator(
+        &part, values, num_values, threadpool);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  return xnn_status_success;
+}
+
+void xnn_init_fully_connected_multi_output_node(struct xnn_node* node) {
+  node->type = xnn_node_type_fully_connected_multi_output;
+  node->create = create_fully_connected_multi_output_operator;
+  node->reshape = reshape_fully_connected_multi_output_operator;
+  node->setup = setup_fully_connected_multi_output_operator;
+}
@@ -0,0 +1,268 @@
+// Copyright 2024 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack.h"
+#include "xnnpack/common.h"
+#include "xnnpack/datatype.h"
+#include "xnnpack/log.h"
+#include "xnnpack/node-type.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/subgraph-validation.h"
+#include "xnnpack/subgraph.h"
+#include "pthreadpool.h"
+
+static enum xnn_status create_kv_cache_append_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  struct xnn_code_cache* code_cache,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_inputs == 1);
+  assert(node->num_outputs == 1);
+
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id < num_values);
+  const struct xnn_value* input_value = &values[input_id];
+  switch (xnn_datatype_size_bits(input_value->datatype)) {
+    case 8:
+      return xnn_create_copy_nc_x8(node->flags, &opdata->operator_objects[0]);
+    case 16:
+      return xnn_create_copy_nc_x16(node->flags, &opdata->operator_objects[0]);
+    case 32:
+      return xnn_create_copy_nc_x32(node->flags, &opdata->operator_objects[0]);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status reshape_kv_cache_append_operator(
+  struct xnn_operator_data* opdata,
+  struct xnn_value* values,
+  size_t num_values,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id < num_values);
+  const struct xnn_value* input = &values[input_id];
+
+  const uint32_t cache_id = opdata->outputs[0];
+  assert(cache_id < num_values);
+  struct xnn_value* cache = &values[cache_id];
+
+  const size_t num_dims = cache->shape.num_dims;
+  if (input->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 " and cache ID #%" PRIu32
+      ": number of input dimensions (%zu) must match number of cache dimensions (%zu)",
+      xnn_node_type_to_string(xnn_node_type_kv_cache_append), input_id, cache_id, input->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+  for (size_t i = 0; i < num_dims; i++) {
+    if (i != num_dims - 2 && input->shape.dim[i] != cache->shape.dim[i]) {
+      xnn_log_error(
+        "failed to reshape %s operator with input ID #%" PRIu32 " and cache ID #%" PRIu32
+        ": input dimension #%zu (%zu) must match cache dimension #%zu (%zu)",
+        xnn_node_type_to_string(xnn_node_type_kv_cache_append), input_id, cache_id,
+        i, input->shape.dim[i], i, cache->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  const size_t batch_size = xnn_shape_multiply_batch_dims(&cache->shape, 2);
+  const size_t new_tokens = input->shape.dim[num_dims - 2];
+  const size_t max_tokens = cache->shape.dim[num_dims - 2];
+  const size_t channels = cache->shape.dim[num_dims - 1];
+  const size_t position = cache->kv_cache_position;
+  if (new_tokens > max_tokens - position) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 " and cache ID #%" PRIu32
+      ": appending %zu tokens at position %zu exceeds cache capacity of %zu tokens",
+      xnn_node_type_to_string(xnn_node_type_kv_cache_append), input_id, cache_id,
+      new_tokens, position, max_tokens);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Every batch & head is a row of the copy: the input rows are dense, the cache rows are max_tokens long.
+  enum xnn_status status = xnn_status_invalid_state;
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_copy_nc_x8:
+      status = xnn_reshape_copy_nc_x8(
+        opdata->operator_objects[0], batch_size, new_tokens * channels,
+        /*input_stride=*/new_tokens * channels, /*output_stride=*/max_tokens * channels, threadpool);
+      break;
+    case xnn_operator_type_copy_nc_x16:
+      status = xnn_reshape_copy_nc_x16(
+        opdata->operator_objects[0], batch_size, new_tokens * channels,
+        /*input_stride=*/new_tokens * channels, /*output_stride=*/max_tokens * channels, threadpool);
+      break;
+    case xnn_operator_type_copy_nc_x32:
+      status = xnn_reshape_copy_nc_x32(
+        opdata->operator_objects[0], batch_size, new_tokens * channels,
+        /*input_stride=*/new_tokens * channels, /*output_stride=*/max_tokens * channels, threadpool);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  cache->kv_cache_tokens = position + new_tokens;
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_kv_cache_append_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values,
+  size_t num_values,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t cache_id = opdata->outputs[0];
+  assert(cache_id != XNN_INVALID_VALUE_ID);
+  assert(cache_id < num_values);
+
+  const struct xnn_value* input_value = values + input_id;
+  const void* input_data = input_value->data;
+  assert(input_data != NULL);
+
+  const struct xnn_value* cache_value = values + cache_id;
+  assert(cache_value->data != NULL);
+
+  const size_t num_dims = cache_value->shape.num_dims;
+  const size_t new_tokens = input_value->shape.dim[num_dims - 2];
+  const size_t channels = cache_value->shape.dim[num_dims - 1];
+  assert(cache_value->kv_cache_tokens >= new_tokens);
+  void* output_data = (void*) ((uintptr_t) cache_value->data +
+    (cache_value->kv_cache_tokens - new_tokens) * channels * xnn_datatype_size_bytes(cache_value->datatype));
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_copy_nc_x8:
+      return xnn_setup_copy_nc_x8(opdata->operator_objects[0], input_data, output_data);
+    case xnn_operator_type_copy_nc_x16:
+      return xnn_setup_copy_nc_x16(opdata->operator_objects[0], input_data, output_data);
+    case xnn_operator_type_copy_nc_x32:
+      return xnn_setup_copy_nc_x32(opdata->operator_objects[0], input_data, output_data);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_define_kv_cache_append(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t cache_id,
+  uint32_t flags)
+{
+  const enum xnn_node_type node_type = xnn_node_type_kv_cache_append;
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(node_type)) != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_subgraph_check_input_node_id(node_type, input_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(node_type, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (!xnn_datatype_is_byte_addressable(input_value->datatype)) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(node_type), input_id,
+      xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_output_node_id(node_type, cache_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* cache_value = &subgraph->values[cache_id];
+  status = xnn_subgraph_check_output_type_dense(node_type, cache_id, cache_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (!xnn_value_is_persistent(cache_value)) {
+    xnn_log_error(
+      "failed to define %s operator with cache ID #%" PRIu32 ": cache Value must be persistent",
+      xnn_node_type_to_string(node_type), cache_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_datatype_matches(node_type, input_id, input_value, cache_id, cache_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const size_t num_dims = cache_value->shape.num_dims;
+  if (num_dims < 2) {
+    xnn_log_error(
+      "failed to define %s operator with cache ID #%" PRIu32 ": cache must have at least 2 dimensions, found %zu",
+      xnn_node_type_to_string(node_type), cache_id, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+  if (input_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and cache ID #%" PRIu32
+      ": number of input dimensions (%zu) must match number of cache dimensions (%zu)",
+      xnn_node_type_to_string(node_type), input_id, cache_id, input_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+  for (size_t i = 0; i < num_dims; i++) {
+    if (i != num_dims - 2 && input_value->shape.dim[i] != cache_value->shape.dim[i]) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and cache ID #%" PRIu32
+        ": input dimension #%zu (%zu) must match cache dimension #%zu (%zu)",
+        xnn_node_type_to_string(node_type), input_id, cache_id,
+        i, input_value->shape.dim[i], i, cache_value->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+  if (input_value->shape.dim[num_dims - 2] > cache_value->shape.dim[num_dims - 2]) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and cache ID #%" PRIu32
+      ": input tokens (%zu) must not exceed cache capacity (%zu)",
+      xnn_node_type_to_string(node_type), input_id, cache_id,
+      input_value->shape.dim[num_dims - 2], cache_value->shape.dim[num_dims - 2]);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = node_type;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = cache_id;
+  node->flags = flags;
+
+  node->create = create_kv_cache_append_operator;
+  node->reshape = reshape_kv_cache_append_operator;
+  node->setup = setup_kv_cache_append_operator;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,373 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack.h"
+#include "xnnpack/common.h"
+#include "xnnpack/log.h"
+#include "xnnpack/node-type.h"
+#include "xnnpack/operator-type.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/reshape-helpers.h"
+#include "xnnpack/subgraph-validation.h"
+#include "xnnpack/subgraph.h"
+#include "pthreadpool.h"
+
+static enum xnn_status create_norm_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  struct xnn_code_cache* code_cache,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_outputs == 1);
+
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const enum xnn_datatype input_datatype = values[input_id].datatype;
+  const enum xnn_datatype output_datatype = values[output_id].datatype;
+  switch (node->type) {
+    case xnn_node_type_layer_norm:
+      assert(node->num_inputs == 3);
+      return xnn_create_layer_norm_nc(
+        input_datatype, output_datatype, node->params.norm.epsilon, node->flags, &opdata->operator_objects[0]);
+    case xnn_node_type_rms_norm:
+      assert(node->num_inputs == 2);
+      return xnn_create_rms_norm_nc(
+        input_datatype, output_datatype, node->params.norm.epsilon, node->flags, &opdata->operator_objects[0]);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status reshape_norm_operator(
+  struct xnn_operator_data* opdata,
+  struct xnn_value* values,
+  size_t num_values,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id < num_values);
+  const struct xnn_value* input_value = &values[input_id];
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  assert(num_input_dims > 0);
+  const size_t channel_dim = input_value->shape.dim[num_input_dims - 1];
+  const size_t batch_size = xnn_shape_multiply_non_channel_dims(&input_value->shape);
+
+  // Scale and bias are applied along the normalized (innermost) dimension.
+  for (uint32_t i = 1; i < opdata->num_inputs; i++) {
+    const struct xnn_value* value = &values[opdata->inputs[i]];
+    if (xnn_shape_multiply_all_dims(&value->shape) != channel_dim) {
+      xnn_log_error(
+        "failed to reshape %s operator: input Value #%" PRIu32 " must have %zu elements, "
+        "the size of the innermost dimension of input Value #%" PRIu32,
+        xnn_operator_type_to_string(opdata->operator_objects[0]->type), opdata->inputs[i], channel_dim, input_id);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  const size_t old_workspace_size = opdata->workspace_size;
+  enum xnn_status status = xnn_status_invalid_state;
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_layer_norm_nc:
+      status = xnn_reshape_layer_norm_nc(
+        opdata->operator_objects[0],
+        /*channels=*/channel_dim,
+        /*input_stride=*/channel_dim,
+        /*output_stride=*/channel_dim,
+        batch_size,
+        &opdata->workspace_size,
+        &opdata->workspace_alignment,
+        threadpool);
+      break;
+    case xnn_operator_type_rms_norm_nc:
+      status = xnn_reshape_rms_norm_nc(
+        opdata->operator_objects[0],
+        /*channels=*/channel_dim,
+        /*input_stride=*/channel_dim,
+        /*output_stride=*/channel_dim,
+        batch_size,
+        &opdata->workspace_size,
+        &opdata->workspace_alignment,
+        threadpool);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status != xnn_status_success) {
+    return status;
+  }
+  return resize_unary_elementwise_output_tensor(opdata, values, num_values, old_workspace_size, threadpool);
+}
+
+static enum xnn_status setup_norm_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values,
+  size_t num_values,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t scale_id = opdata->inputs[1];
+  assert(scale_id != XNN_INVALID_VALUE_ID);
+  assert(scale_id < num_values);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_value* input_value = values + input_id;
+  const void* input_data = input_value->data;
+  assert(input_data != NULL);
+
+  const struct xnn_value* scale_value = values + scale_id;
+  const void* scale_data = scale_value->data;
+  assert(scale_data != NULL);
+
+  const struct xnn_value* output_value = values + output_id;
+  void* output_data = output_value->data;
+  assert(output_data != NULL);
+
+  // Only set for dynamically quantized outputs, one set of parameters per row.
+  struct xnn_quantization_params* quantization_params = NULL;
+  if (output_value->datatype == xnn_datatype_qdint8 || output_value->datatype == xnn_datatype_qduint8) {
+    quantization_params = output_value->quantization.dynamic_params;
+    assert(quantization_params != NULL);
+  }
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_layer_norm_nc:
+    {
+      const uint32_t bias_id = opdata->inputs[2];
+      assert(bias_id != XNN_INVALID_VALUE_ID);
+      assert(bias_id < num_values);
+      const void* bias_data = values[bias_id].data;
+      assert(bias_data != NULL);
+      return xnn_setup_layer_norm_nc(
+        opdata->operator_objects[0],
+        opdata->workspace,
+        input_data,
+        scale_data,
+        bias_data,
+        output_data,
+        quantization_params);
+    }
+    case xnn_operator_type_rms_norm_nc:
+      return xnn_setup_rms_norm_nc(
+        opdata->operator_objects[0],
+        opdata->workspace,
+        input_data,
+        scale_data,
+        output_data,
+        quantization_params);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+// Checks that a scale or bias Value is a 1D tensor with the datatype of the input.
+static enum xnn_status check_norm_parameter(
+  enum xnn_node_type node_type,
+  const char* name,
+  uint32_t input_id,
+  const struct xnn_value* input_value,
+  uint32_t parameter_id,
+  const struct xnn_value* parameter_value,
+  size_t nth)
+{
+  enum xnn_status status = xnn_subgraph_check_nth_input_type_dense(node_type, parameter_id, parameter_value, nth);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (parameter_value->shape.num_dims != 1) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": %s must be 1D tensor, got %zuD",
+      xnn_node_type_to_string(node_type), name, parameter_id, name, parameter_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (parameter_value->datatype != input_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and %s ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and %s (%s)",
+      xnn_node_type_to_string(node_type), input_id, name, parameter_id,
+      xnn_datatype_to_string(input_value->datatype), name, xnn_datatype_to_string(parameter_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+static enum xnn_status define_norm(
+  xnn_subgraph_t subgraph,
+  enum xnn_node_type node_type,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t scale_id,
+  uint32_t bias_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(node_type)) != xnn_status_success) {
+    return status;
+  }
+
+  if (!isfinite(epsilon) || epsilon < 0.0f) {
+    xnn_log_error(
+      "failed to define %s operator with %.7g epsilon: epsilon must be finite and non-negative",
+      xnn_node_type_to_string(node_type), epsilon);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((status = xnn_subgraph_check_input_node_id(node_type, input_id, subgraph->num_values)) !=
+      xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(node_type, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp16:
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_nth_input_node_id(node_type, scale_id, subgraph->num_values, 2);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = check_norm_parameter(
+    node_type, "scale", input_id, input_value, scale_id, &subgraph->values[scale_id], 2);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (node_type == xnn_node_type_layer_norm) {
+    status = xnn_subgraph_check_nth_input_node_id(node_type, bias_id, subgraph->num_values, 3);
+    if (status != xnn_status_success) {
+      return status;
+    }
+
+    status = check_norm_parameter(
+      node_type, "bias", input_id, input_value, bias_id, &subgraph->values[bias_id], 3);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
+  status = xnn_subgraph_check_output_node_id(node_type, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(node_type, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp16:
+    case xnn_datatype_fp32:
+      status = xnn_subgraph_check_datatype_matches(node_type, input_id, input_value, output_id, output_value);
+      if (status != xnn_status_success) {
+        return status;
+      }
+      break;
+    case xnn_datatype_qdint8:
+    case xnn_datatype_qduint8:
+      // The operator computes one set of quantization parameters per normalized row.
+      if (output_value->quantization.num_nonbatch_dims != 1) {
+        xnn_log_error(
+          "failed to define %s operator with output ID #%" PRIu32 ": "
+          "dynamically quantized output must have exactly 1 non-batch dimension, got %zu",
+          xnn_node_type_to_string(node_type), output_id, output_value->quantization.num_nonbatch_dims);
+        return xnn_status_invalid_parameter;
+      }
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = node_type;
+  node->params.norm.epsilon = epsilon;
+  node->inputs[0] = input_id;
+  node->inputs[1] = scale_id;
+  if (node_type == xnn_node_type_layer_norm) {
+    node->num_inputs = 3;
+    node->inputs[2] = bias_id;
+  } else {
+    node->num_inputs = 2;
+  }
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_norm_operator;
+  node->reshape = reshape_norm_operator;
+  node->setup = setup_norm_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_layer_norm(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t scale_id,
+  uint32_t bias_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_norm(subgraph, xnn_node_type_layer_norm, epsilon, input_id, scale_id, bias_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_rms_norm(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t scale_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_norm(
+    subgraph, xnn_node_type_rms_norm, epsilon, input_id, scale_id, XNN_INVALID_VALUE_ID, output_id, flags);
+}
@@ -6,11 +6,13 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "xnnpack.h"
 #include "xnnpack/common.h"
+#include "xnnpack/internal.h"
 #include "xnnpack/log.h"
 #include "xnnpack/node-type.h"
 #include "xnnpack/operator-type.h"
@@ -27,7 +29,7 @@ static enum xnn_status create_scaled_dot_product_attention_operator(
   struct xnn_code_cache* code_cache,
   xnn_weights_cache_t weights_cache)
 {
-  assert(node->num_inputs == 5);
+  assert(node->num_inputs == 4 || node->num_inputs == 5);
   assert(node->num_outputs == 1);
 
   enum xnn_status status;
@@ -40,7 +42,7 @@ static enum xnn_status create_scaled_dot_product_attention_operator(
       status = xnn_create_scaled_dot_product_attention_nhtc_f32(
         node->params.scaled_dot_product_attention.cap_type,
         &node->params.scaled_dot_product_attention.cap_tanh_params,
-        /*flags=*/0,
+        node->flags,
         &opdata->operator_objects[0]);
       break;
     }
@@ -49,7 +51,7 @@ static enum xnn_status create_scaled_dot_product_attention_operator(
       status = xnn_create_scaled_dot_product_attention_nhtc_f16(
         node->params.scaled_dot_product_attention.cap_type,
         &node->params.scaled_dot_product_attention.cap_tanh_params,
-        /*flags=*/0,
+        node->flags,
         &opdata->operator_objects[0]);
       break;
     }
@@ -144,11 +146,6 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
   assert(scale_id < num_values);
   const struct xnn_value* scale = values + scale_id;
 
-  const uint32_t mask_id = opdata->inputs[4];
-  assert(mask_id != XNN_INVALID_VALUE_ID);
-  assert(mask_id < num_values);
-  const struct xnn_value* mask = values + mask_id;
-
   enum xnn_status status = xnn_status_success;
 
   const size_t query_num_dims = query->shape.num_dims;
@@ -181,7 +178,9 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
 
   const size_t num_batch_dims = query_num_dims - 3;
   const bool is_multi_query = key_num_dims == query_num_dims - 1;
-  const size_t key_tokens = key->shape.dim[key_num_dims - 2];
+  // A KV cache written by a KV Cache Append Node only has kv_cache_tokens valid tokens out of its allocated tokens.
+  const size_t key_tokens_stride = key->shape.dim[key_num_dims - 2];
+  const size_t key_tokens = key->kv_cache_tokens != 0 ? key->kv_cache_tokens : key_tokens_stride;
   const size_t key_channels = key->shape.dim[key_num_dims - 1];
 
   status = xnn_subgraph_check_batch_dims_match(opdata->type, query_id, query, key_id, key, num_batch_dims);
@@ -191,10 +190,10 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
 
   if (!is_multi_query) {
     const size_t key_heads = key->shape.dim[key_num_dims - 3];
-    if (key_heads != query_heads) {
+    if (key_heads == 0 || query_heads % key_heads != 0) {
       xnn_log_error(
-        "failed to reshape %s operator with key ID #%" PRIu32 ": key heads (%zu) must be equals to query heads (%zu)",
-        xnn_node_type_to_string(opdata->type), key_id, key_heads, query_heads);
+        "failed to reshape %s operator with key ID #%" PRIu32 ": query heads (%zu) must be divisible by key heads (%zu)",
+        xnn_node_type_to_string(opdata->type), key_id, query_heads, key_heads);
       return xnn_status_invalid_parameter;
     }
   }
@@ -207,7 +206,8 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
   }
 
   const size_t value_num_dims = value->shape.num_dims;
-  const size_t value_tokens = value->shape.dim[value_num_dims - 2];
+  const size_t value_tokens_stride = value->shape.dim[value_num_dims - 2];
+  const size_t value_tokens = value->kv_cache_tokens != 0 ? value->kv_cache_tokens : value_tokens_stride;
   const size_t value_channels = value->shape.dim[value_num_dims - 1];
 
   status = xnn_subgraph_check_batch_dims_match(opdata->type, query_id, query, value_id, value, num_batch_dims);
@@ -218,13 +218,6 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
 
   if (!is_multi_query) {
     const size_t value_heads = value->shape.dim[value_num_dims - 3];
-    if (value_heads != query_heads) {
-      xnn_log_error(
-        "failed to reshape %s operator with value ID #%" PRIu32 ": value heads (%zu) must be equals to query (%zu)",
-        xnn_node_type_to_string(opdata->type), value_id, value_heads, query_heads);
-      return xnn_status_invalid_parameter;
-    }
-
     const size_t key_heads = key->shape.dim[key_num_dims - 3];
     if (key_heads != value_heads) {
       xnn_log_error(
@@ -241,25 +234,41 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
     return xnn_status_invalid_parameter;
   }
 
-  if (scale->shape.dim[0] != query_channels) {
+  if (key_tokens_stride != value_tokens_stride) {
     xnn_log_error(
-      "failed to reshape %s operator with scale ID #%" PRIu32 ": scale channels (%zu) must be equal to query channels "
-      "(%zu)", xnn_node_type_to_string(opdata->type), scale_id, scale->shape.dim[0], query_channels);
+      "failed to reshape %s operator with key ID #%" PRIu32" and value ID #%" PRIu32 ": key allocated tokens (%zu) must "
+      "be equal to value allocated tokens (%zu)", xnn_node_type_to_string(opdata->type), key_id, value_id,
+      key_tokens_stride, value_tokens_stride);
     return xnn_status_invalid_parameter;
   }
 
-  if (mask->shape.dim[0] != query_tokens) {
+  if (scale->shape.dim[0] != query_channels) {
     xnn_log_error(
-      "failed to reshape %s operator with mask ID #%" PRIu32 ": mask query tokens (%zu) must be equal to query tokens "
-      "(%zu)", xnn_node_type_to_string(opdata->type), mask_id, mask->shape.dim[0], query_tokens);
+      "failed to reshape %s operator with scale ID #%" PRIu32 ": scale channels (%zu) must be equal to query channels "
+      "(%zu)", xnn_node_type_to_string(opdata->type), scale_id, scale->shape.dim[0], query_channels);
     return xnn_status_invalid_parameter;
   }
 
-  if (mask->shape.dim[1] != key_tokens) {
-    xnn_log_error(
-      "failed to reshape %s operator with mask ID #%" PRIu32 ": mask key/value tokens (%zu) must be equal to key/value "
-      "tokens (%zu)", xnn_node_type_to_string(opdata->type), mask_id, mask->shape.dim[1], key_tokens);
-    return xnn_status_invalid_parameter;
+  // Mask is optional with the causal mask flag.
+  if (opdata->num_inputs > 4) {
+    const uint32_t mask_id = opdata->inputs[4];
+    assert(mask_id != XNN_INVALID_VALUE_ID);
+    assert(mask_id < num_values);
+    const struct xnn_value* mask = values + mask_id;
+
+    if (mask->shape.dim[0] != query_tokens) {
+      xnn_log_error(
+        "failed to reshape %s operator with mask ID #%" PRIu32 ": mask query tokens (%zu) must be equal to query tokens "
+        "(%zu)", xnn_node_type_to_string(opdata->type), mask_id, mask->shape.dim[0], query_tokens);
+      return xnn_status_invalid_parameter;
+    }
+
+    if (mask->shape.dim[1] != key_tokens) {
+      xnn_log_error(
+        "failed to reshape %s operator with mask ID #%" PRIu32 ": mask key/value tokens (%zu) must be equal to key/value "
+        "tokens (%zu)", xnn_node_type_to_string(opdata->type), mask_id, mask->shape.dim[1], key_tokens);
+      return xnn_status_invalid_parameter;
+    }
   }
 
   const uint32_t output_id = opdata->outputs[0];
@@ -305,13 +314,14 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
 
   switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_scaled_dot_product_attention_nhtc_f32:
-      status = xnn_reshape_scaled_dot_product_attention_nhtc_f32(
+      status = xnn_reshape_scaled_dot_product_attention_nhtc_f32_with_kv_stride(
         opdata->operator_objects[0],
         batch_size,
         query_heads,
         query_tokens,
         key_heads,
         key_tokens,
+        key_tokens_stride,
         query_channels,
         value_channels,
         &opdata->workspace_size,
@@ -319,13 +329,14 @@ static enum xnn_status reshape_scaled_dot_product_attention_operator(
         threadpool);
       break;
     case xnn_operator_type_scaled_dot_product_attention_nhtc_f16:
-      status = xnn_reshape_scaled_dot_product_attention_nhtc_f16(
+      status = xnn_reshape_scaled_dot_product_attention_nhtc_f16_with_kv_stride(
         opdata->operator_objects[0],
         batch_size,
         query_heads,
         query_tokens,
         key_heads,
         key_tokens,
+        key_tokens_stride,
         query_channels,
         value_channels,
         &opdata->workspace_size,
@@ -378,12 +389,16 @@ static enum xnn_status setup_scaled_dot_product_attention_operator(
   const void* scale_data = scale->data;
   assert(scale_data != NULL);
 
-  const uint32_t mask_id = opdata->inputs[4];
-  assert(mask_id != XNN_INVALID_VALUE_ID);
-  assert(mask_id < num_values);
-  const struct xnn_value* mask = values + mask_id;
-  const void* mask_data = mask->data;
-  assert(mask_data != NULL);
+  // Mask is optional with the causal mask flag.
+  const void* mask_data = NULL;
+  if (opdata->num_inputs > 4) {
+    const uint32_t mask_id = opdata->inputs[4];
+    assert(mask_id != XNN_INVALID_VALUE_ID);
+    assert(mask_id < num_values);
+    const struct xnn_value* mask = values + mask_id;
+    mask_data = mask->data;
+    assert(mask_data != NULL);
+  }
 
   const uint32_t output_id = opdata->outputs[0];
   assert(output_id != XNN_INVALID_VALUE_ID);
@@ -532,11 +547,12 @@ enum xnn_status xnn_define_scaled_dot_product_attention(
 
   if (!is_multi_query) {
     const size_t key_heads_dim = key_num_dims - 3;
-    // Key heads must match query.
-    if (key->shape.dim[key_heads_dim] != heads) {
+    // Query heads must be divisible by key heads, each key head is shared by a group of query heads.
+    const size_t key_heads = key->shape.dim[key_heads_dim];
+    if (key_heads == 0 || heads % key_heads != 0) {
       xnn_log_error(
-        "failed to define %s operator with key ID #%" PRIu32 ": key heads (%zu) must be equal to query heads (%zu)",
-        xnn_node_type_to_string(node_type), key_id, key->shape.dim[key_heads_dim], heads);
+        "failed to define %s operator with key ID #%" PRIu32 ": query heads (%zu) must be divisible by key heads (%zu)",
+        xnn_node_type_to_string(node_type), key_id, heads, key_heads);
       return xnn_status_invalid_parameter;
     }
   }
@@ -579,13 +595,14 @@ enum xnn_status xnn_define_scaled_dot_product_attention(
     return status;
   }
 
-  // Value heads must match query.
+  // Value heads must match key.
   if (!is_multi_query) {
     const size_t value_heads_dim = value_num_dims - 3;
-    if (value->shape.dim[value_heads_dim] != heads) {
+    const size_t key_heads = key->shape.dim[key_num_dims - 3];
+    if (value->shape.dim[value_heads_dim] != key_heads) {
       xnn_log_error(
-        "failed to define %s operator with value ID #%" PRIu32 ": value heads (%zu) must be equal to query heads (%zu)",
-        xnn_node_type_to_string(node_type), value_id, value->shape.dim[value_heads_dim], heads);
+        "failed to define %s operator with value ID #%" PRIu32 ": value heads (%zu) must be equal to key heads (%zu)",
+        xnn_node_type_to_string(node_type), value_id, value->shape.dim[value_heads_dim], key_heads);
       return xnn_status_invalid_parameter;
     }
   }
@@ -623,35 +640,48 @@ enum xnn_status xnn_define_scaled_dot_product_attention(
     return xnn_status_invalid_parameter;
   }
 
-  // Mask is [T, U].
-  status = check_inputs(subgraph, mask_id);
-  if (status != xnn_status_success) {
-    return status;
-  }
-  const struct xnn_value* mask = &subgraph->values[mask_id];
-
-  // Mask must have 2 dimensions.
-  if (mask->shape.num_dims != 2) {
+  const bool causal = (flags & XNN_FLAG_CAUSAL_MASK) != 0;
+  // Causal mask requires at least as many key/value tokens as query tokens.
+  if (causal && key_tokens < query_tokens) {
     xnn_log_error(
-      "failed to define %s operator with mask ID #%" PRIu32 ": mask must have only 2 dimension, found %zu",
-      xnn_node_type_to_string(node_type), mask_id, mask->shape.num_dims);
+      "failed to define %s operator with causal mask: key/value tokens (%zu) must be greater than or equal to query "
+      "tokens (%zu)", xnn_node_type_to_string(node_type), key_tokens, query_tokens);
     return xnn_status_invalid_parameter;
   }
 
-  // Mask query tokens must match query tokens.
-  if (mask->shape.dim[0] != query_tokens) {
-    xnn_log_error(
-      "failed to define %s operator with mask ID #%" PRIu32 ": mask query tokens (%zu) must match query (%zu)",
-      xnn_node_type_to_string(node_type), mask_id, mask->shape.dim[0], query_tokens);
-    return xnn_status_invalid_parameter;
-  }
+  // Mask is [T, U], and is optional with the causal mask flag.
+  const bool has_mask = !causal || mask_id != XNN_INVALID_VALUE_ID;
+  if (has_mask) {
+    status = check_inputs(subgraph, mask_id);
+    if (status != xnn_status_success) {
+      return status;
+    }
+    const struct xnn_value* mask = &subgraph->values[mask_id];
 
-  // Mask key/value tokens must match key/value tokens.
-  if (mask->shape.dim[1] != key_tokens) {
-    xnn_log_error(
-      "failed to define %s operator with mask ID #%" PRIu32 ": mask key/value tokens (%zu) must match key/value (%zu)",
-      xnn_node_type_to_string(node_type), mask_id, mask->shape.dim[1], key_tokens);
-    return xnn_status_invalid_parameter;
+    // Mask must have 2 dimensions.
+    if (mask->shape.num_dims != 2) {
+      xnn_log_error(
+        "failed to define %s operator with mask ID #%" PRIu32 ": mask must have only 2 dimension, found %zu",
+        xnn_node_type_to_string(node_type), mask_id, mask->shape.num_dims);
+      return xnn_status_invalid_parameter;
+    }
+
+    // Mask query tokens must match query tokens.
+    if (mask->shape.dim[0] != query_tokens) {
+      xnn_log_error(
+        "failed to define %s operator with mask ID #%" PRIu32 ": mask query tokens (%zu) must match query (%zu)",
+        xnn_node_type_to_string(node_type), mask_id, mask->shape.dim[0], query_tokens);
+      return xnn_status_invalid_parameter;
+    }
+
+    // Mask key/value tokens must match key/value tokens. The number of valid tokens in a KV cache is only known on
+    // reshape.
+    if (!xnn_value_is_persistent(key) && mask->shape.dim[1] != key_tokens) {
+      xnn_log_error(
+        "failed to define %s operator with mask ID #%" PRIu32 ": mask key/value tokens (%zu) must match key/value (%zu)",
+        xnn_node_type_to_string(node_type), mask_id, mask->shape.dim[1], key_tokens);
+      return xnn_status_invalid_parameter;
+    }
   }
 
   status = xnn_subgraph_check_output_node_id(node_type, output_id, subgraph->num_values);
@@ -740,7 +770,7 @@ enum xnn_status xnn_define_scaled_dot_product_attention(
     memcpy(&node->params.scaled_dot_product_attention.cap_tanh_params, cap_params,
            sizeof(struct xnn_attention_logits_cap_tanh_params));
   }
-  node->num_inputs = 5;
+  node->num_inputs = has_mask ? 5 : 4;
   node->inputs[0] = query_id;
   node->inputs[1] = key_id;
   node->inputs[2] = value_id;
@@ -5,6 +5,7 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -303,6 +304,30 @@ enum xnn_status xnn_define_static_reduce_v2(
       return xnn_status_invalid_parameter;
   }
 
+  // Max, min and argmax are only supported for floating-point inputs, and prod
+  // only for single precision.
+  bool supported_datatype = true;
+  switch (reduce_operator) {
+    case xnn_reduce_max:
+    case xnn_reduce_min:
+    case xnn_reduce_argmax:
+      supported_datatype = input_value->datatype == xnn_datatype_fp16 ||
+                           input_value->datatype == xnn_datatype_fp32;
+      break;
+    case xnn_reduce_prod:
+      supported_datatype = input_value->datatype == xnn_datatype_fp32;
+      break;
+    default:
+      break;
+  }
+  if (!supported_datatype) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(node_type), input_id,
+      xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
   status = xnn_subgraph_check_output_node_id(node_type, output_id, subgraph->num_values);
   if (status != xnn_status_success) {
     return status;
@@ -314,6 +339,15 @@ enum xnn_status xnn_define_static_reduce_v2(
     return status;
   }
 
+  if (reduce_operator == xnn_reduce_argmax && output_value->datatype != xnn_datatype_int32) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d), expected %s",
+      xnn_node_type_to_string(node_type), output_id,
+      xnn_datatype_to_string(output_value->datatype), output_value->datatype,
+      xnn_datatype_to_string(xnn_datatype_int32));
+    return xnn_status_invalid_parameter;
+  }
+
   if (num_reduction_axes == 0) {
     xnn_log_error(
       "failed to define %s operator with %zu reduction axes: the number of reduction axes must be non-zero",
@@ -69,6 +69,19 @@ enum xnn_cache_state {
   xnn_cache_state_soft_finalized,
 };
 
+// Microkernel tile chosen by the GEMM autotuner for operators of a type and shape.
+struct xnn_gemm_tuning_record {
+  // Look up key.
+  uint64_t input_channels;
+  uint64_t output_channels;
+  uint32_t operator_type;
+  // Tile of the chosen GEMM config.
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t log2_kr;
+  uint8_t log2_sr;
+};
+
 // Internal implementation of cache for repacked weights.
 struct xnn_internal_weights_cache {
   struct xnn_cache cache;
@@ -78,6 +91,9 @@ struct xnn_internal_weights_cache {
   // Maximum size of packed weights that have been inserted into the cache.
   size_t max_weights_size;
   enum xnn_cache_state finalization_state;
+  // GEMM autotuning results, saved and loaded together with the packed weights. Protected by `mutex`.
+  struct xnn_gemm_tuning_record* gemm_tunings;
+  size_t num_gemm_tunings;
 };
 
 enum xnn_status xnn_internal_init_weights_cache_with_size(struct xnn_internal_weights_cache* cache, size_t size);
@@ -87,6 +103,13 @@ enum xnn_status xnn_internal_finalize_weights_cache(
 
 enum xnn_status xnn_internal_release_weights_cache(struct xnn_internal_weights_cache* cache);
 
+// Writes the packed weights and the index of `cache` to the file at `path`.
+enum xnn_status xnn_internal_save_weights_cache(struct xnn_internal_weights_cache* cache, const char* path);
+
+// Initializes `cache` as a soft finalized cache with the packed weights mapped from a file written by
+// xnn_internal_save_weights_cache. Fails if the file was written by a different build or on different hardware.
+enum xnn_status xnn_internal_init_weights_cache_from_file(struct xnn_internal_weights_cache* cache, const char* path);
+
 // Ensures that cache has enough space for `n` bytes, locks the mutex to protect
 // future updates. Mutex must be unlocked using xnn_internal_get_or_insert_weights_cache.
 void* xnn_internal_reserve_space_in_weights_cache(struct xnn_internal_weights_cache* cache, size_t n);
@@ -106,12 +129,27 @@ void* xnn_internal_weights_cache_offset_to_addr(struct xnn_internal_weights_cach
 
 enum xnn_status xnn_internal_delete_weights_cache(struct xnn_internal_weights_cache* weights_cache);
 
+// Looks up the GEMM autotuning result for the operator type and shape in `record`, and fills in the tile of `record`
+// if found.
+bool xnn_internal_weights_cache_look_up_gemm_tuning(
+  struct xnn_internal_weights_cache* cache, struct xnn_gemm_tuning_record* record);
+
+// Adds a GEMM autotuning result to `cache`. Results can be added to finalized caches too.
+enum xnn_status xnn_internal_weights_cache_insert_gemm_tuning(
+  struct xnn_internal_weights_cache* cache, const struct xnn_gemm_tuning_record* record);
+
 size_t xnn_look_up_or_insert_weights_cache(
   xnn_weights_cache_t cache, const struct xnn_weights_cache_look_up_key* cache_key, void* ptr, size_t size);
 
 size_t xnn_weights_cache_look_up(
   xnn_weights_cache_t cache, const struct xnn_weights_cache_look_up_key* cache_key);
 
+// Same as the internal functions above, for weights caches created by XNNPACK. Other weights cache providers don't
+// keep GEMM autotuning results.
+bool xnn_weights_cache_look_up_gemm_tuning(xnn_weights_cache_t cache, struct xnn_gemm_tuning_record* record);
+
+void xnn_weights_cache_insert_gemm_tuning(xnn_weights_cache_t cache, const struct xnn_gemm_tuning_record* record);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -10,6 +10,7 @@
 
 #include "xnnpack.h"
 #include "xnnpack/common.h"
+#include "xnnpack/internal.h"
 #include "xnnpack/math.h"
 #include "xnnpack/microfnptr.h"
 #include "xnnpack/microparams.h"
@@ -261,6 +262,12 @@ struct packw_gemm_gio_context {
   // Stride, in bytes, between each group of of packed weights.
   size_t gc_stride;
 
+  // Parameters used for batched packw with tiled input channels, where each tile of kc_tile input channels is packed
+  // as a separate matrix.
+  size_t kc_tile;
+  // Stride, in bytes, between packed weights of consecutive tiles of input channels.
+  size_t gc_tile_stride;
+
   // Microkernel to preform packing.
   xnn_packw_gemm_gio_ukernel_fn packw_gemm_gio;
 };
@@ -275,8 +282,41 @@ struct packw_gemm_gio_context {
       size_t batch_index,
       size_t n_block_start,
       size_t n_block_size);
+  XNN_PRIVATE void xnn_compute_batched_packw_gemm_gio_tiled(
+      const struct packw_gemm_gio_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t tile_index,
+      size_t n_block_start,
+      size_t n_block_size);
 #endif
 
+// Elementwise operations applied to each FP32 output tile of a GEMM or IGEMM right after the microkernel produced it,
+// while the tile is still resident in cache, in this order:
+//   C := clamp(activation(C * scale [N] + residual [MxN])).
+// Each step is skipped if its microkernel is NULL.
+struct xnn_gemm_epilogue {
+  // Per-output-channel multipliers.
+  const void* scale;
+  // Microkernel to multiply a row of C by the per-channel scales.
+  xnn_vbinary_ukernel_fn vmul;
+  // Residual tensor with the same shape as C.
+  const void* residual;
+  // Stride, in bytes, between each row (M) of the residual tensor.
+  size_t residual_stride;
+  // Stride, in bytes, between each batch (B) of the residual tensor. Used only by batched IGEMM.
+  size_t residual_batch_stride;
+  // Microkernel to add a row of the residual tensor to a row of C.
+  xnn_vbinary_ukernel_fn vadd;
+  // Parameters for the vmul and vadd microkernels.
+  union xnn_binary_uparams binary_params;
+  // Microkernel for the unary activation.
+  xnn_vunary_ukernel_fn activation;
+  union xnn_unary_uparams activation_params;
+  // Microkernel for the final clamp.
+  xnn_vunary_ukernel_fn clamp;
+  union xnn_unary_uparams clamp_params;
+};
+
 // Context for Dense Matrix Multiplication.
 // C [GxMxN] := A [GxMxK] * B[GxKxN] + bias [GxN]
 // Where B and bias have been packed into packed_w.
@@ -339,6 +379,33 @@ struct gemm_context {
     struct xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
   } params;
+  // Elementwise operations fused into the output, used by xnn_compute_gemm_with_epilogue.
+  const struct xnn_gemm_epilogue* epilogue;
+  // State for splitting K between threads, used by xnn_compute_gemm_k_split and xnn_compute_gemm_k_split_reduce.
+  struct {
+    // Accumulating variant of the GEMM microkernel.
+    xnn_f32_gemminc_minmax_ukernel_fn ukernel;
+    // Microkernel used to sum partial accumulators.
+    xnn_vbinary_ukernel_fn vadd;
+    // The `nr` size of the current GEMM microkernel.
+    size_t nr;
+    // Number of slices K is split into.
+    size_t num_slices;
+    // Size of all slices but the last, in elements of K scaled by size of an element in A.
+    size_t kc_scaled;
+    // A zero `mr x nr` tile, used as the initial accumulator of all slices but the first.
+    const void* zero;
+    // Partial accumulators of all slices but the last, stored as [slice][M / mr][N / nr][mr][nr] tiles.
+    void* buffer;
+    // Stride, in bytes, between the partial accumulators of two slices.
+    size_t slice_stride;
+    // Stride, in bytes, between the partial accumulators of two rows of `mr` tiles.
+    size_t tile_row_stride;
+    // Parameters without clamping, used when computing partial accumulators.
+    union xnn_f32_minmax_params unclamped_params;
+    // Parameters for the `vadd` microkernel.
+    union xnn_binary_uparams vadd_params;
+  } k_split;
 };
 
 #ifndef __cplusplus
@@ -364,6 +431,28 @@ struct gemm_context {
       size_t mr_block_size,
       size_t nr_block_size);
 
+  XNN_PRIVATE void xnn_compute_gemm_with_epilogue(
+      const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_gemm_k_split(
+      const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t slice_index,
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_gemm_k_split_reduce(
+      const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+
   XNN_PRIVATE void xnn_compute_qp8gemm(
       const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t mr_block_start, size_t nr_block_start, size_t mr_block_size,
@@ -401,6 +490,33 @@ struct gemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+#define XNN_MAX_GEMM_MULTI_OUTPUTS 3
+
+// Context for several GEMMs with the same A matrix but different B matrices and outputs, e.g. the Q, K and V projections
+// of an attention block, computed in a single parallel region over the concatenation of their N dimensions:
+//   C_i [MxN_i] := A [MxK] * B_i [KxN_i] + bias_i [N_i]
+struct gemm_multi_output_context {
+  // Contexts of the individual GEMMs, which share the same `mr`.
+  const struct gemm_context* gemm[XNN_MAX_GEMM_MULTI_OUTPUTS];
+  // Task computing a tile of any of the individual GEMMs, e.g. xnn_compute_gemm or xnn_compute_dqgemm.
+  pthreadpool_task_2d_tile_2d_t task;
+  // Number of columns of each GEMM.
+  size_t n[XNN_MAX_GEMM_MULTI_OUTPUTS];
+  // Offset of each GEMM in the concatenated N dimension. Offsets are multiples of the tile size in the N dimension, so
+  // that each tile belongs to a single GEMM.
+  size_t n_offset[XNN_MAX_GEMM_MULTI_OUTPUTS];
+  size_t num_gemms;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_gemm_multi_output(
+      const struct gemm_multi_output_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
     // Context for Sparse Matrix-Dense Matrix Multiplication.
     // C [MxN] := A [MxK] * B [KxN] + bias [N]
     // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -446,6 +562,46 @@ struct gemm_context {
     size_t mr_block_size);
 #endif
 
+// Context for Dense Matrix-Sparse Matrix Multiplication.
+// C [MxN] := A [MxK] * B [KxN] + bias [N]
+// A and C are dense matrices with row-major storage, B is a sparse matrix packed
+// in tiles of `nr` columns, see xnn_pack_f32_spgemm_w.
+struct spgemm_context {
+  // K dimension of the A and B matrices, in bytes.
+  size_t k_scaled;
+  // Input matrix A.
+  const void* a;
+  // Stride, in bytes, between adjacent rows of A matrix.
+  size_t a_stride;
+  // Packed bias elements and non-zero weights of the tiles of B.
+  const void* packed_w;
+  // Offset, in bytes, of each tile of B within packed_w.
+  const uint32_t* tile_offsets;
+  // Output matrix C.
+  void* c;
+  // Stride, in bytes, between adjacent rows of C matrix.
+  size_t cm_stride;
+  // Size, in bytes, of a tile of C in the N dimension.
+  size_t cn_stride;
+  // Number of columns of B in a tile.
+  size_t nr;
+  // Micro-kernel function pointer.
+  xnn_spgemm_ukernel_fn ukernel;
+  // Output activation parameters.
+  union {
+    union xnn_f32_minmax_params f32;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_spgemm(
+      const struct spgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 // Context for initializing the indirection buffer for conv2d igemm.
 struct conv2d_igemm_indirection_init_context {
   const void** indirection_buffer;
@@ -520,6 +676,8 @@ struct igemm_context {
     struct xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
   } params;
+  // Elementwise operations fused into the output, used by xnn_compute_[batch_]igemm_with_epilogue.
+  const struct xnn_gemm_epilogue* epilogue;
 };
 
 #ifndef __cplusplus
@@ -557,6 +715,11 @@ XNN_PRIVATE void xnn_compute_igemm(
     size_t mr_block_start, size_t nr_block_start, size_t mr_block_size,
     size_t nr_block_size);
 
+XNN_PRIVATE void xnn_compute_igemm_with_epilogue(
+    const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start, size_t nr_block_start, size_t mr_block_size,
+    size_t nr_block_size);
+
 XNN_PRIVATE void xnn_compute_conv2d_igemm_indirection(
     const struct conv2d_igemm_indirection_init_context
         context[restrict XNN_MIN_ELEMENTS(1)],
@@ -572,6 +735,11 @@ XNN_PRIVATE void xnn_compute_batch_igemm(
     size_t batch_index, size_t mr_block_start, size_t nr_block_start,
     size_t mr_block_size, size_t nr_block_size);
 
+XNN_PRIVATE void xnn_compute_batch_igemm_with_epilogue(
+    const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index, size_t mr_block_start, size_t nr_block_start,
+    size_t mr_block_size, size_t nr_block_size);
+
 #if XNN_MAX_UARCH_TYPES > 1
 XNN_PRIVATE void xnn_compute_hmp_grouped_igemm(
     const struct igemm_context context[restrict XNN_MIN_ELEMENTS(1)],
@@ -1286,6 +1454,111 @@ struct univector_contiguous_context {
       size_t size);
 #endif
 
+// Size in bytes of the blocks processed by all operations of an elementwise chain before moving to the next block.
+#define XNN_ELEMENTWISE_CHAIN_BLOCK_SIZE 4096
+
+struct elementwise_chain_step {
+  // NULL for binary operations.
+  xnn_vunary_ukernel_fn unary_ukernel;
+  xnn_vbinary_ukernel_fn binary_ukernel;
+  uint32_t input_index;
+  bool input_is_first;
+  bool input_is_scalar;
+  union {
+    union xnn_unary_uparams unary;
+    union xnn_binary_uparams binary;
+  } params;
+};
+
+struct elementwise_chain_context {
+  const void* inputs[XNN_MAX_ELEMENTWISE_CHAIN_INPUTS];
+  void* output;
+  size_t num_inputs;
+  size_t num_steps;
+  struct elementwise_chain_step steps[XNN_MAX_ELEMENTWISE_CHAIN_OPS];
+  // The remaining fields are only used when the output is dynamically quantized. The chain is then applied one row at a
+  // time: the FP32 result of the row goes to a per-thread row buffer, and its minimum and maximum are computed block by
+  // block while the block is still in L1, so the row is quantized in a single pass over the row buffer.
+  size_t batch_size;
+  // Size of a row in bytes, in FP32 for the inputs and the row buffer, in 8-bit integers for the output.
+  size_t row_size;
+  void* row_buffer;
+  size_t row_buffer_stride;
+  struct xnn_qd8_quantization_params* quantization_params;
+  xnn_reduce_ukernel_fn rminmax_ukernel;
+  xnn_vunary_ukernel_fn convert_ukernel;
+  struct xnn_f32_default_params rminmax_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_elementwise_chain(
+      const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t offset,
+      size_t size);
+
+  XNN_PRIVATE void xnn_compute_elementwise_chain_qd8(
+      const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_elementwise_chain_qdu8(
+      const struct elementwise_chain_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index);
+#endif
+
+struct norm_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  const void* scale;
+  // Only used by layer norm.
+  const void* bias;
+  void* y;
+  size_t y_stride;
+  float epsilon;
+  xnn_rmsnorm_ukernel_fn rmsnorm_ukernel;
+  xnn_layernorm_ukernel_fn layernorm_ukernel;
+  // The remaining fields are only used when the output is dynamically quantized. Each row is normalized into a
+  // per-thread row buffer, which stays in cache while its minimum and maximum are computed and it is quantized.
+  size_t batch_size;
+  void* row_buffer;
+  size_t row_buffer_stride;
+  struct xnn_qd8_quantization_params* quantization_params;
+  xnn_reduce_ukernel_fn rminmax_ukernel;
+  xnn_vunary_ukernel_fn convert_ukernel;
+  union {
+    struct xnn_f16_default_params f16_default;
+    struct xnn_f32_default_params f32_default;
+  } rminmax_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_norm(
+      const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_f16_norm_qd8(
+      const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_f16_norm_qdu8(
+      const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_f32_norm_qd8(
+      const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_f32_norm_qdu8(
+      const struct norm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index);
+#endif
+
 struct reduce_context {
   const void* input;
   void* output;
@@ -1297,6 +1570,9 @@ struct reduce_context {
   size_t channels;
   size_t accumulation_element_size;
   size_t output_element_size;
+  enum xnn_reduce_operator reduce_operator;
+  // Bit pattern of the identity element of max, min and prod reductions.
+  uint32_t identity;
   union {
     xnn_reduce_ukernel_fn rsum;
     xnn_rdsum_ukernel_fn rdsum;
@@ -1512,6 +1788,13 @@ struct f32_qd8_convert_context {
 
 typedef void (*xnn_compute_reciprocal_fn)(const void* input, void* output);
 
+// Updates the running maximum of a row of online softmax with the maximum of a new block of the row, and computes the
+// factor exp(old_max - new_max) to rescale the sums and outputs accumulated for previous blocks.
+typedef void (*xnn_update_online_softmax_max_fn)(const void* block_max, void* max, void* rescale);
+
+// Updates the running sum of a row of online softmax: sum = sum * rescale + block_sum.
+typedef void (*xnn_update_online_softmax_sum_fn)(const void* block_sum, const void* rescale, void* sum);
+
 struct floating_point_softmax_context {
   size_t n;
   const void* x;
@@ -1522,6 +1805,10 @@ struct floating_point_softmax_context {
   xnn_raddstoreexpminusmax_ukernel_fn raddstoreexpminusmax_ukernel;
   xnn_compute_reciprocal_fn compute_reciprocal;
   xnn_vbinary_ukernel_fn vmulc_ukernel;
+  // If set, the row is processed in two passes with online softmax instead of
+  // the three passes above.
+  xnn_rmaxaddexp_ukernel_fn rmaxaddexp_ukernel;
+  xnn_vscaleexpminusmax_ukernel_fn vscaleexpminusmax_ukernel;
   union {
     union xnn_f16_minmax_params f16;
     union xnn_f32_minmax_params f32;
@@ -1610,6 +1897,10 @@ struct scaled_dot_product_attention_context {
   size_t value_channels;
   // Value Channels, in bytes.
   size_t value_scaled_channels;
+  // Whether the causal mask is applied: query token i attends to key/value tokens [0, i + causal_offset].
+  bool causal;
+  // Difference between the number of key/value tokens and the number of query tokens.
+  size_t causal_offset;
   // Stride, in bytes, between columns of logits and final attention output.
   size_t cn_stride;
 
@@ -1625,6 +1916,9 @@ struct scaled_dot_product_attention_context {
   size_t value_batch_stride;
   // Stride, in bytes,  between each head of value.
   size_t value_head_stride;
+  // Number of query heads sharing each key/value head: 1 for multi-head attention, number of query heads for
+  // multi-query attention, and the group size for grouped-query attention.
+  size_t query_heads_per_key_value_head;
   // Stride, in bytes,  between each batch of logits (Q*K).
   size_t logits_batch_stride;
   // Stride, in bytes,  between each head of logits (Q*K).
@@ -1639,6 +1933,31 @@ struct scaled_dot_product_attention_context {
   // Stride, in bytes, between the buffer for each thread to write logits.
   size_t logits_thread_stride;
 
+  // Parameters of the tiled implementation, which processes key/value tokens in blocks and computes softmax online,
+  // without materializing the logits of all key/value tokens.
+  // Size, in bytes, of an element.
+  size_t element_size;
+  // Number of key/value tokens in each block.
+  size_t key_value_tokens_tile;
+  // Stride, in bytes, between packed keys of consecutive blocks of key/value tokens.
+  size_t key_tile_stride;
+  // Stride, in bytes, between packed values of consecutive blocks of key/value tokens.
+  size_t value_tile_stride;
+  // Offsets, in bytes, from the logits buffer of each thread, to the accumulated output, the output for a block of
+  // key/value tokens, and running maximum, sum, and rescale factor of each row.
+  size_t accumulator_offset;
+  size_t block_output_offset;
+  size_t row_max_offset;
+  size_t row_sum_offset;
+  size_t row_rescale_offset;
+  // Lowest finite value, used as initial running maximum.
+  union {
+    xnn_float16 f16;
+    float f32;
+  } lowest;
+  xnn_update_online_softmax_max_fn update_max;
+  xnn_update_online_softmax_sum_fn update_sum;
+
   struct xnn_hmp_gemm_ukernel gemm_ukernel;
   xnn_compute_reciprocal_fn compute_reciprocal;
   xnn_rmax_ukernel_fn rmax_ukernel;
@@ -1710,4 +2029,21 @@ struct scaled_dot_product_attention_context {
       size_t head_index,
       size_t tokens_start,
       size_t tokens_block_size);
+  // Tiled implementation with online softmax, used for large numbers of key/value tokens. Workspace is always sized
+  // based on the number of threads.
+  XNN_PRIVATE void xnn_compute_tiled_scaled_dot_product_attention_with_thread(
+      const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t thread_index,
+      size_t batch_index,
+      size_t head_index,
+      size_t tokens_start,
+      size_t tokens_block_size);
+  XNN_PRIVATE void xnn_compute_hmp_tiled_scaled_dot_product_attention_with_thread(
+      const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+      uint32_t uarch_index,
+      size_t thread_index,
+      size_t batch_index,
+      size_t head_index,
+      size_t tokens_start,
+      size_t tokens_block_size);
 #endif
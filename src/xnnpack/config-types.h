@@ -175,7 +175,11 @@ struct xnn_gemm_config {
   struct gemm_fused_ukernels minmax;
   struct gemm_fused_ukernels relu;
   struct gemm_fused_ukernels linear;
+  // Accumulating variants of the F32 `minmax.gemm` microkernels, indexed the same way. They read the same packed
+  // weights as the GEMM microkernels, and are used to split the K dimension between threads.
+  xnn_f32_gemminc_minmax_ukernel_fn gemminc[XNN_MAX_MR];
   union {
+    xnn_init_bf16_minmax_params_fn bf16;
     xnn_init_f16_minmax_params_fn f16;
     xnn_init_f32_minmax_params_fn f32;
     xnn_init_f16_qc4w_minmax_params_fn f16_qc4w;
@@ -252,6 +256,22 @@ struct xnn_spmm_config {
   uint8_t nr;
 };
 
+struct xnn_spgemm_config {
+  // Microkernel for weights packed as non-zero 1xNR blocks (one input channel by
+  // NR output channels).
+  xnn_spgemm_ukernel_fn ukernel;
+  // Microkernel for weights with 2:4 structured sparsity along the input
+  // channels, or NULL if not supported on this platform.
+  xnn_spgemm_ukernel_fn ukernel_2of4;
+  union {
+    xnn_init_f32_minmax_params_fn f32;
+  } init;
+  // Number of batch rows in a tile.
+  uint8_t mr;
+  // Number of output channels in a tile; also the width of the sparse blocks.
+  uint8_t nr;
+};
+
 struct xnn_dwconv2d_chw_parameters {
   xnn_dwconv2d_chw_ukernel_fn ukernel;
   union {
@@ -309,6 +329,21 @@ struct xnn_raddstoreexpminusmax_config {
   } init;
 };
 
+// Online softmax: `ukernel` computes the maximum of a row and the sum of
+// exp(x - max) in a single pass, and `vscale_ukernel` then writes the
+// normalized exp(x - max) / sum in a second pass.
+struct xnn_rmaxaddexp_config {
+  xnn_rmaxaddexp_ukernel_fn ukernel;
+  xnn_vscaleexpminusmax_ukernel_fn vscale_ukernel;
+};
+
+// Row-wise normalization: each microkernel reads its row twice, once to compute
+// the statistics of the row and once to normalize it.
+struct xnn_norm_config {
+  xnn_rmsnorm_ukernel_fn rmsnorm;
+  xnn_layernorm_ukernel_fn layernorm;
+};
+
 struct xnn_argmaxpool_config {
   union {
     xnn_argmaxpool_unipass_ukernel_fn up;
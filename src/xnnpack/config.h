@@ -109,7 +109,12 @@ XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_xx_copy_config(
 
 XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f16_f32acc_rsum_config();
 XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f16_f32acc_rdsum_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f16_reduce_max_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f16_reduce_min_config();
 XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f16_rminmax_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_reduce_max_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_reduce_min_config();
+XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_reduce_prod_config();
 XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rminmax_config();
 XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rsum_config();
 XNN_INTERNAL const struct xnn_reduce_config* xnn_init_f32_rdsum_config();
@@ -238,9 +243,13 @@ static inline bool xnn_is_hmp_igemm_ukernel(struct xnn_hmp_igemm_ukernel ukernel
 #endif
 }
 
+XNN_INTERNAL const struct xnn_gemm_config* xnn_init_bf16_gemm_config();
 XNN_INTERNAL const struct xnn_gemm_config* xnn_init_f16_gemm_config();
 XNN_INTERNAL const struct xnn_gemm_config* xnn_init_f32_gemm_config();
 XNN_INTERNAL const struct xnn_gemm_config* xnn_init_f32_gemm_nr2_config();
+// Returns all F32 GEMM configs supported on this hardware, starting with the default config, and stores their number
+// in `num_configs`. Used to autotune F32 GEMMs.
+XNN_INTERNAL const struct xnn_gemm_config* xnn_init_f32_gemm_candidate_configs(size_t* num_configs);
 XNN_INTERNAL const struct xnn_gemm_config* xnn_init_f32_qc8w_gemm_config();
 XNN_INTERNAL const struct xnn_gemm_config* xnn_init_f32_qc4w_gemm_config();
 XNN_INTERNAL const struct xnn_gemm_config* xnn_init_pf32_gemm_config();
@@ -281,6 +290,9 @@ XNN_INTERNAL const struct xnn_spmm_config* xnn_init_f32_spmm2_config();
 // Sparse Matrix-Dense Matrix Multiplication (NR=4 block).
 XNN_INTERNAL const struct xnn_spmm_config* xnn_init_f32_spmm4_config();
 
+// Sparse-weights Matrix Multiplication on NC-layout inputs.
+XNN_INTERNAL const struct xnn_spgemm_config* xnn_init_f32_spgemm_config();
+
 XNN_INTERNAL const struct xnn_dwconv2d_chw_config* xnn_init_f16_dwconv2d_chw_config();
 XNN_INTERNAL const struct xnn_dwconv2d_chw_config* xnn_init_f32_dwconv2d_chw_config();
 
@@ -294,6 +306,12 @@ XNN_INTERNAL const struct xnn_vmulcaddc_config* xnn_init_f32_vmulcaddc_config();
 XNN_INTERNAL const struct xnn_raddstoreexpminusmax_config* xnn_init_f16_raddstoreexpminusmax_config();
 XNN_INTERNAL const struct xnn_raddstoreexpminusmax_config* xnn_init_f32_raddstoreexpminusmax_config();
 
+XNN_INTERNAL const struct xnn_rmaxaddexp_config* xnn_init_f16_rmaxaddexp_config();
+XNN_INTERNAL const struct xnn_rmaxaddexp_config* xnn_init_f32_rmaxaddexp_config();
+
+XNN_INTERNAL const struct xnn_norm_config* xnn_init_f16_norm_config();
+XNN_INTERNAL const struct xnn_norm_config* xnn_init_f32_norm_config();
+
 #define XNN_MAX_F32_ARGMAXPOOL_UKERNELS 3
 
 XNN_INTERNAL const struct xnn_argmaxpool_config* xnn_init_f32_argmaxpool_config();
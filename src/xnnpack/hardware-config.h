@@ -54,6 +54,7 @@ enum xnn_arch_flags {
   xnn_arch_x86_avx256vnnigfni = 1 << 15,
   xnn_arch_x86_avx512amx = 1 << 16,
   xnn_arch_x86_avx512fp16 = 1 << 17,
+  xnn_arch_x86_avx512bf16 = 1 << 18,
 #endif
 #if XNN_ARCH_RISCV
   xnn_arch_riscv_vector = 1 << 0,
@@ -81,6 +82,11 @@ enum xnn_arch_flags {
 
 struct xnn_hardware_config {
   uint64_t arch_flags;
+  // Sizes, in bytes, of the L1 data, L2, and L3 caches of the first core, or 0 if unknown. The L2 and L3 caches may be
+  // shared with other cores.
+  size_t l1_data_cache_size;
+  size_t l2_cache_size;
+  size_t l3_cache_size;
 #if XNN_ARCH_ARM
   bool use_arm_v6;
   bool use_arm_vfpv2;
@@ -117,6 +123,7 @@ struct xnn_hardware_config {
   bool use_x86_avx512vnnigfni;
   bool use_x86_avx512amx;
   bool use_x86_avx512fp16;
+  bool use_x86_avx512bf16;
   bool use_x86_avxvnni;
   bool use_x86_avxvnniint8;
   bool use_x86_avx256skx;
@@ -171,9 +178,9 @@ static inline bool xnn_is_f16_chw_compatible_config(const struct xnn_hardware_co
 
 static inline bool xnn_is_chw_compatible_config(const struct xnn_hardware_config hardware_config[XNN_MIN_ELEMENTS(1)]) {
   #if (XNN_ARCH_X86 || XNN_ARCH_X86_64)
-    // Sparse microkernels on x86 currently target only SSE, and on processors
-    // with AVX ISA dense inference is expected to be faster than sparse.
-    return (!hardware_config->use_x86_avx);
+    // Processors with AVX but without FMA3 only have the SSE sparse
+    // microkernels, and dense inference is expected to be faster there.
+    return !hardware_config->use_x86_avx || hardware_config->use_x86_fma3;
   #else
     return true;
   #endif
@@ -8,6 +8,7 @@
 #ifndef THIRD_PARTY_XNNPACK_SRC_XNNPACK_INTERNAL_H_
 #define THIRD_PARTY_XNNPACK_SRC_XNNPACK_INTERNAL_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -158,7 +159,7 @@ enum xnn_status xnn_reshape_fully_connected_nc_qdu8_f16_qc8w(
     pthreadpool_t threadpool);
 
 enum xnn_status xnn_setup_fully_connected_nc_qdu8_f16_qc8w(
-    xnn_operator_t fully_connected_op, const int8_t* input, float* output,
+    xnn_operator_t fully_connected_op, const int8_t* input, void* output,
     const struct xnn_quantization_params* quantization_params);
 
 enum xnn_status xnn_create_fully_connected_nc_qdu8_f32_qc8w(
@@ -303,6 +304,82 @@ enum xnn_status xnn_setup_batch_matrix_multiply_nc_qdu8_f32_qc8w(
     const struct xnn_quantization_params* quantization_params,
     float* output);
 
+// Same as xnn_reshape_scaled_dot_product_attention_nhtc_f16, but key and value heads are key_value_tokens_stride tokens
+// apart, of which only the first key_value_tokens are attended to (e.g. the valid prefix of a KV cache).
+enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f16_with_kv_stride(
+    xnn_operator_t attention_op, size_t batch_size, size_t query_heads,
+    size_t query_tokens, size_t key_value_heads, size_t key_value_tokens,
+    size_t key_value_tokens_stride, size_t query_key_channels,
+    size_t value_channels, size_t* workspace_size, size_t* workspace_alignment,
+    pthreadpool_t threadpool);
+
+enum xnn_status xnn_reshape_scaled_dot_product_attention_nhtc_f32_with_kv_stride(
+    xnn_operator_t attention_op, size_t batch_size, size_t query_heads,
+    size_t query_tokens, size_t key_value_heads, size_t key_value_tokens,
+    size_t key_value_tokens_stride, size_t query_key_channels,
+    size_t value_channels, size_t* workspace_size, size_t* workspace_alignment,
+    pthreadpool_t threadpool);
+
+#define XNN_MAX_ELEMENTWISE_CHAIN_OPS 8
+// Must not exceed XNN_MAX_INPUTS, the inputs of the operator are the inputs of its Subgraph Node.
+#define XNN_MAX_ELEMENTWISE_CHAIN_INPUTS 5
+
+// An operation of an Elementwise Chain operator. The first operation reads input 0 of the operator, and every
+// following operation reads the result of the previous one. Binary operations read another input of the operator as
+// their other operand.
+struct xnn_elementwise_chain_op {
+  // xnn_unary_invalid for binary operations.
+  enum xnn_unary_operator unary_operator;
+  union xnn_unary_params unary_params;
+  enum xnn_binary_operator binary_operator;
+  // Index of the operator input which is the other operand of a binary operation.
+  uint32_t input_index;
+  // The other operand is the first operand of the binary operation, e.g. the minuend of a subtraction.
+  bool input_is_first;
+  // The other operand is a single element broadcasted to all elements.
+  bool input_is_scalar;
+};
+
+// Applies a chain of FP32 unary and binary elementwise operations block by block, keeping intermediate results in a
+// small buffer instead of writing them to memory.
+enum xnn_status xnn_create_elementwise_chain_nc_f32(
+    size_t num_ops, const struct xnn_elementwise_chain_op* ops, uint32_t flags,
+    xnn_operator_t* elementwise_chain_op_out);
+
+enum xnn_status xnn_reshape_elementwise_chain_nc_f32(
+    xnn_operator_t elementwise_chain_op, size_t batch_size, size_t channels,
+    pthreadpool_t threadpool);
+
+// inputs must have an element for each input referenced by the operations of the chain.
+enum xnn_status xnn_setup_elementwise_chain_nc_f32(
+    xnn_operator_t elementwise_chain_op, const float* const* inputs,
+    float* output);
+
+// Variants of the Elementwise Chain operator which quantize their output
+// dynamically, like a following Convert operator to QD8 (resp. QDU8) would,
+// without writing the FP32 result to memory and reading it back.
+enum xnn_status xnn_create_elementwise_chain_nc_f32_qd8(
+    size_t num_ops, const struct xnn_elementwise_chain_op* ops, uint32_t flags,
+    xnn_operator_t* elementwise_chain_op_out);
+
+enum xnn_status xnn_create_elementwise_chain_nc_f32_qdu8(
+    size_t num_ops, const struct xnn_elementwise_chain_op* ops, uint32_t flags,
+    xnn_operator_t* elementwise_chain_op_out);
+
+// Each of the `batch_size` rows of `channels` elements is quantized with its
+// own parameters.
+enum xnn_status xnn_reshape_elementwise_chain_nc_f32_qx8(
+    xnn_operator_t elementwise_chain_op, size_t batch_size, size_t channels,
+    size_t* workspace_size, size_t* workspace_alignment,
+    pthreadpool_t threadpool);
+
+// quantization_params must be padded with at least
+// XNN_EXTRA_QUANTIZATION_PARAMS entries.
+enum xnn_status xnn_setup_elementwise_chain_nc_f32_qx8(
+    xnn_operator_t elementwise_chain_op, void* workspace,
+    const float* const* inputs, void* output,
+    struct xnn_quantization_params* quantization_params);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
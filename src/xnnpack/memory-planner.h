@@ -17,7 +17,8 @@ extern "C" {
 #endif
 
 struct xnn_usage_record {
-  // The index (to xnn_runtime_t->opdata) of the first xnn_node that uses this xnn_value.
+  // The index (to xnn_runtime_t->opdata) of the first xnn_node that uses this xnn_value. If the runtime executes
+  // independent operators concurrently, this is the index of the first stage (see xnn_runtime_t->op_stage) instead.
   uint32_t first_node;
   // The index of the last xnn_node that uses this xnn_value.
   uint32_t last_node;
@@ -29,6 +30,13 @@ struct xnn_usage_record {
   // input tensor. The id of the input tensor is recorded in this field. This is XNN_INVALID_VALUE_ID if it does not
   // reuse any tensor.
   uint32_t reuse_value_id;
+  // Byte offset of this xnn_value's memory within the memory of reuse_value_id. This is non-zero only for values that
+  // are views into a larger tensor, e.g. inputs of a Concatenate node that are written directly into its output.
+  size_t reuse_offset;
+  // True if this xnn_value's memory is a sub-range of the memory of reuse_value_id rather than an in-place alias of it.
+  bool is_view;
+  // True if some other xnn_value is a view into this xnn_value's memory.
+  bool has_views;
   // This usage record is not tied to an actual value, but a temporary associated with an opdata, like a dynamic fully
   // connected operation. We need the opdata's id to lookup and intialize opdata's pointers.
   uint32_t opdata_id;
@@ -43,6 +51,8 @@ struct xnn_value_allocation_tracker {
   // The range of value ids (i.e. the index to runtime->values) whose memory might need to be allocated.
   size_t min_value_id;
   size_t max_value_id;
+  // Stage of each operator if the runtime executes independent operators concurrently, NULL otherwise.
+  const uint32_t* op_stage;
 };
 
 // Initialize the memory allocation tracker for xnn_values.
@@ -76,6 +86,15 @@ XNN_INTERNAL void xnn_mark_tensor_as_reuse(
   uint32_t reuse_value_id,
   uint32_t new_last_node);
 
+// Mark value_id as a view into the memory of base_value_id, starting at byte offset 'offset'. No memory is then
+// allocated to value_id. The usage record of the tensor that actually owns the memory is expanded to cover the whole
+// lifecycle of value_id, including its producer.
+XNN_INTERNAL void xnn_mark_tensor_as_view(
+  struct xnn_value_allocation_tracker* tracker,
+  uint32_t value_id,
+  uint32_t base_value_id,
+  size_t offset);
+
 // Plan the exact the memory allocation for intermediate tensors according to the xnn_value allocation tracker.
 XNN_INTERNAL void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker);
 
@@ -40,6 +40,11 @@ enum xnn_status xnn_reserve_weights_memory(struct xnn_weights_buffer* buffer, si
 // Releases unused memory in `buffer`, and sets used memory to read-only. The address of allocated memory (`buffer->start`)
 // is fixed after this call. This should only be called after all the weights have been written.
 enum xnn_status xnn_finalize_weights_memory(struct xnn_weights_buffer* buffer);
+// Maps `size` bytes of the file at `path`, starting at `offset`, read-only into a new weights region associated with
+// `buffer`, followed by at least `extra_capacity` bytes of writable memory. `offset` must be a multiple of the page size.
+// The used size of `buffer` is rounded up to the page size, so that writes never touch the mapped pages.
+enum xnn_status xnn_map_weights_memory_from_file(
+  struct xnn_weights_buffer* buffer, const char* path, size_t offset, size_t size, size_t extra_capacity);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -1596,6 +1596,26 @@ typedef void (*xnn_f32_rdsum_ukernel_fn)(
     float* output,
     const struct xnn_f32_scale_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
 
+// RDREDUCE: Discontiguous Reduce-Max/Min/Prod, updating the output in place
+
+typedef void (*xnn_f16_rdreduce_ukernel_fn)(
+    size_t rows,
+    size_t channels,
+    const xnn_float16* input,
+    size_t input_stride,
+    const xnn_float16* zero,
+    xnn_float16* output,
+    const struct xnn_f16_default_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_f32_rdreduce_ukernel_fn)(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    const float* zero,
+    float* output,
+    const struct xnn_f32_default_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
+
 typedef void (*xnn_qs8_rdsum_ukernel_fn)(
     size_t rows,
     size_t channels,
@@ -1830,6 +1850,32 @@ typedef void (*xnn_f32_spmm_minmax_ukernel_fn)(
     size_t output_stride,
     const union xnn_f32_minmax_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
 
+// SpGEMM: Sparse-weights GEneral Matrix Multiplication on NC-layout inputs
+
+typedef void (*xnn_spgemm_ukernel_fn)(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void* a,
+    size_t a_stride,
+    const void* w,
+    void* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const void* params);
+
+typedef void (*xnn_f32_spgemm_minmax_ukernel_fn)(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
+
 // CONV-HWC2CHW: direct CONVolution from HWC-layout tensor to CHW-layout tensor
 
 typedef void (*xnn_conv_hwc2chw_ukernel_fn)(
@@ -1986,14 +2032,100 @@ typedef void (*xnn_f32_raddexpminusmax_ukernel_fn)(
     float* sum,
     float max);
 
+// RMAXADDEXP: Reduce-MAX & ADD EXP(x_i MINUS MAX[x_i]) in a single (online) pass
+
+typedef void (*xnn_rmaxaddexp_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    float* max,
+    float* sum,
+    const void* params);
+
+typedef void (*xnn_f16_rmaxaddexp_ukernel_fn)(
+    size_t batch,
+    const xnn_float16* input,
+    float* max,
+    float* sum,
+    const void* params);
+
+typedef void (*xnn_f32_rmaxaddexp_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    float* max,
+    float* sum,
+    const void* params);
+
+// RMSNORM: Root-Mean-Square NORMalization of a row, multiplied by a per-channel scale
+
+typedef void (*xnn_rmsnorm_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    const void* scale,
+    void* output,
+    float epsilon);
+
+typedef void (*xnn_f16_rmsnorm_ukernel_fn)(
+    size_t batch,
+    const xnn_float16* input,
+    const xnn_float16* scale,
+    xnn_float16* output,
+    float epsilon);
+
+typedef void (*xnn_f32_rmsnorm_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    const float* scale,
+    float* output,
+    float epsilon);
+
+// LAYERNORM: LAYER NORMalization of a row, followed by a per-channel scale and bias
+
+typedef void (*xnn_layernorm_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    const void* scale,
+    const void* bias,
+    void* output,
+    float epsilon);
+
+typedef void (*xnn_f16_layernorm_ukernel_fn)(
+    size_t batch,
+    const xnn_float16* input,
+    const xnn_float16* scale,
+    const xnn_float16* bias,
+    xnn_float16* output,
+    float epsilon);
+
+typedef void (*xnn_f32_layernorm_ukernel_fn)(
+    size_t batch,
+    const float* input,
+    const float* scale,
+    const float* bias,
+    float* output,
+    float epsilon);
+
 // VSCALEEXPMINUSMAX: Vector SCALE EXP(x_i MINUS MAX[x_i])
 
+typedef void (*xnn_vscaleexpminusmax_ukernel_fn)(
+    size_t batch,
+    const void* input,
+    void* output,
+    float scale,
+    float max);
+
+typedef void (*xnn_f16_vscaleexpminusmax_ukernel_fn)(
+    size_t batch,
+    const xnn_float16* input,
+    xnn_float16* output,
+    float scale,
+    float max);
+
 typedef void (*xnn_f32_vscaleexpminusmax_ukernel_fn)(
     size_t batch,
     const float* input,
     float* output,
-    float max,
-    float scale);
+    float scale,
+    float max);
 
 // RADDEXTEXP: Reduce-ADD EXTended ("mantissa" + "exponent") EXPonentials
 typedef void (*xnn_f32_raddextexp_ukernel_fn)(
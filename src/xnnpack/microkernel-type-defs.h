@@ -17,6 +17,7 @@ XNN_ENUM_ITEM(xnn_microkernel_type_global_average_pooling, "Global Average Pooli
 XNN_ENUM_ITEM(xnn_microkernel_type_igemm, "IGEMM")
 XNN_ENUM_ITEM(xnn_microkernel_type_mean, "Mean")
 XNN_ENUM_ITEM(xnn_microkernel_type_pixelwise_average_pooling, "Pixelwise Average Pooling")
+XNN_ENUM_ITEM(xnn_microkernel_type_spgemm, "SPGEMM")
 XNN_ENUM_ITEM(xnn_microkernel_type_spmm, "SPMM")
 XNN_ENUM_ITEM(xnn_microkernel_type_subconv2d, "Subconv2D")
 XNN_ENUM_ITEM(xnn_microkernel_type_transpose, "Transpose")
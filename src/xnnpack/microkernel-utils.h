@@ -22,6 +22,33 @@ extern "C" {
 size_t xnn_gemm_best_nc(size_t num_groups, size_t m, size_t n, size_t mr,
                         size_t nr, size_t num_threads);
 
+// Computes the tile sizes `mc` and `nc`, multiples of `mr` and `nr`, such that
+// the weights of a tile (`nc` columns of `n_stride` bytes) and the rows of A of
+// a tile (`mc` rows of `m_stride` bytes) each fit in half of a cache of
+// `cache_size` bytes, while keeping at least five tiles per thread (if
+// `num_threads > 1`). The weights of a tile are reused for all `mc / mr` blocks
+// of rows. If `cache_size` is 0, `mc` is `mr` and `nc` is the result of
+// `xnn_gemm_best_nc`.
+void xnn_gemm_best_tile_size(size_t num_groups, size_t m, size_t n,
+                             size_t m_stride, size_t n_stride, size_t mr,
+                             size_t nr, size_t num_threads, size_t cache_size,
+                             size_t* mc, size_t* nc);
+
+// Splitting K between threads is only considered if every slice has at least
+// this many elements of K.
+#define XNN_GEMM_MIN_K_SPLIT_SIZE 256
+
+// Splitting K between threads is only considered if K is at least this many
+// times the number of rows of A, rounded up to `mr`, per slice. This bounds the
+// traffic to the partial accumulators relative to the traffic to the weights.
+#define XNN_GEMM_K_SPLIT_MIN_RATIO 16
+
+// Computes the number of slices to split K into, such that there are at least
+// five tiles per thread when the `m x n` output tiles are not enough, or 1 if K
+// should not be split.
+size_t xnn_gemm_best_k_splits(size_t m, size_t n, size_t k, size_t mr,
+                              size_t nr, size_t num_threads);
+
 // The total tile size needed to cover kernel_size.
 XNN_INTERNAL size_t xnn_dwconv_multipass_tile_size(
   size_t kernel_size,
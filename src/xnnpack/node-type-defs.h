@@ -23,24 +23,33 @@ XNN_ENUM_ITEM(xnn_node_type_copy, "Copy")
 XNN_ENUM_ITEM(xnn_node_type_deconvolution_2d, "Deconvolution 2D")
 XNN_ENUM_ITEM(xnn_node_type_depth_to_space_2d, "Depth To Space 2D")
 XNN_ENUM_ITEM(xnn_node_type_depthwise_convolution_2d, "Depthwise Convolution 2D")
+XNN_ENUM_ITEM(xnn_node_type_elementwise_chain, "Elementwise Chain")
 XNN_ENUM_ITEM(xnn_node_type_even_split2, "Even Split2")
 XNN_ENUM_ITEM(xnn_node_type_even_split3, "Even Split3")
 XNN_ENUM_ITEM(xnn_node_type_even_split4, "Even Split4")
 XNN_ENUM_ITEM(xnn_node_type_fully_connected, "Fully Connected")
+XNN_ENUM_ITEM(xnn_node_type_fully_connected_multi_output, "Fully Connected Multi-Output")
 XNN_ENUM_ITEM(xnn_node_type_fully_connected_sparse, "Fully Connected Sparse")
 XNN_ENUM_ITEM(xnn_node_type_global_average_pooling_1d, "Global Average Pooling 1D")
 XNN_ENUM_ITEM(xnn_node_type_global_average_pooling_2d, "Global Average Pooling 2D")
 XNN_ENUM_ITEM(xnn_node_type_global_sum_pooling_1d, "Global Sum Pooling 1D")
 XNN_ENUM_ITEM(xnn_node_type_global_sum_pooling_2d, "Global Sum Pooling 2D")
+XNN_ENUM_ITEM(xnn_node_type_kv_cache_append, "KV Cache Append")
+XNN_ENUM_ITEM(xnn_node_type_layer_norm, "Layer Norm")
 XNN_ENUM_ITEM(xnn_node_type_max_pooling_2d, "Max Pooling 2D")
 XNN_ENUM_ITEM(xnn_node_type_pack_lh, "Pack LH")
+XNN_ENUM_ITEM(xnn_node_type_rms_norm, "RMS Norm")
 XNN_ENUM_ITEM(xnn_node_type_rope, "RoPE")
 XNN_ENUM_ITEM(xnn_node_type_scaled_dot_product_attention, "Scaled Dot Product Attention")
 XNN_ENUM_ITEM(xnn_node_type_softmax, "Softmax")
 XNN_ENUM_ITEM(xnn_node_type_space_to_depth_2d, "Space To Depth 2D")
+XNN_ENUM_ITEM(xnn_node_type_static_argmax, "Static ArgMax")
 XNN_ENUM_ITEM(xnn_node_type_static_constant_pad, "Static Constant Pad")
 XNN_ENUM_ITEM(xnn_node_type_static_expand_dims, "Static Expand Dims")
+XNN_ENUM_ITEM(xnn_node_type_static_max, "Static Max")
 XNN_ENUM_ITEM(xnn_node_type_static_mean, "Static Mean")
+XNN_ENUM_ITEM(xnn_node_type_static_min, "Static Min")
+XNN_ENUM_ITEM(xnn_node_type_static_prod, "Static Prod")
 XNN_ENUM_ITEM(xnn_node_type_static_reshape, "Static Reshape")
 XNN_ENUM_ITEM(xnn_node_type_static_resize_bilinear_2d, "Static Resize Bilinear 2D")
 XNN_ENUM_ITEM(xnn_node_type_static_slice, "Static Slice")
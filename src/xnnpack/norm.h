@@ -0,0 +1,63 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t n,                                                  \
+      const xnn_float16* input,                                  \
+      const xnn_float16* scale,                                  \
+      xnn_float16* output,                                       \
+      float epsilon);
+#include "f16-rmsnorm/f16-rmsnorm.h"
+#undef XNN_UKERNEL
+
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t n,                                                  \
+      const float* input,                                        \
+      const float* scale,                                        \
+      float* output,                                             \
+      float epsilon);
+#include "f32-rmsnorm/f32-rmsnorm.h"
+#undef XNN_UKERNEL
+
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t n,                                                  \
+      const xnn_float16* input,                                  \
+      const xnn_float16* scale,                                  \
+      const xnn_float16* bias,                                   \
+      xnn_float16* output,                                       \
+      float epsilon);
+#include "f16-layernorm/f16-layernorm.h"
+#undef XNN_UKERNEL
+
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t n,                                                  \
+      const float* input,                                        \
+      const float* scale,                                        \
+      const float* bias,                                         \
+      float* output,                                             \
+      float epsilon);
+#include "f32-layernorm/f32-layernorm.h"
+#undef XNN_UKERNEL
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -9,6 +9,7 @@
 #endif
 
 XNN_ENUM_ITEM_0(xnn_operator_type_invalid, "Invalid")
+XNN_ENUM_ITEM(xnn_operator_type_argmax_nd, "ArgMax (ND)")
 XNN_ENUM_ITEM(xnn_operator_type_argmax_pooling_nhwc_f32, "ArgMax Pooling (NHWC, F32)")
 XNN_ENUM_ITEM(xnn_operator_type_average_pooling_nhwc_f16, "Average Pooling (NHWC, F16)")
 XNN_ENUM_ITEM(xnn_operator_type_average_pooling_nhwc_f32, "Average Pooling (NHWC, F32)")
@@ -59,6 +60,10 @@ XNN_ENUM_ITEM(xnn_operator_type_depth_to_space_nhwc_x16, "Depth To Space (NHWC,
 XNN_ENUM_ITEM(xnn_operator_type_depth_to_space_nhwc_x32, "Depth To Space (NHWC, X32)")
 XNN_ENUM_ITEM(xnn_operator_type_dynamic_fully_connected_nc_f16, "Dynamic Fully Connected (NC, F16)")
 XNN_ENUM_ITEM(xnn_operator_type_dynamic_fully_connected_nc_f32, "Dynamic Fully Connected (NC, F32)")
+XNN_ENUM_ITEM(xnn_operator_type_elementwise_chain_nc_f32, "Elementwise Chain (NC, F32)")
+XNN_ENUM_ITEM(xnn_operator_type_elementwise_chain_nc_f32_qd8, "Elementwise Chain (NC, F32, QD8)")
+XNN_ENUM_ITEM(xnn_operator_type_elementwise_chain_nc_f32_qdu8, "Elementwise Chain (NC, F32, QDU8)")
+XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_bf16, "Fully Connected (NC, BF16)")
 XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_f16, "Fully Connected (NC, F16)")
 XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_f32, "Fully Connected (NC, F32)")
 XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_f32_qc4w, "Fully Connected (NC, F32, QC4W)")
@@ -86,12 +91,17 @@ XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_qp8_f32_qb4w, "Fully Connecte
 XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_qs8, "Fully Connected (NC, QS8)")
 XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_qs8_qc8w, "Fully Connected (NC, QS8, QC8W)")
 XNN_ENUM_ITEM(xnn_operator_type_fully_connected_nc_qu8, "Fully Connected (NC, QU8)")
+XNN_ENUM_ITEM(xnn_operator_type_fully_connected_sparse_nc_f32, "Fully Connected Sparse (NC, F32)")
+XNN_ENUM_ITEM(xnn_operator_type_layer_norm_nc, "Layer Norm (NC)")
+XNN_ENUM_ITEM(xnn_operator_type_max_nd, "Max (ND)")
 XNN_ENUM_ITEM(xnn_operator_type_max_pooling_nhwc_f16, "Max Pooling (NHWC, F16)")
 XNN_ENUM_ITEM(xnn_operator_type_max_pooling_nhwc_f32, "Max Pooling (NHWC, F32)")
 XNN_ENUM_ITEM(xnn_operator_type_max_pooling_nhwc_s8, "Max Pooling (NHWC, S8)")
 XNN_ENUM_ITEM(xnn_operator_type_max_pooling_nhwc_u8, "Max Pooling (NHWC, U8)")
 XNN_ENUM_ITEM(xnn_operator_type_mean_nd, "Mean (ND)")
+XNN_ENUM_ITEM(xnn_operator_type_min_nd, "Min (ND)")
 XNN_ENUM_ITEM(xnn_operator_type_pack_lh_x32, "Pack LH (X32)")
+XNN_ENUM_ITEM(xnn_operator_type_prod_nd, "Prod (ND)")
 XNN_ENUM_ITEM(xnn_operator_type_reciprocal_square_root, "Reciprocal Square Root (NC)")
 XNN_ENUM_ITEM(xnn_operator_type_resize_bilinear_nchw_f16, "Resize Bilinear (NCHW, F16)")
 XNN_ENUM_ITEM(xnn_operator_type_resize_bilinear_nchw_f32, "Resize Bilinear (NCHW, F32)")
@@ -99,6 +109,7 @@ XNN_ENUM_ITEM(xnn_operator_type_resize_bilinear_nhwc_f16, "Resize Bilinear (NHWC
 XNN_ENUM_ITEM(xnn_operator_type_resize_bilinear_nhwc_f32, "Resize Bilinear (NHWC, F32)")
 XNN_ENUM_ITEM(xnn_operator_type_resize_bilinear_nhwc_s8, "Resize Bilinear (NHWC, S8)")
 XNN_ENUM_ITEM(xnn_operator_type_resize_bilinear_nhwc_u8, "Resize Bilinear (NHWC, U8)")
+XNN_ENUM_ITEM(xnn_operator_type_rms_norm_nc, "RMS Norm (NC)")
 XNN_ENUM_ITEM(xnn_operator_type_rope_nthc_f16, "RoPE (NTHC, F16)")
 XNN_ENUM_ITEM(xnn_operator_type_rope_nthc_f32, "RoPE (NTHC, F32)")
 XNN_ENUM_ITEM(xnn_operator_type_scaled_dot_product_attention_nhtc_f16, "Scaled Dot-Product Attention (NHTC, F16)")
@@ -67,6 +67,14 @@ XNN_INTERNAL uint32_t xnn_get_heuristic_mr_igemm(
 
 XNN_INTERNAL enum xnn_status xnn_destroy_operator(xnn_operator_t op);
 
+// Creates a copy of an operator which shares its read-only state (packed weights, lookup table, zero buffer allocated
+// at creation) with the original operator, and owns the state allocated when reshaping. The clone must be reshaped
+// before it is set up, and the original operator must outlive it.
+XNN_INTERNAL enum xnn_status xnn_clone_operator(const struct xnn_operator* op, xnn_operator_t* clone_out);
+
+// Returns a monotonic timestamp in nanoseconds, or 0 if the clock can't be read.
+XNN_INTERNAL uint64_t xnn_read_timer_ns(void);
+
 XNN_INTERNAL const char* xnn_unary_operator_to_string(enum xnn_unary_operator op);
 XNN_INTERNAL const char* xnn_binary_operator_to_string(enum xnn_binary_operator op);
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -59,6 +60,8 @@ struct xnn_ukernel_dwconv2d {
 
 struct xnn_ukernel_gemm {
   struct xnn_hmp_gemm_ukernel gemm_cases[XNN_MAX_MR];
+  // Accumulating microkernels used to split K between threads, NULL if not supported.
+  xnn_f32_gemminc_minmax_ukernel_fn gemminc_cases[XNN_MAX_MR];
   // Attention operator uses both types of packing.
   xnn_packw_gemm_goi_ukernel_fn packw_gemm_goi;
   xnn_packw_gemm_gio_ukernel_fn packw_gemm_gio;
@@ -83,6 +86,12 @@ struct xnn_ukernel_spmm {
   uint8_t mr;
 };
 
+struct xnn_ukernel_spgemm {
+  xnn_spgemm_ukernel_fn function;
+  uint8_t mr;
+  uint8_t nr;
+};
+
 struct xnn_ukernel_vmulcaddc {
   xnn_vmulcaddc_ukernel_fn function;
   uint8_t mr;
@@ -112,6 +121,7 @@ struct xnn_ukernel {
     };
     struct xnn_ukernel_igemm igemm;
     struct xnn_ukernel_spmm spmm;
+    struct xnn_ukernel_spgemm spgemm;
     struct xnn_ukernel_vmulcaddc vmulcaddc;
     struct xnn_ukernel_vbinary vbinary;
     struct xnn_ukernel_vunary vunary;
@@ -205,6 +215,9 @@ struct xnn_operator {
   size_t zero_size;
   void* lookup_table;
   void* pixelwise_buffer;
+  // Zero tile and partial accumulators of GEMMs which split K between threads.
+  void* k_split_buffer;
+  size_t k_split_buffer_size;
   struct subconvolution_params* subconvolution_buffer;
   uint32_t flags;
 
@@ -219,6 +232,7 @@ struct xnn_operator {
     struct {
       uint32_t log2_data_element_size;
       uint32_t log2_accumulator_element_size;
+      enum xnn_reduce_operator reduce_operator;
     } reduce;
   };
 
@@ -227,6 +241,7 @@ struct xnn_operator {
     union xnn_unary_uparams unary;
     struct xnn_f16_default_params f16_default;
     struct xnn_f32_default_params f32_default;
+    struct xnn_bf16_minmax_params bf16_minmax;
     union xnn_f16_minmax_params f16_minmax;
     struct xnn_f16_scaleminmax_params f16_scaleminmax;
     struct xnn_reduce_params reduce;
@@ -295,6 +310,8 @@ struct xnn_operator {
         struct {
           const struct xnn_raddstoreexpminusmax_config* raddstoreexpminusmax_config;
           const struct xnn_binary_elementwise_config* vmul_config;
+          // Two-pass online softmax, used for long rows when available.
+          const struct xnn_rmaxaddexp_config* rmaxaddexp_config;
         };
       };
     };  // For softmax operator.
@@ -325,6 +342,15 @@ struct xnn_operator {
       enum xnn_attention_logits_cap_type cap_type;
       struct xnn_attention_logits_cap_tanh_params cap_params;
     } attention;  // For attention operator.
+    struct {
+      const struct xnn_norm_config* config;
+      // For dynamically quantized outputs.
+      const struct xnn_reduce_config* rminmax_config;
+      const struct xnn_unary_elementwise_config* cvt_config;
+      float epsilon;
+      enum xnn_datatype input_datatype;
+      enum xnn_datatype output_datatype;
+    } norm;  // For layer norm and RMS norm operators.
     const struct xnn_pack_lh_config* pack_lh_config;
   };
 
@@ -340,6 +366,7 @@ struct xnn_operator {
       struct dwconv_indirection_init_context dwconv_indirection_init;
     } dwconv;
     struct elementwise_binary_context elementwise_binary;
+    struct elementwise_chain_context elementwise_chain;
     // PACKW GEMM GOI + GEMM are used together in Dynamic Fully Connected.
     struct {
       union {
@@ -348,6 +375,8 @@ struct xnn_operator {
       } gemm;
       struct packw_gemm_goi_context packw_gemm_goi;
       struct packw_gemm_gio_context packw_gemm_gio;
+      // Used by the first of several Fully Connected operators fused with xnn_fuse_fully_connected_nc_outputs.
+      struct gemm_multi_output_context multi_output;
       bool const_weights;
     } gemm;
     struct {
@@ -366,6 +395,7 @@ struct xnn_operator {
     };
     struct resize_bilinear_chw_context resize_bilinear_chw;
     struct slice_context slice;
+    struct spgemm_context spgemm;
     struct spmm_context spmm;
     struct subconv_context subconv;
     struct subgemm_context subgemm;
@@ -379,12 +409,20 @@ struct xnn_operator {
     struct univector_strided_context univector_strided;
     struct unpooling_context unpooling;
     struct vmulcaddc_context vmulcaddc;
+    struct norm_context norm;
     struct rope_context rope;
     struct x32_pack_lh_context x32_pack_lh;
   } context;
 
+  // Elementwise operations fused into the output of a FP32 GEMM-based operator, see xnn_fuse_gemm_epilogue_f32.
+  struct xnn_gemm_epilogue gemm_epilogue;
+  bool has_gemm_epilogue;
+
   struct xnn_code_cache* code_cache;
   xnn_weights_cache_t weights_cache;
+  // True if the packed weights, lookup table and creation-time zero buffer belong to the operator this operator was
+  // cloned from, see xnn_clone_operator.
+  bool shares_weights;
   enum xnn_run_state state;
 };
 
@@ -394,8 +432,58 @@ XNN_INTERNAL enum xnn_status xnn_run_operator_with_index(
   size_t operator_object_index,
   pthreadpool_t threadpool);
 
+// Runs the operator like xnn_run_operator_with_index, but dispatches every parallel tile separately to accumulate the
+// time spent by each thread of the thread pool in thread_busy_ns (which must have an element for each thread), and
+// returns the number of tiles that were run in num_tiles.
+XNN_INTERNAL enum xnn_status xnn_run_operator_with_profile(
+  xnn_operator_t op,
+  size_t opdata_index,
+  size_t operator_object_index,
+  pthreadpool_t threadpool,
+  uint64_t* thread_busy_ns,
+  size_t* num_tiles);
+
 XNN_INTERNAL enum xnn_operator_type xnn_reduce_operator_to_operator_type(enum xnn_reduce_operator op);
 
+// Return the config used by FP32 unary and binary elementwise operators, which is a reference config if there is no
+// optimized microkernel for the operation, or NULL if the operation is not supported.
+XNN_INTERNAL const struct xnn_unary_elementwise_config* xnn_init_f32_unary_elementwise_config(
+  enum xnn_unary_operator op_type);
+XNN_INTERNAL const struct xnn_binary_elementwise_config* xnn_init_f32_binary_elementwise_config(
+  enum xnn_binary_operator op_type);
+
+// Returns true if the activation can be fused into the epilogue of a FP32 GEMM-based operator.
+XNN_INTERNAL bool xnn_gemm_epilogue_supports_activation_f32(enum xnn_unary_operator activation);
+
+// Fuses elementwise operations into the output of a FP32 Fully Connected operator or of a non-grouped FP32 Convolution
+// operator which runs as GEMM or IGEMM. Each output tile C is updated as
+//   C := clamp(activation(C * scale + residual), output_min, output_max)
+// after the microkernel computed it. Scale has one element per output channel, residual has the shape of the output,
+// and both are passed to xnn_setup_gemm_epilogue_f32. Pass xnn_unary_invalid to skip the activation.
+XNN_INTERNAL enum xnn_status xnn_fuse_gemm_epilogue_f32(
+  xnn_operator_t op,
+  bool has_scale,
+  bool has_residual,
+  enum xnn_unary_operator activation,
+  const union xnn_unary_params* activation_params,
+  float output_min,
+  float output_max);
+
+// Sets the scale and residual inputs of the epilogue, must be called after setting up the operator.
+XNN_INTERNAL enum xnn_status xnn_setup_gemm_epilogue_f32(
+  xnn_operator_t op,
+  const float* scale,
+  const float* residual);
+
+// Fuses the GEMMs of reshaped Fully Connected operators with the same type, input and batch size into a single
+// parallel region over the concatenation of their output channels, which is run by the first operator while the other
+// operators do nothing. Must be called after reshaping all operators, and again after each reshape. Leaves the operators
+// unchanged if they can not be fused, e.g. if they have an epilogue.
+XNN_INTERNAL enum xnn_status xnn_fuse_fully_connected_nc_outputs(
+  xnn_operator_t* fully_connected_ops,
+  size_t num_ops,
+  pthreadpool_t threadpool);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
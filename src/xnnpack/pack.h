@@ -87,6 +87,36 @@ XNN_INTERNAL void xnn_pack_f16_gemm_goi_w(
   size_t extra_bytes,
   const void* params);
 
+typedef void (*xnn_pack_bf16_gemm_fn)(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const xnn_bfloat16* kernel,
+  const xnn_bfloat16* bias,
+  const void* scale,
+  xnn_bfloat16* packed_weights,
+  size_t extra_bytes,
+  const void* params);
+
+// The BF16 packing functions zero the padding of the last KR block, which the
+// BF16 dot-product microkernels multiply with the input.
+XNN_INTERNAL void xnn_pack_bf16_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const xnn_bfloat16* kernel,
+  const xnn_bfloat16* bias,
+  const void* scale,
+  xnn_bfloat16* packed_weights,
+  size_t extra_bytes,
+  const void* params);
+
 XNN_INTERNAL void xnn_pack_f32_to_f16_gemm_goi_w(
   size_t g,
   size_t nc,
@@ -320,6 +350,21 @@ XNN_INTERNAL void xnn_pack_f32_gemm_gio_w(
   size_t extra_bytes,
   const void* params);
 
+XNN_INTERNAL void xnn_pack_bf16_gemm_gio_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  size_t k_stride,
+  const xnn_bfloat16* kernel,
+  const xnn_bfloat16* bias,
+  const void* scale,
+  xnn_bfloat16* packed_weights,
+  size_t extra_bytes,
+  const void* params);
+
 XNN_INTERNAL void xnn_pack_f16_gemm_gio_w(
   size_t g,
   size_t nc,
@@ -1440,6 +1485,49 @@ XNN_INTERNAL enum xnn_status xnn_pack_f16_spmm_w(
   xnn_float16* nonzero_values,
   size_t* first_input_channel);
 
+// Sparse packing functions for Fully Connected operators on NC-layout inputs.
+// Weights are packed in tiles of NR output channels. tile_offsets receives the
+// byte offset of each tile within packed_weights.
+
+struct xnn_spgemm_packing_params {
+  // Number of (input channel, NR-wide output channel tile) blocks that contain
+  // at least one non-zero weight.
+  size_t num_nonzero_blocks;
+  // Whether every output channel has at most 2 non-zero weights in each group
+  // of 4 consecutive input channels.
+  bool is_2of4;
+};
+
+XNN_INTERNAL void xnn_analyze_f32_spgemm_w(
+  size_t output_channels,
+  size_t input_channels,
+  size_t nr,
+  const float* kernel,
+  struct xnn_spgemm_packing_params* params);
+
+// Each tile holds NR biases, the number of non-zero blocks, and for each
+// non-zero block the byte offset of its input channel followed by NR weights.
+XNN_INTERNAL void xnn_pack_f32_spgemm_w(
+  size_t output_channels,
+  size_t input_channels,
+  size_t nr,
+  const float* kernel,
+  const float* bias,
+  uint32_t* tile_offsets,
+  void* packed_weights);
+
+// Each tile holds NR biases and, for each group of 4 input channels, 2 x NR
+// weights followed by 2 x NR byte-sized positions of those weights within the
+// group. Requires the kernel to satisfy the 2:4 pattern.
+XNN_INTERNAL void xnn_pack_f32_spgemm_2of4_w(
+  size_t output_channels,
+  size_t input_channels,
+  size_t nr,
+  const float* kernel,
+  const float* bias,
+  uint32_t* tile_offsets,
+  void* packed_weights);
+
 
 #ifdef __cplusplus
 }  // extern "C"
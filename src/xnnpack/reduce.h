@@ -241,6 +241,25 @@ DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__wasmsimd_pminmax_u12_a
 DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__wasmsimd_pminmax_u16_acc2)
 DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rmin_ukernel__wasmsimd_pminmax_u16_acc4)
 
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__avx_u8)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__avx_u16_acc2)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__avx_u32_acc4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__avx512f_u16)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__avx512f_u32_acc2)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__avx512f_u64_acc4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__neon_u4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__neon_u8_acc2)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__neon_u16_acc4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__scalar_u1)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__scalar_u2_acc2)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__scalar_u4_acc4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__sse2_u4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__sse2_u8_acc2)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__sse2_u16_acc4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__wasmsimd_u4)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__wasmsimd_u8_acc2)
+DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rprod_ukernel__wasmsimd_u16_acc4)
+
 DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_u8)
 DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_u16_acc2)
 DECLARE_F32_REDUCE_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_u24_acc3)
@@ -476,6 +495,71 @@ DECLARE_F16_F32ACC_RDSUM_UKERNEL_FUNCTION(xnn_f16_f32acc_rdsum_ukernel_7p7x__neo
 DECLARE_F16_F32ACC_RDSUM_UKERNEL_FUNCTION(xnn_f16_f32acc_rdsum_ukernel_7p7x__neonfp16arith_c32)
 DECLARE_F16_F32ACC_RDSUM_UKERNEL_FUNCTION(xnn_f16_f32acc_rdsum_ukernel_7p7x__neonfp16arith_c64)
 
+#define DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                          \
+      size_t rows,                                    \
+      size_t channels,                                \
+      const float* input,                             \
+      size_t input_stride,                            \
+      const float* zero,                              \
+      float* output,                                  \
+      const struct xnn_f32_default_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__avx_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__avx512f_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__neon_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__sse2_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__sse2_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__wasmsimd_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_7p7x__wasmsimd_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__avx_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__avx512f_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__neon_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__sse2_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__sse2_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__wasmsimd_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdmin_ukernel_7p7x__wasmsimd_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__avx_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__avx_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__avx512f_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__avx512f_c64)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__neon_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__neon_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__scalar_c4)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__sse2_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__sse2_c32)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__wasmsimd_c16)
+DECLARE_F32_RDREDUCE_UKERNEL_FUNCTION(xnn_f32_rdprod_ukernel_7p7x__wasmsimd_c32)
+
+#define DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                          \
+      size_t rows,                                    \
+      size_t channels,                                \
+      const xnn_float16* input,                       \
+      size_t input_stride,                            \
+      const xnn_float16* zero,                        \
+      xnn_float16* output,                            \
+      const struct xnn_f16_default_params params[XNN_RESTRICT XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmax_ukernel_7p7x__f16c_c16)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmax_ukernel_7p7x__f16c_c32)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmax_ukernel_7p7x__neonfp16arith_c16)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmax_ukernel_7p7x__neonfp16arith_c32)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmax_ukernel_7p7x__scalar_c2)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmin_ukernel_7p7x__f16c_c16)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmin_ukernel_7p7x__f16c_c32)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32)
+DECLARE_F16_RDREDUCE_UKERNEL_FUNCTION(xnn_f16_rdmin_ukernel_7p7x__scalar_c2)
+
 #define DECLARE_QS8_RDSUM_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                        \
       size_t rows,                                  \
@@ -0,0 +1,41 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "xnnpack/common.h"
+#include "xnnpack/microparams.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t n,                                                  \
+      const xnn_float16* input,                                  \
+      float* max,                                                \
+      float* sum,                                                \
+      const void* params);
+#include "f16-rmaxaddexp/f16-rmaxaddexp.h"
+#undef XNN_UKERNEL
+
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                                     \
+      size_t n,                                                  \
+      const float* input,                                        \
+      float* max,                                                \
+      float* sum,                                                \
+      const void* params);
+#include "f32-rmaxaddexp/f32-rmaxaddexp.h"
+#undef XNN_UKERNEL
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
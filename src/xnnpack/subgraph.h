@@ -13,7 +13,9 @@
 #include "xnnpack/cache.h"
 #include "xnnpack/common.h"
 #include "xnnpack/config-types.h"
+#include "xnnpack/internal.h"
 #include "xnnpack/math.h"
+#include "xnnpack/mutex.h"
 #include "xnnpack/node-type.h"
 #include "pthreadpool.h"
 
@@ -25,12 +27,13 @@
 #include <time.h>
 #endif
 
-#define XNN_MAX_INPUTS 5
+#define XNN_MAX_INPUTS 7
 #define XNN_MAX_OUTPUTS 4
 
 #define XNN_INVALID_NODE_ID UINT32_MAX
 
 #define XNN_MAX_OPERATOR_OBJECTS 5
+#define XNN_MAX_RESHAPE_PLANS 8
 #define XNN_MAX_SUBGRAPH_INPUT_OR_OUTPUTS 16
 
 /// Disable fusion of nodes in subgraph. Fusion is enabled by default, set this flag to turn it off.
@@ -155,6 +158,11 @@ struct xnn_value {
   // If not NULL, points to the original fp32 data, (which should be `data` before it was overwritten to point to
   // converted fp16 buffer.
   const void* fp32_data;
+  /// Token position at which a KV Cache Append Node writes new rows into this Value. Set by xnn_set_kv_cache_position.
+  size_t kv_cache_position;
+  /// Number of valid tokens in this Value after the last reshape of the KV Cache Append Node writing into it, or 0 if
+  /// the Value is not a KV cache.
+  size_t kv_cache_tokens;
 };
 
 
@@ -210,6 +218,20 @@ typedef enum xnn_status (*xnn_setup_operator_fn)(
   size_t num_values,
   pthreadpool_t threadpool);
 
+// Elementwise Nodes fused by xnn_subgraph_fusion into the epilogue of a FP32 Fully Connected or Convolution 2D Node,
+// see xnn_fuse_gemm_epilogue_f32. The scale and residual Values are appended to the inputs of the Node, in this order.
+struct xnn_node_epilogue {
+  bool enabled;
+  uint32_t num_inputs;
+  uint32_t scale_id;
+  uint32_t residual_id;
+  // xnn_unary_invalid if there is no fused activation.
+  enum xnn_unary_operator activation;
+  union xnn_unary_params activation_params;
+  float output_min;
+  float output_max;
+};
+
 struct xnn_node {
   enum xnn_node_type type;
   union {
@@ -274,6 +296,9 @@ struct xnn_node {
     struct {
       int32_t axis;
     } even_split;
+    struct {
+      float epsilon;
+    } norm;
     struct {
       uint32_t padding_top;
       uint32_t padding_right;
@@ -325,11 +350,16 @@ struct xnn_node {
     struct {
       const struct xnn_gemm_config* gemm_config;
     } lhs_packing;
+    struct {
+      size_t num_ops;
+      struct xnn_elementwise_chain_op ops[XNN_MAX_ELEMENTWISE_CHAIN_OPS];
+    } elementwise_chain;
   } params;
   struct {
     float output_min;
     float output_max;
   } activation;
+  struct xnn_node_epilogue epilogue;
   /// Value IDs for node inputs.
   uint32_t inputs[XNN_MAX_INPUTS];
   uint32_t num_inputs;
@@ -357,16 +387,6 @@ struct xnn_node {
   xnn_setup_operator_fn setup;
 };
 
-#ifdef __MACH__
-typedef uint64_t xnn_timestamp;
-#elif __EMSCRIPTEN__
-typedef double xnn_timestamp;
-#elif XNN_PLATFORM_WINDOWS
-typedef LARGE_INTEGER xnn_timestamp;
-#else
-typedef struct timespec xnn_timestamp;
-#endif
-
 struct xnn_operator_data {
   enum xnn_node_type type;
   uint32_t id;
@@ -410,11 +430,13 @@ struct xnn_operator_data {
   };
   uint32_t adjustment_height;
   uint32_t adjustment_width;
+  struct xnn_node_epilogue epilogue;
   uint32_t num_inputs;
   uint32_t inputs[XNN_MAX_INPUTS];
   uint32_t num_outputs;
   uint32_t outputs[XNN_MAX_OUTPUTS];
-  xnn_timestamp end_ts[XNN_MAX_OPERATOR_OBJECTS];
+  // Timestamps in nanoseconds, see xnn_read_timer_ns.
+  uint64_t end_ts[XNN_MAX_OPERATOR_OBJECTS];
   void* workspace;
   size_t workspace_size;
   size_t workspace_alignment;
@@ -435,6 +457,42 @@ struct xnn_subgraph {
   struct xnn_node* nodes;
 };
 
+/// Shape-dependent state of a Value in a reshape plan.
+struct xnn_reshape_plan_value {
+  struct xnn_shape shape;
+  size_t size;
+  size_t kv_cache_position;
+  size_t kv_cache_tokens;
+  /// Offsets of the data and of the dynamic quantization parameters in the workspace, for Values allocated in the
+  /// workspace.
+  size_t data_offset;
+  size_t dynamic_params_offset;
+};
+
+/// Snapshot of the state of a Runtime after reshaping it, see XNN_FLAG_CACHE_RESHAPE_PLANS. The shapes of the external
+/// inputs and the KV cache positions of the persistent Values in the snapshot are the key of the plan.
+struct xnn_reshape_plan {
+  /// Values of the Runtime, NULL if this plan is unused.
+  struct xnn_reshape_plan_value* values;
+  /// Operator data of the Runtime.
+  struct xnn_operator_data* opdata;
+  /// Offsets of the operator workspaces in the workspace, SIZE_MAX for operators without a workspace.
+  size_t* workspace_offsets;
+  /// Operator objects of the Runtime, in order of opdata.
+  struct xnn_operator* operators;
+  size_t workspace_size;
+  size_t persistent_size;
+  uint64_t last_used;
+};
+
+struct xnn_operator_trace {
+  // Start and end of the operator, in nanoseconds since the start of the invocation.
+  uint64_t start_ns;
+  uint64_t end_ns;
+  // Number of parallel tiles the operator was split into.
+  size_t num_tiles;
+};
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 struct xnn_runtime {
   uint32_t num_external_values;
@@ -450,16 +508,56 @@ struct xnn_runtime {
   struct xnn_workspace* workspace;
   struct xnn_runtime* next_workspace_user;
 
+  // Runtime this Runtime was cloned from (NULL otherwise). Static data and packed weights are owned by the source.
+  struct xnn_runtime* clone_source;
+  /// Number of clones of this Runtime which have not been deleted.
+  size_t num_clones;
+  /// Protects num_clones, as clones may be created and deleted concurrently on different threads.
+  struct xnn_mutex clones_mutex;
+
   pthreadpool_t threadpool;
 
+  // Execution stages, used only if XNN_FLAG_INTER_OPERATOR_PARALLELISM was specified (NULL otherwise). Operators in
+  // the same stage do not depend on each other, and each stage only depends on the preceding stages.
+  /// Stage of each operator in opdata.
+  uint32_t* op_stage;
+  /// Indices of operators in opdata, sorted by stage. Removed operators are not included.
+  uint32_t* stage_ops;
+  /// Offset of the first operator of each stage in stage_ops, with an extra entry for the end of the last stage.
+  uint32_t* stage_offsets;
+  /// Number of execution stages.
+  size_t num_stages;
+  /// Status of each operator of the stage being executed concurrently.
+  enum xnn_status* stage_status;
+
+  // Reshape plans memoized by the shapes of the external inputs, used only if XNN_FLAG_CACHE_RESHAPE_PLANS was
+  // specified (NULL otherwise).
+  struct xnn_reshape_plan* reshape_plans;
+  /// Number of operator objects in opdata, i.e. number of operators in each reshape plan.
+  size_t num_operator_objects;
+  /// Incremented on every reshape, used to evict the least recently used reshape plan.
+  uint64_t reshape_plan_clock;
+
   bool profiling;
-  // The start timestamp of the first operator in the subgraph. This is set when profiling is true.
-  xnn_timestamp start_ts;
+  // The start timestamp in nanoseconds of the first operator in the subgraph. This is set when profiling is true.
+  uint64_t start_ts;
+
+  // Per operator object timings of the last invocation, recorded only if XNN_FLAG_DETAILED_PROFILING was specified
+  // (NULL otherwise). Both arrays are indexed by opdata index * XNN_MAX_OPERATOR_OBJECTS + operator object index, and
+  // thread_busy_ns has num_profiled_threads elements for each operator object.
+  struct xnn_operator_trace* operator_traces;
+  uint64_t* thread_busy_ns;
+  size_t num_profiled_threads;
+  // Timestamp of the start of the last invocation in nanoseconds, operator traces are relative to it.
+  uint64_t trace_start_ns;
 
   // True if runtime has ever been setup. If it has been setup, the pointers inside of opdata need to be updated if
   // workspace changes.
   bool has_been_setup;
   bool memory_planned;
+  // True if some values were planned as views into the memory of other values. The offsets of the views depend on the
+  // shapes of the values, so memory needs to be planned again whenever the runtime is reshaped.
+  bool has_views;
 
   #ifdef XNN_SLINKY_AVAILABLE
   // Fields used by Slinky -- unused unless XNN_FLAG_SLINKY_ENABLED is set
@@ -556,6 +654,16 @@ void xnn_init_convert_node(
   uint32_t output_id,
   uint32_t flags);
 
+// Turns the Node into an Elementwise Chain Node applying node->params.elementwise_chain to its inputs. The first input
+// has the shape of the output, and other inputs have either the same shape or a single element. The output is FP32, or
+// dynamically quantized to QD8 or QDU8.
+void xnn_init_elementwise_chain_node(struct xnn_node* node);
+
+// Turns the Node into a Multi-Output Fully Connected Node, which computes several Fully Connected Nodes with the same
+// input, flags and activation in a single parallel region. Its inputs are the shared input followed by the filter and
+// the optional bias of each Fully Connected Node, and it has one output per Fully Connected Node.
+void xnn_init_fully_connected_multi_output_node(struct xnn_node* node);
+
 struct xnn_workspace {
   void* data;
   size_t size;
@@ -574,6 +682,21 @@ enum xnn_status resize_fully_connected_output_tensor(
   size_t old_workspace_size,
   pthreadpool_t threadpool);
 
+// Fuses the epilogue of a Fully Connected or Convolution 2D Node, if any, into the operator created for the Node.
+enum xnn_status xnn_create_node_epilogue(
+  const struct xnn_node_epilogue* epilogue,
+  struct xnn_operator* op);
+
+// Checks that the residual input of the epilogue, if any, has the shape of the output of the operator.
+enum xnn_status xnn_reshape_node_epilogue(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values);
+
+// Passes the inputs of the epilogue, if any, to the operator after it was set up.
+enum xnn_status xnn_setup_node_epilogue(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_value* values);
+
 XNN_INTERNAL enum xnn_node_type xnn_reduce_operator_to_node_type(enum xnn_reduce_operator type);
 XNN_INTERNAL enum xnn_reduce_operator xnn_node_type_to_reduce_operator(enum xnn_node_type type);
 
@@ -9,11 +9,22 @@
 #include <stdint.h>
 
 #include "xnnpack/common.h"
+#include "xnnpack/microparams.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
+  XNN_INTERNAL void fn_name(                               \
+      size_t n,                                            \
+      const xnn_float16* input,                            \
+      xnn_float16* output,                                 \
+      float scale,                                         \
+      float max);
+#include "f16-vscaleexpminusmax/f16-vscaleexpminusmax.h"
+#undef XNN_UKERNEL
+
 #define XNN_UKERNEL(arch_flags, fn_name, element_tile, datatype) \
   XNN_INTERNAL void fn_name(                               \
       size_t n,                                            \
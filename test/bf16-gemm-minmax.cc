@@ -296,7 +296,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_1x4c8__neonfma_shland,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -316,7 +316,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_2x4c8__neonfma_shland,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -336,7 +336,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_3x4c8__neonfma_shland,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -356,7 +356,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_4x4c8__neonfma_shland,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -376,7 +376,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_5x4c8__neonfma_shland,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -396,7 +396,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_1x4c8__neonfma_zip,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -416,7 +416,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_2x4c8__neonfma_zip,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -436,7 +436,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_3x4c8__neonfma_zip,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -456,7 +456,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_4x4c8__neonfma_zip,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -476,7 +476,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_5x4c8__neonfma_zip,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_FMA;
@@ -499,7 +499,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_1x8c2__neonbf16_bfdot_lane_ld128,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -519,7 +519,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_4x8c2__neonbf16_bfdot_lane_ld128,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -539,7 +539,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_5x8c2__neonbf16_bfdot_lane_ld128,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -559,7 +559,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_6x8c2__neonbf16_bfdot_lane_ld128,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -579,7 +579,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_1x4c8__neonbf16_bfdot,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -599,7 +599,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_2x4c8__neonbf16_bfdot,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -619,7 +619,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_3x4c8__neonbf16_bfdot,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -639,7 +639,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_4x4c8__neonbf16_bfdot,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -659,7 +659,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_5x4c8__neonbf16_bfdot,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -679,7 +679,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_1x4c8__neonbf16_bfmlal,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -699,7 +699,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_2x4c8__neonbf16_bfmlal,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -719,7 +719,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_3x4c8__neonbf16_bfmlal,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -739,7 +739,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_4x4c8__neonbf16_bfmlal,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -759,7 +759,7 @@ std::vector<GemmTestParams> CreateTests1(
           [](GemmMicrokernelTester& tester) {
             tester.Test(xnn_bf16_gemm_minmax_ukernel_5x4c8__neonbf16_bfmlal,
                         xnn_init_bf16_minmax_scalar_params,
-                        xnn_pack_f16_gemm_goi_w);
+                        xnn_pack_bf16_gemm_goi_w);
           },
           []() {
             TEST_REQUIRES_ARM_NEON_BF16;
@@ -768,3 +768,126 @@ std::vector<GemmTestParams> CreateTests1(
         return info.param.test_name;
       });
 #endif  // XNN_ENABLE_ARM_BF16 && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+
+
+#if XNN_ENABLE_AVX512BF16 && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  INSTANTIATE_TEST_SUITE_P(
+      BF16_GEMM_MINMAX_1X16C2__AVX512BF16_BROADCAST, GemmTest,
+      testing::ValuesIn(CreateTests1(
+          /*k_block=*/2,
+          /*adj_k_block=*/2,
+          /*mr=*/1, /*nr=*/16, /*kr=*/2, /*sr=*/1,
+          /*is_igemm=*/false,
+          /*unsigned_inputs=*/false,
+          [](GemmMicrokernelTester& tester) {
+            tester.Test(xnn_bf16_gemm_minmax_ukernel_1x16c2__avx512bf16_broadcast,
+                        xnn_init_bf16_minmax_scalar_params,
+                        xnn_pack_bf16_gemm_goi_w);
+          },
+          []() {
+            TEST_REQUIRES_X86_AVX512BF16;
+          })),
+      [](const testing::TestParamInfo<GemmTest::ParamType>& info) {
+        return info.param.test_name;
+      });
+
+  INSTANTIATE_TEST_SUITE_P(
+      BF16_GEMM_MINMAX_4X16C2__AVX512BF16_BROADCAST, GemmTest,
+      testing::ValuesIn(CreateTests1(
+          /*k_block=*/2,
+          /*adj_k_block=*/2,
+          /*mr=*/4, /*nr=*/16, /*kr=*/2, /*sr=*/1,
+          /*is_igemm=*/false,
+          /*unsigned_inputs=*/false,
+          [](GemmMicrokernelTester& tester) {
+            tester.Test(xnn_bf16_gemm_minmax_ukernel_4x16c2__avx512bf16_broadcast,
+                        xnn_init_bf16_minmax_scalar_params,
+                        xnn_pack_bf16_gemm_goi_w);
+          },
+          []() {
+            TEST_REQUIRES_X86_AVX512BF16;
+          })),
+      [](const testing::TestParamInfo<GemmTest::ParamType>& info) {
+        return info.param.test_name;
+      });
+
+  INSTANTIATE_TEST_SUITE_P(
+      BF16_GEMM_MINMAX_7X16C2__AVX512BF16_BROADCAST, GemmTest,
+      testing::ValuesIn(CreateTests1(
+          /*k_block=*/2,
+          /*adj_k_block=*/2,
+          /*mr=*/7, /*nr=*/16, /*kr=*/2, /*sr=*/1,
+          /*is_igemm=*/false,
+          /*unsigned_inputs=*/false,
+          [](GemmMicrokernelTester& tester) {
+            tester.Test(xnn_bf16_gemm_minmax_ukernel_7x16c2__avx512bf16_broadcast,
+                        xnn_init_bf16_minmax_scalar_params,
+                        xnn_pack_bf16_gemm_goi_w);
+          },
+          []() {
+            TEST_REQUIRES_X86_AVX512BF16;
+          })),
+      [](const testing::TestParamInfo<GemmTest::ParamType>& info) {
+        return info.param.test_name;
+      });
+
+  INSTANTIATE_TEST_SUITE_P(
+      BF16_GEMM_MINMAX_1X32C2__AVX512BF16_BROADCAST, GemmTest,
+      testing::ValuesIn(CreateTests1(
+          /*k_block=*/2,
+          /*adj_k_block=*/2,
+          /*mr=*/1, /*nr=*/32, /*kr=*/2, /*sr=*/1,
+          /*is_igemm=*/false,
+          /*unsigned_inputs=*/false,
+          [](GemmMicrokernelTester& tester) {
+            tester.Test(xnn_bf16_gemm_minmax_ukernel_1x32c2__avx512bf16_broadcast,
+                        xnn_init_bf16_minmax_scalar_params,
+                        xnn_pack_bf16_gemm_goi_w);
+          },
+          []() {
+            TEST_REQUIRES_X86_AVX512BF16;
+          })),
+      [](const testing::TestParamInfo<GemmTest::ParamType>& info) {
+        return info.param.test_name;
+      });
+
+  INSTANTIATE_TEST_SUITE_P(
+      BF16_GEMM_MINMAX_4X32C2__AVX512BF16_BROADCAST, GemmTest,
+      testing::ValuesIn(CreateTests1(
+          /*k_block=*/2,
+          /*adj_k_block=*/2,
+          /*mr=*/4, /*nr=*/32, /*kr=*/2, /*sr=*/1,
+          /*is_igemm=*/false,
+          /*unsigned_inputs=*/false,
+          [](GemmMicrokernelTester& tester) {
+            tester.Test(xnn_bf16_gemm_minmax_ukernel_4x32c2__avx512bf16_broadcast,
+                        xnn_init_bf16_minmax_scalar_params,
+                        xnn_pack_bf16_gemm_goi_w);
+          },
+          []() {
+            TEST_REQUIRES_X86_AVX512BF16;
+          })),
+      [](const testing::TestParamInfo<GemmTest::ParamType>& info) {
+        return info.param.test_name;
+      });
+
+  INSTANTIATE_TEST_SUITE_P(
+      BF16_GEMM_MINMAX_7X32C2__AVX512BF16_BROADCAST, GemmTest,
+      testing::ValuesIn(CreateTests1(
+          /*k_block=*/2,
+          /*adj_k_block=*/2,
+          /*mr=*/7, /*nr=*/32, /*kr=*/2, /*sr=*/1,
+          /*is_igemm=*/false,
+          /*unsigned_inputs=*/false,
+          [](GemmMicrokernelTester& tester) {
+            tester.Test(xnn_bf16_gemm_minmax_ukernel_7x32c2__avx512bf16_broadcast,
+                        xnn_init_bf16_minmax_scalar_params,
+                        xnn_pack_bf16_gemm_goi_w);
+          },
+          []() {
+            TEST_REQUIRES_X86_AVX512BF16;
+          })),
+      [](const testing::TestParamInfo<GemmTest::ParamType>& info) {
+        return info.param.test_name;
+      });
+#endif  // XNN_ENABLE_AVX512BF16 && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
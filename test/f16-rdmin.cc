@@ -0,0 +1,1114 @@
+// Copyright 2024 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f16-rdmin.yaml
+//   Generator: tools/generate-rdsum-test.py
+
+
+#include <gtest/gtest.h>
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microparams-init.h"
+#include "xnnpack/reduce.h"
+#include "rdsum-microkernel-tester.h"
+
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_eq_2_2pass_fulltile) {
+  const size_t channel_tile = 2;
+  RDSumMicrokernelTester()
+    .rows(14)
+    .channels(channel_tile)
+    .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_eq_2_2pass_fulltile_with_input_stride) {
+  const size_t channel_tile = 2;
+  RDSumMicrokernelTester()
+    .rows(14)
+    .channels(channel_tile)
+    .input_stride(5)
+    .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_eq_2_2pass_subtile) {
+  const size_t channel_tile = 2;
+  for (size_t rows = 1; rows < 14; rows++) {
+    RDSumMicrokernelTester()
+      .rows(rows)
+      .channels(channel_tile)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_eq_2_2pass_subtile_with_input_stride) {
+  const size_t channel_tile = 2;
+  for (size_t rows = 1; rows < 14; rows++) {
+    RDSumMicrokernelTester()
+      .rows(rows)
+      .channels(channel_tile)
+      .input_stride(5)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_eq_2_multipass_fulltile) {
+  const size_t channel_tile = 2;
+  for (size_t rows = 1; rows <= 35; rows += 7) {
+    RDSumMicrokernelTester()
+      .rows(rows)
+      .channels(channel_tile)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_eq_2_multipass_fulltile_with_input_stride) {
+  const size_t channel_tile = 2;
+  for (size_t rows = 1; rows <= 35; rows += 7) {
+    RDSumMicrokernelTester()
+      .rows(rows)
+      .channels(channel_tile)
+      .input_stride(5)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_div_2_2pass_fulltile) {
+  for (size_t channels = 4; channels < 16; channels += 2) {
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channels)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_div_2_2pass_subtile) {
+  for (size_t channels = 4; channels < 16; channels += 2) {
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_div_2_multipass_fulltile) {
+  for (size_t channels = 4; channels < 16; channels += 2) {
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_div_2_multipass_fulltile_with_input_stride) {
+  for (size_t channels = 4; channels < 16; channels += 2) {
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .input_stride(37)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_lt_2_2pass_fulltile) {
+  const size_t channel_tile = 2;
+  for (size_t channels = 1; channels < channel_tile; channels++) {
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channels)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_lt_2_2pass_subtile) {
+  const size_t channel_tile = 2;
+  for (size_t channels = 1; channels < channel_tile; channels++) {
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_lt_2_multipass_fulltile) {
+  const size_t channel_tile = 2;
+  for (size_t channels = 1; channels < channel_tile; channels++) {
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_lt_2_multipass_fulltile_with_input_stride) {
+  const size_t channel_tile = 2;
+  for (size_t channels = 1; channels < channel_tile; channels++) {
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .input_stride(5)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_gt_2_2pass_fulltile) {
+  for (size_t channels = 3; channels < 4; channels++) {
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channels)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_gt_2_2pass_subtile) {
+  for (size_t channels = 3; channels < 4; channels++) {
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_gt_2_multipass_fulltile) {
+  for (size_t channels = 3; channels < 4; channels++) {
+    for (size_t rows = 1; rows < 35; rows += 14) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, channels_gt_2_multipass_fulltile_with_input_stride) {
+  for (size_t channels = 3; channels < 4; channels++) {
+    for (size_t rows = 1; rows < 35; rows += 14) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .input_stride(17)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+}
+
+TEST(F16_RDMIN_7P7X__SCALAR_C2, overflow_accumulator) {
+  const size_t channel_tile = 2;
+  for (size_t channels = 1; channels < channel_tile*2; ++channels) {
+     RDSumMicrokernelTester()
+       .rows(264)
+       .channels(channels)
+       .Test(xnn_f16_rdmin_ukernel_7p7x__scalar_c2, RDSumMicrokernelTester::OpType::Min);
+  }
+}
+
+#if XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_eq_16_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_eq_16_2pass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .input_stride(19)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_eq_16_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_eq_16_2pass_subtile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(19)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_eq_16_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_eq_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(19)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_div_16_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_div_16_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_div_16_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_div_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(263)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_lt_16_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_lt_16_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_lt_16_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_lt_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(19)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_gt_16_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_gt_16_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 17; channels < 32; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_gt_16_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 17; channels < 32; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, channels_gt_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 17; channels < 32; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(47)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C16, overflow_accumulator) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile*2; ++channels) {
+       RDSumMicrokernelTester()
+         .rows(264)
+         .channels(channels)
+         .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+#endif  // XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+
+
+#if XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_eq_32_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_eq_32_2pass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .input_stride(37)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_eq_32_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_eq_32_2pass_subtile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(37)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_eq_32_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_eq_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(37)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_div_32_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_div_32_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_div_32_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_div_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(521)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_lt_32_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_lt_32_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_lt_32_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_lt_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(37)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_gt_32_2pass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 33; channels < 64; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_gt_32_2pass_subtile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 33; channels < 64; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_gt_32_multipass_fulltile) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 33; channels < 64; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, channels_gt_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    for (size_t channels = 33; channels < 64; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(79)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__NEONFP16ARITH_C32, overflow_accumulator) {
+    TEST_REQUIRES_ARM_NEON_FP16_ARITH;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile*2; ++channels) {
+       RDSumMicrokernelTester()
+         .rows(264)
+         .channels(channels)
+         .Test(xnn_f16_rdmin_ukernel_7p7x__neonfp16arith_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+#endif  // XNN_ENABLE_ARM_FP16_VECTOR && (XNN_ARCH_ARM || XNN_ARCH_ARM64)
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_eq_16_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_eq_16_2pass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .input_stride(19)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_eq_16_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_eq_16_2pass_subtile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(19)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_eq_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_eq_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(19)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_div_16_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_div_16_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_div_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_div_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(263)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_lt_16_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_lt_16_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_lt_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_lt_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(19)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_gt_16_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_gt_16_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 17; channels < 32; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_gt_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 17; channels < 32; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, channels_gt_16_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 17; channels < 32; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(47)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C16, overflow_accumulator) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 16;
+    for (size_t channels = 1; channels < channel_tile*2; ++channels) {
+       RDSumMicrokernelTester()
+         .rows(264)
+         .channels(channels)
+         .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c16, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_eq_32_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_eq_32_2pass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    RDSumMicrokernelTester()
+      .rows(14)
+      .channels(channel_tile)
+      .input_stride(37)
+      .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_eq_32_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_eq_32_2pass_subtile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows < 14; rows++) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(37)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_eq_32_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_eq_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t rows = 1; rows <= 35; rows += 7) {
+      RDSumMicrokernelTester()
+        .rows(rows)
+        .channels(channel_tile)
+        .input_stride(37)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_div_32_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_div_32_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_div_32_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_div_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 64; channels < 256; channels += 32) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(521)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_lt_32_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_lt_32_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_lt_32_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_lt_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile; channels++) {
+      for (size_t rows = 1; rows <= 35; rows += 7) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(37)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_gt_32_2pass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 33; channels < 64; channels++) {
+      RDSumMicrokernelTester()
+        .rows(14)
+        .channels(channels)
+        .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_gt_32_2pass_subtile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 33; channels < 64; channels++) {
+      for (size_t rows = 1; rows < 14; rows++) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_gt_32_multipass_fulltile) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 33; channels < 64; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, channels_gt_32_multipass_fulltile_with_input_stride) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t channels = 33; channels < 64; channels++) {
+      for (size_t rows = 1; rows < 35; rows += 14) {
+        RDSumMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(79)
+          .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+      }
+    }
+  }
+
+  TEST(F16_RDMIN_7P7X__F16C_C32, overflow_accumulator) {
+    TEST_REQUIRES_X86_F16C;
+    const size_t channel_tile = 32;
+    for (size_t channels = 1; channels < channel_tile*2; ++channels) {
+       RDSumMicrokernelTester()
+         .rows(264)
+         .channels(channels)
+         .Test(xnn_f16_rdmin_ukernel_7p7x__f16c_c32, RDSumMicrokernelTester::OpType::Min);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
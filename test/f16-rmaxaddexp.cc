@@ -0,0 +1,172 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+//   Specification: f16-rmaxaddexp
+
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "replicable_random_device.h"
+#include "xnnpack.h"
+#include "xnnpack/buffer.h"
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/rmaxaddexp.h"
+
+class RMaxAddExpMicrokernelTester {
+public:
+  RMaxAddExpMicrokernelTester& elements(size_t elements)
+  {
+    assert(elements != 0);
+    this->elements_ = elements;
+    return *this;
+  }
+
+  size_t elements() const { return this->elements_; }
+
+  // Inputs grow by this amount with every element, so that the maximum keeps
+  // increasing and the running sum has to be rescaled.
+  RMaxAddExpMicrokernelTester& slope(float slope)
+  {
+    this->slope_ = slope;
+    return *this;
+  }
+
+  float slope() const { return this->slope_; }
+
+  // Every element with an index divisible by this number is -inf.
+  RMaxAddExpMicrokernelTester& infinity_stride(size_t infinity_stride)
+  {
+    this->infinity_stride_ = infinity_stride;
+    return *this;
+  }
+
+  size_t infinity_stride() const { return this->infinity_stride_; }
+
+  RMaxAddExpMicrokernelTester& iterations(size_t iterations)
+  {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  size_t iterations() const { return this->iterations_; }
+
+  void Test(xnn_f16_rmaxaddexp_ukernel_fn rmaxaddexp) const
+  {
+    xnnpack::ReplicableRandomDevice rng;
+    // Choose such range that expf(x[i]) overflows, but expf(x[i] - x_max) doesn't.
+    auto f32rng = [&rng]() { return std::uniform_real_distribution<float>(90.0f, 100.0f)(rng); };
+
+    xnnpack::Buffer<xnn_float16> x(elements() + XNN_EXTRA_BYTES / sizeof(xnn_float16));
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      for (size_t i = 0; i < elements(); i++) {
+        x[i] = static_cast<xnn_float16>(static_cast<float>(x[i]) + slope() * float(i));
+      }
+      if (infinity_stride() != 0) {
+        // Keep the last element finite, so that the sum is non-zero.
+        for (size_t i = 0; i + 1 < elements(); i += infinity_stride()) {
+          x[i] = static_cast<xnn_float16>(-std::numeric_limits<float>::infinity());
+        }
+      }
+
+      // Compute reference results.
+      float max_ref = -std::numeric_limits<float>::infinity();
+      for (size_t i = 0; i < elements(); i++) {
+        max_ref = std::max(max_ref, static_cast<float>(x[i]));
+      }
+      double sum_ref = 0.0;
+      for (size_t i = 0; i < elements(); i++) {
+        sum_ref += exp(double(static_cast<float>(x[i])) - double(max_ref));
+      }
+
+      // Call optimized micro-kernel.
+      float max = std::nanf("");
+      float sum = std::nanf("");
+      rmaxaddexp(elements() * sizeof(xnn_float16), x.data(), &max, &sum, /*params=*/nullptr);
+
+      // Verify results.
+      ASSERT_EQ(max, max_ref) << "elements = " << elements();
+      ASSERT_NEAR(sum, sum_ref, std::abs(sum_ref) * 1.0e-6) << "elements = " << elements() << ", max = " << max_ref;
+    }
+  }
+
+private:
+  size_t elements_{1};
+  float slope_{0.0f};
+  size_t infinity_stride_{0};
+  size_t iterations_{15};
+};
+
+#define XNN_TEST_RMAXADDEXP_ELEMENT_EQ(ukernel, arch_flags, element_tile, ...)                                         \
+  TEST(ukernel, element_eq)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    RMaxAddExpMicrokernelTester().elements(element_tile).Test(ukernel);                                                \
+  }
+#define XNN_TEST_RMAXADDEXP_ELEMENT_GT(ukernel, arch_flags, element_tile, ...)                                         \
+  TEST(ukernel, element_gt)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = element_tile + 1; element_size < ((element_tile == 1) ? 10 : element_tile * 2);         \
+         element_size++) {                                                                                             \
+      RMaxAddExpMicrokernelTester().elements(element_size).Test(ukernel);                                              \
+    }                                                                                                                  \
+  }
+#define XNN_TEST_RMAXADDEXP_ELEMENT_LT(ukernel, arch_flags, element_tile, ...)                                         \
+  TEST(ukernel, element_lt)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size < element_tile; element_size++) {                                       \
+      RMaxAddExpMicrokernelTester().elements(element_size).Test(ukernel);                                              \
+    }                                                                                                                  \
+  }
+#define XNN_TEST_RMAXADDEXP_ELEMENT_DIV(ukernel, arch_flags, element_tile, ...)                                        \
+  TEST(ukernel, element_div)                                                                                           \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 2 * element_tile; element_size < 10 * element_tile; element_size += element_tile) {     \
+      RMaxAddExpMicrokernelTester().elements(element_size).Test(ukernel);                                              \
+    }                                                                                                                  \
+  }
+
+#define XNN_TEST_RMAXADDEXP_RESCALE(ukernel, arch_flags, element_tile, ...)                                            \
+  TEST(ukernel, rescale)                                                                                               \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size <= 20 * element_tile; element_size += max(1, element_tile - 1)) {       \
+      RMaxAddExpMicrokernelTester().elements(element_size).slope(0.5f).Test(ukernel);                                  \
+      RMaxAddExpMicrokernelTester().elements(element_size).slope(-0.5f).Test(ukernel);                                 \
+    }                                                                                                                  \
+  }
+
+#define XNN_TEST_RMAXADDEXP_NEGATIVE_INFINITY(ukernel, arch_flags, element_tile, ...)                                  \
+  TEST(ukernel, negative_infinity)                                                                                     \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size <= 5 * element_tile; element_size += max(1, element_tile - 1)) {        \
+      RMaxAddExpMicrokernelTester().elements(element_size).infinity_stride(1).Test(ukernel);                           \
+      RMaxAddExpMicrokernelTester().elements(element_size).infinity_stride(3).Test(ukernel);                           \
+    }                                                                                                                  \
+  }
+
+#define XNN_UKERNEL_WITH_PARAMS(arch_flags, ukernel, element_tile, datatype, params_type, init_params) XNN_TEST_RMAXADDEXP_ELEMENT_EQ(ukernel,arch_flags, element_tile, init_params);  \
+XNN_TEST_RMAXADDEXP_ELEMENT_DIV(ukernel,arch_flags, element_tile, init_params);                                                                                                       \
+XNN_TEST_RMAXADDEXP_ELEMENT_LT(ukernel,arch_flags, element_tile, init_params);                                                                                                        \
+XNN_TEST_RMAXADDEXP_ELEMENT_GT(ukernel,arch_flags, element_tile, init_params);                                                                                                        \
+XNN_TEST_RMAXADDEXP_RESCALE(ukernel,arch_flags, element_tile, init_params);                                                                                                           \
+XNN_TEST_RMAXADDEXP_NEGATIVE_INFINITY(ukernel,arch_flags, element_tile, init_params);
+#include "f16-rmaxaddexp/f16-rmaxaddexp.h"
+#undef XNN_UKERNEL_WITH_PARAMS
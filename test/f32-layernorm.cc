@@ -0,0 +1,177 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+//   Specification: f32-layernorm
+
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "replicable_random_device.h"
+#include "xnnpack.h"
+#include "xnnpack/buffer.h"
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/norm.h"
+
+class LayerNormMicrokernelTester {
+public:
+  LayerNormMicrokernelTester& elements(size_t elements)
+  {
+    assert(elements != 0);
+    this->elements_ = elements;
+    return *this;
+  }
+
+  size_t elements() const { return this->elements_; }
+
+  // Inputs are centered around this value, so that the mean is large compared
+  // to the standard deviation of the row.
+  LayerNormMicrokernelTester& mean(float mean)
+  {
+    this->mean_ = mean;
+    return *this;
+  }
+
+  float mean() const { return this->mean_; }
+
+  LayerNormMicrokernelTester& epsilon(float epsilon)
+  {
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  float epsilon() const { return this->epsilon_; }
+
+  LayerNormMicrokernelTester& iterations(size_t iterations)
+  {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  size_t iterations() const { return this->iterations_; }
+
+  void Test(xnn_f32_layernorm_ukernel_fn layernorm) const
+  {
+    xnnpack::ReplicableRandomDevice rng;
+    auto f32rng = [&rng, this]() { return std::uniform_real_distribution<float>(mean() - 1.0f, mean() + 1.0f)(rng); };
+    auto scalerng = [&rng]() { return std::uniform_real_distribution<float>(0.5f, 2.0f)(rng); };
+    auto biasrng = [&rng]() { return std::uniform_real_distribution<float>(-1.0f, 1.0f)(rng); };
+
+    xnnpack::Buffer<float> x(elements() + XNN_EXTRA_BYTES / sizeof(float));
+    xnnpack::Buffer<float> scale(elements() + XNN_EXTRA_BYTES / sizeof(float));
+    xnnpack::Buffer<float> bias(elements() + XNN_EXTRA_BYTES / sizeof(float));
+    xnnpack::Buffer<float> y(elements());
+    std::vector<double> y_ref(elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::generate(scale.begin(), scale.end(), std::ref(scalerng));
+      std::generate(bias.begin(), bias.end(), std::ref(biasrng));
+
+      // Compute reference results.
+      double mean_ref = 0.0;
+      for (size_t i = 0; i < elements(); i++) {
+        mean_ref += double(x[i]);
+      }
+      mean_ref /= double(elements());
+      double variance_ref = 0.0;
+      for (size_t i = 0; i < elements(); i++) {
+        const double deviation = double(x[i]) - mean_ref;
+        variance_ref += deviation * deviation;
+      }
+      variance_ref /= double(elements());
+      const double multiplier_ref = 1.0 / std::sqrt(variance_ref + double(epsilon()));
+      for (size_t i = 0; i < elements(); i++) {
+        const double normalized = (double(x[i]) - mean_ref) * multiplier_ref;
+        y_ref[i] = normalized * double(scale[i]) + double(bias[i]);
+      }
+
+      // Call optimized micro-kernel.
+      std::fill(y.begin(), y.end(), std::nanf(""));
+      layernorm(elements() * sizeof(float), x.data(), scale.data(), bias.data(), y.data(), epsilon());
+
+      // Verify results.
+      for (size_t i = 0; i < elements(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(1.0e-4, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << elements();
+      }
+    }
+  }
+
+private:
+  size_t elements_{1};
+  float mean_{0.0f};
+  float epsilon_{1.0e-5f};
+  size_t iterations_{15};
+};
+
+#define XNN_TEST_LAYERNORM_ELEMENT_EQ(ukernel, arch_flags, element_tile, ...)                                          \
+  TEST(ukernel, element_eq)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    LayerNormMicrokernelTester().elements(element_tile).Test(ukernel);                                                 \
+  }
+#define XNN_TEST_LAYERNORM_ELEMENT_GT(ukernel, arch_flags, element_tile, ...)                                          \
+  TEST(ukernel, element_gt)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = element_tile + 1; element_size < ((element_tile == 1) ? 10 : element_tile * 2);         \
+         element_size++) {                                                                                             \
+      LayerNormMicrokernelTester().elements(element_size).Test(ukernel);                                               \
+    }                                                                                                                  \
+  }
+#define XNN_TEST_LAYERNORM_ELEMENT_LT(ukernel, arch_flags, element_tile, ...)                                          \
+  TEST(ukernel, element_lt)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size < element_tile; element_size++) {                                       \
+      LayerNormMicrokernelTester().elements(element_size).Test(ukernel);                                               \
+    }                                                                                                                  \
+  }
+#define XNN_TEST_LAYERNORM_ELEMENT_DIV(ukernel, arch_flags, element_tile, ...)                                         \
+  TEST(ukernel, element_div)                                                                                           \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 2 * element_tile; element_size < 10 * element_tile; element_size += element_tile) {     \
+      LayerNormMicrokernelTester().elements(element_size).Test(ukernel);                                               \
+    }                                                                                                                  \
+  }
+
+#define XNN_TEST_LAYERNORM_EPSILON(ukernel, arch_flags, element_tile, ...)                                             \
+  TEST(ukernel, epsilon)                                                                                               \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size <= 5 * element_tile; element_size += max(1, element_tile - 1)) {        \
+      LayerNormMicrokernelTester().elements(element_size).epsilon(1.0e-3f).Test(ukernel);                              \
+      LayerNormMicrokernelTester().elements(element_size).epsilon(1.0f).Test(ukernel);                                 \
+    }                                                                                                                  \
+  }
+
+#define XNN_TEST_LAYERNORM_LARGE_MEAN(ukernel, arch_flags, element_tile, ...)                                          \
+  TEST(ukernel, large_mean)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size <= 20 * element_tile; element_size += max(1, element_tile - 1)) {       \
+      LayerNormMicrokernelTester().elements(element_size).mean(100.0f).Test(ukernel);                                  \
+      LayerNormMicrokernelTester().elements(element_size).mean(-100.0f).Test(ukernel);                                 \
+    }                                                                                                                  \
+  }
+
+#define XNN_UKERNEL_WITH_PARAMS(arch_flags, ukernel, element_tile, datatype, params_type, init_params) XNN_TEST_LAYERNORM_ELEMENT_EQ(ukernel,arch_flags, element_tile, init_params);  \
+XNN_TEST_LAYERNORM_ELEMENT_DIV(ukernel,arch_flags, element_tile, init_params);                                                                                                        \
+XNN_TEST_LAYERNORM_ELEMENT_LT(ukernel,arch_flags, element_tile, init_params);                                                                                                         \
+XNN_TEST_LAYERNORM_ELEMENT_GT(ukernel,arch_flags, element_tile, init_params);                                                                                                         \
+XNN_TEST_LAYERNORM_EPSILON(ukernel,arch_flags, element_tile, init_params);                                                                                                            \
+XNN_TEST_LAYERNORM_LARGE_MEAN(ukernel,arch_flags, element_tile, init_params);
+#include "f32-layernorm/f32-layernorm.h"
+#undef XNN_UKERNEL_WITH_PARAMS
@@ -0,0 +1,145 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+//   Specification: f32-rmsnorm
+
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "replicable_random_device.h"
+#include "xnnpack.h"
+#include "xnnpack/buffer.h"
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/norm.h"
+
+class RMSNormMicrokernelTester {
+public:
+  RMSNormMicrokernelTester& elements(size_t elements)
+  {
+    assert(elements != 0);
+    this->elements_ = elements;
+    return *this;
+  }
+
+  size_t elements() const { return this->elements_; }
+
+  RMSNormMicrokernelTester& epsilon(float epsilon)
+  {
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  float epsilon() const { return this->epsilon_; }
+
+  RMSNormMicrokernelTester& iterations(size_t iterations)
+  {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  size_t iterations() const { return this->iterations_; }
+
+  void Test(xnn_f32_rmsnorm_ukernel_fn rmsnorm) const
+  {
+    xnnpack::ReplicableRandomDevice rng;
+    auto f32rng = [&rng]() { return std::uniform_real_distribution<float>(-10.0f, 10.0f)(rng); };
+    auto scalerng = [&rng]() { return std::uniform_real_distribution<float>(0.5f, 2.0f)(rng); };
+
+    xnnpack::Buffer<float> x(elements() + XNN_EXTRA_BYTES / sizeof(float));
+    xnnpack::Buffer<float> scale(elements() + XNN_EXTRA_BYTES / sizeof(float));
+    xnnpack::Buffer<float> y(elements());
+    std::vector<double> y_ref(elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::generate(scale.begin(), scale.end(), std::ref(scalerng));
+
+      // Compute reference results.
+      double mean_sq_ref = 0.0;
+      for (size_t i = 0; i < elements(); i++) {
+        mean_sq_ref += double(x[i]) * double(x[i]);
+      }
+      mean_sq_ref /= double(elements());
+      const double multiplier_ref = 1.0 / std::sqrt(mean_sq_ref + double(epsilon()));
+      for (size_t i = 0; i < elements(); i++) {
+        y_ref[i] = double(x[i]) * multiplier_ref * double(scale[i]);
+      }
+
+      // Call optimized micro-kernel.
+      std::fill(y.begin(), y.end(), std::nanf(""));
+      rmsnorm(elements() * sizeof(float), x.data(), scale.data(), y.data(), epsilon());
+
+      // Verify results.
+      for (size_t i = 0; i < elements(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(1.0e-5, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << elements();
+      }
+    }
+  }
+
+private:
+  size_t elements_{1};
+  float epsilon_{1.0e-5f};
+  size_t iterations_{15};
+};
+
+#define XNN_TEST_RMSNORM_ELEMENT_EQ(ukernel, arch_flags, element_tile, ...)                                            \
+  TEST(ukernel, element_eq)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    RMSNormMicrokernelTester().elements(element_tile).Test(ukernel);                                                   \
+  }
+#define XNN_TEST_RMSNORM_ELEMENT_GT(ukernel, arch_flags, element_tile, ...)                                            \
+  TEST(ukernel, element_gt)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = element_tile + 1; element_size < ((element_tile == 1) ? 10 : element_tile * 2);         \
+         element_size++) {                                                                                             \
+      RMSNormMicrokernelTester().elements(element_size).Test(ukernel);                                                 \
+    }                                                                                                                  \
+  }
+#define XNN_TEST_RMSNORM_ELEMENT_LT(ukernel, arch_flags, element_tile, ...)                                            \
+  TEST(ukernel, element_lt)                                                                                            \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size < element_tile; element_size++) {                                       \
+      RMSNormMicrokernelTester().elements(element_size).Test(ukernel);                                                 \
+    }                                                                                                                  \
+  }
+#define XNN_TEST_RMSNORM_ELEMENT_DIV(ukernel, arch_flags, element_tile, ...)                                           \
+  TEST(ukernel, element_div)                                                                                           \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 2 * element_tile; element_size < 10 * element_tile; element_size += element_tile) {     \
+      RMSNormMicrokernelTester().elements(element_size).Test(ukernel);                                                 \
+    }                                                                                                                  \
+  }
+
+#define XNN_TEST_RMSNORM_EPSILON(ukernel, arch_flags, element_tile, ...)                                               \
+  TEST(ukernel, epsilon)                                                                                               \
+  {                                                                                                                    \
+    TEST_REQUIRES_ARCH_FLAGS(arch_flags);                                                                              \
+    for (size_t element_size = 1; element_size <= 5 * element_tile; element_size += max(1, element_tile - 1)) {        \
+      RMSNormMicrokernelTester().elements(element_size).epsilon(0.0f).Test(ukernel);                                   \
+      RMSNormMicrokernelTester().elements(element_size).epsilon(1.0f).Test(ukernel);                                   \
+    }                                                                                                                  \
+  }
+
+#define XNN_UKERNEL_WITH_PARAMS(arch_flags, ukernel, element_tile, datatype, params_type, init_params) XNN_TEST_RMSNORM_ELEMENT_EQ(ukernel,arch_flags, element_tile, init_params);  \
+XNN_TEST_RMSNORM_ELEMENT_DIV(ukernel,arch_flags, element_tile, init_params);                                                                                                        \
+XNN_TEST_RMSNORM_ELEMENT_LT(ukernel,arch_flags, element_tile, init_params);                                                                                                         \
+XNN_TEST_RMSNORM_ELEMENT_GT(ukernel,arch_flags, element_tile, init_params);                                                                                                         \
+XNN_TEST_RMSNORM_EPSILON(ukernel,arch_flags, element_tile, init_params);
+#include "f32-rmsnorm/f32-rmsnorm.h"
+#undef XNN_UKERNEL_WITH_PARAMS
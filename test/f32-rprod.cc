@@ -0,0 +1,636 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-rprod.yaml
+//   Generator: tools/generate-reduce-test.py
+
+
+#include <gtest/gtest.h>
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microparams-init.h"
+#include "xnnpack/reduce.h"
+#include "reduce-microkernel-tester.h"
+
+
+TEST(F32_RPROD__SCALAR_U1, batch_eq_1) {
+  ReduceMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_rprod_ukernel__scalar_u1, ReduceMicrokernelTester::OpType::Prod);
+}
+
+TEST(F32_RPROD__SCALAR_U1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u1, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+
+TEST(F32_RPROD__SCALAR_U2_ACC2, batch_eq_2) {
+  ReduceMicrokernelTester()
+    .batch_size(2)
+    .Test(xnn_f32_rprod_ukernel__scalar_u2_acc2, ReduceMicrokernelTester::OpType::Prod);
+}
+
+TEST(F32_RPROD__SCALAR_U2_ACC2, batch_div_2) {
+  for (size_t batch_size = 4; batch_size < 20; batch_size += 2) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u2_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+TEST(F32_RPROD__SCALAR_U2_ACC2, batch_lt_2) {
+  for (size_t batch_size = 1; batch_size < 2; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u2_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+TEST(F32_RPROD__SCALAR_U2_ACC2, batch_gt_2) {
+  for (size_t batch_size = 3; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u2_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+
+TEST(F32_RPROD__SCALAR_U4_ACC4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rprod_ukernel__scalar_u4_acc4, ReduceMicrokernelTester::OpType::Prod);
+}
+
+TEST(F32_RPROD__SCALAR_U4_ACC4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u4_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+TEST(F32_RPROD__SCALAR_U4_ACC4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u4_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+TEST(F32_RPROD__SCALAR_U4_ACC4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rprod_ukernel__scalar_u4_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+}
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RPROD__NEON_U4, batch_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_rprod_ukernel__neon_u4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__NEON_U4, batch_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__NEON_U4, batch_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__NEON_U4, batch_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RPROD__NEON_U8_ACC2, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rprod_ukernel__neon_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__NEON_U8_ACC2, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__NEON_U8_ACC2, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__NEON_U8_ACC2, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RPROD__NEON_U16_ACC4, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rprod_ukernel__neon_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__NEON_U16_ACC4, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__NEON_U16_ACC4, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__NEON_U16_ACC4, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__neon_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RPROD__SSE2_U4, batch_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    ReduceMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_rprod_ukernel__sse2_u4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__SSE2_U4, batch_div_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__SSE2_U4, batch_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__SSE2_U4, batch_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RPROD__SSE2_U8_ACC2, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rprod_ukernel__sse2_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__SSE2_U8_ACC2, batch_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__SSE2_U8_ACC2, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__SSE2_U8_ACC2, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RPROD__SSE2_U16_ACC4, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rprod_ukernel__sse2_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__SSE2_U16_ACC4, batch_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__SSE2_U16_ACC4, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__SSE2_U16_ACC4, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__sse2_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RPROD__AVX_U8, batch_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rprod_ukernel__avx_u8, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__AVX_U8, batch_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u8, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX_U8, batch_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u8, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX_U8, batch_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u8, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RPROD__AVX_U16_ACC2, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rprod_ukernel__avx_u16_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__AVX_U16_ACC2, batch_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u16_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX_U16_ACC2, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u16_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX_U16_ACC2, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u16_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RPROD__AVX_U32_ACC4, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rprod_ukernel__avx_u32_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__AVX_U32_ACC4, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u32_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX_U32_ACC4, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u32_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX_U32_ACC4, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx_u32_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_RPROD__AVX512F_U16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rprod_ukernel__avx512f_u16, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__AVX512F_U16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u16, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX512F_U16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u16, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX512F_U16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u16, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_RPROD__AVX512F_U32_ACC2, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rprod_ukernel__avx512f_u32_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__AVX512F_U32_ACC2, batch_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u32_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX512F_U32_ACC2, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u32_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX512F_U32_ACC2, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u32_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_RPROD__AVX512F_U64_ACC4, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_rprod_ukernel__avx512f_u64_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__AVX512F_U64_ACC4, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u64_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX512F_U64_ACC4, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u64_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__AVX512F_U64_ACC4, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__avx512f_u64_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
+#if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+  TEST(F32_RPROD__WASMSIMD_U4, batch_eq_4) {
+    ReduceMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_rprod_ukernel__wasmsimd_u4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U4, batch_div_4) {
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U4, batch_lt_4) {
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U4, batch_gt_4) {
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+
+
+#if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+  TEST(F32_RPROD__WASMSIMD_U8_ACC2, batch_eq_8) {
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rprod_ukernel__wasmsimd_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U8_ACC2, batch_div_8) {
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U8_ACC2, batch_lt_8) {
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U8_ACC2, batch_gt_8) {
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u8_acc2, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+
+
+#if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+  TEST(F32_RPROD__WASMSIMD_U16_ACC4, batch_eq_16) {
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rprod_ukernel__wasmsimd_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U16_ACC4, batch_div_16) {
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U16_ACC4, batch_lt_16) {
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+
+  TEST(F32_RPROD__WASMSIMD_U16_ACC4, batch_gt_16) {
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rprod_ukernel__wasmsimd_u16_acc4, ReduceMicrokernelTester::OpType::Prod);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
@@ -0,0 +1,1437 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-spgemm-minmax.yaml
+//   Generator: tools/generate-spgemm-test.py
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microparams-init.h"
+#include "xnnpack/spmm.h"
+#include "spgemm-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, n_lt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, n_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, n_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(5)
+      .cm_stride(11)
+      .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(5)
+      .qmin(128)
+      .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(5)
+      .qmax(128)
+      .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_1X8__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n += 7) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spgemm_minmax_ukernel_1x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, n_lt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, n_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, n_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, m_lt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 4; m++) {
+      for (uint32_t n = 1; n <= 16; n += 7) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpGEMMMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .m(m)
+            .n(n)
+            .k(k)
+            .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(5)
+      .cm_stride(11)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(5)
+      .qmin(128)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(5)
+      .qmax(128)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X8__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n += 7) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x8__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .m(4)
+      .n(16)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .m(4)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, n_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, m_lt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 4; m++) {
+      for (uint32_t n = 1; n <= 32; n += 15) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpGEMMMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .m(m)
+            .n(n)
+            .k(k)
+            .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .m(4)
+      .n(16)
+      .k(5)
+      .cm_stride(19)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .m(4)
+      .n(16)
+      .k(5)
+      .qmin(128)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .m(4)
+      .n(16)
+      .k(5)
+      .qmax(128)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_MINMAX_4X16__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 32; n += 15) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x16__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, k_eq_4) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(4)
+      .sparsity(0.0f)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, k_lt_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k < 4; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .m(1)
+        .n(8)
+        .k(k)
+        .sparsity(0.0f)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, k_gt_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 5; k < 8; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .m(1)
+        .n(8)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, k_div_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .m(1)
+        .n(8)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, n_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, n_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, n_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(20)
+      .cm_stride(11)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(20)
+      .qmin(128)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .m(1)
+      .n(8)
+      .k(20)
+      .qmax(128)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_1X8__AVX2, zero_weights) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 16; n += 7) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .m(1)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, k_eq_4) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(4)
+      .sparsity(0.0f)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, k_lt_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k < 4; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .m(4)
+        .n(8)
+        .k(k)
+        .sparsity(0.0f)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, k_gt_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 5; k < 8; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .m(4)
+        .n(8)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, k_div_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 8; k <= 40; k += 4) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .m(4)
+        .n(8)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, n_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, n_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, n_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, m_lt_4) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t m = 1; m < 4; m++) {
+      for (uint32_t n = 1; n <= 16; n += 7) {
+        for (size_t k = 1; k <= 20; k += 5) {
+          SpGEMMMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparse_2of4(true)
+            .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(20)
+      .cm_stride(11)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(20)
+      .qmin(128)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .m(4)
+      .n(8)
+      .k(20)
+      .qmax(128)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPGEMM_2OF4_MINMAX_4X8__AVX2, zero_weights) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 16; n += 7) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .m(4)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x8__avx2, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, k_eq_1) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(1)
+    .sparsity(0.0f)
+    .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, strided_a) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .m(1)
+      .n(4)
+      .k(k)
+      .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, n_lt_4) {
+  for (uint32_t n = 1; n < 4; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, strided_cm) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(5)
+    .cm_stride(7)
+    .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, qmin) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(5)
+    .qmin(128)
+    .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, qmax) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(5)
+    .qmax(128)
+    .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_1X4__SCALAR, zero_weights) {
+  for (uint32_t n = 1; n <= 8; n += 3) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .sparsity(1.0f)
+        .Test(xnn_f32_spgemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, k_eq_1) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(1)
+    .sparsity(0.0f)
+    .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, strided_a) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .m(4)
+      .n(4)
+      .k(k)
+      .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, n_lt_4) {
+  for (uint32_t n = 1; n < 4; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, m_lt_4) {
+  for (uint32_t m = 1; m < 4; m++) {
+    for (uint32_t n = 1; n <= 8; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(m)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, strided_cm) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(5)
+    .cm_stride(7)
+    .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, qmin) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(5)
+    .qmin(128)
+    .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, qmax) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(5)
+    .qmax(128)
+    .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_MINMAX_4X4__SCALAR, zero_weights) {
+  for (uint32_t n = 1; n <= 8; n += 3) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .sparsity(1.0f)
+        .Test(xnn_f32_spgemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, k_eq_4) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(4)
+    .sparsity(0.0f)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, strided_a) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(4)
+    .a_stride(7)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, k_lt_4) {
+  for (size_t k = 1; k < 4; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .m(1)
+      .n(4)
+      .k(k)
+      .sparsity(0.0f)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, k_gt_4) {
+  for (size_t k = 5; k < 8; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .m(1)
+      .n(4)
+      .k(k)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, k_div_4) {
+  for (size_t k = 8; k <= 40; k += 4) {
+    SpGEMMMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .m(1)
+      .n(4)
+      .k(k)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, n_lt_4) {
+  for (uint32_t n = 1; n < 4; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, strided_cm) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(20)
+    .cm_stride(7)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, qmin) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(20)
+    .qmin(128)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, qmax) {
+  SpGEMMMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .m(1)
+    .n(4)
+    .k(20)
+    .qmax(128)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_1X4__SCALAR, zero_weights) {
+  for (uint32_t n = 1; n <= 8; n += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .m(1)
+        .n(n)
+        .k(k)
+        .sparsity(1.0f)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, k_eq_4) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(4)
+    .sparsity(0.0f)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, strided_a) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(4)
+    .a_stride(7)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, k_lt_4) {
+  for (size_t k = 1; k < 4; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .m(4)
+      .n(4)
+      .k(k)
+      .sparsity(0.0f)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, k_gt_4) {
+  for (size_t k = 5; k < 8; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .m(4)
+      .n(4)
+      .k(k)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, k_div_4) {
+  for (size_t k = 8; k <= 40; k += 4) {
+    SpGEMMMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .m(4)
+      .n(4)
+      .k(k)
+      .sparse_2of4(true)
+      .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, n_lt_4) {
+  for (uint32_t n = 1; n < 4; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, m_lt_4) {
+  for (uint32_t m = 1; m < 4; m++) {
+    for (uint32_t n = 1; n <= 8; n += 3) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        SpGEMMMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .m(m)
+          .n(n)
+          .k(k)
+          .sparse_2of4(true)
+          .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, strided_cm) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(20)
+    .cm_stride(7)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, qmin) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(20)
+    .qmin(128)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, qmax) {
+  SpGEMMMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .m(4)
+    .n(4)
+    .k(20)
+    .qmax(128)
+    .sparse_2of4(true)
+    .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_SPGEMM_2OF4_MINMAX_4X4__SCALAR, zero_weights) {
+  for (uint32_t n = 1; n <= 8; n += 3) {
+    for (size_t k = 1; k <= 20; k += 5) {
+      SpGEMMMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .m(4)
+        .n(n)
+        .k(k)
+        .sparsity(1.0f)
+        .sparse_2of4(true)
+        .Test(xnn_f32_spgemm_2of4_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
\ No newline at end of file
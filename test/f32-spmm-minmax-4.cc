@@ -1152,6 +1152,1051 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(4)
+      .m(32)
+      .n(4)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 4; n++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(4)
+        .m(32)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(4)
+        .m(32)
+        .n(4)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, n_gt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 5; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, n_div_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, m_lt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, m_div_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, m_gt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .output_stride(67)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__fma3, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(1)
+      .m(16)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, n_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, m_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, m_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, m_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, output_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .output_stride(37)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_16X1__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_16x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(1)
+      .m(32)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, n_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, m_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, m_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, m_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, output_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .output_stride(67)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X1__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x1__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(64)
+      .nr(2)
+      .m(64)
+      .n(2)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 2; n++) {
+      SpMMMicrokernelTester()
+        .mr(64)
+        .nr(2)
+        .m(64)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(64)
+        .nr(2)
+        .m(64)
+        .n(2)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 2; n++) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, n_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 3; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, n_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 4; n <= 6; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(64)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, m_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(64)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, m_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 128; m <= 192; m += 64) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(64)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, m_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 65; m < 128; m++) {
+      for (uint32_t n = 1; n < 10; n += 3) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(64)
+            .nr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, output_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(128)
+          .n(n)
+          .k(k)
+          .output_stride(131)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(128)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(128)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(128)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_64X2__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 10; n += 3) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(64)
+          .nr(2)
+          .m(128)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_64x2__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
+#if XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, k_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(4)
+      .m(32)
+      .n(4)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 4; n++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(4)
+        .m(32)
+        .n(n)
+        .k(1)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, k_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(4)
+        .m(32)
+        .n(4)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, n_gt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 5; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, n_div_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(32)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, m_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, m_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, m_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 20; n += 5) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, output_stride) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .output_stride(67)
+          .sparsity(0.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, half_sparse) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_SPMM_MINMAX_32X4__AVX512F, zero_weights) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n < 20; n += 5) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(4)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f32_spmm_minmax_ukernel_32x4__avx512f, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+#endif  // XNN_ENABLE_AVX512F && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+
+
 #if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
   TEST(F32_SPMM_MINMAX_4X1__WASMSIMD_ARM_X2, k_eq_2) {
     SpMMMicrokernelTester()
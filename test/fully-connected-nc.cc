@@ -687,6 +687,80 @@ TEST(FULLY_CONNECTED_NC_F32, small_batch_without_bias) {
     .TestF32();
 }
 
+TEST(FULLY_CONNECTED_NC_F32, large_batch_large_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(1031)
+    .output_channels(300)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_large_k_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(1031)
+    .output_channels(300)
+    .multithreaded(true)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_k_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(67)
+    .multithreaded(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_large_k_multithreaded_with_qmin_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(4099)
+    .output_channels(67)
+    .qmin(128)
+    .qmax(192)
+    .multithreaded(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_k_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(2051)
+    .output_channels(37)
+    .multithreaded(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_k_multithreaded_with_strides) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(2051)
+    .input_stride(2060)
+    .output_channels(37)
+    .output_stride(43)
+    .multithreaded(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_large_k_multithreaded_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(5)
+    .input_channels(2051)
+    .output_channels(37)
+    .multithreaded(true)
+    .iterations(3)
+    .TestF32();
+}
+
 TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -708,6 +782,208 @@ TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch_transpose_weights) {
     .TestF32();
 }
 
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, dense_fallback) {
+  FullyConnectedOperatorTester()
+    .batch_size(3)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, unit_batch_sparsity_50) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(67)
+    .output_channels(19)
+    .sparsity(0.5f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, unit_batch_sparsity_70) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(67)
+    .output_channels(19)
+    .sparsity(0.7f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, unit_batch_sparsity_90) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(67)
+    .output_channels(19)
+    .sparsity(0.9f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_sparsity_80) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .qmin(128)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .qmax(128)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .input_stride(71)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .output_stride(41)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, all_zero_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(1.0f)
+    .iterations(1)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, large_batch_large_k_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(1031)
+    .output_channels(300)
+    .sparsity(0.9f)
+    .multithreaded(true)
+    .iterations(1)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_2of4) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparse_2of4(true)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, small_batch_2of4_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(5)
+    .input_channels(66)
+    .output_channels(37)
+    .sparse_2of4(true)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, large_batch_2of4_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(37)
+    .input_channels(1031)
+    .output_channels(300)
+    .sparse_2of4(true)
+    .multithreaded(true)
+    .iterations(1)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, weights_cache_small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, weights_cache_small_batch_2of4) {
+  FullyConnectedOperatorTester()
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparse_2of4(true)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
+TEST(FULLY_CONNECTED_SPARSE_NC_F32, weights_cache_small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(5)
+    .input_channels(67)
+    .output_channels(37)
+    .sparsity(0.8f)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestF32Sparse();
+}
+
 TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -1029,6 +1305,122 @@ TEST(FULLY_CONNECTED_NC_F32_QC8W, weights_cache_unit_batch_transpose_weights) {
     .TestF32QC8W();
 }
 
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_odd_input_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(22)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(22)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_wide_output) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(22)
+    .output_channels(75)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(22)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, weights_cache_unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(22)
+    .output_channels(19)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestBF16();
+}
+
 TEST(FULLY_CONNECTED_NC_F16, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -31,6 +31,7 @@
 #include "xnnpack/internal.h"
 #include "xnnpack/buffer.h"
 #include "replicable_random_device.h"
+#include "pthreadpool.h"
 
 static int8_t sign_extend_int4(int8_t value) {
   int8_t mask = 0x08;
@@ -182,6 +183,26 @@ class FullyConnectedOperatorTester {
     return this->has_bias_;
   }
 
+  FullyConnectedOperatorTester& sparsity(float sparsity) {
+    assert(sparsity >= 0.0f);
+    assert(sparsity <= 1.0f);
+    this->sparsity_ = sparsity;
+    return *this;
+  }
+
+  float sparsity() const {
+    return this->sparsity_;
+  }
+
+  FullyConnectedOperatorTester& sparse_2of4(bool sparse_2of4) {
+    this->sparse_2of4_ = sparse_2of4;
+    return *this;
+  }
+
+  bool sparse_2of4() const {
+    return this->sparse_2of4_;
+  }
+
   FullyConnectedOperatorTester& weights_type(WeightsType weights_type) {
     this->weights_type_ = weights_type;
     return *this;
@@ -200,6 +221,20 @@ class FullyConnectedOperatorTester {
     return this->use_weights_cache_;
   }
 
+  FullyConnectedOperatorTester& multithreaded(bool multithreaded) {
+    this->multithreaded_ = multithreaded;
+    return *this;
+  }
+
+  bool multithreaded() const {
+    return this->multithreaded_;
+  }
+
+  size_t num_threads() const {
+    // Do not spin up excessive number of threads for tests.
+    return multithreaded() ? 5 : 1;
+  }
+
   FullyConnectedOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -2400,6 +2435,16 @@ class FullyConnectedOperatorTester {
     xnnpack::Buffer<float> output_ref(batch_size() * output_channels());
 
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool{nullptr, pthreadpool_destroy};
+      if (multithreaded()) {
+        const pthreadpool_t threadpool = pthreadpool_create(num_threads());
+        if (pthreadpool_get_threads_count(threadpool) <= 1) {
+          GTEST_SKIP();
+        } else {
+          auto_threadpool.reset(threadpool);
+        }
+      }
+
       std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
       std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
       std::copy(kernel.cbegin(), kernel.cend(), kernel_as_float.begin());
@@ -2513,14 +2558,14 @@ class FullyConnectedOperatorTester {
                     xnn_reshape_fully_connected_nc_f32(
                         fully_connected_op,
                         batch_size(),
-                        /*threadpool=*/nullptr));
+                        auto_threadpool.get()));
           break;
         case WeightsType::FP16:
           ASSERT_EQ(xnn_status_success,
                     xnn_reshape_fully_connected_nc_f32_f16(
                         fully_connected_op,
                         batch_size(),
-                        /*threadpool=*/nullptr));
+                        auto_threadpool.get()));
           break;
         default:
           GTEST_FAIL() <<"unexpected weights type";
@@ -2545,7 +2590,7 @@ class FullyConnectedOperatorTester {
       }
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, /*threadpool=*/nullptr));
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
 
       VerifyF32(output, output_ref, output_max, output_min);
 
@@ -2651,6 +2696,182 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void TestF32Sparse() const {
+    xnnpack::ReplicableRandomDevice rng;
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+    std::uniform_real_distribution<float> pdist;
+
+    xnnpack::Buffer<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    xnnpack::Buffer<float> kernel(output_channels() * input_channels());
+    xnnpack::Buffer<float> bias(output_channels());
+    xnnpack::Buffer<float> output((batch_size() - 1) * output_stride() + output_channels());
+    xnnpack::Buffer<float> output_ref(batch_size() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool{nullptr, pthreadpool_destroy};
+      if (multithreaded()) {
+        const pthreadpool_t threadpool = pthreadpool_create(num_threads());
+        if (pthreadpool_get_threads_count(threadpool) <= 1) {
+          GTEST_SKIP();
+        } else {
+          auto_threadpool.reset(threadpool);
+        }
+      }
+
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+
+      // Zero out weights in [output channels][input channels] order: either
+      // whole input channels (1xN blocks), or 2 of every 4 input channels of
+      // each output channel.
+      const auto weight = [&](size_t oc, size_t ic) -> float& {
+        return transpose_weights() ?
+          kernel[ic * output_channels() + oc] : kernel[oc * input_channels() + ic];
+      };
+      if (sparse_2of4()) {
+        std::uniform_int_distribution<size_t> idist(0, 3);
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          for (size_t ic = 0; ic < input_channels(); ic += 4) {
+            const size_t keep0 = idist(rng);
+            const size_t keep1 = (keep0 + 1 + idist(rng) % 3) % 4;
+            for (size_t k = 0; k < 4 && ic + k < input_channels(); k++) {
+              if (k != keep0 && k != keep1) {
+                weight(oc, ic + k) = 0.0f;
+              }
+            }
+          }
+        }
+      } else {
+        for (size_t ic = 0; ic < input_channels(); ic++) {
+          if (pdist(rng) < sparsity()) {
+            for (size_t oc = 0; oc < output_channels(); oc++) {
+              weight(oc, ic) = 0.0f;
+            }
+          }
+        }
+      }
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          float acc = has_bias() ? bias[oc] : 0.0f;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            acc += input[i * input_stride() + ic] * weight(oc, ic);
+          }
+          output_ref[i * output_channels() + oc] = acc;
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      struct xnn_internal_weights_cache* internal_weights_cache = nullptr;
+      std::unique_ptr<xnn_weights_cache_provider, decltype(&xnn_delete_weights_cache)> auto_weights_cache(
+        nullptr, xnn_delete_weights_cache);
+      if (use_weights_cache()) {
+        xnn_weights_cache_t weights_cache = nullptr;
+        xnn_create_weights_cache(&weights_cache);
+        auto_weights_cache.reset(weights_cache);
+        if (weights_cache) {
+          internal_weights_cache = (struct xnn_internal_weights_cache*) weights_cache->context;
+        }
+      }
+
+      const xnn_status status = xnn_create_fully_connected_sparse_nc_f32(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          /*code_cache=*/nullptr, auto_weights_cache.get(),
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+      if (use_weights_cache()) {
+        ASSERT_EQ(xnn_status_success,
+                  xnn_finalize_weights_cache(auto_weights_cache.get(), xnn_weights_cache_finalization_kind_soft));
+      }
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+                xnn_reshape_fully_connected_sparse_nc_f32(
+                    fully_connected_op,
+                    batch_size(),
+                    auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_sparse_nc_f32(
+          fully_connected_op,
+          input.data(), output.data()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      VerifyF32(output, output_ref, output_max, output_min);
+
+      if (use_weights_cache()) {
+        // Create another operator with the same weights cache.
+        xnn_operator_t fully_connected_op2 = nullptr;
+        size_t old_weights_cache_size = internal_weights_cache->cache.weights.size;
+
+        ASSERT_EQ(xnn_status_success, xnn_create_fully_connected_sparse_nc_f32(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_min, output_max,
+            transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+            /*code_cache=*/nullptr, auto_weights_cache.get(),
+            &fully_connected_op2));
+        ASSERT_NE(nullptr, fully_connected_op2);
+
+        // Smart pointer to automatically delete fully_connected_op2.
+        std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)>
+            auto_fully_connected_op2(fully_connected_op2, xnn_delete_operator);
+
+        ASSERT_EQ(xnn_status_success,
+                  xnn_reshape_fully_connected_sparse_nc_f32(
+                      fully_connected_op2,
+                      batch_size(),
+                      auto_threadpool.get()));
+
+        xnnpack::Buffer<float> output2(output.size());
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_fully_connected_sparse_nc_f32(
+            fully_connected_op2,
+            input.data(), output2.data()));
+
+        ASSERT_EQ(xnn_status_success,
+          xnn_run_operator(fully_connected_op2, auto_threadpool.get()));
+
+        VerifyWeightsCache(*internal_weights_cache, old_weights_cache_size);
+
+        VerifyF32(output2, output_ref, output_max, output_min);
+      }
+    }
+  }
+
   void TestF32QC4W() const {
     ASSERT_EQ(weights_type(), WeightsType::Default);
 
@@ -3005,6 +3226,125 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void TestBF16() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+
+    xnnpack::ReplicableRandomDevice rng;
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    xnnpack::Buffer<xnn_bfloat16> input(XNN_EXTRA_BYTES / sizeof(xnn_bfloat16) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    xnnpack::Buffer<xnn_bfloat16> kernel(output_channels() * input_channels());
+    xnnpack::Buffer<xnn_bfloat16> bias(output_channels());
+    xnnpack::Buffer<xnn_bfloat16> output((batch_size() - 1) * output_stride() + output_channels());
+    xnnpack::Buffer<float> output_ref(batch_size() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+
+      // Compute reference results, without renormalization.
+      if (has_bias()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            output_ref[i * output_channels() + oc] = bias[oc];
+          }
+        }
+      } else {
+        std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+      }
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const size_t kernel_index = transpose_weights() ?
+              ic * output_channels() + oc : oc * input_channels() + ic;
+            output_ref[i * output_channels() + oc] +=
+              float(input[i * input_stride() + ic]) * float(kernel[kernel_index]);
+          }
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float scaled_min = xnn_bfloat16(accumulated_min + accumulated_range / 255.0f * float(qmin()));
+      const float scaled_max = xnn_bfloat16(accumulated_max - accumulated_range / 255.0f * float(255 - qmax()));
+      const float output_min = scaled_min == scaled_max ? -std::numeric_limits<float>::infinity() : scaled_min;
+      const float output_max = scaled_min == scaled_max ? +std::numeric_limits<float>::infinity() : scaled_max;
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      std::unique_ptr<xnn_weights_cache_provider, decltype(&xnn_delete_weights_cache)> auto_weights_cache(
+        nullptr, xnn_delete_weights_cache);
+      if (use_weights_cache()) {
+        xnn_weights_cache_t weights_cache = nullptr;
+        xnn_create_weights_cache(&weights_cache);
+        auto_weights_cache.reset(weights_cache);
+      }
+
+      const xnn_status status = xnn_create_fully_connected_nc_bf16(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          nullptr, auto_weights_cache.get(),
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+      if (use_weights_cache()) {
+        ASSERT_EQ(xnn_status_success,
+                  xnn_finalize_weights_cache(auto_weights_cache.get(), xnn_weights_cache_finalization_kind_soft));
+      }
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_reshape_fully_connected_nc_bf16(
+          fully_connected_op,
+          batch_size(),
+          /*threadpool=*/nullptr));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_bf16(
+          fully_connected_op,
+          input.data(), output.data()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, /*threadpool=*/nullptr));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+            << "batch index = " << i << ", channel = " << c;
+          // BF16 keeps only 8 bits of mantissa.
+          const float tolerance = std::max(1e-3f, 1.0e-2f * std::abs(output_ref[i * output_channels() + c]));
+          EXPECT_NEAR(
+              output_ref[i * output_channels() + c],
+              output[i * output_stride() + c],
+              tolerance)
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
   void TestF16() const {
     switch (weights_type()) {
       case WeightsType::Default:
@@ -3232,7 +3572,10 @@ class FullyConnectedOperatorTester {
   uint8_t qmax_{255};
   bool transpose_weights_{false};
   bool has_bias_{true};
+  float sparsity_{0.0f};
+  bool sparse_2of4_{false};
   WeightsType weights_type_{WeightsType::Default};
   bool use_weights_cache_{false};
+  bool multithreaded_{false};
   size_t iterations_{1};
 };
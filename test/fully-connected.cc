@@ -100,6 +100,66 @@ class FullyConnectedTestBase
                            std::multiplies<size_t>());
   }
 
+  // Runs a Fully Connected Sparse node with FP32 static weights on `input`.
+  xnn_status RunFullyConnectedSparse(xnn_datatype datatype,
+                                     const float* kernel_data,
+                                     const std::vector<size_t>& kernel_shape,
+                                     const float* bias_data, uint32_t flags,
+                                     OutputType* output) {
+    xnn_subgraph_t subgraph = nullptr;
+    xnn_status status = xnn_create_subgraph(4, /*flags=*/0, &subgraph);
+    if (status != xnn_status_success) {
+      return status;
+    }
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)>
+        auto_subgraph(subgraph, xnn_delete_subgraph);
+
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    uint32_t kernel_id = XNN_INVALID_VALUE_ID;
+    uint32_t bias_id = XNN_INVALID_VALUE_ID;
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    if ((status = xnn_define_tensor_value(
+             subgraph, datatype, input_dims.size(), input_dims.data(), nullptr,
+             /*external_id=*/0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id)) !=
+            xnn_status_success ||
+        (status = xnn_define_tensor_value(
+             subgraph, xnn_datatype_fp32, kernel_shape.size(),
+             kernel_shape.data(), kernel_data,
+             /*external_id=*/1, /*flags=*/0, &kernel_id)) !=
+            xnn_status_success ||
+        (bias_data != nullptr &&
+         (status = xnn_define_tensor_value(
+              subgraph, xnn_datatype_fp32, bias_dims.size(), bias_dims.data(),
+              bias_data, /*external_id=*/2, /*flags=*/0, &bias_id)) !=
+             xnn_status_success) ||
+        (status = xnn_define_tensor_value(
+             subgraph, datatype, output_dims.size(), output_dims.data(),
+             nullptr, /*external_id=*/3, XNN_VALUE_FLAG_EXTERNAL_OUTPUT,
+             &output_id)) != xnn_status_success ||
+        (status = xnn_define_fully_connected_sparse(
+             subgraph, output_min, output_max, input_id, kernel_id, bias_id,
+             output_id, flags)) != xnn_status_success) {
+      return status;
+    }
+
+    xnn_runtime_t runtime = nullptr;
+    status = xnn_create_runtime_v3(subgraph, nullptr, nullptr,
+                                   xnn_test_runtime_flags(), &runtime);
+    if (status != xnn_status_success) {
+      return status;
+    }
+    std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(
+        runtime, xnn_delete_runtime);
+    std::array<xnn_external_value, 2> external = {
+        xnn_external_value{input_id, input.data()},
+        xnn_external_value{output_id, output}};
+    status = xnn_setup_runtime(runtime, external.size(), external.data());
+    if (status != xnn_status_success) {
+      return status;
+    }
+    return xnn_invoke_runtime(runtime);
+  }
+
   xnnpack::ReplicableRandomDevice rng;
   std::uniform_int_distribution<int32_t> i32dist;
   std::uniform_real_distribution<float> f32dist;
@@ -1304,6 +1364,42 @@ TEST_P(FullyConnectedTestF16, matches_operator_api_f16_weights) {
   EXPECT_THAT(subgraph_output, ElementsAreArray(operator_output));
 }
 
+TEST_P(FullyConnectedTestF16, sparse_matches_transposed_weights) {
+  const bool use_bias = GetParam().use_bias;
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+  std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+  std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+  // Prune half of the weights.
+  for (size_t i = 0; i < kernel.size(); i += 2) {
+    kernel[i] = 0.0f;
+  }
+  xnnpack::Buffer<float> kernel_transposed(kernel.size());
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      kernel_transposed[ic * output_channels + oc] =
+          kernel[oc * input_channels + ic];
+    }
+  }
+
+  const xnn_status status = RunFullyConnectedSparse(
+      xnn_datatype_fp16, kernel.data(), kernel_dims, use_bias ? bias.data() : nullptr,
+      /*flags=*/0, operator_output.data());
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_EQ(xnn_status_success,
+            RunFullyConnectedSparse(
+                xnn_datatype_fp16, kernel_transposed.data(), kernel_dims_tranposed,
+                use_bias ? bias.data() : nullptr, XNN_FLAG_TRANSPOSE_WEIGHTS,
+                subgraph_output.data()));
+
+  // Check outputs match.
+  EXPECT_THAT(subgraph_output, ElementsAreArray(operator_output));
+}
+
 TEST_F(FullyConnectedTestF32, matches_operator_api) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
 
@@ -1392,6 +1488,41 @@ TEST_F(FullyConnectedTestF32, matches_operator_api) {
   EXPECT_THAT(subgraph_output, ElementsAreArray(operator_output));
 }
 
+TEST_F(FullyConnectedTestF32, sparse_matches_transposed_weights) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+  std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+  std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+  // Prune half of the weights.
+  for (size_t i = 0; i < kernel.size(); i += 2) {
+    kernel[i] = 0.0f;
+  }
+  xnnpack::Buffer<float> kernel_transposed(kernel.size());
+  for (size_t oc = 0; oc < output_channels; oc++) {
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      kernel_transposed[ic * output_channels + oc] =
+          kernel[oc * input_channels + ic];
+    }
+  }
+
+  const xnn_status status = RunFullyConnectedSparse(
+      xnn_datatype_fp32, kernel.data(), kernel_dims, bias.data(),
+      /*flags=*/0, operator_output.data());
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_EQ(xnn_status_success,
+            RunFullyConnectedSparse(
+                xnn_datatype_fp32, kernel_transposed.data(), kernel_dims_tranposed,
+                bias.data(), XNN_FLAG_TRANSPOSE_WEIGHTS,
+                subgraph_output.data()));
+
+  // Check outputs match.
+  EXPECT_THAT(subgraph_output, ElementsAreArray(operator_output));
+}
+
 TEST_F(FullyConnectedTestF32QC4W, matches_operator_api) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
 
@@ -3,6 +3,8 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -761,4 +763,589 @@ TEST(COPY, fused_chain_of_copies) {
 }
 
 
+TEST(FULLY_CONNECTED_THEN_MULTIPLY_THEN_ADD_THEN_GELU, fused_into_epilogue) {
+  RuntimeTester tester(10);
+  uint32_t input_id = 0;
+  uint32_t filter_id = 1;
+  uint32_t bias_id = 2;
+  uint32_t scale_id = 3;
+  uint32_t residual_id = 4;
+  uint32_t fc_out_id = 5;
+  uint32_t mul_out_id = 6;
+  uint32_t add_out_id = 7;
+  uint32_t output_id = 8;
+  tester
+    .AddInputTensorF32({5, 16}, input_id)
+    .AddStaticTensorF32({19, 16}, TensorType::kDense, filter_id)
+    .AddStaticTensorF32({19}, TensorType::kDense, bias_id)
+    .AddStaticTensorF32({19}, TensorType::kDense, scale_id)
+    .AddInputTensorF32({5, 19}, residual_id)
+    .AddDynamicTensorF32({5, 19}, fc_out_id)
+    .AddDynamicTensorF32({5, 19}, mul_out_id)
+    .AddDynamicTensorF32({5, 19}, add_out_id)
+    .AddOutputTensorF32({5, 19}, output_id)
+    .AddFullyConnected(input_id, filter_id, bias_id, fc_out_id)
+    .AddMultiply(fc_out_id, scale_id, mul_out_id)
+    .AddAddition(residual_id, mul_out_id, add_out_id)
+    .AddGelu(add_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 4);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 1);
+
+  const xnn_node* fc_node = tester.Node(0);
+  ASSERT_TRUE(fc_node->epilogue.enabled);
+  EXPECT_EQ(fc_node->epilogue.scale_id, scale_id);
+  EXPECT_EQ(fc_node->epilogue.residual_id, residual_id);
+  EXPECT_EQ(fc_node->epilogue.activation, xnn_unary_gelu);
+  EXPECT_EQ(fc_node->num_inputs, 5);
+  EXPECT_EQ(fc_node->outputs[0], output_id);
+
+  ASSERT_EQ(unoptimized_output.size(), optimized_output.size());
+  for (size_t i = 0; i < unoptimized_output.size(); i++) {
+    EXPECT_NEAR(unoptimized_output[i], optimized_output[i], 1.0e-5f * std::max(1.0f, std::abs(unoptimized_output[i])));
+  }
+}
+
+TEST(CONVOLUTION_2D_THEN_ADD_THEN_CLAMP, fused_into_epilogue) {
+  RuntimeTester tester(7);
+  float output_min = -0.25f;
+  float output_max = 0.75f;
+  uint32_t input_id = 0;
+  uint32_t filter_id = 1;
+  uint32_t bias_id = 2;
+  uint32_t residual_id = 3;
+  uint32_t conv_out_id = 4;
+  uint32_t add_out_id = 5;
+  uint32_t output_id = 6;
+  tester
+    .AddInputTensorF32({2, 9, 9, 8}, input_id)
+    .AddStaticTensorF32({24, 3, 3, 8}, TensorType::kDense, filter_id)
+    .AddStaticTensorF32({24}, TensorType::kDense, bias_id)
+    .AddInputTensorF32({2, 9, 9, 24}, residual_id)
+    .AddDynamicTensorF32({2, 9, 9, 24}, conv_out_id)
+    .AddDynamicTensorF32({2, 9, 9, 24}, add_out_id)
+    .AddOutputTensorF32({2, 9, 9, 24}, output_id)
+    .AddConvolution2D(
+        ConvolutionParams{
+          Padding{1, 1, 1, 1},
+          Kernel{3, 3},
+          Subsampling{1, 1},
+          Dilation{1, 1},
+          /*groups=*/ 1,
+          /*group_input_channels=*/ 8,
+          /*group_output_channels=*/ 24,
+        }, input_id, filter_id, bias_id, conv_out_id)
+    .AddAddition(conv_out_id, residual_id, add_out_id)
+    .AddClamp(output_min, output_max, add_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 1);
+
+  const xnn_node* conv_node = tester.Node(0);
+  ASSERT_TRUE(conv_node->epilogue.enabled);
+  EXPECT_EQ(conv_node->epilogue.residual_id, residual_id);
+  EXPECT_EQ(conv_node->epilogue.output_min, output_min);
+  EXPECT_EQ(conv_node->epilogue.output_max, output_max);
+  EXPECT_EQ(conv_node->activation.output_min, -std::numeric_limits<float>::infinity());
+  EXPECT_EQ(conv_node->outputs[0], output_id);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(CONVOLUTION_2D_1X1_THEN_HARDSWISH, fused_into_epilogue) {
+  RuntimeTester tester(5);
+  uint32_t input_id = 0;
+  uint32_t filter_id = 1;
+  uint32_t bias_id = 2;
+  uint32_t conv_out_id = 3;
+  uint32_t output_id = 4;
+  tester
+    .AddInputTensorF32({1, 7, 7, 16}, input_id)
+    .AddStaticTensorF32({32, 1, 1, 16}, TensorType::kDense, filter_id)
+    .AddStaticTensorF32({32}, TensorType::kDense, bias_id)
+    .AddDynamicTensorF32({1, 7, 7, 32}, conv_out_id)
+    .AddOutputTensorF32({1, 7, 7, 32}, output_id)
+    .AddConvolution2D(
+        ConvolutionParams{
+          Padding{0, 0, 0, 0},
+          Kernel{1, 1},
+          Subsampling{1, 1},
+          Dilation{1, 1},
+          /*groups=*/ 1,
+          /*group_input_channels=*/ 16,
+          /*group_output_channels=*/ 32,
+        }, input_id, filter_id, bias_id, conv_out_id)
+    .AddHardSwish(conv_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 1);
+  EXPECT_EQ(tester.Node(0)->epilogue.activation, xnn_unary_hardswish);
+  EXPECT_EQ(tester.Node(0)->outputs[0], output_id);
+
+  ASSERT_EQ(unoptimized_output.size(), optimized_output.size());
+  for (size_t i = 0; i < unoptimized_output.size(); i++) {
+    EXPECT_NEAR(unoptimized_output[i], optimized_output[i], 1.0e-5f * std::max(1.0f, std::abs(unoptimized_output[i])));
+  }
+}
+
+TEST(FULLY_CONNECTED_THEN_ADD, residual_fused_into_later_producer) {
+  // The output of the first Fully Connected is not available yet when the second one runs, so the addition can only be
+  // fused into the epilogue of the second Fully Connected.
+  RuntimeTester tester(7);
+  uint32_t input_id = 0;
+  uint32_t filter1_id = 1;
+  uint32_t filter2_id = 2;
+  uint32_t fc1_out_id = 3;
+  uint32_t fc2_out_id = 4;
+  uint32_t output_id = 5;
+  tester
+    .AddInputTensorF32({3, 8}, input_id)
+    .AddStaticTensorF32({8, 8}, TensorType::kDense, filter1_id)
+    .AddStaticTensorF32({8, 8}, TensorType::kDense, filter2_id)
+    .AddDynamicTensorF32({3, 8}, fc1_out_id)
+    .AddDynamicTensorF32({3, 8}, fc2_out_id)
+    .AddOutputTensorF32({3, 8}, output_id)
+    .AddFullyConnected(input_id, filter1_id, XNN_INVALID_VALUE_ID, fc1_out_id)
+    .AddFullyConnected(input_id, filter2_id, XNN_INVALID_VALUE_ID, fc2_out_id)
+    .AddAddition(fc1_out_id, fc2_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+  EXPECT_FALSE(tester.Node(0)->epilogue.enabled);
+  ASSERT_TRUE(tester.Node(1)->epilogue.enabled);
+  EXPECT_EQ(tester.Node(1)->epilogue.residual_id, fc1_out_id);
+  EXPECT_EQ(tester.Node(1)->outputs[0], output_id);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(FULLY_CONNECTED_SHARING_INPUT, fused_into_multi_output_fully_connected) {
+  RuntimeTester tester(14);
+  uint32_t input_id = 0;
+  uint32_t q_filter_id = 1;
+  uint32_t q_bias_id = 2;
+  uint32_t k_filter_id = 3;
+  uint32_t k_bias_id = 4;
+  uint32_t v_filter_id = 5;
+  uint32_t v_bias_id = 6;
+  uint32_t q_out_id = 7;
+  uint32_t k_out_id = 8;
+  uint32_t v_out_id = 9;
+  uint32_t qk_out_id = 10;
+  uint32_t output_id = 11;
+  tester
+    .AddInputTensorF32({3, 24}, input_id)
+    .AddStaticTensorF32({40, 24}, TensorType::kDense, q_filter_id)
+    .AddStaticTensorF32({40}, TensorType::kDense, q_bias_id)
+    .AddStaticTensorF32({8, 24}, TensorType::kDense, k_filter_id)
+    .AddStaticTensorF32({8}, TensorType::kDense, k_bias_id)
+    .AddStaticTensorF32({8, 24}, TensorType::kDense, v_filter_id)
+    .AddStaticTensorF32({8}, TensorType::kDense, v_bias_id)
+    .AddDynamicTensorF32({3, 40}, q_out_id)
+    .AddDynamicTensorF32({3, 8}, k_out_id)
+    .AddDynamicTensorF32({3, 8}, v_out_id)
+    .AddDynamicTensorF32({3, 48}, qk_out_id)
+    .AddOutputTensorF32({3, 56}, output_id)
+    .AddFullyConnected(input_id, q_filter_id, q_bias_id, q_out_id)
+    .AddFullyConnected(input_id, k_filter_id, k_bias_id, k_out_id)
+    .AddFullyConnected(input_id, v_filter_id, v_bias_id, v_out_id)
+    .AddConcatenate2(1, q_out_id, k_out_id, qk_out_id)
+    .AddConcatenate2(1, qk_out_id, v_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 5);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+  const xnn_node* fused_node = tester.Node(0);
+  ASSERT_EQ(fused_node->type, xnn_node_type_fully_connected_multi_output);
+  ASSERT_EQ(fused_node->num_inputs, 7);
+  EXPECT_EQ(fused_node->inputs[0], input_id);
+  EXPECT_EQ(fused_node->inputs[1], q_filter_id);
+  EXPECT_EQ(fused_node->inputs[2], q_bias_id);
+  EXPECT_EQ(fused_node->inputs[5], v_filter_id);
+  EXPECT_EQ(fused_node->inputs[6], v_bias_id);
+  ASSERT_EQ(fused_node->num_outputs, 3);
+  EXPECT_EQ(fused_node->outputs[0], q_out_id);
+  EXPECT_EQ(fused_node->outputs[1], k_out_id);
+  EXPECT_EQ(fused_node->outputs[2], v_out_id);
+  EXPECT_EQ(tester.Node(1)->type, xnn_node_type_invalid);
+  EXPECT_EQ(tester.Node(2)->type, xnn_node_type_invalid);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(FULLY_CONNECTED_SHARING_INPUT, not_fused_with_different_activations) {
+  RuntimeTester tester(7);
+  uint32_t input_id = 0;
+  uint32_t filter1_id = 1;
+  uint32_t filter2_id = 2;
+  uint32_t fc1_out_id = 3;
+  uint32_t clamp_out_id = 4;
+  uint32_t fc2_out_id = 5;
+  uint32_t output_id = 6;
+  tester
+    .AddInputTensorF32({3, 8}, input_id)
+    .AddStaticTensorF32({8, 8}, TensorType::kDense, filter1_id)
+    .AddStaticTensorF32({8, 8}, TensorType::kDense, filter2_id)
+    .AddDynamicTensorF32({3, 8}, fc1_out_id)
+    .AddDynamicTensorF32({3, 8}, clamp_out_id)
+    .AddDynamicTensorF32({3, 8}, fc2_out_id)
+    .AddOutputTensorF32({3, 16}, output_id)
+    .AddFullyConnected(input_id, filter1_id, XNN_INVALID_VALUE_ID, fc1_out_id)
+    .AddClamp(-0.5f, 0.5f, fc1_out_id, clamp_out_id)
+    .AddFullyConnected(input_id, filter2_id, XNN_INVALID_VALUE_ID, fc2_out_id)
+    .AddConcatenate2(1, clamp_out_id, fc2_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 4);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+  EXPECT_EQ(tester.Node(0)->type, xnn_node_type_fully_connected);
+  EXPECT_EQ(tester.Node(2)->type, xnn_node_type_fully_connected);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(CONVERT_TO_QDINT8, shared_between_consumers) {
+  RuntimeTester tester(9);
+  uint32_t input_id = 0;
+  uint32_t quantized1_id = 1;
+  uint32_t filter1_id = 2;
+  uint32_t quantized2_id = 3;
+  uint32_t filter2_id = 4;
+  uint32_t fc1_out_id = 5;
+  uint32_t fc2_out_id = 6;
+  uint32_t output_id = 7;
+  std::vector<float> filter_scale(8, 0.25f);
+  tester
+    .AddInputTensorF32({3, 8}, input_id)
+    .AddDynamicallyQuantizedTensor({3, 8}, quantized1_id)
+    .AddStaticTensorQS8({8, 8}, TensorType::kDense, filter_scale.data(), filter1_id)
+    .AddDynamicallyQuantizedTensor({3, 8}, quantized2_id)
+    .AddStaticTensorQS8({8, 8}, TensorType::kDense, filter_scale.data(), filter2_id)
+    .AddDynamicTensorF32({3, 8}, fc1_out_id)
+    .AddDynamicTensorF32({3, 8}, fc2_out_id)
+    .AddOutputTensorF32({3, 16}, output_id)
+    .AddConvert(input_id, quantized1_id)
+    .AddFullyConnected(quantized1_id, filter1_id, XNN_INVALID_VALUE_ID, fc1_out_id)
+    .AddConvert(input_id, quantized2_id)
+    .AddFullyConnected(quantized2_id, filter2_id, XNN_INVALID_VALUE_ID, fc2_out_id)
+    .AddConcatenate2(1, fc1_out_id, fc2_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 5);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  EXPECT_EQ(tester.Node(0)->type, xnn_node_type_convert);
+  EXPECT_EQ(tester.Node(2)->type, xnn_node_type_invalid);
+  // Both Fully Connected Nodes now read the same quantized input, so they are also fused into a single Node.
+  ASSERT_EQ(tester.NumOperators(), 3);
+  ASSERT_EQ(tester.Node(1)->type, xnn_node_type_fully_connected_multi_output);
+  EXPECT_EQ(tester.Node(1)->inputs[0], quantized1_id);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(SIGMOID_THEN_CONVERT_TO_QDINT8, fused_into_elementwise_chain) {
+  RuntimeTester tester(6);
+  uint32_t input_id = 0;
+  uint32_t sigmoid_out_id = 1;
+  uint32_t quantized_id = 2;
+  uint32_t filter_id = 3;
+  uint32_t output_id = 4;
+  std::vector<float> filter_scale(16, 0.25f);
+  tester
+    .AddInputTensorF32({5, 1100}, input_id)
+    .AddDynamicTensorF32({5, 1100}, sigmoid_out_id)
+    .AddDynamicallyQuantizedTensor({5, 1100}, quantized_id)
+    .AddStaticTensorQS8({16, 1100}, TensorType::kDense, filter_scale.data(), filter_id)
+    .AddOutputTensorF32({5, 16}, output_id)
+    .AddUnary(xnn_unary_sigmoid, nullptr, input_id, sigmoid_out_id)
+    .AddConvert(sigmoid_out_id, quantized_id)
+    .AddFullyConnected(quantized_id, filter_id, XNN_INVALID_VALUE_ID, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+  const xnn_node* chain_node = tester.Node(1);
+  ASSERT_EQ(chain_node->type, xnn_node_type_elementwise_chain);
+  ASSERT_EQ(chain_node->params.elementwise_chain.num_ops, 1);
+  EXPECT_EQ(chain_node->params.elementwise_chain.ops[0].unary_operator, xnn_unary_sigmoid);
+  EXPECT_EQ(chain_node->inputs[0], input_id);
+  EXPECT_EQ(chain_node->outputs[0], quantized_id);
+
+  // The range of each row is found block by block, so the quantized values, and the result, are exactly the same.
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(SIGMOID_THEN_MULTIPLY, fused_into_elementwise_chain) {
+  RuntimeTester tester(3);
+  uint32_t input_id = 0;
+  uint32_t sigmoid_out_id = 1;
+  uint32_t output_id = 2;
+  tester
+    .AddInputTensorF32({2, 33, 40}, input_id)
+    .AddDynamicTensorF32({2, 33, 40}, sigmoid_out_id)
+    .AddOutputTensorF32({2, 33, 40}, output_id)
+    .AddUnary(xnn_unary_sigmoid, nullptr, input_id, sigmoid_out_id)
+    .AddMultiply(input_id, sigmoid_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 1);
+
+  const xnn_node* chain_node = tester.Node(1);
+  ASSERT_EQ(chain_node->type, xnn_node_type_elementwise_chain);
+  ASSERT_EQ(chain_node->params.elementwise_chain.num_ops, 2);
+  EXPECT_EQ(chain_node->params.elementwise_chain.ops[0].unary_operator, xnn_unary_sigmoid);
+  EXPECT_EQ(chain_node->params.elementwise_chain.ops[1].binary_operator, xnn_binary_multiply);
+  EXPECT_EQ(chain_node->params.elementwise_chain.ops[1].input_index, 0);
+  EXPECT_TRUE(chain_node->params.elementwise_chain.ops[1].input_is_first);
+  ASSERT_EQ(chain_node->num_inputs, 1);
+  EXPECT_EQ(chain_node->inputs[0], input_id);
+  EXPECT_EQ(chain_node->outputs[0], output_id);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(SUBTRACT_THEN_MULTIPLY_THEN_ADD_THEN_SUBTRACT, fused_into_elementwise_chain) {
+  RuntimeTester tester(10);
+  uint32_t a_id = 0;
+  uint32_t b_id = 1;
+  uint32_t c_id = 2;
+  uint32_t d_id = 3;
+  uint32_t sub_out_id = 4;
+  uint32_t mul_out_id = 5;
+  uint32_t add_out_id = 6;
+  uint32_t output_id = 7;
+  tester
+    .AddInputTensorF32({5, 7, 61}, a_id)
+    .AddInputTensorF32({5, 7, 61}, b_id)
+    .AddStaticTensorF32({1}, TensorType::kDense, c_id)
+    .AddInputTensorF32({5, 7, 61}, d_id)
+    .AddDynamicTensorF32({5, 7, 61}, sub_out_id)
+    .AddDynamicTensorF32({5, 7, 61}, mul_out_id)
+    .AddDynamicTensorF32({5, 7, 61}, add_out_id)
+    .AddOutputTensorF32({5, 7, 61}, output_id)
+    .AddSubtract(a_id, b_id, sub_out_id)
+    .AddMultiply(sub_out_id, c_id, mul_out_id)
+    .AddAddition(d_id, mul_out_id, add_out_id)
+    .AddSubtract(c_id, add_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 4);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 1);
+
+  const xnn_node* chain_node = tester.Node(3);
+  ASSERT_EQ(chain_node->type, xnn_node_type_elementwise_chain);
+  ASSERT_EQ(chain_node->params.elementwise_chain.num_ops, 4);
+  ASSERT_EQ(chain_node->num_inputs, 4);
+  EXPECT_EQ(chain_node->inputs[0], a_id);
+  EXPECT_EQ(chain_node->inputs[1], b_id);
+  EXPECT_EQ(chain_node->inputs[2], c_id);
+  EXPECT_EQ(chain_node->inputs[3], d_id);
+  const xnn_elementwise_chain_op* ops = chain_node->params.elementwise_chain.ops;
+  EXPECT_FALSE(ops[0].input_is_first);
+  EXPECT_FALSE(ops[0].input_is_scalar);
+  EXPECT_TRUE(ops[1].input_is_scalar);
+  EXPECT_TRUE(ops[2].input_is_first);
+  EXPECT_TRUE(ops[3].input_is_first);
+  EXPECT_TRUE(ops[3].input_is_scalar);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(TANH_GELU_FROM_PRIMITIVES, split_into_elementwise_chain_and_multiply) {
+  // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) takes 9 operations, one more than fits in a chain.
+  RuntimeTester tester(14);
+  float half = 0.5f;
+  float one = 1.0f;
+  float cubic_coefficient = 0.044715f;
+  float sqrt_2_over_pi = 0.7978846f;
+  uint32_t input_id = 0;
+  uint32_t half_id = 1;
+  uint32_t one_id = 2;
+  uint32_t cubic_coefficient_id = 3;
+  uint32_t sqrt_2_over_pi_id = 4;
+  uint32_t output_id = 13;
+  const std::vector<size_t> dims = {3, 1000};
+  tester
+    .AddInputTensorF32(dims, input_id)
+    .AddStaticTensorF32({1}, half_id, &half)
+    .AddStaticTensorF32({1}, one_id, &one)
+    .AddStaticTensorF32({1}, cubic_coefficient_id, &cubic_coefficient)
+    .AddStaticTensorF32({1}, sqrt_2_over_pi_id, &sqrt_2_over_pi);
+  for (uint32_t id = 5; id < output_id; id++) {
+    tester.AddDynamicTensorF32(dims, id);
+  }
+  tester
+    .AddOutputTensorF32(dims, output_id)
+    .AddUnary(xnn_unary_square, nullptr, input_id, 5)
+    .AddMultiply(5, input_id, 6)
+    .AddMultiply(cubic_coefficient_id, 6, 7)
+    .AddAddition(input_id, 7, 8)
+    .AddMultiply(8, sqrt_2_over_pi_id, 9)
+    .AddUnary(xnn_unary_tanh, nullptr, 9, 10)
+    .AddAddition(10, one_id, 11)
+    .AddMultiply(input_id, 11, 12)
+    .AddMultiply(12, half_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 9);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+
+  const xnn_node* chain_node = tester.Node(7);
+  ASSERT_EQ(chain_node->type, xnn_node_type_elementwise_chain);
+  EXPECT_EQ(chain_node->params.elementwise_chain.num_ops, XNN_MAX_ELEMENTWISE_CHAIN_OPS);
+  EXPECT_EQ(tester.Node(8)->type, xnn_node_type_binary_elementwise);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(SIGMOID_THEN_MULTIPLY, not_fused_into_elementwise_chain_across_external_output) {
+  RuntimeTester tester(3);
+  uint32_t input_id = 0;
+  uint32_t sigmoid_out_id = 1;
+  uint32_t output_id = 2;
+  tester
+    .AddInputTensorF32({4, 16}, input_id)
+    .AddOutputTensorF32({4, 16}, sigmoid_out_id)
+    .AddOutputTensorF32({4, 16}, output_id)
+    .AddUnary(xnn_unary_sigmoid, nullptr, input_id, sigmoid_out_id)
+    .AddMultiply(input_id, sigmoid_out_id, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(RMS_NORM_THEN_CONVERT_TO_QDINT8, fused_into_rms_norm) {
+  RuntimeTester tester(6);
+  uint32_t input_id = 0;
+  uint32_t scale_id = 1;
+  uint32_t norm_out_id = 2;
+  uint32_t quantized_id = 3;
+  uint32_t filter_id = 4;
+  uint32_t output_id = 5;
+  std::vector<float> filter_scale(16, 0.25f);
+  tester
+    .AddInputTensorF32({5, 1100}, input_id)
+    .AddStaticTensorF32({1100}, TensorType::kDense, scale_id)
+    .AddDynamicTensorF32({5, 1100}, norm_out_id)
+    .AddDynamicallyQuantizedTensor({5, 1100}, quantized_id)
+    .AddStaticTensorQS8({16, 1100}, TensorType::kDense, filter_scale.data(), filter_id)
+    .AddOutputTensorF32({5, 16}, output_id)
+    .AddRMSNorm(1.0e-5f, input_id, scale_id, norm_out_id)
+    .AddConvert(norm_out_id, quantized_id)
+    .AddFullyConnected(quantized_id, filter_id, XNN_INVALID_VALUE_ID, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+  EXPECT_EQ(tester.Node(0)->type, xnn_node_type_invalid);
+  const xnn_node* norm_node = tester.Node(1);
+  ASSERT_EQ(norm_node->type, xnn_node_type_rms_norm);
+  EXPECT_EQ(norm_node->inputs[0], input_id);
+  EXPECT_EQ(norm_node->inputs[1], scale_id);
+  EXPECT_EQ(norm_node->outputs[0], quantized_id);
+
+  // Rows are normalized by the same microkernel and quantized with the same parameters, so the results are the same.
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(LAYER_NORM_THEN_CONVERT_TO_QDINT8, fused_into_layer_norm) {
+  RuntimeTester tester(7);
+  uint32_t input_id = 0;
+  uint32_t scale_id = 1;
+  uint32_t bias_id = 2;
+  uint32_t norm_out_id = 3;
+  uint32_t quantized_id = 4;
+  uint32_t filter_id = 5;
+  uint32_t output_id = 6;
+  std::vector<float> filter_scale(16, 0.25f);
+  tester
+    .AddInputTensorF32({5, 1100}, input_id)
+    .AddStaticTensorF32({1100}, TensorType::kDense, scale_id)
+    .AddStaticTensorF32({1100}, TensorType::kDense, bias_id)
+    .AddDynamicTensorF32({5, 1100}, norm_out_id)
+    .AddDynamicallyQuantizedTensor({5, 1100}, quantized_id)
+    .AddStaticTensorQS8({16, 1100}, TensorType::kDense, filter_scale.data(), filter_id)
+    .AddOutputTensorF32({5, 16}, output_id)
+    .AddLayerNorm(1.0e-5f, input_id, scale_id, bias_id, norm_out_id)
+    .AddConvert(norm_out_id, quantized_id)
+    .AddFullyConnected(quantized_id, filter_id, XNN_INVALID_VALUE_ID, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 2);
+  const xnn_node* norm_node = tester.Node(1);
+  ASSERT_EQ(norm_node->type, xnn_node_type_layer_norm);
+  ASSERT_EQ(norm_node->num_inputs, 3);
+  EXPECT_EQ(norm_node->inputs[2], bias_id);
+  EXPECT_EQ(norm_node->outputs[0], quantized_id);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
+TEST(RMS_NORM_THEN_CONVERT_TO_QDINT8, not_fused_across_external_output) {
+  RuntimeTester tester(6);
+  uint32_t input_id = 0;
+  uint32_t scale_id = 1;
+  uint32_t norm_out_id = 2;
+  uint32_t quantized_id = 3;
+  uint32_t filter_id = 4;
+  uint32_t output_id = 5;
+  std::vector<float> filter_scale(16, 0.25f);
+  tester
+    .AddInputTensorF32({5, 64}, input_id)
+    .AddStaticTensorF32({64}, TensorType::kDense, scale_id)
+    .AddOutputTensorF32({5, 64}, norm_out_id)
+    .AddDynamicallyQuantizedTensor({5, 64}, quantized_id)
+    .AddStaticTensorQS8({16, 64}, TensorType::kDense, filter_scale.data(), filter_id)
+    .AddOutputTensorF32({5, 16}, output_id)
+    .AddRMSNorm(1.0e-5f, input_id, scale_id, norm_out_id)
+    .AddConvert(norm_out_id, quantized_id)
+    .AddFullyConnected(quantized_id, filter_id, XNN_INVALID_VALUE_ID, output_id);
+
+  xnnpack::Buffer<float> unoptimized_output = tester.RunWithoutFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+
+  xnnpack::Buffer<float> optimized_output = tester.RunWithFusion<float>();
+  ASSERT_EQ(tester.NumOperators(), 3);
+  EXPECT_EQ(tester.Node(0)->type, xnn_node_type_rms_norm);
+  EXPECT_EQ(tester.Node(1)->type, xnn_node_type_convert);
+
+  ASSERT_EQ(unoptimized_output, optimized_output);
+}
+
 }  // namespace xnnpack
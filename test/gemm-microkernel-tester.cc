@@ -2281,7 +2281,7 @@ void GemmMicrokernelTester::Test(
 void GemmMicrokernelTester::Test(
   xnn_bf16_gemm_minmax_ukernel_fn gemm_minmax,
   xnn_init_bf16_minmax_params_fn init_params,
-  xnn_pack_f16_gemm_fn pack) const
+  xnn_pack_bf16_gemm_fn pack) const
 {
   ASSERT_LE(m(), mr());
   ASSERT_GE(a_stride(), k());
@@ -2305,11 +2305,9 @@ void GemmMicrokernelTester::Test(
     std::fill(c_ref.begin(), c_ref.end(), 0.0f);
 
     std::fill(packed_w.begin(), packed_w.end(), 0);
-    pack(/*g=*/1, n(), k(), nr(), kr(), sr(),
-         reinterpret_cast<const uint16_t*>(b.data()),
-         reinterpret_cast<const uint16_t*>(bias.data()), /*scale=*/nullptr,
-         reinterpret_cast<uint16_t*>(packed_w.data()),
-         /*extra_bytes=*/0, /*params=*/nullptr);
+    pack(/*g=*/1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(),
+         /*scale=*/nullptr, packed_w.data(), /*extra_bytes=*/0,
+         /*params=*/nullptr);
 
     for (size_t m_index = 0; m_index < m(); m_index++) {
       for (size_t n_index = 0; n_index < n(); n_index++) {
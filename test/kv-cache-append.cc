@@ -0,0 +1,311 @@
+// Copyright 2024 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "xnnpack.h"
+#include "xnnpack/aligned-allocator.h"
+#include "xnnpack/common.h"
+#include "xnnpack/node-type.h"
+#include "xnnpack/subgraph.h"
+#include "replicable_random_device.h"
+#include "runtime-flags.h"
+
+class KVCacheAppendTest : public ::testing::Test {
+ protected:
+  KVCacheAppendTest() {
+    f32dist = std::uniform_real_distribution<float>(0.1f, 1.0f);
+  }
+
+  uint32_t DefineTensor(xnn_subgraph_t subgraph, const std::vector<size_t>& dims, uint32_t external_id,
+                        uint32_t flags) {
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success,
+              xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, external_id,
+                                      flags, &id));
+    return id;
+  }
+
+  xnnpack::ReplicableRandomDevice rng;
+  std::uniform_real_distribution<float> f32dist;
+};
+
+TEST_F(KVCacheAppendTest, define) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(1, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t input_id = DefineTensor(subgraph, {1, 2, 3, 8}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t cache_id = DefineTensor(subgraph, {1, 2, 16, 8}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+
+  ASSERT_EQ(xnn_status_success, xnn_define_kv_cache_append(subgraph, input_id, cache_id, /*flags=*/0));
+
+  ASSERT_EQ(subgraph->num_nodes, 1);
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(node->type, xnn_node_type_kv_cache_append);
+  ASSERT_EQ(node->num_inputs, 1);
+  ASSERT_EQ(node->inputs[0], input_id);
+  ASSERT_EQ(node->num_outputs, 1);
+  ASSERT_EQ(node->outputs[0], cache_id);
+  ASSERT_EQ(node->flags, 0);
+}
+
+TEST_F(KVCacheAppendTest, cache_must_be_persistent) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(1, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t input_id = DefineTensor(subgraph, {1, 2, 3, 8}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t cache_id = DefineTensor(subgraph, {1, 2, 16, 8}, XNN_INVALID_VALUE_ID, /*flags=*/0);
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_kv_cache_append(subgraph, input_id, cache_id, /*flags=*/0));
+}
+
+TEST_F(KVCacheAppendTest, input_dims_must_match_cache_dims) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(1, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t input_id = DefineTensor(subgraph, {1, 3, 3, 8}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t cache_id = DefineTensor(subgraph, {1, 2, 16, 8}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_kv_cache_append(subgraph, input_id, cache_id, /*flags=*/0));
+}
+
+TEST_F(KVCacheAppendTest, input_tokens_must_not_exceed_cache_capacity) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(1, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t input_id = DefineTensor(subgraph, {1, 2, 17, 8}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t cache_id = DefineTensor(subgraph, {1, 2, 16, 8}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_define_kv_cache_append(subgraph, input_id, cache_id, /*flags=*/0));
+}
+
+TEST_F(KVCacheAppendTest, set_position_validates_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t input_id = DefineTensor(subgraph, {1, 2, 3, 8}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t cache_id = DefineTensor(subgraph, {1, 2, 16, 8}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+  const uint32_t output_id = DefineTensor(subgraph, {1, 2, 16, 8}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  ASSERT_EQ(xnn_status_success, xnn_define_kv_cache_append(subgraph, input_id, cache_id, /*flags=*/0));
+  ASSERT_EQ(xnn_status_success, xnn_define_copy(subgraph, cache_id, output_id, /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_set_kv_cache_position(runtime, input_id, 0));
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_set_kv_cache_position(runtime, cache_id, 17));
+  ASSERT_EQ(xnn_status_success, xnn_set_kv_cache_position(runtime, cache_id, 16));
+
+  // Appending 3 tokens at position 14 overflows the cache.
+  ASSERT_EQ(xnn_status_success, xnn_set_kv_cache_position(runtime, cache_id, 14));
+  ASSERT_NE(xnn_status_success, xnn_reshape_runtime(runtime));
+}
+
+TEST_F(KVCacheAppendTest, appends_rows_in_place) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  const size_t heads = 2;
+  const size_t max_tokens = 16;
+  const size_t channels = 8;
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t input_id = DefineTensor(subgraph, {1, heads, 1, channels}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t cache_id =
+    DefineTensor(subgraph, {1, heads, max_tokens, channels}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+  const uint32_t output_id =
+    DefineTensor(subgraph, {1, heads, max_tokens, channels}, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  ASSERT_EQ(xnn_status_success, xnn_define_kv_cache_append(subgraph, input_id, cache_id, /*flags=*/0));
+  ASSERT_EQ(xnn_status_success, xnn_define_copy(subgraph, cache_id, output_id, /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  std::vector<float> expected(heads * max_tokens * channels, 0.0f);
+  std::vector<float> output(heads * max_tokens * channels);
+  size_t position = 0;
+  for (size_t new_tokens : {3, 1, 2}) {
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + heads * new_tokens * channels);
+    std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+    for (size_t h = 0; h < heads; h++) {
+      std::copy_n(&input[h * new_tokens * channels], new_tokens * channels,
+                  &expected[(h * max_tokens + position) * channels]);
+    }
+
+    const std::array<size_t, 4> input_dims = {1, heads, new_tokens, channels};
+    ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, input_id, input_dims.size(), input_dims.data()));
+    ASSERT_EQ(xnn_status_success, xnn_set_kv_cache_position(runtime, cache_id, position));
+    ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime));
+    const std::array<xnn_external_value, 2> external = {
+      xnn_external_value{input_id, input.data()},
+      xnn_external_value{output_id, output.data()}};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime_v2(runtime, external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    position += new_tokens;
+
+    for (size_t h = 0; h < heads; h++) {
+      for (size_t i = 0; i < position * channels; i++) {
+        ASSERT_EQ(output[h * max_tokens * channels + i], expected[h * max_tokens * channels + i])
+          << "head " << h << " offset " << i << " after " << position << " tokens";
+      }
+    }
+  }
+}
+
+TEST_F(KVCacheAppendTest, decode_matches_attention_over_full_history) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  const size_t query_heads = 4;
+  const size_t key_value_heads = 2;
+  const size_t max_tokens = 32;
+  const size_t channels = 8;
+  const size_t value_channels = 6;
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(5, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  const uint32_t query_id = DefineTensor(subgraph, {1, query_heads, 1, channels}, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t new_key_id =
+    DefineTensor(subgraph, {1, key_value_heads, 1, channels}, 1, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t new_value_id =
+    DefineTensor(subgraph, {1, key_value_heads, 1, value_channels}, 2, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t scale_id = DefineTensor(subgraph, {channels}, 3, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id =
+    DefineTensor(subgraph, {1, query_heads, 1, value_channels}, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t key_cache_id = DefineTensor(
+    subgraph, {1, key_value_heads, max_tokens, channels}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+  const uint32_t value_cache_id = DefineTensor(
+    subgraph, {1, key_value_heads, max_tokens, value_channels}, XNN_INVALID_VALUE_ID, XNN_VALUE_FLAG_PERSISTENT);
+
+  ASSERT_EQ(xnn_status_success, xnn_define_kv_cache_append(subgraph, new_key_id, key_cache_id, /*flags=*/0));
+  ASSERT_EQ(xnn_status_success, xnn_define_kv_cache_append(subgraph, new_value_id, value_cache_id, /*flags=*/0));
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_scaled_dot_product_attention(
+      subgraph, xnn_attention_logits_cap_type_none, /*cap_params=*/nullptr, query_id, key_cache_id, value_cache_id,
+      scale_id, /*mask_id=*/XNN_INVALID_VALUE_ID, output_id, XNN_FLAG_CAUSAL_MASK));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  std::vector<float> scale(XNN_EXTRA_BYTES / sizeof(float) + channels);
+  std::generate(scale.begin(), scale.end(), [&]() { return f32dist(rng); });
+
+  // Full key/value history, used as reference input to the operator API.
+  std::vector<std::vector<float>> key_history(key_value_heads);
+  std::vector<std::vector<float>> value_history(key_value_heads);
+
+  size_t position = 0;
+  // Prefill a prompt, then decode one token at a time.
+  for (size_t new_tokens : {5, 1, 1, 3, 1}) {
+    std::vector<float> query(XNN_EXTRA_BYTES / sizeof(float) + query_heads * new_tokens * channels);
+    std::vector<float> new_key(XNN_EXTRA_BYTES / sizeof(float) + key_value_heads * new_tokens * channels);
+    std::vector<float> new_value(XNN_EXTRA_BYTES / sizeof(float) + key_value_heads * new_tokens * value_channels);
+    std::generate(query.begin(), query.end(), [&]() { return f32dist(rng); });
+    std::generate(new_key.begin(), new_key.end(), [&]() { return f32dist(rng); });
+    std::generate(new_value.begin(), new_value.end(), [&]() { return f32dist(rng); });
+    for (size_t h = 0; h < key_value_heads; h++) {
+      key_history[h].insert(key_history[h].end(), &new_key[h * new_tokens * channels],
+                            &new_key[(h + 1) * new_tokens * channels]);
+      value_history[h].insert(value_history[h].end(), &new_value[h * new_tokens * value_channels],
+                              &new_value[(h + 1) * new_tokens * value_channels]);
+    }
+    const size_t key_value_tokens = position + new_tokens;
+
+    // Call operator API on the full history.
+    std::vector<float> key(XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> value(XNN_EXTRA_BYTES / sizeof(float));
+    for (size_t h = 0; h < key_value_heads; h++) {
+      key.insert(key.end() - XNN_EXTRA_BYTES / sizeof(float), key_history[h].begin(), key_history[h].end());
+      value.insert(value.end() - XNN_EXTRA_BYTES / sizeof(float), value_history[h].begin(), value_history[h].end());
+    }
+    std::vector<float> operator_output(query_heads * new_tokens * value_channels);
+    xnn_operator_t op = nullptr;
+    const xnn_status status = xnn_create_scaled_dot_product_attention_nhtc_f32(
+      xnn_attention_logits_cap_type_none, /*cap_params=*/nullptr, XNN_FLAG_CAUSAL_MASK, &op);
+    std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+    if (status == xnn_status_unsupported_hardware) {
+      GTEST_SKIP();
+    }
+    ASSERT_EQ(xnn_status_success, status);
+    size_t workspace_size = 0;
+    size_t workspace_alignment = 0;
+    ASSERT_EQ(
+      xnn_status_success,
+      xnn_reshape_scaled_dot_product_attention_nhtc_f32(
+        op, /*batch_size=*/1, query_heads, new_tokens, key_value_heads, key_value_tokens, channels, value_channels,
+        &workspace_size, &workspace_alignment, /*threadpool=*/nullptr));
+    std::vector<char, AlignedAllocator<char, XNN_ALLOCATION_ALIGNMENT>> workspace(workspace_size);
+    ASSERT_EQ(
+      xnn_status_success,
+      xnn_setup_scaled_dot_product_attention_nhtc_f32(
+        op, workspace.data(), query.data(), key.data(), value.data(), scale.data(), /*mask=*/nullptr,
+        operator_output.data()));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+    // Run the subgraph, which only receives the new tokens.
+    const std::array<size_t, 4> query_dims = {1, query_heads, new_tokens, channels};
+    const std::array<size_t, 4> new_key_dims = {1, key_value_heads, new_tokens, channels};
+    const std::array<size_t, 4> new_value_dims = {1, key_value_heads, new_tokens, value_channels};
+    const std::array<size_t, 4> output_dims = {1, query_heads, new_tokens, value_channels};
+    ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, query_id, query_dims.size(), query_dims.data()));
+    ASSERT_EQ(xnn_status_success,
+              xnn_reshape_external_value(runtime, new_key_id, new_key_dims.size(), new_key_dims.data()));
+    ASSERT_EQ(xnn_status_success,
+              xnn_reshape_external_value(runtime, new_value_id, new_value_dims.size(), new_value_dims.data()));
+    ASSERT_EQ(xnn_status_success,
+              xnn_reshape_external_value(runtime, output_id, output_dims.size(), output_dims.data()));
+    ASSERT_EQ(xnn_status_success, xnn_set_kv_cache_position(runtime, key_cache_id, position));
+    ASSERT_EQ(xnn_status_success, xnn_set_kv_cache_position(runtime, value_cache_id, position));
+    ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime));
+
+    std::vector<float> subgraph_output(query_heads * new_tokens * value_channels);
+    const std::array<xnn_external_value, 5> external = {
+      xnn_external_value{query_id, query.data()},
+      xnn_external_value{new_key_id, new_key.data()},
+      xnn_external_value{new_value_id, new_value.data()},
+      xnn_external_value{scale_id, scale.data()},
+      xnn_external_value{output_id, subgraph_output.data()}};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime_v2(runtime, external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+    for (size_t i = 0; i < operator_output.size(); i++) {
+      ASSERT_NEAR(subgraph_output[i], operator_output[i],
+                  std::abs(operator_output[i]) * 5 * std::numeric_limits<float>::epsilon())
+        << "at offset " << i << " after " << key_value_tokens << " tokens";
+    }
+    position = key_value_tokens;
+  }
+}
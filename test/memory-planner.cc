@@ -25,6 +25,7 @@ TEST(MemoryPlanner, ValueLiveInfo) {
   struct xnn_runtime runtime;
   runtime.num_values = 4;
   runtime.num_ops = 2;
+  runtime.op_stage = nullptr;
   struct xnn_operator_data nodes[2];
   nodes[0].num_inputs = 2;
   nodes[0].inputs[0] = 0;
@@ -213,7 +214,7 @@ TEST(MemoryPlanner, LeakyReluInPlaceAfterConv) {
         input_id, filter_id, bias_id, conv_out)
     .AddLeakyRelu(1.0f, conv_out, leaky_relu_out)
     .AddClamp(0.0f, 1.0f, leaky_relu_out, output_id);
-  tester.CreateRuntime(xnn_test_runtime_flags());
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION);
   tester.SetupRuntime();
 
   xnn_runtime_t runtime = tester.Runtime();
@@ -303,7 +304,7 @@ TEST(MemoryPlanner, HardSwishAndLeakyReluInPlaceAfterConv) {
     .AddLeakyRelu(1.0f, conv_out, leaky_relu_out)
     .AddHardSwish(leaky_relu_out, hard_swish_out)
     .AddClamp(0.0f, 1.0f, hard_swish_out, output_id);
-  tester.CreateRuntime(xnn_test_runtime_flags());
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION);
   tester.SetupRuntime();
 
   xnn_runtime_t runtime = tester.Runtime();
@@ -328,7 +329,7 @@ TEST(MemoryPlanner, ExternalInputsCannotBeInPlace) {
       .AddOutputTensorF32({1, 3, 3, 3}, output_id)
       .AddLeakyRelu(1.0f, input_id, leaky_relu_out)
       .AddClamp(0.0f, 1.0f, leaky_relu_out, output_id);
-  tester.CreateRuntime(xnn_test_runtime_flags());
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION);
   tester.SetupRuntime();
 
   xnn_runtime_t runtime = tester.Runtime();
@@ -421,7 +422,8 @@ TEST(MemoryPlanner, Add2WithLHSConstantInPlace) {
         input_id, filter_id, bias_id, conv_out)
     .AddAddition(add_constant_input_id, conv_out, add_out_id)
     .AddLeakyRelu(1.0f, add_out_id, output_id);
-  tester.CreateRuntime(xnn_test_runtime_flags());
+  // Keep the Add and Leaky ReLU as separate operators to exercise in-place memory planning.
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION);
   tester.SetupRuntime();
   xnn_runtime_t runtime = tester.Runtime();
 
@@ -505,7 +507,8 @@ TEST(MemoryPlanner, Add2WithRHSConstantInPlace) {
         input_id, filter_id, bias_id, conv_out)
     .AddAddition(conv_out, add_constant_input_id, add_out_id)
     .AddLeakyRelu(1.0f, add_out_id, output_id);
-  tester.CreateRuntime(xnn_test_runtime_flags());
+  // Keep the Add and Leaky ReLU as separate operators to exercise in-place memory planning.
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION);
   tester.SetupRuntime();
   xnn_runtime_t runtime = tester.Runtime();
 
@@ -587,7 +590,7 @@ TEST(MemoryPlanner, Mul2WithRHSConstant) {
         input_id, filter_id, bias_id, conv_out)
     .AddMultiply(conv_out, mul_constant_input_id, mul_out_id)
     .AddLeakyRelu(1.0f, mul_out_id, output_id);
-  tester.CreateRuntime(xnn_test_runtime_flags());
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION);
   tester.SetupRuntime();
   xnn_runtime_t runtime = tester.Runtime();
 
@@ -904,4 +907,213 @@ TEST(MemoryPlanner, FullyConnectedExternalFilterExternalBias) {
             + MEMORY_ARENA_EXTRA_BYTES);
 }
 
+TEST(MemoryPlanner, ConcatenateInputsAreViewsOfOutput) {
+  //  input1       input2
+  //    |            |
+  // LeakyRelu   LeakyRelu
+  //      \        /
+  //     Concatenate
+  //          |
+  //      LeakyRelu
+  //          |
+  //        output
+  uint32_t input1_id = 0;
+  uint32_t input2_id = 1;
+  uint32_t leaky_relu1_out = 2;
+  uint32_t leaky_relu2_out = 3;
+  uint32_t concat_out = 4;
+  uint32_t output_id = 5;
+
+  RuntimeTester tester(6);
+  tester
+    .AddInputTensorF32({1, 2, 2, 3}, input1_id)
+    .AddInputTensorF32({1, 3, 2, 3}, input2_id)
+    .AddDynamicTensorF32({1, 2, 2, 3}, leaky_relu1_out)
+    .AddDynamicTensorF32({1, 3, 2, 3}, leaky_relu2_out)
+    .AddDynamicTensorF32({1, 5, 2, 3}, concat_out)
+    .AddOutputTensorF32({1, 5, 2, 3}, output_id)
+    .AddLeakyRelu(0.5f, input1_id, leaky_relu1_out)
+    .AddLeakyRelu(0.5f, input2_id, leaky_relu2_out)
+    .AddConcatenate2(/*axis=*/1, leaky_relu1_out, leaky_relu2_out, concat_out)
+    .AddLeakyRelu(1.0f, concat_out, output_id);
+  xnnpack::Buffer<float> output = tester.RunWithFusion<float>();
+  xnn_runtime_t runtime = tester.Runtime();
+
+  // Leaky Relus write directly into the output of Concatenate, so only the output of Concatenate needs space.
+  ASSERT_EQ(runtime->workspace->size,
+            xnn_tensor_get_rounded_size(&runtime->values[concat_out]) + MEMORY_ARENA_EXTRA_BYTES);
+  ASSERT_EQ(runtime->values[leaky_relu1_out].data, runtime->values[concat_out].data);
+  ASSERT_EQ(runtime->values[leaky_relu2_out].data,
+            (void*) ((uintptr_t) runtime->values[concat_out].data + 2 * 2 * 3 * sizeof(float)));
+
+  const float* input1 = tester.GetExternalTensorDataF32(input1_id);
+  const float* input2 = tester.GetExternalTensorDataF32(input2_id);
+  for (size_t i = 0; i < 12; i++) {
+    ASSERT_EQ(output[i], input1[i] < 0.0f ? input1[i] * 0.5f : input1[i]);
+  }
+  for (size_t i = 0; i < 18; i++) {
+    ASSERT_EQ(output[12 + i], input2[i] < 0.0f ? input2[i] * 0.5f : input2[i]);
+  }
+}
+
+TEST(MemoryPlanner, ConcatenateWithNonUnitBatchIsNotAView) {
+  uint32_t input1_id = 0;
+  uint32_t input2_id = 1;
+  uint32_t leaky_relu1_out = 2;
+  uint32_t leaky_relu2_out = 3;
+  uint32_t concat_out = 4;
+  uint32_t output_id = 5;
+
+  RuntimeTester tester(6);
+  tester
+    .AddInputTensorF32({2, 2, 2, 3}, input1_id)
+    .AddInputTensorF32({2, 3, 2, 3}, input2_id)
+    .AddDynamicTensorF32({2, 2, 2, 3}, leaky_relu1_out)
+    .AddDynamicTensorF32({2, 3, 2, 3}, leaky_relu2_out)
+    .AddDynamicTensorF32({2, 5, 2, 3}, concat_out)
+    .AddOutputTensorF32({2, 5, 2, 3}, output_id)
+    .AddLeakyRelu(0.5f, input1_id, leaky_relu1_out)
+    .AddLeakyRelu(0.5f, input2_id, leaky_relu2_out)
+    .AddConcatenate2(/*axis=*/1, leaky_relu1_out, leaky_relu2_out, concat_out)
+    .AddLeakyRelu(1.0f, concat_out, output_id);
+  tester.CreateRuntime(xnn_test_runtime_flags());
+  tester.SetupRuntime();
+  xnn_runtime_t runtime = tester.Runtime();
+
+  // Inputs are interleaved in the output, so they must be copied.
+  ASSERT_NE(runtime->values[leaky_relu1_out].data, runtime->values[concat_out].data);
+  ASSERT_NE(runtime->values[leaky_relu2_out].data, runtime->values[concat_out].data);
+}
+
+TEST(MemoryPlanner, ConcatenateInputsAreViewsOfOutputAfterReshape) {
+  uint32_t input1_id = 0;
+  uint32_t input2_id = 1;
+  uint32_t leaky_relu1_out = 2;
+  uint32_t leaky_relu2_out = 3;
+  uint32_t concat_out = 4;
+  uint32_t output_id = 5;
+
+  RuntimeTester tester(6);
+  tester
+    .AddInputTensorF32({1, 4, 3}, input1_id)
+    .AddInputTensorF32({1, 2, 3}, input2_id)
+    .AddDynamicTensorF32({1, 4, 3}, leaky_relu1_out)
+    .AddDynamicTensorF32({1, 2, 3}, leaky_relu2_out)
+    .AddDynamicTensorF32({1, 6, 3}, concat_out)
+    .AddOutputTensorF32({1, 6, 3}, output_id)
+    .AddLeakyRelu(0.5f, input1_id, leaky_relu1_out)
+    .AddLeakyRelu(0.5f, input2_id, leaky_relu2_out)
+    .AddConcatenate2(/*axis=*/1, leaky_relu1_out, leaky_relu2_out, concat_out)
+    .AddLeakyRelu(1.0f, concat_out, output_id);
+  tester.RunWithFusion<float>();
+
+  // Shrink the first input, which moves the second input within the output of Concatenate.
+  tester.ReshapeInput({1, 1, 3}, input1_id);
+  tester.ReshapeRuntime();
+  tester.SetupRuntimeV2();
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(tester.Runtime()));
+  xnn_runtime_t runtime = tester.Runtime();
+  ASSERT_EQ(runtime->values[leaky_relu2_out].data,
+            (void*) ((uintptr_t) runtime->values[concat_out].data + 1 * 3 * sizeof(float)));
+
+  const float* input1 = tester.GetExternalTensorDataF32(input1_id);
+  const float* input2 = tester.GetExternalTensorDataF32(input2_id);
+  const float* output = tester.GetExternalTensorDataF32(output_id);
+  for (size_t i = 0; i < 3; i++) {
+    ASSERT_EQ(output[i], input1[i] < 0.0f ? input1[i] * 0.5f : input1[i]);
+  }
+  for (size_t i = 0; i < 6; i++) {
+    ASSERT_EQ(output[3 + i], input2[i] < 0.0f ? input2[i] * 0.5f : input2[i]);
+  }
+}
+
+TEST(MemoryPlanner, EvenSplitOutputsAreViewsOfInput) {
+  //     input
+  //       |
+  //   LeakyRelu
+  //       |
+  //   Even Split
+  //     /    \
+  //     \    /
+  //      Add
+  //       |
+  //     output
+  uint32_t input_id = 0;
+  uint32_t leaky_relu_out = 1;
+  uint32_t split_out1 = 2;
+  uint32_t split_out2 = 3;
+  uint32_t output_id = 4;
+
+  RuntimeTester tester(5);
+  tester
+    .AddInputTensorF32({1, 6, 2, 2}, input_id)
+    .AddDynamicTensorF32({1, 6, 2, 2}, leaky_relu_out)
+    .AddDynamicTensorF32({1, 3, 2, 2}, split_out1)
+    .AddDynamicTensorF32({1, 3, 2, 2}, split_out2)
+    .AddOutputTensorF32({1, 3, 2, 2}, output_id)
+    .AddLeakyRelu(0.5f, input_id, leaky_relu_out)
+    .AddEvenSplit2(/*split_dim=*/1, leaky_relu_out, split_out1, split_out2)
+    .AddAddition(split_out1, split_out2, output_id);
+  xnnpack::Buffer<float> output = tester.RunWithFusion<float>();
+  xnn_runtime_t runtime = tester.Runtime();
+
+  // Add reads directly from the output of Leaky Relu, so only the output of Leaky Relu needs space.
+  ASSERT_EQ(runtime->workspace->size,
+            xnn_tensor_get_rounded_size(&runtime->values[leaky_relu_out]) + MEMORY_ARENA_EXTRA_BYTES);
+  ASSERT_EQ(runtime->values[split_out1].data, runtime->values[leaky_relu_out].data);
+  ASSERT_EQ(runtime->values[split_out2].data,
+            (void*) ((uintptr_t) runtime->values[leaky_relu_out].data + 3 * 2 * 2 * sizeof(float)));
+
+  const float* input = tester.GetExternalTensorDataF32(input_id);
+  for (size_t i = 0; i < 12; i++) {
+    const float x1 = input[i] < 0.0f ? input[i] * 0.5f : input[i];
+    const float x2 = input[12 + i] < 0.0f ? input[12 + i] * 0.5f : input[12 + i];
+    ASSERT_EQ(output[i], x1 + x2);
+  }
+}
+
+TEST(MemoryPlanner, ConcurrentOperatorsDoNotShareMemory) {
+  //        input
+  //       /     \
+  // LeakyRelu  LeakyRelu
+  //     |        |
+  // LeakyRelu    |
+  //       \     /
+  //         Add
+  //          |
+  //        output
+  uint32_t input_id = 0;
+  uint32_t leaky_relu1_out = 1;
+  uint32_t leaky_relu2_out = 2;
+  uint32_t leaky_relu3_out = 3;
+  uint32_t output_id = 4;
+
+  RuntimeTester tester(5);
+  tester
+    .AddInputTensorF32({1, 3, 3, 3}, input_id)
+    .AddDynamicTensorF32({1, 3, 3, 3}, leaky_relu1_out)
+    .AddDynamicTensorF32({1, 3, 3, 3}, leaky_relu2_out)
+    .AddDynamicTensorF32({1, 3, 3, 3}, leaky_relu3_out)
+    .AddOutputTensorF32({1, 3, 3, 3}, output_id)
+    .AddLeakyRelu(0.5f, input_id, leaky_relu1_out)
+    .AddLeakyRelu(0.5f, leaky_relu1_out, leaky_relu2_out)
+    .AddLeakyRelu(0.5f, input_id, leaky_relu3_out)
+    .AddAddition(leaky_relu2_out, leaky_relu3_out, output_id);
+  tester.CreateRuntime(xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION | XNN_FLAG_INTER_OPERATOR_PARALLELISM);
+  tester.SetupRuntime();
+  xnn_runtime_t runtime = tester.Runtime();
+
+  ASSERT_EQ(runtime->num_stages, 3);
+  ASSERT_EQ(runtime->op_stage[0], 0);
+  ASSERT_EQ(runtime->op_stage[1], 1);
+  ASSERT_EQ(runtime->op_stage[2], 0);
+  ASSERT_EQ(runtime->op_stage[3], 2);
+  // Run in order, the third Leaky Relu could reuse the output of the first one, but the two may run concurrently.
+  ASSERT_NE(runtime->values[leaky_relu1_out].data, runtime->values[leaky_relu3_out].data);
+  ASSERT_NE(runtime->values[leaky_relu1_out].data, runtime->values[leaky_relu2_out].data);
+  ASSERT_NE(runtime->values[leaky_relu2_out].data, runtime->values[leaky_relu3_out].data);
+  ASSERT_EQ(runtime->workspace->size,
+            3 * xnn_tensor_get_rounded_size(&runtime->values[leaky_relu1_out]) + MEMORY_ARENA_EXTRA_BYTES);
+}
+
 } // namespace xnnpack
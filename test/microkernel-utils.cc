@@ -158,3 +158,104 @@ TEST(MULTIPASS_DWCONV_ELEMENTS_WRITTEN, different_accumulator_size) {
               /*channels=*/16, /*channel_round=*/4,
               /*log2_accumulator_size=*/2, /*log2_output_size=*/0));
 }
+
+TEST(GEMM_BEST_TILE_SIZE, fits_in_cache) {
+  xnnpack::ReplicableRandomDevice rnd;
+  std::uniform_int_distribution<size_t> rnd_kernel_dim(1, XNN_MAX_MR);
+  std::uniform_int_distribution<size_t> rnd_tensor_dim(1, 1000);
+  std::uniform_int_distribution<size_t> rnd_stride(1, 64 * 1024);
+  std::uniform_int_distribution<size_t> rnd_thread_dim(1, 16);
+  const size_t kNumTrials = 1000;
+
+  for (size_t trial = 0; trial < kNumTrials; trial++) {
+    const size_t mr = rnd_kernel_dim(rnd);
+    const size_t nr = 8 * rnd_kernel_dim(rnd);
+    const size_t m = rnd_tensor_dim(rnd);
+    const size_t n = rnd_tensor_dim(rnd);
+    const size_t m_stride = rnd_stride(rnd);
+    const size_t n_stride = rnd_stride(rnd);
+    const size_t num_threads = rnd_thread_dim(rnd);
+    const size_t cache_size = 1024 * 1024;
+
+    size_t mc = 0;
+    size_t nc = 0;
+    xnn_gemm_best_tile_size(/*num_groups=*/1, m, n, m_stride, n_stride, mr, nr, num_threads, cache_size, &mc, &nc);
+
+    EXPECT_EQ(mc % mr, 0) << "Not a multiple of `mr`";
+    EXPECT_TRUE(nc == n || nc % nr == 0) << "Not a multiple of `nr`";
+    EXPECT_LE(mc, round_up(m, mr));
+    EXPECT_LE(nc, n);
+    if (mr < mc) {
+      EXPECT_LE(mc * m_stride, cache_size / 2)
+          << "Rows of A don't fit in the cache, m=" << m << ", mr=" << mr << ", mc=" << mc;
+      if (num_threads > 1) {
+        EXPECT_LE(XNN_GEMM_TILES_PER_THREAD * num_threads, divide_round_up(m, mc) * divide_round_up(n, nc))
+            << "Didn't generate enough tiles, m=" << m << ", n=" << n << ", mc=" << mc << ", nc=" << nc
+            << ", num_threads=" << num_threads;
+      }
+    }
+    if (nr < nc) {
+      EXPECT_LE(nc * n_stride, cache_size / 2)
+          << "Weights don't fit in the cache, n=" << n << ", nr=" << nr << ", nc=" << nc;
+    }
+  }
+}
+
+TEST(GEMM_BEST_TILE_SIZE, unknown_cache_size) {
+  size_t mc = 0;
+  size_t nc = 0;
+  xnn_gemm_best_tile_size(/*num_groups=*/1, /*m=*/64, /*n=*/1024, /*m_stride=*/16384, /*n_stride=*/16388, /*mr=*/4,
+                          /*nr=*/16, /*num_threads=*/1, /*cache_size=*/0, &mc, &nc);
+  EXPECT_EQ(mc, 4);
+  EXPECT_EQ(nc, 1024);
+}
+
+TEST(GEMM_BEST_TILE_SIZE, single_thread) {
+  // Half of the cache holds 32 rows of A or 31 columns of weights.
+  size_t mc = 0;
+  size_t nc = 0;
+  xnn_gemm_best_tile_size(/*num_groups=*/1, /*m=*/64, /*n=*/1024, /*m_stride=*/16384, /*n_stride=*/16388, /*mr=*/4,
+                          /*nr=*/16, /*num_threads=*/1, /*cache_size=*/1024 * 1024, &mc, &nc);
+  EXPECT_EQ(mc, 32);
+  EXPECT_EQ(nc, 16);
+}
+
+TEST(GEMM_BEST_TILE_SIZE, multithreaded) {
+  // 20 tiles are needed for 4 threads.
+  size_t mc = 0;
+  size_t nc = 0;
+  xnn_gemm_best_tile_size(/*num_groups=*/1, /*m=*/1024, /*n=*/64, /*m_stride=*/256, /*n_stride=*/260, /*mr=*/4,
+                          /*nr=*/16, /*num_threads=*/4, /*cache_size=*/1024 * 1024, &mc, &nc);
+  EXPECT_EQ(mc, 48);
+  EXPECT_EQ(nc, 64);
+}
+
+TEST(GEMM_BEST_K_SPLITS, single_thread) {
+  ASSERT_EQ(1, xnn_gemm_best_k_splits(/*m=*/1, /*n=*/32, /*k=*/4096, /*mr=*/1, /*nr=*/32, /*num_threads=*/1));
+}
+
+TEST(GEMM_BEST_K_SPLITS, enough_tiles) {
+  // 64 tiles are enough for 8 threads.
+  ASSERT_EQ(1, xnn_gemm_best_k_splits(/*m=*/1, /*n=*/2048, /*k=*/4096, /*mr=*/1, /*nr=*/32, /*num_threads=*/8));
+}
+
+TEST(GEMM_BEST_K_SPLITS, few_tiles) {
+  // 4 tiles, 40 are needed for 8 threads.
+  ASSERT_EQ(10, xnn_gemm_best_k_splits(/*m=*/1, /*n=*/128, /*k=*/4096, /*mr=*/1, /*nr=*/32, /*num_threads=*/8));
+}
+
+TEST(GEMM_BEST_K_SPLITS, limited_by_min_k_split_size) {
+  // 1 tile, 40 are needed for 8 threads, but slices must have at least XNN_GEMM_MIN_K_SPLIT_SIZE elements.
+  ASSERT_EQ(4096 / XNN_GEMM_MIN_K_SPLIT_SIZE,
+            xnn_gemm_best_k_splits(/*m=*/1, /*n=*/32, /*k=*/4096, /*mr=*/1, /*nr=*/32, /*num_threads=*/8));
+}
+
+TEST(GEMM_BEST_K_SPLITS, limited_by_m) {
+  // Slices must have at least XNN_GEMM_K_SPLIT_MIN_RATIO elements per row of A.
+  ASSERT_EQ(4096 / (XNN_GEMM_K_SPLIT_MIN_RATIO * 64),
+            xnn_gemm_best_k_splits(/*m=*/64, /*n=*/32, /*k=*/4096, /*mr=*/64, /*nr=*/32, /*num_threads=*/64));
+}
+
+TEST(GEMM_BEST_K_SPLITS, small_k) {
+  ASSERT_EQ(1, xnn_gemm_best_k_splits(/*m=*/1, /*n=*/32, /*k=*/256, /*mr=*/1, /*nr=*/32, /*num_threads=*/8));
+}
@@ -0,0 +1,544 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+#include "norm-operator-tester.h"
+
+
+TEST(LAYER_NORM_NC_F16, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F16, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F16, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F16, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F16, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F16, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F16, large_epsilon) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .epsilon(1.0f)
+    .TestF16();
+}
+
+TEST(LAYER_NORM_NC_F32, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F32, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F32, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F32, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F32, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F32, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F32, large_epsilon) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .epsilon(1.0f)
+    .TestF32();
+}
+
+TEST(LAYER_NORM_NC_F16_QD8, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF16QD8();
+}
+
+TEST(LAYER_NORM_NC_F16_QD8, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF16QD8();
+}
+
+TEST(LAYER_NORM_NC_F16_QD8, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF16QD8();
+}
+
+TEST(LAYER_NORM_NC_F16_QD8, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF16QD8();
+}
+
+TEST(LAYER_NORM_NC_F16_QD8, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF16QD8();
+}
+
+TEST(LAYER_NORM_NC_F16_QD8, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF16QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QD8, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF32QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QD8, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF32QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QD8, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF32QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QD8, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF32QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QD8, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF32QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QD8, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF32QD8();
+}
+
+TEST(LAYER_NORM_NC_F32_QDU8, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF32QDU8();
+}
+
+TEST(LAYER_NORM_NC_F32_QDU8, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF32QDU8();
+}
+
+TEST(LAYER_NORM_NC_F32_QDU8, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF32QDU8();
+}
+
+TEST(LAYER_NORM_NC_F32_QDU8, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF32QDU8();
+}
+
+TEST(LAYER_NORM_NC_F32_QDU8, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF32QDU8();
+}
+
+TEST(LAYER_NORM_NC_F32_QDU8, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kLayerNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF32QDU8();
+}
+
+TEST(RMS_NORM_NC_F16, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F16, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F16, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F16, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F16, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F16, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F16, large_epsilon) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .epsilon(1.0f)
+    .TestF16();
+}
+
+TEST(RMS_NORM_NC_F32, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F32, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F32, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F32, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F32, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F32, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F32, large_epsilon) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .epsilon(1.0f)
+    .TestF32();
+}
+
+TEST(RMS_NORM_NC_F16_QD8, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF16QD8();
+}
+
+TEST(RMS_NORM_NC_F16_QD8, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF16QD8();
+}
+
+TEST(RMS_NORM_NC_F16_QD8, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF16QD8();
+}
+
+TEST(RMS_NORM_NC_F16_QD8, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF16QD8();
+}
+
+TEST(RMS_NORM_NC_F16_QD8, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF16QD8();
+}
+
+TEST(RMS_NORM_NC_F16_QD8, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF16QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QD8, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF32QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QD8, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF32QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QD8, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF32QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QD8, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF32QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QD8, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF32QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QD8, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF32QD8();
+}
+
+TEST(RMS_NORM_NC_F32_QDU8, single_channel) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(1)
+    .TestF32QDU8();
+}
+
+TEST(RMS_NORM_NC_F32_QDU8, small_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(7)
+    .TestF32QDU8();
+}
+
+TEST(RMS_NORM_NC_F32_QDU8, multiple_channels) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(1)
+    .channels(100)
+    .TestF32QDU8();
+}
+
+TEST(RMS_NORM_NC_F32_QDU8, nonunit_batch) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .TestF32QDU8();
+}
+
+TEST(RMS_NORM_NC_F32_QDU8, input_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .input_stride(129)
+    .TestF32QDU8();
+}
+
+TEST(RMS_NORM_NC_F32_QDU8, output_stride) {
+  NormOperatorTester()
+    .norm_type(NormOperatorTester::NormType::kRMSNorm)
+    .batch_size(13)
+    .channels(100)
+    .output_stride(117)
+    .TestF32QDU8();
+}
@@ -0,0 +1,263 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "xnnpack.h"
+#include "xnnpack/buffer.h"
+#include "xnnpack/math.h"
+#include "replicable_random_device.h"
+
+class NormOperatorTester {
+ public:
+  enum class NormType {
+    kLayerNorm,
+    kRMSNorm,
+  };
+
+  NormOperatorTester& norm_type(NormType norm_type) {
+    this->norm_type_ = norm_type;
+    return *this;
+  }
+
+  NormType norm_type() const {
+    return this->norm_type_;
+  }
+
+  NormOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  size_t channels() const {
+    return this->channels_;
+  }
+
+  NormOperatorTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->input_stride_ >= this->channels_);
+      return this->input_stride_;
+    }
+  }
+
+  NormOperatorTester& output_stride(size_t output_stride) {
+    assert(output_stride != 0);
+    this->output_stride_ = output_stride;
+    return *this;
+  }
+
+  size_t output_stride() const {
+    if (this->output_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->output_stride_ >= this->channels_);
+      return this->output_stride_;
+    }
+  }
+
+  NormOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  NormOperatorTester& epsilon(float epsilon) {
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  float epsilon() const {
+    return this->epsilon_;
+  }
+
+  NormOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF16() const {
+    Test<xnn_float16, xnn_float16>(xnn_datatype_fp16, xnn_datatype_fp16);
+  }
+
+  void TestF32() const {
+    Test<float, float>(xnn_datatype_fp32, xnn_datatype_fp32);
+  }
+
+  void TestF16QD8() const {
+    Test<xnn_float16, int8_t>(xnn_datatype_fp16, xnn_datatype_qdint8);
+  }
+
+  void TestF32QD8() const {
+    Test<float, int8_t>(xnn_datatype_fp32, xnn_datatype_qdint8);
+  }
+
+  void TestF32QDU8() const {
+    Test<float, uint8_t>(xnn_datatype_fp32, xnn_datatype_qduint8);
+  }
+
+ private:
+  template <typename In, typename Out>
+  void Test(xnn_datatype input_datatype, xnn_datatype output_datatype) const {
+    const bool quantized_output =
+      output_datatype == xnn_datatype_qdint8 || output_datatype == xnn_datatype_qduint8;
+
+    xnnpack::ReplicableRandomDevice rng;
+    std::uniform_real_distribution<float> f32dist(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> scaledist(0.5f, 2.0f);
+    std::uniform_real_distribution<float> biasdist(-1.0f, 1.0f);
+
+    xnnpack::Buffer<In> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(In));
+    xnnpack::Buffer<In> scale(channels() + XNN_EXTRA_BYTES / sizeof(In));
+    xnnpack::Buffer<In> bias(channels() + XNN_EXTRA_BYTES / sizeof(In));
+    xnnpack::Buffer<Out> output((batch_size() - 1) * output_stride() + channels());
+    xnnpack::Buffer<xnn_quantization_params> quantization_params(batch_size() + XNN_EXTRA_QUANTIZATION_PARAMS);
+    xnnpack::Buffer<double> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(scale.begin(), scale.end(), [&]() { return scaledist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return biasdist(rng); });
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const In* x = &input[i * input_stride()];
+        double mean = 0.0;
+        double mean_sq = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          mean += static_cast<double>(static_cast<float>(x[c]));
+        }
+        mean /= static_cast<double>(channels());
+        for (size_t c = 0; c < channels(); c++) {
+          const double centered = norm_type() == NormType::kLayerNorm
+            ? static_cast<double>(static_cast<float>(x[c])) - mean
+            : static_cast<double>(static_cast<float>(x[c]));
+          mean_sq += centered * centered;
+        }
+        mean_sq /= static_cast<double>(channels());
+        const double multiplier = 1.0 / std::sqrt(mean_sq + static_cast<double>(epsilon()));
+        for (size_t c = 0; c < channels(); c++) {
+          double y = static_cast<double>(static_cast<float>(scale[c]));
+          if (norm_type() == NormType::kLayerNorm) {
+            y *= (static_cast<double>(static_cast<float>(x[c])) - mean) * multiplier;
+            y += static_cast<double>(static_cast<float>(bias[c]));
+          } else {
+            y *= static_cast<double>(static_cast<float>(x[c])) * multiplier;
+          }
+          output_ref[i * channels() + c] = y;
+        }
+      }
+
+      // Create, setup, run, and destroy Norm operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t norm_op = nullptr;
+
+      xnn_status status = norm_type() == NormType::kLayerNorm
+        ? xnn_create_layer_norm_nc(input_datatype, output_datatype, epsilon(), 0, &norm_op)
+        : xnn_create_rms_norm_nc(input_datatype, output_datatype, epsilon(), 0, &norm_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, norm_op);
+
+      // Smart pointer to automatically delete norm_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_norm_op(norm_op, xnn_delete_operator);
+
+      size_t workspace_size = SIZE_MAX;
+      size_t workspace_alignment = SIZE_MAX;
+      if (norm_type() == NormType::kLayerNorm) {
+        ASSERT_EQ(
+          xnn_status_success,
+          xnn_reshape_layer_norm_nc(
+            norm_op, channels(), input_stride(), output_stride(), batch_size(), &workspace_size,
+            &workspace_alignment, /*threadpool=*/nullptr));
+      } else {
+        ASSERT_EQ(
+          xnn_status_success,
+          xnn_reshape_rms_norm_nc(
+            norm_op, channels(), input_stride(), output_stride(), batch_size(), &workspace_size,
+            &workspace_alignment, /*threadpool=*/nullptr));
+      }
+      ASSERT_NE(workspace_size, SIZE_MAX);
+      ASSERT_LE(workspace_alignment, XNN_ALLOCATION_ALIGNMENT);
+      if (!quantized_output) {
+        ASSERT_EQ(workspace_size, 0);
+      }
+      xnnpack::Buffer<char, XNN_ALLOCATION_ALIGNMENT> workspace(workspace_size);
+
+      if (norm_type() == NormType::kLayerNorm) {
+        ASSERT_EQ(
+          xnn_status_success,
+          xnn_setup_layer_norm_nc(
+            norm_op, workspace.data(), input.data(), scale.data(), bias.data(), output.data(),
+            quantization_params.data()));
+      } else {
+        ASSERT_EQ(
+          xnn_status_success,
+          xnn_setup_rms_norm_nc(
+            norm_op, workspace.data(), input.data(), scale.data(), output.data(), quantization_params.data()));
+      }
+
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(norm_op, /*threadpool=*/nullptr));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const double y_ref = output_ref[i * channels() + c];
+          const Out y = output[i * output_stride() + c];
+          if (quantized_output) {
+            // Dequantized outputs are within one quantization step of the reference.
+            const float y_dequantized =
+              static_cast<float>(static_cast<int32_t>(y) - quantization_params[i].zero_point) *
+              quantization_params[i].scale;
+            ASSERT_NEAR(y_dequantized, y_ref, 1.01 * quantization_params[i].scale)
+              << "element " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+          } else {
+            const double tolerance = input_datatype == xnn_datatype_fp16
+              ? std::max(2.0e-3, std::abs(y_ref) * 1.0e-2)
+              : std::max(1.0e-5, std::abs(y_ref) * 1.0e-5);
+            ASSERT_NEAR(static_cast<float>(y), y_ref, tolerance)
+              << "element " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+          }
+        }
+      }
+    }
+  }
+
+  NormType norm_type_{NormType::kLayerNorm};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  size_t output_stride_{0};
+  size_t batch_size_{1};
+  float epsilon_{1.0e-5f};
+  size_t iterations_{15};
+};
@@ -0,0 +1,353 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "xnnpack.h"
+#include "xnnpack/buffer.h"
+#include "xnnpack/math.h"
+#include "xnnpack/node-type.h"
+#include "xnnpack/operator.h"
+#include "xnnpack/subgraph.h"
+#include "subgraph-unary-tester.h"
+#include "runtime-flags.h"
+
+template <typename T>
+class NormTest : public UnaryTest<T, /*OutputType=*/T, /*min_dim=*/1, /*max_dim=*/XNN_MAX_TENSOR_DIMS> {
+ protected:
+  NormTest() {
+    std::uniform_real_distribution<float> scale_dist(0.5f, 2.0f);
+    std::uniform_real_distribution<float> bias_dist(-1.0f, 1.0f);
+    norm_scale = xnnpack::Buffer<T>(this->channels + XNN_EXTRA_BYTES / sizeof(T));
+    norm_bias = xnnpack::Buffer<T>(this->channels + XNN_EXTRA_BYTES / sizeof(T));
+    std::generate(norm_scale.begin(), norm_scale.end(), [&]() { return scale_dist(this->rng); });
+    std::generate(norm_bias.begin(), norm_bias.end(), [&]() { return bias_dist(this->rng); });
+
+    std::uniform_real_distribution<float> input_dist(-5.0f, 5.0f);
+    std::generate(this->input.begin(), this->input.end(), [&]() { return input_dist(this->rng); });
+  }
+
+  // Defines the input, scale, bias, and output Values and the Norm Node.
+  void DefineNorm(xnn_subgraph_t subgraph, xnn_node_type node_type, xnn_datatype datatype) {
+    this->input_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, datatype, this->dims.size(), this->dims.data(), nullptr, /*external_id=*/0,
+                            /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &this->input_id));
+    ASSERT_NE(this->input_id, XNN_INVALID_VALUE_ID);
+
+    const std::array<size_t, 1> channel_dims = {this->channels};
+    scale_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, datatype, channel_dims.size(), channel_dims.data(), norm_scale.data(),
+                            XNN_INVALID_VALUE_ID, /*flags=*/0, &scale_id));
+    ASSERT_NE(scale_id, XNN_INVALID_VALUE_ID);
+
+    bias_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, datatype, channel_dims.size(), channel_dims.data(), norm_bias.data(),
+                            XNN_INVALID_VALUE_ID, /*flags=*/0, &bias_id));
+    ASSERT_NE(bias_id, XNN_INVALID_VALUE_ID);
+
+    this->output_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(
+      xnn_status_success, xnn_define_tensor_value(
+                            subgraph, datatype, this->dims.size(), this->dims.data(), nullptr, /*external_id=*/1,
+                            /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &this->output_id));
+    ASSERT_NE(this->output_id, XNN_INVALID_VALUE_ID);
+
+    if (node_type == xnn_node_type_layer_norm) {
+      ASSERT_EQ(
+        xnn_status_success,
+        xnn_define_layer_norm(subgraph, epsilon, this->input_id, scale_id, bias_id, this->output_id, /*flags=*/0));
+    } else {
+      ASSERT_EQ(
+        xnn_status_success,
+        xnn_define_rms_norm(subgraph, epsilon, this->input_id, scale_id, this->output_id, /*flags=*/0));
+    }
+  }
+
+  void TestDefine(xnn_node_type node_type, xnn_datatype datatype) {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+    xnn_subgraph_t subgraph = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+    DefineNorm(subgraph, node_type, datatype);
+
+    ASSERT_EQ(subgraph->num_nodes, 1);
+    const struct xnn_node* node = &subgraph->nodes[0];
+    ASSERT_EQ(node->type, node_type);
+    ASSERT_EQ(node->params.norm.epsilon, epsilon);
+    ASSERT_EQ(node->inputs[0], this->input_id);
+    ASSERT_EQ(node->inputs[1], scale_id);
+    if (node_type == xnn_node_type_layer_norm) {
+      ASSERT_EQ(node->num_inputs, 3);
+      ASSERT_EQ(node->inputs[2], bias_id);
+    } else {
+      ASSERT_EQ(node->num_inputs, 2);
+    }
+    ASSERT_EQ(node->num_outputs, 1);
+    ASSERT_EQ(node->outputs[0], this->output_id);
+    ASSERT_EQ(node->flags, 0);
+  }
+
+  void TestMatchesOperatorApi(xnn_node_type node_type, xnn_datatype datatype) {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+    // Call operator API.
+    xnn_operator_t op = nullptr;
+    const xnn_status status = node_type == xnn_node_type_layer_norm
+      ? xnn_create_layer_norm_nc(datatype, datatype, epsilon, /*flags=*/0, &op)
+      : xnn_create_rms_norm_nc(datatype, datatype, epsilon, /*flags=*/0, &op);
+    if (status == xnn_status_unsupported_hardware) {
+      GTEST_SKIP();
+    }
+
+    ASSERT_EQ(xnn_status_success, status);
+    ASSERT_NE(nullptr, op);
+    std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+
+    size_t workspace_size = 0;
+    size_t workspace_alignment = 0;
+    if (node_type == xnn_node_type_layer_norm) {
+      ASSERT_EQ(
+        xnn_status_success,
+        xnn_reshape_layer_norm_nc(
+          op, this->channels, this->channels, this->channels, this->batch_size, &workspace_size, &workspace_alignment,
+          /*threadpool=*/nullptr));
+      ASSERT_EQ(
+        xnn_status_success,
+        xnn_setup_layer_norm_nc(
+          op, /*workspace=*/nullptr, this->input.data(), norm_scale.data(), norm_bias.data(),
+          this->operator_output.data(), /*quantization_params=*/nullptr));
+    } else {
+      ASSERT_EQ(
+        xnn_status_success,
+        xnn_reshape_rms_norm_nc(
+          op, this->channels, this->channels, this->channels, this->batch_size, &workspace_size, &workspace_alignment,
+          /*threadpool=*/nullptr));
+      ASSERT_EQ(
+        xnn_status_success,
+        xnn_setup_rms_norm_nc(
+          op, /*workspace=*/nullptr, this->input.data(), norm_scale.data(), this->operator_output.data(),
+          /*quantization_params=*/nullptr));
+    }
+    ASSERT_EQ(workspace_size, 0);
+
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+    // Call subgraph API.
+    xnn_subgraph_t subgraph = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+    DefineNorm(subgraph, node_type, datatype);
+
+    xnn_runtime_t runtime = nullptr;
+    ASSERT_EQ(
+      xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+    ASSERT_NE(nullptr, runtime);
+    std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+    std::array<xnn_external_value, 2> external = {
+      xnn_external_value{this->input_id, this->input.data()},
+      xnn_external_value{this->output_id, this->subgraph_output.data()}};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+    for (size_t i = 0; i < this->num_output_elements; i++) {
+      ASSERT_EQ(this->subgraph_output[i], this->operator_output[i])
+        << "element " << i << " / " << this->num_output_elements;
+    }
+  }
+
+  const float epsilon = 1.0e-5f;
+  uint32_t scale_id;
+  uint32_t bias_id;
+  xnnpack::Buffer<T> norm_scale;
+  xnnpack::Buffer<T> norm_bias;
+};
+
+using NormTestF16 = NormTest<xnn_float16>;
+using NormTestF32 = NormTest<float>;
+
+TEST_F(NormTestF16, define_layer_norm)
+{
+  TestDefine(xnn_node_type_layer_norm, xnn_datatype_fp16);
+}
+
+TEST_F(NormTestF16, define_rms_norm)
+{
+  TestDefine(xnn_node_type_rms_norm, xnn_datatype_fp16);
+}
+
+TEST_F(NormTestF32, define_layer_norm)
+{
+  TestDefine(xnn_node_type_layer_norm, xnn_datatype_fp32);
+}
+
+TEST_F(NormTestF32, define_rms_norm)
+{
+  TestDefine(xnn_node_type_rms_norm, xnn_datatype_fp32);
+}
+
+TEST_F(NormTestF16, layer_norm_matches_operator_api)
+{
+  TestMatchesOperatorApi(xnn_node_type_layer_norm, xnn_datatype_fp16);
+}
+
+TEST_F(NormTestF16, rms_norm_matches_operator_api)
+{
+  TestMatchesOperatorApi(xnn_node_type_rms_norm, xnn_datatype_fp16);
+}
+
+TEST_F(NormTestF32, layer_norm_matches_operator_api)
+{
+  TestMatchesOperatorApi(xnn_node_type_layer_norm, xnn_datatype_fp32);
+}
+
+TEST_F(NormTestF32, rms_norm_matches_operator_api)
+{
+  TestMatchesOperatorApi(xnn_node_type_rms_norm, xnn_datatype_fp32);
+}
+
+TEST_F(NormTestF32, define_rejects_negative_epsilon)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, /*external_id=*/0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  const std::array<size_t, 1> channel_dims = {channels};
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, channel_dims.size(), channel_dims.data(), norm_scale.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &scale_id));
+  output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, /*external_id=*/1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  ASSERT_EQ(
+    xnn_status_invalid_parameter,
+    xnn_define_rms_norm(subgraph, /*epsilon=*/-1.0f, input_id, scale_id, output_id, /*flags=*/0));
+  ASSERT_EQ(subgraph->num_nodes, 0);
+}
+
+TEST_F(NormTestF32, define_rejects_2d_scale)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, /*external_id=*/0,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  const std::array<size_t, 2> scale_dims = {1, channels};
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, scale_dims.size(), scale_dims.data(), norm_scale.data(),
+                          XNN_INVALID_VALUE_ID, /*flags=*/0, &scale_id));
+  output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success, xnn_define_tensor_value(
+                          subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, /*external_id=*/1,
+                          /*flags=*/XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  ASSERT_EQ(
+    xnn_status_invalid_parameter,
+    xnn_define_rms_norm(subgraph, epsilon, input_id, scale_id, output_id, /*flags=*/0));
+  ASSERT_EQ(subgraph->num_nodes, 0);
+}
+
+TEST_F(NormTestF32, reshape_output)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+  DefineNorm(subgraph, xnn_node_type_layer_norm, xnn_datatype_fp32);
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  const std::array<xnn_external_value, 2> external{{
+    xnn_external_value{input_id, input.data()},
+    xnn_external_value{output_id, subgraph_output.data()}
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  // Growing the batch dimensions requires a larger output.
+  dims[0] += 4;
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, input_id, dims.size(), dims.data()));
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(
+    node->reshape(&runtime->opdata[0], runtime->values, runtime->num_values, /*threadpool=*/nullptr),
+    dims.size() == 1 ? xnn_status_invalid_parameter : xnn_status_reallocation_required);
+  if (dims.size() == 1) {
+    // The only dimension of a 1D input is the normalized one, which must match the scale and bias.
+    return;
+  }
+  const xnn_shape* output_shape = &runtime->values[node->outputs[0]].shape;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    ASSERT_EQ(dims[i], output_shape->dim[i]);
+  }
+
+  dims[0] -= 4;
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, input_id, dims.size(), dims.data()));
+  ASSERT_EQ(
+    node->reshape(&runtime->opdata[0], runtime->values, runtime->num_values, /*threadpool=*/nullptr),
+    xnn_status_success);
+  output_shape = &runtime->values[node->outputs[0]].shape;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    ASSERT_EQ(dims[i], output_shape->dim[i]);
+  }
+}
+
+TEST_F(NormTestF32, reshape_rejects_mismatched_channels)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+  DefineNorm(subgraph, xnn_node_type_rms_norm, xnn_datatype_fp32);
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+
+  dims.back() += 1;
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, input_id, dims.size(), dims.data()));
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(
+    node->reshape(&runtime->opdata[0], runtime->values, runtime->num_values, /*threadpool=*/nullptr),
+    xnn_status_invalid_parameter);
+}
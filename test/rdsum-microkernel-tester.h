@@ -26,6 +26,12 @@
 
 class RDSumMicrokernelTester {
  public:
+  enum class OpType {
+    Max,
+    Min,
+    Prod,
+  };
+
   RDSumMicrokernelTester& rows(size_t rows) {
     assert(rows != 0);
     this->rows_ = rows;
@@ -282,6 +288,98 @@ class RDSumMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_rdreduce_ukernel_fn rdreduce, OpType op_type) const {
+    xnnpack::ReplicableRandomDevice rng;
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    const float identity = op_type == OpType::Max ? -std::numeric_limits<float>::infinity()
+                                                  : std::numeric_limits<float>::infinity();
+    assert(op_type != OpType::Prod);
+    xnnpack::Buffer<xnn_float16> input((rows() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(xnn_float16));
+    xnnpack::Buffer<xnn_float16> zero(channels() + XNN_EXTRA_BYTES / sizeof(xnn_float16), identity);
+    xnnpack::Buffer<xnn_float16> output(channels());
+    xnnpack::Buffer<float> output_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(output.begin(), output.end(), [&]() { return f32dist(rng); });
+
+      // Compute reference results, starting from the initial output.
+      for (size_t c = 0; c < channels(); c++) {
+        float acc = output[c];
+        for (size_t n = 0; n < rows(); n++) {
+          const float x = input[n * input_stride() + c];
+          acc = op_type == OpType::Max ? std::max(acc, x) : std::min(acc, x);
+        }
+        output_ref[c] = acc;
+      }
+
+      // Call optimized micro-kernel.
+      rdreduce(rows(), channels(), input.data(), input_stride() * sizeof(xnn_float16), zero.data(), output.data(), nullptr);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        EXPECT_EQ(static_cast<float>(output[c]), output_ref[c])
+          << "at position " << c << ", rows = " << rows() << ", channels = " << channels();
+      }
+    }
+  }
+
+  void Test(xnn_f32_rdreduce_ukernel_fn rdreduce, OpType op_type) const {
+    xnnpack::ReplicableRandomDevice rng;
+    // Products of values close to 1 neither underflow nor overflow.
+    std::uniform_real_distribution<float> f32dist =
+        op_type == OpType::Prod ? std::uniform_real_distribution<float>(0.9f, 1.1f)
+                                : std::uniform_real_distribution<float>(-1.0f, 1.0f);
+
+    float identity = 1.0f;
+    if (op_type == OpType::Max) {
+      identity = -std::numeric_limits<float>::infinity();
+    } else if (op_type == OpType::Min) {
+      identity = std::numeric_limits<float>::infinity();
+    }
+    xnnpack::Buffer<float> input((rows() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    xnnpack::Buffer<float> zero(channels() + XNN_EXTRA_BYTES / sizeof(float), identity);
+    xnnpack::Buffer<float> output(channels());
+    xnnpack::Buffer<float> output_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(output.begin(), output.end(), [&]() { return f32dist(rng); });
+
+      // Compute reference results, starting from the initial output.
+      for (size_t c = 0; c < channels(); c++) {
+        double acc = output[c];
+        for (size_t n = 0; n < rows(); n++) {
+          const double x = input[n * input_stride() + c];
+          switch (op_type) {
+            case OpType::Max:
+              acc = std::max(acc, x);
+              break;
+            case OpType::Min:
+              acc = std::min(acc, x);
+              break;
+            case OpType::Prod:
+              acc *= x;
+              break;
+          }
+        }
+        output_ref[c] = acc;
+      }
+
+      // Call optimized micro-kernel.
+      rdreduce(rows(), channels(), input.data(), input_stride() * sizeof(float), zero.data(), output.data(), nullptr);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        if (op_type == OpType::Prod) {
+          EXPECT_NEAR(output[c], output_ref[c], std::abs(output_ref[c]) * 1.0e-5f)
+            << "at position " << c << ", rows = " << rows() << ", channels = " << channels();
+        } else {
+          EXPECT_EQ(output[c], output_ref[c])
+            << "at position " << c << ", rows = " << rows() << ", channels = " << channels();
+        }
+      }
+    }
+  }
 
  private:
   size_t rows_{1};
@@ -11,7 +11,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <limits>
+#include <numeric>
 #include <random>
 #include <tuple>
 #include <vector>
@@ -30,6 +32,7 @@ class ReduceMicrokernelTester {
     Max,
     Min,
     MinMax,
+    Prod,
   };
 
   ReduceMicrokernelTester& batch_size(size_t batch_size) {
@@ -89,13 +92,18 @@ class ReduceMicrokernelTester {
           EXPECT_EQ(output[1], *max)
               << "with batch " << batch_size();
           break;
+        case OpType::Prod:
+          GTEST_FAIL() << "Prod is only supported for f32";
       }
     }
   }
 
   void Test(xnn_f32_reduce_ukernel_fn reduce, OpType op_type, xnn_init_f32_default_params_fn init_params = nullptr) const {
     xnnpack::ReplicableRandomDevice rng;
-    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    // Products of values close to 1 neither underflow nor overflow.
+    std::uniform_real_distribution<float> f32dist =
+        op_type == OpType::Prod ? std::uniform_real_distribution<float>(0.9f, 1.1f)
+                                : std::uniform_real_distribution<float>(-1.0f, 1.0f);
 
     xnnpack::Buffer<float> input(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
@@ -104,6 +112,8 @@ class ReduceMicrokernelTester {
       // Compute reference results.
       xnnpack::Buffer<float>::iterator min, max;
       std::tie(min, max) = std::minmax_element(input.begin(), input.begin() + batch_size());
+      const double product = std::accumulate(
+          input.begin(), input.begin() + batch_size(), 1.0, std::multiplies<double>());
 
       // Prepare parameters.
       xnn_f32_default_params params;
@@ -131,6 +141,10 @@ class ReduceMicrokernelTester {
           EXPECT_EQ(output[1], *max)
               << "with batch " << batch_size();
           break;
+        case OpType::Prod:
+          EXPECT_NEAR(output[0], product, std::abs(product) * batch_size() * std::numeric_limits<float>::epsilon())
+              << "with batch " << batch_size();
+          break;
       }
     }
   }
@@ -168,6 +182,8 @@ class ReduceMicrokernelTester {
           EXPECT_EQ(output[1], *max)
               << "with batch " << batch_size();
           break;
+        case OpType::Prod:
+          GTEST_FAIL() << "Prod is only supported for f32";
       }
     }
   }
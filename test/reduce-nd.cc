@@ -242,8 +242,12 @@ class ReduceOperatorTester {
 
     std::vector<StorageType> input(XNN_EXTRA_BYTES / sizeof(StorageType) + num_input_elements());
     std::vector<StorageType> output(num_output_elements);
+    std::vector<int32_t> indices(num_output_elements);
     std::vector<double> output_ref(num_output_elements);
     std::vector<typename Config::AccumulatorType> accumulator(num_output_elements);
+    // Number of input elements visited so far for each output element, which is
+    // the row-major index into the reduced axes.
+    std::vector<int32_t> reduced_index(num_output_elements);
 
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)>
@@ -257,10 +261,34 @@ class ReduceOperatorTester {
         }
       }
 
-      std::generate(input.begin(), input.end(), [&]() { return dist(rng); });
+      if (operation() == xnn_reduce_prod) {
+        // Keep long products away from underflow and overflow.
+        std::uniform_real_distribution<float> prod_dist(0.99f, 1.01f);
+        std::generate(input.begin(), input.end(), [&]() { return prod_dist(rng); });
+      } else {
+        std::generate(input.begin(), input.end(), [&]() { return dist(rng); });
+      }
       std::fill(output.begin(), output.end(), INT8_C(0xA5));
+      std::fill(indices.begin(), indices.end(), -1);
       std::fill(output_ref.begin(), output_ref.end(), 0);
-      std::fill(accumulator.begin(), accumulator.end(), 0);
+      std::fill(reduced_index.begin(), reduced_index.end(), 0);
+      switch (operation()) {
+        case xnn_reduce_max:
+        case xnn_reduce_argmax:
+          std::fill(accumulator.begin(), accumulator.end(),
+                    -std::numeric_limits<typename Config::AccumulatorType>::infinity());
+          break;
+        case xnn_reduce_min:
+          std::fill(accumulator.begin(), accumulator.end(),
+                    std::numeric_limits<typename Config::AccumulatorType>::infinity());
+          break;
+        case xnn_reduce_prod:
+          std::fill(accumulator.begin(), accumulator.end(), 1);
+          break;
+        default:
+          std::fill(accumulator.begin(), accumulator.end(), 0);
+          break;
+      }
 
       const int32_t num_reduced_elements = num_input_elements() / num_output_elements;
       const float reduce_scale =
@@ -285,8 +313,30 @@ class ReduceOperatorTester {
                       i * output_strides[0] + j * output_strides[1] +
                       k * output_strides[2] + l * output_strides[3] +
                       m * output_strides[4] + n * output_strides[5];
-                  accumulator[output_idx] +=
+                  const typename Config::AccumulatorType value =
                       static_cast<typename Config::AccumulatorType>(input[input_idx]);
+                  switch (operation()) {
+                    case xnn_reduce_max:
+                      accumulator[output_idx] = std::max(accumulator[output_idx], value);
+                      break;
+                    case xnn_reduce_min:
+                      accumulator[output_idx] = std::min(accumulator[output_idx], value);
+                      break;
+                    case xnn_reduce_prod:
+                      accumulator[output_idx] *= value;
+                      break;
+                    case xnn_reduce_argmax:
+                      // Ties keep the first occurrence.
+                      if (value > accumulator[output_idx]) {
+                        accumulator[output_idx] = value;
+                        output_ref[output_idx] = reduced_index[output_idx];
+                      }
+                      reduced_index[output_idx] += 1;
+                      break;
+                    default:
+                      accumulator[output_idx] += value;
+                      break;
+                  }
                 }
               }
             }
@@ -310,11 +360,17 @@ class ReduceOperatorTester {
           output_ref[idx] = static_cast<StorageType>(
               std::lrintf(output_ref[idx]) + q.output.zero_point);
         }
-      } else {
+      } else if (operation() != xnn_reduce_argmax) {
         for (size_t i = 0; i < accumulator.size(); ++i) {
           output_ref[i] = accumulator[i] * reduce_scale;
         }
       }
+      // Long products accumulate one rounding error per reduced element.
+      const double tolerance =
+          operation() == xnn_reduce_prod
+              ? std::max(Config::GetTolerance(),
+                         num_reduced_elements * double(std::numeric_limits<float>::epsilon()))
+              : Config::GetTolerance();
 
       // Create, setup, run, and destroy a reduce operator.
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
@@ -364,7 +420,9 @@ class ReduceOperatorTester {
         xnn_setup_reduce_nd(
           reduce_op,
           workspace_ptr,
-          input.data(), output.data()));
+          input.data(),
+          operation() == xnn_reduce_argmax ? static_cast<void*>(indices.data())
+                                           : static_cast<void*>(output.data())));
 
       ASSERT_EQ(xnn_status_success,
                 xnn_run_operator(reduce_op, auto_threadpool.get()));
@@ -378,8 +436,13 @@ class ReduceOperatorTester {
                 for (size_t n = 0; n < output_dims[5]; n++) {
                   const size_t index =
                     i * output_strides[0] + j * output_strides[1] + k * output_strides[2] + l * output_strides[3] + m * output_strides[4] + n * output_strides[5];
-                  ASSERT_NEAR(output[index], output_ref[index], Config::GetTolerance() * std::abs(output_ref[index]))
-                    << "(i, j, k, l, m, n) = (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ")";
+                  if (operation() == xnn_reduce_argmax) {
+                    ASSERT_EQ(indices[index], static_cast<int32_t>(output_ref[index]))
+                      << "(i, j, k, l, m, n) = (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ")";
+                  } else {
+                    ASSERT_NEAR(output[index], output_ref[index], tolerance * std::abs(output_ref[index]))
+                      << "(i, j, k, l, m, n) = (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ")";
+                  }
                 }
               }
             }
@@ -423,6 +486,18 @@ struct TestParam {
       case xnn_reduce_sum:
         sstr << "sum";
         break;
+      case xnn_reduce_max:
+        sstr << "max";
+        break;
+      case xnn_reduce_min:
+        sstr << "min";
+        break;
+      case xnn_reduce_prod:
+        sstr << "prod";
+        break;
+      case xnn_reduce_argmax:
+        sstr << "argmax";
+        break;
       case xnn_reduce_invalid:
         sstr << "invalid";
         break;
@@ -520,9 +595,17 @@ TEST_P(ReduceNDTest, reduce) {
 
 std::vector<TestParam> GenerateTests() {
   std::vector<TestParam> params;
-  for(enum xnn_reduce_operator operation : {xnn_reduce_sum, xnn_reduce_mean}) {
+  for(enum xnn_reduce_operator operation : {xnn_reduce_sum, xnn_reduce_mean, xnn_reduce_max,
+                                             xnn_reduce_min, xnn_reduce_prod, xnn_reduce_argmax}) {
     for(enum xnn_datatype datatype : {xnn_datatype_fp16, xnn_datatype_fp32,
                                       xnn_datatype_qint8, xnn_datatype_quint8}) {
+      const bool is_float = datatype == xnn_datatype_fp16 || datatype == xnn_datatype_fp32;
+      if ((operation != xnn_reduce_sum && operation != xnn_reduce_mean && !is_float) ||
+          (operation == xnn_reduce_prod && datatype != xnn_datatype_fp32)) {
+        // Max, min, prod and argmax are not supported for quantized types, and
+        // prod only for fp32.
+        continue;
+      }
       for(int dims = 1; dims <= 6; ++dims) {
         for(int reduction_axes = 1; reduction_axes < (1 << dims); ++reduction_axes) {
           for (bool use_neg_axes : {false, true}) {
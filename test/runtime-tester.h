@@ -53,9 +53,9 @@ class RuntimeTester : public SubgraphTester {
     return output;
   }
 
-  void CreateRuntime(uint32_t flags) {
+  void CreateRuntime(uint32_t flags, pthreadpool_t threadpool = nullptr) {
     xnn_runtime_t runtime = nullptr;
-    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(this->subgraph_.get(), nullptr, nullptr, flags, &runtime));
+    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(this->subgraph_.get(), nullptr, threadpool, flags, &runtime));
     ASSERT_NE(nullptr, runtime);
     runtime_.reset(runtime);
   }
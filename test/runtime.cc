@@ -1,9 +1,15 @@
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include "xnnpack/operator.h"
 #include "runtime-tester.h"
+#include "pthreadpool.h"
 
 TEST(RUNTIME, reshape_runtime) {
   xnnpack::RuntimeTester tester(4);
@@ -60,3 +66,489 @@ TEST(RUNTIME, reshape_runtime) {
   }
   ASSERT_EQ(expected, output);
 }
+
+TEST(RUNTIME, inter_operator_parallelism) {
+  xnnpack::RuntimeTester tester(4);
+  uint32_t input0_id = 0;
+  uint32_t input1_id = 1;
+  uint32_t input2_id = 2;
+  uint32_t output_id = 3;
+  uint32_t add1_out, add2_out;
+  size_t dim0 = 3;
+  size_t new_dim0 = 400;
+
+  tester.AddInputTensorF32({dim0}, input0_id)
+      .AddInputTensorF32({dim0}, input1_id)
+      .AddInputTensorF32({dim0}, input2_id)
+      .AddOutputTensorF32({dim0}, output_id)
+      .AddInternalDynamicTensorF32({dim0}, &add1_out)
+      .AddInternalDynamicTensorF32({dim0}, &add2_out);
+  tester.AddAddition(input0_id, input1_id, add1_out)
+      .AddAddition(input0_id, input2_id, add2_out)
+      .AddMultiply(add1_out, add2_out, output_id);
+
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+      pthreadpool_create(4), pthreadpool_destroy);
+  tester.CreateRuntime(XNN_FLAG_NO_OPERATOR_FUSION | XNN_FLAG_INTER_OPERATOR_PARALLELISM, threadpool.get());
+  tester.SetupRuntime();
+  xnn_runtime_t runtime = tester.Runtime();
+  // Both additions are independent and run in the first stage.
+  ASSERT_EQ(runtime->num_stages, 2);
+  ASSERT_EQ(runtime->stage_offsets[1] - runtime->stage_offsets[0], 2);
+  ASSERT_EQ(runtime->stage_offsets[2] - runtime->stage_offsets[1], 1);
+
+  for (size_t dim : {dim0, new_dim0}) {
+    if (dim != dim0) {
+      tester.ReshapeInput({dim}, input0_id);
+      tester.ReshapeInput({dim}, input1_id);
+      tester.ReshapeInput({dim}, input2_id);
+      tester.ReshapeRuntime();
+      tester.SetupRuntimeV2();
+    }
+    xnnpack::Buffer<float> output = tester.RepeatRun<float>();
+    xnnpack::Buffer<float> expected(dim);
+    const float* input0_data = tester.GetExternalTensorDataF32(input0_id);
+    const float* input1_data = tester.GetExternalTensorDataF32(input1_id);
+    const float* input2_data = tester.GetExternalTensorDataF32(input2_id);
+    for (size_t i = 0; i < dim; ++i) {
+      expected[i] =
+          (input0_data[i] + input1_data[i]) * (input0_data[i] + input2_data[i]);
+    }
+    ASSERT_EQ(expected, output);
+  }
+}
+
+namespace {
+
+xnn_status reshape_should_not_be_called(xnn_operator_data*, xnn_value*, size_t, pthreadpool_t) {
+  return xnn_status_invalid_state;
+}
+
+void ExpectAddMultiplyOutput(xnnpack::RuntimeTester& tester, size_t dim, uint32_t input0_id, uint32_t input1_id,
+                             uint32_t input2_id) {
+  xnnpack::Buffer<float> output = tester.RepeatRun<float>();
+  ASSERT_EQ(output.size(), dim);
+  const float* input0_data = tester.GetExternalTensorDataF32(input0_id);
+  const float* input1_data = tester.GetExternalTensorDataF32(input1_id);
+  const float* input2_data = tester.GetExternalTensorDataF32(input2_id);
+  for (size_t i = 0; i < dim; ++i) {
+    ASSERT_EQ(output[i], (input0_data[i] + input1_data[i]) * (input0_data[i] + input2_data[i]));
+  }
+}
+
+}  // namespace
+
+TEST(RUNTIME, cache_reshape_plans) {
+  xnnpack::RuntimeTester tester(4);
+  uint32_t input0_id = 0;
+  uint32_t input1_id = 1;
+  uint32_t input2_id = 2;
+  uint32_t output_id = 3;
+  uint32_t add1_out, add2_out;
+  size_t dim0 = 3;
+
+  tester.AddInputTensorF32({dim0}, input0_id)
+      .AddInputTensorF32({dim0}, input1_id)
+      .AddInputTensorF32({dim0}, input2_id)
+      .AddOutputTensorF32({dim0}, output_id)
+      .AddInternalDynamicTensorF32({dim0}, &add1_out)
+      .AddInternalDynamicTensorF32({dim0}, &add2_out);
+  tester.AddAddition(input0_id, input1_id, add1_out)
+      .AddAddition(input0_id, input2_id, add2_out)
+      .AddMultiply(add1_out, add2_out, output_id);
+
+  tester.CreateRuntime(XNN_FLAG_NO_OPERATOR_FUSION | XNN_FLAG_CACHE_RESHAPE_PLANS);
+  tester.SetupRuntime();
+  xnn_runtime_t runtime = tester.Runtime();
+  ASSERT_NE(runtime->reshape_plans, nullptr);
+
+  // Alternate between shapes, the second time a shape is seen its plan is restored.
+  for (size_t dim : {400, 3, 400, 3, 17, 400}) {
+    tester.ReshapeInput({dim}, input0_id);
+    tester.ReshapeInput({dim}, input1_id);
+    tester.ReshapeInput({dim}, input2_id);
+    tester.ReshapeRuntime();
+    tester.SetupRuntimeV2();
+    ExpectAddMultiplyOutput(tester, dim, input0_id, input1_id, input2_id);
+  }
+
+  // Reshaping to a memoized shape must not reshape any operator.
+  std::vector<xnn_reshape_operator_fn> reshape_fns(runtime->num_ops);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    reshape_fns[i] = runtime->opdata[i].reshape;
+    runtime->opdata[i].reshape = reshape_should_not_be_called;
+  }
+  tester.ReshapeInput({17}, input0_id);
+  tester.ReshapeInput({17}, input1_id);
+  tester.ReshapeInput({17}, input2_id);
+  tester.ReshapeRuntime();
+  tester.SetupRuntimeV2();
+  ExpectAddMultiplyOutput(tester, 17, input0_id, input1_id, input2_id);
+
+  // A new shape reshapes the operators.
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    runtime->opdata[i].reshape = reshape_should_not_be_called;
+  }
+  tester.ReshapeInput({5}, input0_id);
+  tester.ReshapeInput({5}, input1_id);
+  tester.ReshapeInput({5}, input2_id);
+  ASSERT_EQ(xnn_status_invalid_state, xnn_reshape_runtime(runtime));
+
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    runtime->opdata[i].reshape = reshape_fns[i];
+  }
+  tester.ReshapeRuntime();
+  tester.SetupRuntimeV2();
+  ExpectAddMultiplyOutput(tester, 5, input0_id, input1_id, input2_id);
+}
+
+TEST(RUNTIME, cache_reshape_plans_evicts_least_recently_used) {
+  xnnpack::RuntimeTester tester(4);
+  uint32_t input0_id = 0;
+  uint32_t input1_id = 1;
+  uint32_t input2_id = 2;
+  uint32_t output_id = 3;
+  uint32_t add1_out, add2_out;
+  size_t dim0 = 1;
+
+  tester.AddInputTensorF32({dim0}, input0_id)
+      .AddInputTensorF32({dim0}, input1_id)
+      .AddInputTensorF32({dim0}, input2_id)
+      .AddOutputTensorF32({dim0}, output_id)
+      .AddInternalDynamicTensorF32({dim0}, &add1_out)
+      .AddInternalDynamicTensorF32({dim0}, &add2_out);
+  tester.AddAddition(input0_id, input1_id, add1_out)
+      .AddAddition(input0_id, input2_id, add2_out)
+      .AddMultiply(add1_out, add2_out, output_id);
+
+  tester.CreateRuntime(XNN_FLAG_NO_OPERATOR_FUSION | XNN_FLAG_CACHE_RESHAPE_PLANS);
+  tester.SetupRuntime();
+  xnn_runtime_t runtime = tester.Runtime();
+
+  // Memoize one more shape than there are plans, the first shape is evicted.
+  for (size_t dim = 1; dim <= XNN_MAX_RESHAPE_PLANS + 1; dim++) {
+    tester.ReshapeInput({dim}, input0_id);
+    tester.ReshapeInput({dim}, input1_id);
+    tester.ReshapeInput({dim}, input2_id);
+    tester.ReshapeRuntime();
+  }
+
+  std::vector<xnn_reshape_operator_fn> reshape_fns(runtime->num_ops);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    reshape_fns[i] = runtime->opdata[i].reshape;
+    runtime->opdata[i].reshape = reshape_should_not_be_called;
+  }
+  tester.ReshapeInput({2}, input0_id);
+  tester.ReshapeInput({2}, input1_id);
+  tester.ReshapeInput({2}, input2_id);
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime));
+
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    runtime->opdata[i].reshape = reshape_should_not_be_called;
+  }
+  tester.ReshapeInput({1}, input0_id);
+  tester.ReshapeInput({1}, input1_id);
+  tester.ReshapeInput({1}, input2_id);
+  ASSERT_EQ(xnn_status_invalid_state, xnn_reshape_runtime(runtime));
+
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    runtime->opdata[i].reshape = reshape_fns[i];
+  }
+  tester.ReshapeRuntime();
+  tester.SetupRuntimeV2();
+  ExpectAddMultiplyOutput(tester, 1, input0_id, input1_id, input2_id);
+}
+
+namespace {
+
+// Runs a runtime computing a fully connected layer without bias on a batch of inputs, and returns the output.
+std::vector<float> RunFullyConnected(xnn_runtime_t runtime, uint32_t input_id, uint32_t output_id,
+                                     const std::vector<float>& input, size_t batch_size, size_t input_channels,
+                                     size_t output_channels) {
+  const size_t input_dims[2] = {batch_size, input_channels};
+  EXPECT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, input_id, 2, input_dims));
+  EXPECT_EQ(xnn_status_success, xnn_reshape_runtime(runtime));
+  std::vector<float> output(batch_size * output_channels);
+  const xnn_external_value external_values[2] = {
+    {input_id, const_cast<float*>(input.data())},
+    {output_id, output.data()},
+  };
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime_v2(runtime, 2, external_values));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+}  // namespace
+
+TEST(RUNTIME, clone_runtime) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const size_t input_channels = 7;
+  const size_t output_channels = 5;
+  std::vector<float> filter(output_channels * input_channels);
+  for (size_t i = 0; i < filter.size(); i++) {
+    filter[i] = static_cast<float>(i % 5) - 2.0f;
+  }
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+  const size_t input_dims[2] = {1, input_channels};
+  const size_t filter_dims[2] = {output_channels, input_channels};
+  const size_t output_dims[2] = {1, output_channels};
+  uint32_t input_id = 0;
+  uint32_t output_id = 1;
+  uint32_t filter_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, input_dims, nullptr, input_id,
+                                    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, filter_dims, filter.data(), XNN_INVALID_VALUE_ID,
+                                    /*flags=*/0, &filter_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, output_dims, nullptr, output_id,
+                                    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_fully_connected(subgraph, -std::numeric_limits<float>::infinity(),
+                                       std::numeric_limits<float>::infinity(), input_id, filter_id,
+                                       XNN_INVALID_VALUE_ID, output_id, /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  xnn_runtime_t clone = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_clone_runtime(runtime, nullptr, nullptr, &clone));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_clone(clone, xnn_delete_runtime);
+
+  // The clone shares the packed weights, but not the operators or the workspace.
+  ASSERT_EQ(clone->num_ops, runtime->num_ops);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const xnn_operator_t op = runtime->opdata[i].operator_objects[0];
+    const xnn_operator_t cloned_op = clone->opdata[i].operator_objects[0];
+    if (op == nullptr) {
+      ASSERT_EQ(cloned_op, nullptr);
+      continue;
+    }
+    ASSERT_NE(cloned_op, op);
+    ASSERT_EQ(cloned_op->packed_weights.pointer, op->packed_weights.pointer);
+  }
+  ASSERT_NE(clone->workspace, runtime->workspace);
+
+  // Run the runtime and its clone concurrently with different batch sizes.
+  const size_t batch_size = 3;
+  const size_t clone_batch_size = 11;
+  std::vector<float> input(clone_batch_size * input_channels);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<float>(i % 3);
+  }
+  std::vector<float> output;
+  std::thread thread([&]() {
+    output = RunFullyConnected(runtime, input_id, output_id, input, batch_size, input_channels, output_channels);
+  });
+  std::vector<float> clone_output =
+    RunFullyConnected(clone, input_id, output_id, input, clone_batch_size, input_channels, output_channels);
+  thread.join();
+
+  for (size_t b = 0; b < clone_batch_size; b++) {
+    for (size_t n = 0; n < output_channels; n++) {
+      float expected = 0.0f;
+      for (size_t k = 0; k < input_channels; k++) {
+        expected += input[b * input_channels + k] * filter[n * input_channels + k];
+      }
+      ASSERT_EQ(clone_output[b * output_channels + n], expected);
+      if (b < batch_size) {
+        ASSERT_EQ(output[b * output_channels + n], expected);
+      }
+    }
+  }
+
+  // The runtime can't be deleted while it has clones.
+  ASSERT_EQ(xnn_status_invalid_state, xnn_delete_runtime(runtime));
+  auto_clone.reset();
+}
+
+TEST(RUNTIME, clone_and_delete_runtime_concurrently) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const size_t channels = 3;
+  std::vector<float> filter(channels * channels, 1.0f);
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+  const size_t dims[2] = {1, channels};
+  uint32_t input_id = 0;
+  uint32_t output_id = 1;
+  uint32_t filter_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, dims, nullptr, input_id,
+                                    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, dims, filter.data(), XNN_INVALID_VALUE_ID,
+                                    /*flags=*/0, &filter_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, dims, nullptr, output_id,
+                                    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_fully_connected(subgraph, -std::numeric_limits<float>::infinity(),
+                                       std::numeric_limits<float>::infinity(), input_id, filter_id,
+                                       XNN_INVALID_VALUE_ID, output_id, /*flags=*/0));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, /*flags=*/0, &runtime));
+
+  // Every thread repeatedly clones the runtime and deletes its clone.
+  const size_t num_threads = 4;
+  const size_t iterations = 100;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&]() {
+      for (size_t i = 0; i < iterations; i++) {
+        xnn_runtime_t clone = nullptr;
+        EXPECT_EQ(xnn_status_success, xnn_clone_runtime(runtime, nullptr, nullptr, &clone));
+        EXPECT_EQ(xnn_status_success, xnn_delete_runtime(clone));
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(0, runtime->num_clones);
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(RUNTIME, cache_reshape_plans_with_k_split_fully_connected) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  // Few output channels and a large K split K between threads, with partial accumulators owned by the operator.
+  const size_t input_channels = 2051;
+  const size_t output_channels = 37;
+  std::vector<float> filter(output_channels * input_channels);
+  for (size_t i = 0; i < filter.size(); i++) {
+    filter[i] = static_cast<float>(i % 5) - 2.0f;
+  }
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(/*external_value_ids=*/2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+  const size_t input_dims[2] = {1, input_channels};
+  const size_t filter_dims[2] = {output_channels, input_channels};
+  const size_t output_dims[2] = {1, output_channels};
+  uint32_t input_id = 0;
+  uint32_t output_id = 1;
+  uint32_t filter_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, input_dims, nullptr, input_id,
+                                    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, filter_dims, filter.data(), XNN_INVALID_VALUE_ID,
+                                    /*flags=*/0, &filter_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32, 2, output_dims, nullptr, output_id,
+                                    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_fully_connected(subgraph, -std::numeric_limits<float>::infinity(),
+                                       std::numeric_limits<float>::infinity(), input_id, filter_id,
+                                       XNN_INVALID_VALUE_ID, output_id, /*flags=*/0));
+
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+      pthreadpool_create(/*threads_count=*/4), pthreadpool_destroy);
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success,
+            xnn_create_runtime_v3(subgraph, nullptr, threadpool.get(), XNN_FLAG_CACHE_RESHAPE_PLANS, &runtime));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  ASSERT_NE(runtime->reshape_plans, nullptr);
+
+  // Larger batches reallocate the partial accumulators, so shrinking back must not restore a plan referring to the
+  // freed buffer.
+  const size_t max_batch_size = 5;
+  std::vector<float> input(max_batch_size * input_channels);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<float>(i % 3);
+  }
+  for (size_t batch_size : {1, 5, 1, 5, 2, 1}) {
+    const std::vector<float> output =
+      RunFullyConnected(runtime, input_id, output_id, input, batch_size, input_channels, output_channels);
+    for (size_t b = 0; b < batch_size; b++) {
+      for (size_t n = 0; n < output_channels; n++) {
+        float expected = 0.0f;
+        for (size_t k = 0; k < input_channels; k++) {
+          expected += input[b * input_channels + k] * filter[n * input_channels + k];
+        }
+        ASSERT_EQ(output[b * output_channels + n], expected) << "batch size " << batch_size;
+      }
+    }
+  }
+}
+
+TEST(RUNTIME, detailed_profiling) {
+  xnnpack::RuntimeTester tester(4);
+  uint32_t input0_id = 0;
+  uint32_t input1_id = 1;
+  uint32_t input2_id = 2;
+  uint32_t output_id = 3;
+  uint32_t add1_out, add2_out;
+  size_t dim0 = 10000;
+
+  tester.AddInputTensorF32({dim0}, input0_id)
+      .AddInputTensorF32({dim0}, input1_id)
+      .AddInputTensorF32({dim0}, input2_id)
+      .AddOutputTensorF32({dim0}, output_id)
+      .AddInternalDynamicTensorF32({dim0}, &add1_out)
+      .AddInternalDynamicTensorF32({dim0}, &add2_out);
+  tester.AddAddition(input0_id, input1_id, add1_out)
+      .AddAddition(input0_id, input2_id, add2_out)
+      .AddMultiply(add1_out, add2_out, output_id);
+
+  const size_t num_threads = 4;
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+      pthreadpool_create(num_threads), pthreadpool_destroy);
+  tester.CreateRuntime(XNN_FLAG_NO_OPERATOR_FUSION | XNN_FLAG_DETAILED_PROFILING, threadpool.get());
+  tester.SetupRuntime();
+  ExpectAddMultiplyOutput(tester, dim0, input0_id, input1_id, input2_id);
+
+  xnn_runtime_t runtime = tester.Runtime();
+  ASSERT_EQ(runtime->num_profiled_threads, num_threads);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    if (runtime->opdata[i].operator_objects[0] == nullptr) {
+      continue;
+    }
+    const xnn_operator_trace& trace = runtime->operator_traces[i * XNN_MAX_OPERATOR_OBJECTS];
+    ASSERT_GE(trace.end_ns, trace.start_ns);
+    ASSERT_GE(trace.num_tiles, 1);
+  }
+
+  // Basic profiling information is still available.
+  size_t num_operators = 0;
+  size_t size = 0;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_profiling_info(runtime, xnn_profile_info_num_operators,
+                                                                sizeof(num_operators), &num_operators, &size));
+  ASSERT_EQ(num_operators, 3);
+
+  ASSERT_EQ(xnn_status_out_of_memory,
+            xnn_get_runtime_profiling_info(runtime, xnn_profile_info_chrome_trace, 0, nullptr, &size));
+  std::vector<char> trace(size);
+  ASSERT_EQ(xnn_status_success,
+            xnn_get_runtime_profiling_info(runtime, xnn_profile_info_chrome_trace, trace.size(), trace.data(), &size));
+  const std::string json(trace.data());
+  ASSERT_EQ(json.size() + 1, trace.size());
+  ASSERT_EQ(json.rfind("{\"traceEvents\":[", 0), 0);
+  ASSERT_EQ(json.back(), '}');
+  size_t num_operator_events = 0;
+  for (size_t pos = json.find("\"cat\":\"operator\""); pos != std::string::npos;
+       pos = json.find("\"cat\":\"operator\"", pos + 1)) {
+    num_operator_events++;
+  }
+  ASSERT_EQ(num_operator_events, num_operators);
+  ASSERT_NE(json.find("\"cat\":\"worker\""), std::string::npos);
+}
+
+TEST(RUNTIME, chrome_trace_requires_detailed_profiling) {
+  xnnpack::RuntimeTester tester(3);
+  tester.AddInputTensorF32({3}, 0).AddInputTensorF32({3}, 1).AddOutputTensorF32({3}, 2).AddAddition(0, 1, 2);
+  tester.CreateRuntime(XNN_FLAG_BASIC_PROFILING);
+  tester.SetupRuntime();
+  tester.RepeatRun<float>();
+
+  size_t size = 0;
+  ASSERT_EQ(xnn_status_invalid_state,
+            xnn_get_runtime_profiling_info(tester.Runtime(), xnn_profile_info_chrome_trace, 0, nullptr, &size));
+}
@@ -167,6 +167,128 @@ TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_head_cross_attention_multithre
       .TestF16();
 }
 
+// Many key/value tokens to test the tiled implementation with online softmax.
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_head_cross_attention_many_key_value_tokens) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(3)
+      .key_value_heads(3)
+      .query_tokens(17)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_query_cross_attention_many_key_value_tokens_with_cap) {
+  ScaledDotProductAttentionOperatorTester()
+      .cap_tanh(20.0f)
+      .batch_size(2)
+      .query_heads(3)
+      .key_value_heads(1)
+      .query_tokens(17)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_head_cross_attention_many_key_value_tokens_multithreaded) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(3)
+      .query_heads(5)
+      .key_value_heads(5)
+      .query_tokens(29)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .multithreaded(true)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_head_self_attention_causal_mask) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(2)
+      .query_heads(3)
+      .key_value_heads(3)
+      .query_tokens(37)
+      .query_key_channels(29)
+      .value_channels(23)
+      .causal_mask(true)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_query_cross_attention_causal_mask_key_value_tokens_gt_query_tokens) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(3)
+      .key_value_heads(1)
+      .query_tokens(17)
+      .key_value_tokens(53)
+      .query_key_channels(29)
+      .value_channels(23)
+      .causal_mask(true)
+      .TestF16();
+}
+
+// Causal mask with many key/value tokens, where blocks of key/value tokens after the query tokens are skipped.
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_head_self_attention_causal_mask_many_tokens) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(2)
+      .key_value_heads(2)
+      .query_tokens(601)
+      .query_key_channels(37)
+      .value_channels(29)
+      .causal_mask(true)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multi_head_self_attention_causal_mask_many_tokens_multithreaded) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(2)
+      .query_heads(3)
+      .key_value_heads(3)
+      .query_tokens(601)
+      .query_key_channels(37)
+      .value_channels(29)
+      .causal_mask(true)
+      .multithreaded(true)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, grouped_query) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(6)
+      .key_value_heads(2)
+      .query_tokens(13)
+      .query_key_channels(29)
+      .value_channels(23)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, batch_size_grouped_query_cross_attention_multithreaded) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(3)
+      .query_heads(8)
+      .key_value_heads(4)
+      .query_tokens(17)
+      .key_value_tokens(31)
+      .query_key_channels(29)
+      .value_channels(23)
+      .multithreaded(true)
+      .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, grouped_query_cross_attention_many_key_value_tokens_causal_mask) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(6)
+      .key_value_heads(3)
+      .query_tokens(17)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .causal_mask(true)
+      .TestF16();
+}
+
 TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, unit_batch) {
   ScaledDotProductAttentionOperatorTester()
       .batch_size(1)
@@ -333,3 +455,125 @@ TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_head_cross_attention_multithre
       .multithreaded(true)
       .TestF32();
 }
+
+// Many key/value tokens to test the tiled implementation with online softmax.
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_head_cross_attention_many_key_value_tokens) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(3)
+      .key_value_heads(3)
+      .query_tokens(17)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_query_cross_attention_many_key_value_tokens_with_cap) {
+  ScaledDotProductAttentionOperatorTester()
+      .cap_tanh(20.0f)
+      .batch_size(2)
+      .query_heads(3)
+      .key_value_heads(1)
+      .query_tokens(17)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_head_cross_attention_many_key_value_tokens_multithreaded) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(3)
+      .query_heads(5)
+      .key_value_heads(5)
+      .query_tokens(29)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .multithreaded(true)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_head_self_attention_causal_mask) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(2)
+      .query_heads(3)
+      .key_value_heads(3)
+      .query_tokens(37)
+      .query_key_channels(29)
+      .value_channels(23)
+      .causal_mask(true)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_query_cross_attention_causal_mask_key_value_tokens_gt_query_tokens) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(3)
+      .key_value_heads(1)
+      .query_tokens(17)
+      .key_value_tokens(53)
+      .query_key_channels(29)
+      .value_channels(23)
+      .causal_mask(true)
+      .TestF32();
+}
+
+// Causal mask with many key/value tokens, where blocks of key/value tokens after the query tokens are skipped.
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_head_self_attention_causal_mask_many_tokens) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(2)
+      .key_value_heads(2)
+      .query_tokens(601)
+      .query_key_channels(37)
+      .value_channels(29)
+      .causal_mask(true)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multi_head_self_attention_causal_mask_many_tokens_multithreaded) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(2)
+      .query_heads(3)
+      .key_value_heads(3)
+      .query_tokens(601)
+      .query_key_channels(37)
+      .value_channels(29)
+      .causal_mask(true)
+      .multithreaded(true)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, grouped_query) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(6)
+      .key_value_heads(2)
+      .query_tokens(13)
+      .query_key_channels(29)
+      .value_channels(23)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, batch_size_grouped_query_cross_attention_multithreaded) {
+  ScaledDotProductAttentionOperatorTester()
+      .batch_size(3)
+      .query_heads(8)
+      .key_value_heads(4)
+      .query_tokens(17)
+      .key_value_tokens(31)
+      .query_key_channels(29)
+      .value_channels(23)
+      .multithreaded(true)
+      .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, grouped_query_cross_attention_many_key_value_tokens_causal_mask) {
+  ScaledDotProductAttentionOperatorTester()
+      .query_heads(6)
+      .key_value_heads(3)
+      .query_tokens(17)
+      .key_value_tokens(1031)
+      .query_key_channels(37)
+      .value_channels(29)
+      .causal_mask(true)
+      .TestF32();
+}
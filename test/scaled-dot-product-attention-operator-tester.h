@@ -47,7 +47,7 @@ class ScaledDotProductAttentionOperatorTester {
   }
 
   ScaledDotProductAttentionOperatorTester& key_value_heads(size_t key_value_heads) {
-    assert(key_value_heads == 1 || key_value_heads == query_heads());
+    assert(key_value_heads != 0 && query_heads() % key_value_heads == 0);
     this->key_value_heads_ = key_value_heads;
     return *this;
   }
@@ -107,6 +107,15 @@ class ScaledDotProductAttentionOperatorTester {
     return this->value_channels_;
   }
 
+  ScaledDotProductAttentionOperatorTester& causal_mask(bool causal_mask) {
+    this->causal_mask_ = causal_mask;
+    return *this;
+  }
+
+  bool causal_mask() const {
+    return this->causal_mask_;
+  }
+
   ScaledDotProductAttentionOperatorTester& multithreaded(bool multithreaded) {
     this->multithreaded_ = multithreaded;
     return *this;
@@ -169,9 +178,10 @@ class ScaledDotProductAttentionOperatorTester {
       const size_t output_head_stride = query_tokens() * value_channels();
       const size_t key_batch_stride = key_value_heads() *  key_value_tokens() * query_key_channels();
       const size_t value_batch_stride = key_value_heads() *  key_value_tokens() * value_channels();
-      // For multi-query, key/value only has single head, so don't advance along head dimension.
-      const size_t key_head_stride = key_value_heads() == 1 ? 0 : key_value_tokens() * query_key_channels();
-      const size_t value_head_stride = key_value_heads() == 1 ? 0 : key_value_tokens() * value_channels();
+      // Each key/value head is shared by a group of query heads.
+      const size_t query_heads_per_key_value_head = query_heads() / key_value_heads();
+      const size_t key_head_stride = key_value_tokens() * query_key_channels();
+      const size_t value_head_stride = key_value_tokens() * value_channels();
 
       for (size_t b = 0; b < batch_size(); b++) {
         for (size_t h = 0; h < query_heads(); h++) {
@@ -191,7 +201,7 @@ class ScaledDotProductAttentionOperatorTester {
               for (size_t ki = 0; ki < query_key_channels(); ki++) {
                 logits[n_0 * key_value_tokens() + n_1] +=
                   (q_scaled[n_0 * query_key_channels() + ki]) *
-                  key[b * key_batch_stride + h * key_head_stride + n_1 * query_key_channels() + ki];
+                  key[b * key_batch_stride + (h / query_heads_per_key_value_head) * key_head_stride + n_1 * query_key_channels() + ki];
               }
               if (cap_type() == xnn_attention_logits_cap_type_tanh) {
                 // Cap and tanh.
@@ -199,8 +209,12 @@ class ScaledDotProductAttentionOperatorTester {
                   std::tanh((logits[n_0 * key_value_tokens() + n_1]) / cap_value()) * cap_value();
               }
               // Mask.
-              logits[n_0 * key_value_tokens() + n_1] +=
-                mask[n_0 * key_value_tokens() + n_1];
+              if (causal_mask() && n_1 > n_0 + key_value_tokens() - query_tokens()) {
+                logits[n_0 * key_value_tokens() + n_1] = -std::numeric_limits<float>::infinity();
+              } else if (!causal_mask()) {
+                logits[n_0 * key_value_tokens() + n_1] +=
+                  mask[n_0 * key_value_tokens() + n_1];
+              }
             }
           }
 
@@ -227,7 +241,7 @@ class ScaledDotProductAttentionOperatorTester {
               for (size_t di = 0; di < value_channels(); di++) {
                 output_ref[b * output_batch_stride + h * output_head_stride + ni * value_channels() + di] +=
                     weights[ni * key_value_tokens() + nj] *
-                    value[b * value_batch_stride + h * value_head_stride + nj * value_channels() + di];
+                    value[b * value_batch_stride + (h / query_heads_per_key_value_head) * value_head_stride + nj * value_channels() + di];
               }
             }
           }
@@ -241,7 +255,7 @@ class ScaledDotProductAttentionOperatorTester {
       const xnn_status status = xnn_create_scaled_dot_product_attention_nhtc_f16(
           cap_type(),
           &cap_tanh_params,
-          /*flags=*/0,
+          causal_mask() ? XNN_FLAG_CAUSAL_MASK : 0,
           &attention_op);
 
       if (status == xnn_status_unsupported_hardware) {
@@ -271,7 +285,7 @@ class ScaledDotProductAttentionOperatorTester {
                 xnn_setup_scaled_dot_product_attention_nhtc_f16(
                   attention_op,
                   workspace.data(), query.data(), key.data(), value.data(),
-                  scale.data(), mask.data(), output.data()));
+                  scale.data(), causal_mask() ? nullptr : mask.data(), output.data()));
 
       ASSERT_EQ(xnn_status_success, xnn_run_operator(attention_op, auto_threadpool.get()));
 
@@ -330,9 +344,10 @@ class ScaledDotProductAttentionOperatorTester {
       const size_t output_head_stride = query_tokens() * value_channels();
       const size_t key_batch_stride = key_value_heads() *  key_value_tokens() * query_key_channels();
       const size_t value_batch_stride = key_value_heads() *  key_value_tokens() * value_channels();
-      // For multi-query, key/value only has single head, so don't advance along head dimension.
-      const size_t key_head_stride = key_value_heads() == 1 ? 0 : key_value_tokens() * query_key_channels();
-      const size_t value_head_stride = key_value_heads() == 1 ? 0 : key_value_tokens() * value_channels();
+      // Each key/value head is shared by a group of query heads.
+      const size_t query_heads_per_key_value_head = query_heads() / key_value_heads();
+      const size_t key_head_stride = key_value_tokens() * query_key_channels();
+      const size_t value_head_stride = key_value_tokens() * value_channels();
 
       for (size_t b = 0; b < batch_size(); b++) {
         for (size_t h = 0; h < query_heads(); h++) {
@@ -351,7 +366,7 @@ class ScaledDotProductAttentionOperatorTester {
               for (size_t ki = 0; ki < query_key_channels(); ki++) {
                 logits[n_0 * key_value_tokens() + n_1] +=
                     q_scaled[n_0 * query_key_channels() + ki] *
-                    key[b * key_batch_stride + h * key_head_stride + n_1 * query_key_channels() + ki];
+                    key[b * key_batch_stride + (h / query_heads_per_key_value_head) * key_head_stride + n_1 * query_key_channels() + ki];
               }
               if (cap_type() == xnn_attention_logits_cap_type_tanh) {
                 // Cap and tanh.
@@ -359,7 +374,11 @@ class ScaledDotProductAttentionOperatorTester {
                     std::tanh(logits[n_0 * key_value_tokens() + n_1] / cap_value()) * cap_value();
               }
               // Mask.
-              logits[n_0 * key_value_tokens() + n_1] += mask[n_0 * key_value_tokens() + n_1];
+              if (causal_mask() && n_1 > n_0 + key_value_tokens() - query_tokens()) {
+                logits[n_0 * key_value_tokens() + n_1] = -std::numeric_limits<float>::infinity();
+              } else if (!causal_mask()) {
+                logits[n_0 * key_value_tokens() + n_1] += mask[n_0 * key_value_tokens() + n_1];
+              }
             }
           }
 
@@ -385,7 +404,7 @@ class ScaledDotProductAttentionOperatorTester {
               for (size_t di = 0; di < value_channels(); di++) {
                 output_ref[b * output_batch_stride + h * output_head_stride + ni * value_channels() + di] +=
                     weights[ni * key_value_tokens() + nj] *
-                    value[b * value_batch_stride + h * value_head_stride + nj * value_channels() + di];
+                    value[b * value_batch_stride + (h / query_heads_per_key_value_head) * value_head_stride + nj * value_channels() + di];
               }
             }
           }
@@ -399,7 +418,7 @@ class ScaledDotProductAttentionOperatorTester {
       const xnn_status status = xnn_create_scaled_dot_product_attention_nhtc_f32(
           cap_type(),
           &cap_tanh_params,
-          /*flags=*/0,
+          causal_mask() ? XNN_FLAG_CAUSAL_MASK : 0,
           &attention_op);
 
       if (status == xnn_status_unsupported_hardware) {
@@ -429,7 +448,7 @@ class ScaledDotProductAttentionOperatorTester {
                 xnn_setup_scaled_dot_product_attention_nhtc_f32(
                   attention_op,
                   workspace.data(), query.data(), key.data(), value.data(),
-                  scale.data(), mask.data(), output.data()));
+                  scale.data(), causal_mask() ? nullptr : mask.data(), output.data()));
 
       ASSERT_EQ(xnn_status_success, xnn_run_operator(attention_op, auto_threadpool.get()));
 
@@ -461,6 +480,7 @@ class ScaledDotProductAttentionOperatorTester {
   size_t value_channels_{1};
   size_t query_tokens_{1};
   size_t key_value_tokens_{0};
+  bool causal_mask_{false};
   bool multithreaded_{false};
   size_t iterations_{1};
 };
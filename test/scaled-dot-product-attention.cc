@@ -577,6 +577,127 @@ TEST_F(ScaledDotProductAttentionTestF32, matches_operator_api) {
   }
 }
 
+TEST_F(ScaledDotProductAttentionTestF32, matches_operator_api_causal_mask) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  // Causal mask requires at least as many key/value tokens as query tokens.
+  query_dims = {2, 3, 7, 5};
+  key_dims = {2, 3, 11, 5};
+  value_dims = {2, 3, 11, 6};
+  mask_dims = {7, 11};
+  scale_dims = {5};
+  output_dims = {2, 3, 7, 6};
+  ResizeTensors(query_dims, key_dims, value_dims, mask_dims, scale_dims, output_dims);
+
+  xnn_operator_t op = nullptr;
+  std::generate(query.begin(), query.end(), [&]() { return f32dist(rng); });
+  std::generate(key.begin(), key.end(), [&]() { return f32dist(rng); });
+  std::generate(value.begin(), value.end(), [&]() { return f32dist(rng); });
+  std::generate(scale.begin(), scale.end(), [&]() { return f32dist(rng); });
+
+  // Call operator API.
+  const xnn_status status =
+    xnn_create_scaled_dot_product_attention_nhtc_f32(cap_type, &cap_params, XNN_FLAG_CAUSAL_MASK, &op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_op(op, xnn_delete_operator);
+
+  if (status == xnn_status_unsupported_hardware) {
+    GTEST_SKIP();
+  }
+
+  ASSERT_EQ(xnn_status_success, status);
+  ASSERT_NE(nullptr, op);
+
+  size_t workspace_size = 0;
+  size_t workspace_alignment = 0;
+  ASSERT_EQ(
+    xnn_status_success, xnn_reshape_scaled_dot_product_attention_nhtc_f32(
+                          op, batch_size, query_heads, query_tokens, key_value_heads, key_value_tokens,
+                          channels, value_channels,
+                          &workspace_size, &workspace_alignment, /*threadpool=*/nullptr));
+  ASSERT_NE(workspace_size, 0);
+  ASSERT_LE(workspace_alignment, XNN_ALLOCATION_ALIGNMENT);
+
+  std::vector<char, AlignedAllocator<char, XNN_ALLOCATION_ALIGNMENT>> workspace(workspace_size);
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_setup_scaled_dot_product_attention_nhtc_f32(op, workspace.data(), query.data(), key.data(), value.data(),
+                                                    scale.data(), /*mask=*/nullptr, operator_output.data()));
+
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+
+  // Call subgraph API.
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(5, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(subgraph, xnn_delete_subgraph);
+
+  uint32_t query_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, query_dims.size(), query_dims.data(), nullptr, /*external_id=*/0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &query_id));
+  ASSERT_NE(query_id, XNN_INVALID_VALUE_ID);
+
+  uint32_t key_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, key_dims.size(), key_dims.data(), nullptr, /*external_id=*/1,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &key_id));
+  ASSERT_NE(key_id, XNN_INVALID_VALUE_ID);
+
+  uint32_t value_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, value_dims.size(), value_dims.data(), nullptr, /*external_id=*/2,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &value_id));
+  ASSERT_NE(value_id, XNN_INVALID_VALUE_ID);
+
+  uint32_t scale_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, scale_dims.size(), scale_dims.data(), nullptr, /*external_id=*/3,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &scale_id));
+  ASSERT_NE(scale_id, XNN_INVALID_VALUE_ID);
+
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, /*external_id=*/4,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  ASSERT_NE(output_id, XNN_INVALID_VALUE_ID);
+
+  ASSERT_EQ(
+    xnn_status_success,
+    xnn_define_scaled_dot_product_attention(
+      subgraph, cap_type, &cap_params, query_id, key_id, value_id, scale_id, /*mask_id=*/XNN_INVALID_VALUE_ID,
+      output_id, XNN_FLAG_CAUSAL_MASK));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr, nullptr, xnn_test_runtime_flags(), &runtime));
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime(runtime, xnn_delete_runtime);
+  std::array<xnn_external_value, 5> external = {
+    xnn_external_value{query_id, query.data()},
+    xnn_external_value{key_id, key.data()},
+    xnn_external_value{value_id, value.data()},
+    xnn_external_value{scale_id, scale.data()},
+    xnn_external_value{output_id, subgraph_output.data()}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  // Check outputs match.
+  for (size_t i = 0; i < operator_output.size(); i++) {
+    ASSERT_NEAR(subgraph_output[i], operator_output[i],
+                std::abs(operator_output[i]) * 5 *
+                    std::numeric_limits<float>::epsilon())
+        << "at offset " << i;
+  }
+}
+
 TEST_F(ScaledDotProductAttentionTestF32, matches_operator_api_dynamic_shape_no_reallocation)
 {
   /*
@@ -989,7 +1110,7 @@ void DefineScaledDotProductAttentionSubgraph(
   std::vector<size_t> scale_dims,
   std::vector<size_t> mask_dims,
   std::vector<size_t> output_dims,
-  uint32_t batch_matrix_multiply_flags = 0)
+  uint32_t flags = 0)
 {
   ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
 
@@ -1029,13 +1150,16 @@ void DefineScaledDotProductAttentionSubgraph(
       XNN_VALUE_FLAG_EXTERNAL_INPUT, &scale_id));
   ASSERT_NE(scale_id, XNN_INVALID_VALUE_ID);
 
+  // Empty mask dimensions mean no mask.
   uint32_t mask_id = XNN_INVALID_VALUE_ID;
-  ASSERT_EQ(
-    xnn_status_success,
-    xnn_define_tensor_value(
-      subgraph, xnn_datatype_fp32, mask_dims.size(), mask_dims.data(), nullptr, /*external_id=*/4,
-      XNN_VALUE_FLAG_EXTERNAL_INPUT, &mask_id));
-  ASSERT_NE(mask_id, XNN_INVALID_VALUE_ID);
+  if (!mask_dims.empty()) {
+    ASSERT_EQ(
+      xnn_status_success,
+      xnn_define_tensor_value(
+        subgraph, xnn_datatype_fp32, mask_dims.size(), mask_dims.data(), nullptr, /*external_id=*/4,
+        XNN_VALUE_FLAG_EXTERNAL_INPUT, &mask_id));
+    ASSERT_NE(mask_id, XNN_INVALID_VALUE_ID);
+  }
 
   uint32_t output_id = XNN_INVALID_VALUE_ID;
   ASSERT_EQ(
@@ -1046,7 +1170,7 @@ void DefineScaledDotProductAttentionSubgraph(
   ASSERT_NE(output_id, XNN_INVALID_VALUE_ID);
 
   *status_out = xnn_define_scaled_dot_product_attention(
-    subgraph, cap_type, &cap_params, query_id, key_id, value_id, scale_id, mask_id, output_id, /*flags=*/0);
+    subgraph, cap_type, &cap_params, query_id, key_id, value_id, scale_id, mask_id, output_id, flags);
 }
 }  // namespace
 
@@ -1170,7 +1294,7 @@ TEST(ScaledDotProductAttentionTest, query_channels_eq_key_channels) {
   EXPECT_EQ(xnn_status_invalid_parameter, status);
 }
 
-TEST(ScaledDotProductAttentionTest, query_heads_eq_key_heads) {
+TEST(ScaledDotProductAttentionTest, query_heads_divisible_by_key_heads) {
   std::vector<size_t> query_dims = {1, 2, 3, 5};
   std::vector<size_t> key_dims = {1, 7, 3, 5};
   std::vector<size_t> value_dims = {1, 2, 3, 5};
@@ -1185,7 +1309,7 @@ TEST(ScaledDotProductAttentionTest, query_heads_eq_key_heads) {
   EXPECT_EQ(xnn_status_invalid_parameter, status);
 }
 
-TEST(ScaledDotProductAttentionTest, query_heads_eq_value_heads) {
+TEST(ScaledDotProductAttentionTest, key_heads_eq_value_heads) {
   std::vector<size_t> query_dims = {1, 2, 3, 5};
   std::vector<size_t> key_dims = {1, 2, 3, 5};
   std::vector<size_t> value_dims = {1, 7, 3, 5};
@@ -1200,6 +1324,36 @@ TEST(ScaledDotProductAttentionTest, query_heads_eq_value_heads) {
   EXPECT_EQ(xnn_status_invalid_parameter, status);
 }
 
+TEST(ScaledDotProductAttentionTest, grouped_query_is_ok) {
+  std::vector<size_t> query_dims = {1, 6, 3, 5};
+  std::vector<size_t> key_dims = {1, 2, 3, 5};
+  std::vector<size_t> value_dims = {1, 2, 3, 5};
+  std::vector<size_t> scale_dims = {5};
+  std::vector<size_t> mask_dims = {3, 3};
+  std::vector<size_t> output_dims = {1, 6, 3, 5};
+  xnn_status status = xnn_status_success;
+  xnn_attention_logits_cap_type cap_type = xnn_attention_logits_cap_type_none;
+  xnn_attention_logits_cap_tanh_params cap_params{};
+  DefineScaledDotProductAttentionSubgraph(
+    &status, cap_type, cap_params, query_dims, key_dims, value_dims, scale_dims, mask_dims, output_dims);
+  EXPECT_EQ(xnn_status_success, status);
+}
+
+TEST(ScaledDotProductAttentionTest, grouped_query_key_heads_eq_value_heads) {
+  std::vector<size_t> query_dims = {1, 6, 3, 5};
+  std::vector<size_t> key_dims = {1, 2, 3, 5};
+  std::vector<size_t> value_dims = {1, 6, 3, 5};
+  std::vector<size_t> scale_dims = {5};
+  std::vector<size_t> mask_dims = {3, 3};
+  std::vector<size_t> output_dims = {1, 6, 3, 5};
+  xnn_status status = xnn_status_success;
+  xnn_attention_logits_cap_type cap_type = xnn_attention_logits_cap_type_none;
+  xnn_attention_logits_cap_tanh_params cap_params{};
+  DefineScaledDotProductAttentionSubgraph(
+    &status, cap_type, cap_params, query_dims, key_dims, value_dims, scale_dims, mask_dims, output_dims);
+  EXPECT_EQ(xnn_status_invalid_parameter, status);
+}
+
 TEST(ScaledDotProductAttentionTest, key_num_dims_ne_query_num_dims) {
   std::vector<size_t> query_dims = {1, 2, 3, 5};
   std::vector<size_t> key_dims = {7, 1, 2, 3, 5};
@@ -1380,6 +1534,53 @@ TEST(ScaledDotProductAttentionTest, mask_key_value_tokens_eq_key_value_tokens) {
   EXPECT_EQ(xnn_status_invalid_parameter, status);
 }
 
+TEST(ScaledDotProductAttentionTest, mask_is_required_without_causal_mask) {
+  std::vector<size_t> query_dims = {1, 2, 3, 5};
+  std::vector<size_t> key_dims = {1, 2, 7, 5};
+  std::vector<size_t> value_dims = {1, 2, 7, 5};
+  std::vector<size_t> scale_dims = {5};
+  std::vector<size_t> mask_dims = {};
+  std::vector<size_t> output_dims = {1, 2, 3, 5};
+  xnn_status status = xnn_status_success;
+  xnn_attention_logits_cap_type cap_type = xnn_attention_logits_cap_type_none;
+  xnn_attention_logits_cap_tanh_params cap_params{};
+  DefineScaledDotProductAttentionSubgraph(
+    &status, cap_type, cap_params, query_dims, key_dims, value_dims, scale_dims, mask_dims, output_dims);
+  EXPECT_EQ(xnn_status_invalid_parameter, status);
+}
+
+TEST(ScaledDotProductAttentionTest, causal_mask_without_mask_is_ok) {
+  std::vector<size_t> query_dims = {1, 2, 3, 5};
+  std::vector<size_t> key_dims = {1, 2, 7, 5};
+  std::vector<size_t> value_dims = {1, 2, 7, 5};
+  std::vector<size_t> scale_dims = {5};
+  std::vector<size_t> mask_dims = {};
+  std::vector<size_t> output_dims = {1, 2, 3, 5};
+  xnn_status status = xnn_status_success;
+  xnn_attention_logits_cap_type cap_type = xnn_attention_logits_cap_type_none;
+  xnn_attention_logits_cap_tanh_params cap_params{};
+  DefineScaledDotProductAttentionSubgraph(
+    &status, cap_type, cap_params, query_dims, key_dims, value_dims, scale_dims, mask_dims, output_dims,
+    XNN_FLAG_CAUSAL_MASK);
+  EXPECT_EQ(xnn_status_success, status);
+}
+
+TEST(ScaledDotProductAttentionTest, causal_mask_key_value_tokens_ge_query_tokens) {
+  std::vector<size_t> query_dims = {1, 2, 9, 5};
+  std::vector<size_t> key_dims = {1, 2, 7, 5};
+  std::vector<size_t> value_dims = {1, 2, 7, 5};
+  std::vector<size_t> scale_dims = {5};
+  std::vector<size_t> mask_dims = {};
+  std::vector<size_t> output_dims = {1, 2, 9, 5};
+  xnn_status status = xnn_status_success;
+  xnn_attention_logits_cap_type cap_type = xnn_attention_logits_cap_type_none;
+  xnn_attention_logits_cap_tanh_params cap_params{};
+  DefineScaledDotProductAttentionSubgraph(
+    &status, cap_type, cap_params, query_dims, key_dims, value_dims, scale_dims, mask_dims, output_dims,
+    XNN_FLAG_CAUSAL_MASK);
+  EXPECT_EQ(xnn_status_invalid_parameter, status);
+}
+
 TEST(ScaledDotProductAttentionTest, output_dims_ge_4) {
   std::vector<size_t> query_dims = {1, 2, 3, 5};
   std::vector<size_t> key_dims = {1, 2, 7, 5};
@@ -75,6 +75,17 @@ TEST(SOFTMAX_NC_F16, imagenet_classes) {
     .TestF16();
 }
 
+TEST(SOFTMAX_NC_F16, long_rows) {
+  // Rows of 1 MiB and longer use the two-pass online softmax.
+  for (size_t channels : {524288, 589825}) {
+    SoftMaxOperatorTester()
+      .batch_size(2)
+      .channels(channels)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
 TEST(SOFTMAX_NC_F16, small_batch) {
   for (size_t channels = 1; channels < 100; channels += 5) {
     SoftMaxOperatorTester()
@@ -183,6 +194,17 @@ TEST(SOFTMAX_NC_F32, imagenet_classes) {
     .TestF32();
 }
 
+TEST(SOFTMAX_NC_F32, long_rows) {
+  // Rows of 1 MiB and longer use the two-pass online softmax.
+  for (size_t channels : {262144, 294913}) {
+    SoftMaxOperatorTester()
+      .batch_size(2)
+      .channels(channels)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
 TEST(SOFTMAX_NC_F32, small_batch) {
   for (size_t channels = 1; channels < 100; channels += 5) {
     SoftMaxOperatorTester()
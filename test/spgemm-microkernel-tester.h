@@ -0,0 +1,276 @@
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+#include "xnnpack/common.h"
+#include "xnnpack/math.h"
+#include "xnnpack/microfnptr.h"
+#include "xnnpack/microparams.h"
+#include "xnnpack/pack.h"
+#include "xnnpack/buffer.h"
+#include "replicable_random_device.h"
+
+class SpGEMMMicrokernelTester {
+ public:
+  SpGEMMMicrokernelTester& mr(size_t mr) {
+    this->mr_ = mr;
+    return *this;
+  }
+
+  size_t mr() const {
+    return this->mr_;
+  }
+
+  SpGEMMMicrokernelTester& nr(size_t nr) {
+    this->nr_ = nr;
+    return *this;
+  }
+
+  size_t nr() const {
+    return this->nr_;
+  }
+
+  SpGEMMMicrokernelTester& m(size_t m) {
+    this->m_ = m;
+    return *this;
+  }
+
+  size_t m() const {
+    return this->m_;
+  }
+
+  SpGEMMMicrokernelTester& n(size_t n) {
+    this->n_ = n;
+    return *this;
+  }
+
+  size_t n() const {
+    return this->n_;
+  }
+
+  SpGEMMMicrokernelTester& k(size_t k) {
+    this->k_ = k;
+    return *this;
+  }
+
+  size_t k() const {
+    return this->k_;
+  }
+
+  SpGEMMMicrokernelTester& a_stride(size_t a_stride) {
+    assert(a_stride != 0);
+    this->a_stride_ = a_stride;
+    return *this;
+  }
+
+  size_t a_stride() const {
+    if (this->a_stride_ == 0) {
+      return k();
+    } else {
+      assert(this->a_stride_ >= k());
+      return this->a_stride_;
+    }
+  }
+
+  SpGEMMMicrokernelTester& cm_stride(size_t cm_stride) {
+    assert(cm_stride != 0);
+    this->cm_stride_ = cm_stride;
+    return *this;
+  }
+
+  size_t cm_stride() const {
+    if (this->cm_stride_ == 0) {
+      return n();
+    } else {
+      assert(this->cm_stride_ >= n());
+      return this->cm_stride_;
+    }
+  }
+
+  // Fraction of zero blocks of 1 input channel by NR output channels, or of
+  // zero weights in the 2 non-zero slots of each 2:4 group.
+  SpGEMMMicrokernelTester& sparsity(float sparsity) {
+    this->sparsity_ = sparsity;
+    return *this;
+  }
+
+  float sparsity() const {
+    return this->sparsity_;
+  }
+
+  SpGEMMMicrokernelTester& sparse_2of4(bool sparse_2of4) {
+    this->sparse_2of4_ = sparse_2of4;
+    return *this;
+  }
+
+  bool sparse_2of4() const {
+    return this->sparse_2of4_;
+  }
+
+  SpGEMMMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  SpGEMMMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  SpGEMMMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_spgemm_minmax_ukernel_fn spgemm, xnn_init_f32_minmax_params_fn init_params) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_GE(m(), 1);
+    ASSERT_GE(n(), 1);
+    ASSERT_GE(k(), 1);
+
+    xnnpack::ReplicableRandomDevice rng;
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> pdist;
+    std::uniform_int_distribution<size_t> positiondist(0, 3);
+
+    xnnpack::Buffer<float> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(float));
+    // Weights in [N, K] layout, as expected by the packing functions.
+    xnnpack::Buffer<float> b(n() * k());
+    xnnpack::Buffer<float> bias(n());
+    xnnpack::Buffer<float> c((m() - 1) * cm_stride() + n());
+    xnnpack::Buffer<float> c_ref(m() * n());
+
+    const size_t num_tiles = divide_round_up(n(), nr());
+    const size_t num_groups = divide_round_up(k(), 4);
+    // Upper bound of the packed weights size: every block of the 1xN format is non-zero.
+    const size_t packed_w_size = sparse_2of4()
+      ? num_tiles * (nr() * sizeof(float) + num_groups * 2 * nr() * (sizeof(float) + sizeof(uint8_t)))
+      : num_tiles * (nr() * sizeof(float) + sizeof(uint32_t) + k() * (sizeof(uint32_t) + nr() * sizeof(float)));
+    xnnpack::Buffer<char, XNN_ALLOCATION_ALIGNMENT> packed_w(packed_w_size + XNN_EXTRA_BYTES);
+    xnnpack::Buffer<uint32_t> tile_offsets(num_tiles);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(b.begin(), b.end(), 0.0f);
+      if (sparse_2of4()) {
+        // At most 2 non-zero weights in each group of 4 input channels.
+        for (size_t nn = 0; nn < n(); nn++) {
+          for (size_t kk = 0; kk < k(); kk += 4) {
+            const size_t group_size = std::min(k() - kk, size_t(4));
+            for (size_t slot = 0; slot < 2; slot++) {
+              if (pdist(rng) > sparsity()) {
+                b[nn * k() + kk + positiondist(rng) % group_size] = f32dist(rng);
+              }
+            }
+          }
+        }
+      } else {
+        for (size_t nn = 0; nn < n(); nn += nr()) {
+          for (size_t kk = 0; kk < k(); kk++) {
+            if (pdist(rng) > sparsity()) {
+              for (size_t i = nn; i < std::min(nn + nr(), n()); i++) {
+                b[i * k() + kk] = f32dist(rng);
+              }
+            }
+          }
+        }
+      }
+      std::fill(c.begin(), c.end(), std::nanf(""));
+
+      if (sparse_2of4()) {
+        xnn_pack_f32_spgemm_2of4_w(n(), k(), nr(), b.data(), bias.data(), tile_offsets.data(), packed_w.data());
+      } else {
+        xnn_pack_f32_spgemm_w(n(), k(), nr(), b.data(), bias.data(), tile_offsets.data(), packed_w.data());
+      }
+
+      for (size_t mm = 0; mm < m(); mm++) {
+        for (size_t nn = 0; nn < n(); nn++) {
+          double acc = bias[nn];
+          for (size_t kk = 0; kk < k(); kk++) {
+            acc += double(a[mm * a_stride() + kk]) * double(b[nn * k() + kk]);
+          }
+          c_ref[mm * n() + nn] = float(acc);
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+      const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+      const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                                                       : accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                                                       : accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& c_value : c_ref) {
+        c_value = std::max(std::min(c_value, c_max), c_min);
+      }
+
+      // Prepare parameters.
+      xnn_f32_minmax_params params;
+      init_params(&params, c_min, c_max);
+
+      // Tiles are packed back to back, so the micro-kernel walks all of them from the first one.
+      spgemm(m(), n(), k() * sizeof(float),
+        a.data(), a_stride() * sizeof(float),
+        packed_w.data() + tile_offsets[0],
+        c.data(), cm_stride() * sizeof(float), nr() * sizeof(float),
+        &params);
+
+      // Validate micro-kernel outputs.
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_NEAR(
+              c[i * cm_stride() + j],
+              c_ref[i * n() + j],
+              std::max(1.0e-5f, std::abs(c_ref[i * n() + j]) * 1.0e-5f))
+            << "at M index " << i << " / " << m() << " (tile " << mr() << ")"
+            << ", N index " << j << " / " << n() << " (tile " << nr() << ")"
+            << ", K = " << k();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t mr_{1};
+  size_t nr_{1};
+  size_t m_{1};
+  size_t n_{1};
+  size_t k_{1};
+  size_t a_stride_{0};
+  size_t cm_stride_{0};
+  float sparsity_{0.5f};
+  bool sparse_2of4_{false};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
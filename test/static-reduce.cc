@@ -47,6 +47,18 @@ struct Param {
       case xnn_reduce_sum:
         sstr << "sum";
         break;
+      case xnn_reduce_max:
+        sstr << "max";
+        break;
+      case xnn_reduce_min:
+        sstr << "min";
+        break;
+      case xnn_reduce_prod:
+        sstr << "prod";
+        break;
+      case xnn_reduce_argmax:
+        sstr << "argmax";
+        break;
       case xnn_reduce_invalid:
         sstr << "invalid";
         break;
@@ -290,6 +302,19 @@ INSTANTIATE_TEST_SUITE_P(ReduceTest, ReduceTest,
                              Bool())),
                          [](auto p) { return p.param.Name(); });
 
+INSTANTIATE_TEST_SUITE_P(ReduceMinMaxTest, ReduceTest,
+                         testing::ConvertGenerator<Param::TupleT>(Combine(
+                             Values(xnn_datatype_fp16, xnn_datatype_fp32),
+                             Values(xnn_reduce_max, xnn_reduce_min), Bool(),
+                             Bool())),
+                         [](auto p) { return p.param.Name(); });
+
+INSTANTIATE_TEST_SUITE_P(ReduceProdTest, ReduceTest,
+                         testing::ConvertGenerator<Param::TupleT>(Combine(
+                             Values(xnn_datatype_fp32), Values(xnn_reduce_prod),
+                             Bool(), Bool())),
+                         [](auto p) { return p.param.Name(); });
+
 TEST_P(ReduceTest, define) {
   const Param p = GetParam();
   ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
@@ -575,4 +600,88 @@ TEST_P(ReduceTest, reshape) {
   }
 }
 
+TEST(ReduceArgMaxTest, define) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(
+      subgraph, xnn_delete_subgraph);
+
+  const std::array<size_t, 3> input_shape = {2, 3, 5};
+  const std::array<size_t, 2> output_shape = {2, 5};
+  const std::array<int64_t, 1> reduction_axes = {1};
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32,
+                                    input_shape.size(), input_shape.data(),
+                                    nullptr, /*external_id=*/0,
+                                    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_int32,
+                                    output_shape.size(), output_shape.data(),
+                                    nullptr, /*external_id=*/1,
+                                    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  uint32_t float_output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_tensor_value(subgraph, xnn_datatype_fp32,
+                                    output_shape.size(), output_shape.data(),
+                                    nullptr, /*external_id=*/2,
+                                    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &float_output_id));
+
+  // ArgMax produces int32 indices.
+  ASSERT_EQ(xnn_status_invalid_parameter,
+            xnn_define_static_reduce_v2(
+                subgraph, xnn_reduce_argmax, reduction_axes.size(),
+                reduction_axes.data(), input_id, float_output_id, /*flags=*/0));
+  ASSERT_EQ(subgraph->num_nodes, 0);
+
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_static_reduce_v2(
+                subgraph, xnn_reduce_argmax, reduction_axes.size(),
+                reduction_axes.data(), input_id, output_id, /*flags=*/0));
+  ASSERT_EQ(subgraph->num_nodes, 1);
+  const struct xnn_node* node = &subgraph->nodes[0];
+  ASSERT_EQ(node->type, xnn_node_type_static_argmax);
+  ASSERT_EQ(node->inputs[0], input_id);
+  ASSERT_EQ(node->outputs[0], output_id);
+}
+
+TEST(ReduceMaxTest, rejects_quantized_input) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, /*flags=*/0, &subgraph));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph(
+      subgraph, xnn_delete_subgraph);
+
+  const std::array<size_t, 2> input_shape = {3, 5};
+  const std::array<size_t, 1> output_shape = {3};
+  const std::array<int64_t, 1> reduction_axes = {1};
+
+  uint32_t input_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_quantized_tensor_value(
+                subgraph, xnn_datatype_qint8, /*zero_point=*/0, /*scale=*/1.0f,
+                input_shape.size(), input_shape.data(), nullptr,
+                /*external_id=*/0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_NODE_ID;
+  ASSERT_EQ(xnn_status_success,
+            xnn_define_quantized_tensor_value(
+                subgraph, xnn_datatype_qint8, /*zero_point=*/0, /*scale=*/1.0f,
+                output_shape.size(), output_shape.data(), nullptr,
+                /*external_id=*/1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  for (xnn_reduce_operator reduce_operator :
+       {xnn_reduce_max, xnn_reduce_min, xnn_reduce_prod, xnn_reduce_argmax}) {
+    ASSERT_EQ(xnn_status_invalid_parameter,
+              xnn_define_static_reduce_v2(
+                  subgraph, reduce_operator, reduction_axes.size(),
+                  reduction_axes.data(), input_id, output_id, /*flags=*/0));
+  }
+  ASSERT_EQ(subgraph->num_nodes, 0);
+}
+
 }  // namespace xnnpack
@@ -480,6 +480,14 @@ class SubgraphTester {
     return *this;
   }
 
+  SubgraphTester& AddGelu(uint32_t input_id, uint32_t output_id) {
+    const xnn_status status =
+        xnn_define_unary(subgraph_.get(), xnn_unary_gelu, nullptr, input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   SubgraphTester& AddHardSwish(uint32_t input_id, uint32_t output_id) {
     const xnn_status status =
         xnn_define_unary(subgraph_.get(), xnn_unary_hardswish, nullptr, input_id, output_id, 0 /* flags */);
@@ -498,6 +506,15 @@ class SubgraphTester {
     return *this;
   }
 
+  SubgraphTester& AddLayerNorm(
+      float epsilon, uint32_t input_id, uint32_t scale_id, uint32_t bias_id, uint32_t output_id) {
+    const xnn_status status =
+        xnn_define_layer_norm(subgraph_.get(), epsilon, input_id, scale_id, bias_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   inline SubgraphTester& AddMaxPooling2D(
       uint32_t input_padding_top, uint32_t input_padding_right,
       uint32_t input_padding_bottom, uint32_t input_padding_left,
@@ -532,6 +549,14 @@ class SubgraphTester {
     return *this;
   }
 
+  SubgraphTester& AddRMSNorm(float epsilon, uint32_t input_id, uint32_t scale_id, uint32_t output_id) {
+    const xnn_status status =
+        xnn_define_rms_norm(subgraph_.get(), epsilon, input_id, scale_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   SubgraphTester& AddSubtract(uint32_t input_id1, uint32_t input_id2, uint32_t output_id) {
     struct xnn_binary_params params = {-std::numeric_limits<float>::infinity(),
                                        std::numeric_limits<float>::infinity()};
@@ -543,6 +568,14 @@ class SubgraphTester {
     return *this;
   }
 
+  SubgraphTester& AddUnary(xnn_unary_operator op, const xnn_unary_params* params, uint32_t input_id,
+                           uint32_t output_id) {
+    const xnn_status status = xnn_define_unary(subgraph_.get(), op, params, input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   SubgraphTester& Optimize() {
     const xnn_status status = xnn_subgraph_optimize(subgraph_.get(), 0 /* flags */);
     EXPECT_EQ(status, xnn_status_success);
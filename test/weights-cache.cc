@@ -4,7 +4,9 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <algorithm>  // For std::rotate.
+#include <cmath>      // For INFINITY.
 #include <cstdint>    // For uintptr_t.
+#include <cstdio>     // For std::fopen.
 #include <cstring>    // For memcpy.
 #include <string>
 #include <thread>
@@ -14,6 +16,7 @@
 #include "xnnpack.h"
 #include "xnnpack/cache.h"
 #include "xnnpack/common.h"
+#include "xnnpack/config.h"
 #include "xnnpack/memory.h"
 
 static void* cache_end(const struct xnn_internal_weights_cache* cache) {
@@ -366,3 +369,280 @@ TEST(WEIGHTS_CACHE, insert_into_finalized_cache_soft) {
 
   ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
 }
+
+static std::string weights_cache_file_path(const char* name) {
+  return ::testing::TempDir() + "/" + name + ".xnnwc";
+}
+
+TEST(WEIGHTS_CACHE, save_and_load) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("save_and_load");
+  {
+    struct xnn_internal_weights_cache cache;
+    ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_with_size(&cache, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+    write_weights(&cache, "1234");
+    ASSERT_EQ(0, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+    write_weights(&cache, "5678");
+    ASSERT_EQ(4, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+    ASSERT_EQ(xnn_status_success, xnn_internal_save_weights_cache(&cache, path.c_str()));
+    ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+  }
+
+  struct xnn_internal_weights_cache cache;
+  ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_from_file(&cache, path.c_str()));
+  ASSERT_TRUE(xnn_internal_weights_cache_is_finalized(&cache));
+  ASSERT_EQ(2, cache.cache.num_entries);
+  ASSERT_EQ(0, std::memcmp(xnn_internal_weights_cache_offset_to_addr(&cache, 0), "12345678", 8));
+
+  // Packed weights in the file are found.
+  write_weights(&cache, "5678");
+  ASSERT_EQ(4, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+  ASSERT_EQ(1, cache.cache.hits);
+
+  // Packed weights not in the file are not inserted.
+  write_weights(&cache, "abcd");
+  ASSERT_EQ(XNN_CACHE_NOT_FOUND, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+
+  ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+  std::remove(path.c_str());
+}
+
+TEST(WEIGHTS_CACHE, save_hard_finalized_fails) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("save_hard_finalized_fails");
+  struct xnn_internal_weights_cache cache;
+  ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_with_size(&cache, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+  ASSERT_EQ(xnn_status_success, xnn_internal_finalize_weights_cache(&cache, xnn_weights_cache_finalization_kind_hard));
+  ASSERT_EQ(xnn_status_invalid_state, xnn_internal_save_weights_cache(&cache, path.c_str()));
+  ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+}
+
+TEST(WEIGHTS_CACHE, load_invalid_file_fails) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("load_invalid_file_fails");
+  struct xnn_internal_weights_cache cache;
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_internal_init_weights_cache_from_file(&cache, path.c_str()));
+
+  FILE* file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(nullptr, file);
+  const std::string garbage(1024, 'x');
+  ASSERT_EQ(garbage.size(), std::fwrite(garbage.data(), 1, garbage.size(), file));
+  ASSERT_EQ(0, std::fclose(file));
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_internal_init_weights_cache_from_file(&cache, path.c_str()));
+  std::remove(path.c_str());
+}
+
+TEST(WEIGHTS_CACHE, load_different_build_fails) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("load_different_build_fails");
+  {
+    struct xnn_internal_weights_cache cache;
+    ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_with_size(&cache, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+    write_weights(&cache, "1234");
+    ASSERT_EQ(0, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+    ASSERT_EQ(xnn_status_success, xnn_internal_save_weights_cache(&cache, path.c_str()));
+    ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+  }
+
+  // Corrupt the build identifier stored in the file.
+  FILE* file = std::fopen(path.c_str(), "rb");
+  ASSERT_NE(nullptr, file);
+  std::vector<char> contents(4096);
+  contents.resize(std::fread(contents.data(), 1, contents.size(), file));
+  ASSERT_EQ(0, std::fclose(file));
+  const char* build_identifier = static_cast<const char*>(xnn_experimental_get_build_identifier_data());
+  auto it = std::search(contents.begin(), contents.end(), build_identifier,
+                        build_identifier + xnn_experimental_get_build_identifier_size());
+  ASSERT_NE(it, contents.end());
+  *it = ~*it;
+  file = std::fopen(path.c_str(), "r+b");
+  ASSERT_NE(nullptr, file);
+  ASSERT_EQ(contents.size(), std::fwrite(contents.data(), 1, contents.size(), file));
+  ASSERT_EQ(0, std::fclose(file));
+
+  struct xnn_internal_weights_cache cache;
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_internal_init_weights_cache_from_file(&cache, path.c_str()));
+  std::remove(path.c_str());
+}
+
+TEST(WEIGHTS_CACHE, load_truncated_file_fails) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("load_truncated_file_fails");
+  {
+    struct xnn_internal_weights_cache cache;
+    ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_with_size(&cache, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+    write_weights(&cache, "1234");
+    ASSERT_EQ(0, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+    ASSERT_EQ(xnn_status_success, xnn_internal_save_weights_cache(&cache, path.c_str()));
+    ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+  }
+
+  // Drop the packed weights at the end of the file, so that mapping them would fault on access.
+  FILE* file = std::fopen(path.c_str(), "rb");
+  ASSERT_NE(nullptr, file);
+  std::vector<char> contents(1 << 20);
+  contents.resize(std::fread(contents.data(), 1, contents.size(), file));
+  ASSERT_EQ(0, std::fclose(file));
+  ASSERT_GT(contents.size(), 4);
+  contents.resize(contents.size() - 4);
+  file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(nullptr, file);
+  ASSERT_EQ(contents.size(), std::fwrite(contents.data(), 1, contents.size(), file));
+  ASSERT_EQ(0, std::fclose(file));
+
+  struct xnn_internal_weights_cache cache;
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_internal_init_weights_cache_from_file(&cache, path.c_str()));
+  std::remove(path.c_str());
+}
+
+TEST(WEIGHTS_CACHE, create_operator_with_loaded_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("create_operator_with_loaded_cache");
+  const size_t input_channels = 37;
+  const size_t output_channels = 19;
+  std::vector<float> kernel(output_channels * input_channels);
+  std::vector<float> bias(output_channels);
+  for (size_t i = 0; i < kernel.size(); i++) {
+    kernel[i] = static_cast<float>(i % 7) - 3.0f;
+  }
+  for (size_t i = 0; i < bias.size(); i++) {
+    bias[i] = static_cast<float>(i);
+  }
+  std::vector<float> input(input_channels + XNN_EXTRA_BYTES / sizeof(float), 1.0f);
+
+  std::vector<float> expected(output_channels);
+  {
+    xnn_weights_cache_t weights_cache = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+    xnn_operator_t op = nullptr;
+    ASSERT_EQ(xnn_status_success,
+              xnn_create_fully_connected_nc_f32(input_channels, output_channels, input_channels, output_channels,
+                                                kernel.data(), bias.data(), -INFINITY, INFINITY, /*flags=*/0,
+                                                /*code_cache=*/nullptr, weights_cache, &op));
+    ASSERT_EQ(xnn_status_success, xnn_finalize_weights_cache(weights_cache, xnn_weights_cache_finalization_kind_soft));
+    ASSERT_EQ(xnn_status_success, xnn_reshape_fully_connected_nc_f32(op, 1, /*threadpool=*/nullptr));
+    ASSERT_EQ(xnn_status_success, xnn_setup_fully_connected_nc_f32(op, input.data(), expected.data()));
+    ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+    ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+    ASSERT_EQ(xnn_status_success, xnn_save_weights_cache(weights_cache, path.c_str()));
+    ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+  }
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache_from_file(path.c_str(), &weights_cache));
+  ASSERT_TRUE(xnn_weights_cache_is_finalized(weights_cache));
+
+  xnn_operator_t op = nullptr;
+  ASSERT_EQ(xnn_status_success,
+            xnn_create_fully_connected_nc_f32(input_channels, output_channels, input_channels, output_channels,
+                                              kernel.data(), bias.data(), -INFINITY, INFINITY, /*flags=*/0,
+                                              /*code_cache=*/nullptr, weights_cache, &op));
+  std::vector<float> output(output_channels);
+  ASSERT_EQ(xnn_status_success, xnn_reshape_fully_connected_nc_f32(op, 1, /*threadpool=*/nullptr));
+  ASSERT_EQ(xnn_status_success, xnn_setup_fully_connected_nc_f32(op, input.data(), output.data()));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+  ASSERT_EQ(xnn_status_success, xnn_delete_operator(op));
+  EXPECT_EQ(expected, output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+  std::remove(path.c_str());
+}
+
+TEST(WEIGHTS_CACHE, gemm_tunings_are_saved_and_loaded) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const std::string path = weights_cache_file_path("gemm_tunings_are_saved_and_loaded");
+  struct xnn_gemm_tuning_record record = {};
+  record.input_channels = 4096;
+  record.output_channels = 1024;
+  record.operator_type = 1;
+  record.mr = 5;
+  record.nr = 16;
+  {
+    struct xnn_internal_weights_cache cache;
+    ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_with_size(&cache, XNN_DEFAULT_WEIGHTS_BUFFER_SIZE));
+    write_weights(&cache, "1234");
+    ASSERT_EQ(0, xnn_internal_get_or_insert_weights_cache(&cache, nullptr, cache_end(&cache), 4));
+    ASSERT_EQ(xnn_status_success, xnn_internal_weights_cache_insert_gemm_tuning(&cache, &record));
+    // Inserting the same shape again replaces the result.
+    record.mr = 7;
+    record.nr = 32;
+    ASSERT_EQ(xnn_status_success, xnn_internal_weights_cache_insert_gemm_tuning(&cache, &record));
+    ASSERT_EQ(1, cache.num_gemm_tunings);
+    ASSERT_EQ(xnn_status_success, xnn_internal_save_weights_cache(&cache, path.c_str()));
+    ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+  }
+
+  struct xnn_internal_weights_cache cache;
+  ASSERT_EQ(xnn_status_success, xnn_internal_init_weights_cache_from_file(&cache, path.c_str()));
+  struct xnn_gemm_tuning_record found = {};
+  found.input_channels = 4096;
+  found.output_channels = 1024;
+  found.operator_type = 1;
+  ASSERT_TRUE(xnn_internal_weights_cache_look_up_gemm_tuning(&cache, &found));
+  EXPECT_EQ(7, found.mr);
+  EXPECT_EQ(32, found.nr);
+  found.output_channels = 1023;
+  EXPECT_FALSE(xnn_internal_weights_cache_look_up_gemm_tuning(&cache, &found));
+  ASSERT_EQ(0, std::memcmp(xnn_internal_weights_cache_offset_to_addr(&cache, 0), "1234", 4));
+
+  ASSERT_EQ(xnn_status_success, xnn_internal_release_weights_cache(&cache));
+  std::remove(path.c_str());
+}
+
+TEST(WEIGHTS_CACHE, create_autotuned_operator) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(/*allocator=*/nullptr));
+  const size_t input_channels = 53;
+  const size_t output_channels = 67;
+  const size_t batch_size = 9;
+  std::vector<float> kernel(output_channels * input_channels);
+  std::vector<float> bias(output_channels);
+  for (size_t i = 0; i < kernel.size(); i++) {
+    kernel[i] = static_cast<float>(i % 5) - 2.0f;
+  }
+  for (size_t i = 0; i < bias.size(); i++) {
+    bias[i] = static_cast<float>(i % 3);
+  }
+  std::vector<float> input(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<float>(i % 7) - 3.0f;
+  }
+
+  auto run = [&](uint32_t flags, xnn_weights_cache_t weights_cache) {
+    std::vector<float> output(batch_size * output_channels);
+    xnn_operator_t op = nullptr;
+    EXPECT_EQ(xnn_status_success,
+              xnn_create_fully_connected_nc_f32(input_channels, output_channels, input_channels, output_channels,
+                                                kernel.data(), bias.data(), -INFINITY, INFINITY, flags,
+                                                /*code_cache=*/nullptr, weights_cache, &op));
+    EXPECT_EQ(xnn_status_success, xnn_reshape_fully_connected_nc_f32(op, batch_size, /*threadpool=*/nullptr));
+    EXPECT_EQ(xnn_status_success, xnn_setup_fully_connected_nc_f32(op, input.data(), output.data()));
+    EXPECT_EQ(xnn_status_success, xnn_run_operator(op, /*threadpool=*/nullptr));
+    EXPECT_EQ(xnn_status_success, xnn_delete_operator(op));
+    return output;
+  };
+
+  const std::vector<float> expected = run(/*flags=*/0, /*weights_cache=*/nullptr);
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+  // All inputs and weights are small integers, so results are exact with any GEMM microkernel.
+  EXPECT_EQ(expected, run(XNN_FLAG_AUTOTUNE_GEMM, weights_cache));
+  size_t num_configs = 0;
+  xnn_init_f32_gemm_candidate_configs(&num_configs);
+  const size_t expected_num_gemm_tunings = num_configs > 1 ? 1 : 0;
+  const struct xnn_internal_weights_cache* cache =
+    static_cast<const struct xnn_internal_weights_cache*>(weights_cache->context);
+  EXPECT_EQ(expected_num_gemm_tunings, cache->num_gemm_tunings);
+  // The second operator uses the recorded result.
+  EXPECT_EQ(expected, run(XNN_FLAG_AUTOTUNE_GEMM, weights_cache));
+  EXPECT_EQ(expected_num_gemm_tunings, cache->num_gemm_tunings);
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+
+  // Weights in a finalized weights cache were packed for the default config, autotuning must not pick another one.
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+  EXPECT_EQ(expected, run(/*flags=*/0, weights_cache));
+  ASSERT_EQ(xnn_status_success, xnn_finalize_weights_cache(weights_cache, xnn_weights_cache_finalization_kind_hard));
+  EXPECT_EQ(expected, run(XNN_FLAG_AUTOTUNE_GEMM, weights_cache));
+  cache = static_cast<const struct xnn_internal_weights_cache*>(weights_cache->context);
+  EXPECT_EQ(0, cache->num_gemm_tunings);
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+}
@@ -45,6 +45,7 @@ void DefineGraphWithoutInternalTensors(xnn_subgraph_t* subgraph, std::array<size
 // Helper function to create a subgraph with 1 input, 1 output, and 1 intermediate tensor.
 // input -> (abs) -> intermediate -> (hard swish) -> output
 // The size of the tensors are all the same, specified by `dims`.
+// Runtimes must be created with XNN_FLAG_NO_OPERATOR_FUSION to keep the intermediate tensor.
 void DefineGraph(xnn_subgraph_t* subgraph, std::array<size_t, 4> dims)
 {
   xnn_create_subgraph(/*external_value_ids=*/0, /*flags=*/0, subgraph);
@@ -195,7 +196,7 @@ TEST(WORKSPACE, static_data_not_moved_does_not_segv)
   DefineGraph(&subgraph2, dims);
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
   xnn_runtime_t runtime2 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime2));
   const std::array<xnn_external_value, 2> external_values2 = {
     xnn_external_value{0, static_data.data()},
     xnn_external_value{2, static_data.data()},
@@ -251,7 +252,7 @@ TEST(WORKSPACE, workspace_no_growth)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph1(subgraph1, xnn_delete_subgraph);
 
   xnn_runtime_t runtime1 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime1));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime1, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime1(runtime1, xnn_delete_runtime);
 
@@ -266,7 +267,7 @@ TEST(WORKSPACE, workspace_no_growth)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
 
   xnn_runtime_t runtime2 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime2));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime2, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime2(runtime2, xnn_delete_runtime);
 
@@ -320,7 +321,7 @@ TEST(WORKSPACE, workspace_grow)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph1(subgraph1, xnn_delete_subgraph);
 
   xnn_runtime_t runtime1 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime1));
 
   // No workspace allocated yet, it should be only allocated on setup.
   ASSERT_EQ(workspace->size, 0);
@@ -342,7 +343,7 @@ TEST(WORKSPACE, workspace_grow)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
 
   xnn_runtime_t runtime2 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime2));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime2, 2, external_values2.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime2(runtime2, xnn_delete_runtime);
 
@@ -399,7 +400,7 @@ TEST(WORKSPACE, workspace_runtime_delete_head_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph1(subgraph1, xnn_delete_subgraph);
 
   xnn_runtime_t runtime1 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime1));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime1, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime1(runtime1, xnn_delete_runtime);
 
@@ -408,7 +409,7 @@ TEST(WORKSPACE, workspace_runtime_delete_head_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
 
   xnn_runtime_t runtime2 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime2));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime2, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime2(runtime2, xnn_delete_runtime);
 
@@ -451,7 +452,7 @@ TEST(WORKSPACE, workspace_runtime_delete_tail_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph1(subgraph1, xnn_delete_subgraph);
 
   xnn_runtime_t runtime1 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime1));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime1, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime1(runtime1, xnn_delete_runtime);
 
@@ -460,7 +461,7 @@ TEST(WORKSPACE, workspace_runtime_delete_tail_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
 
   xnn_runtime_t runtime2 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime2));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime2, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime2(runtime2, xnn_delete_runtime);
 
@@ -504,7 +505,7 @@ TEST(WORKSPACE, workspace_runtime_delete_middle_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph1(subgraph1, xnn_delete_subgraph);
 
   xnn_runtime_t runtime1 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph1, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime1));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime1, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime1(runtime1, xnn_delete_runtime);
 
@@ -513,7 +514,7 @@ TEST(WORKSPACE, workspace_runtime_delete_middle_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph2(subgraph2, xnn_delete_subgraph);
 
   xnn_runtime_t runtime2 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph2, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime2));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime2, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime2(runtime2, xnn_delete_runtime);
 
@@ -522,7 +523,7 @@ TEST(WORKSPACE, workspace_runtime_delete_middle_runtime_first)
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> auto_subgraph3(subgraph3, xnn_delete_subgraph);
 
   xnn_runtime_t runtime3 = nullptr;
-  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph3, nullptr, workspace, nullptr, xnn_test_runtime_flags(), &runtime3));
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph3, nullptr, workspace, nullptr, xnn_test_runtime_flags() | XNN_FLAG_NO_OPERATOR_FUSION, &runtime3));
   ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime3, 2, external_values.data()));
   std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> auto_runtime3(runtime3, xnn_delete_runtime);
 
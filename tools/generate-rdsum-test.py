@@ -27,7 +27,7 @@ parser.set_defaults(defines=list())
 
 
 def split_ukernel_name(name):
-  match = re.fullmatch(r"xnn_(qs8|qu8|f16_f32acc|f32)_rdsum?(_minmax)?(_(fp32|rndnu))?_ukernel_((\d+)p)?(\d+)x__(.+)_(c)?(u)?(\d+)(_acc(\d+))?(v)?", name)
+  match = re.fullmatch(r"xnn_(qs8|qu8|f16_f32acc|f16|f32)_rd(?:sum|max|min|prod)(_minmax)?(_(fp32|rndnu))?_ukernel_((\d+)p)?(\d+)x__(.+)_(c)?(u)?(\d+)(_acc(\d+))?(v)?", name)
 
   if match is None:
     raise ValueError("Unexpected microkernel name: " + name)
@@ -415,6 +415,8 @@ def generate_test_cases(ukernel, init_fn, requantization_type, primary_tile,
   if requantization_type:
     test_args.append("xnn_%s_requantize_%s" % \
       (datatype.lower(), requantization_type.lower()))
+  if ukernel_type in ("rdmax", "rdmin", "rdprod"):
+    test_args.append("RDSumMicrokernelTester::OpType::" + ukernel_type[2:].capitalize())
   channel_scaled_tile = channel_tile
   if vector_tile:
     ctype = {"qs8": "int8_t", "qu8": "uint8_t", "f16": "uint16_t", "f32": "float"}[datatype]
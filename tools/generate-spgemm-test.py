@@ -0,0 +1,330 @@
+#!/usr/bin/env python
+# Copyright 2025 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+import argparse
+import codecs
+import os
+import sys
+import yaml
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from primes import next_prime
+import xngen
+import xnncommon
+
+
+parser = argparse.ArgumentParser(description='XNNPACK generator')
+parser.add_argument("-s", "--spec", metavar="FILE", required=True,
+                    help="Spec (YAML) file")
+parser.add_argument("-o", "--output", metavar="FILE", required=True,
+                    help="Output (C++ source) file")
+parser.set_defaults(defines=list())
+
+
+def split_ukernel_name(name):
+  common_name, target_name = name.split("__", 1)
+  common_parts = common_name.split("_")
+  param_spec = common_parts[-1]
+  mr, nr = map(int, param_spec.split("x"))
+  arch, isa, assembly = xnncommon.parse_target_name(target_name)
+  return mr, nr, arch, isa
+
+
+TEST_TEMPLATE = """\
+TEST(${TEST_NAME}, k_eq_${KBLOCK}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  SpGEMMMicrokernelTester()
+    .mr(${MR})
+    .nr(${NR})
+    .m(${MR})
+    .n(${NR})
+    .k(${KBLOCK})
+    .sparsity(0.0f)
+    $if SPARSE_2OF4:
+      .sparse_2of4(true)
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+TEST(${TEST_NAME}, strided_a) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  SpGEMMMicrokernelTester()
+    .mr(${MR})
+    .nr(${NR})
+    .m(${MR})
+    .n(${NR})
+    .k(${KBLOCK})
+    .a_stride(${next_prime(KBLOCK + 1)})
+    $if SPARSE_2OF4:
+      .sparse_2of4(true)
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+$if KBLOCK > 1:
+  TEST(${TEST_NAME}, k_lt_${KBLOCK}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t k = 1; k < ${KBLOCK}; k++) {
+      SpGEMMMicrokernelTester()
+        .mr(${MR})
+        .nr(${NR})
+        .m(${MR})
+        .n(${NR})
+        .k(k)
+        .sparsity(0.0f)
+        $if SPARSE_2OF4:
+          .sparse_2of4(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+TEST(${TEST_NAME}, k_gt_${KBLOCK}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (size_t k = ${KBLOCK + 1}; k < ${KBLOCK * 10 if KBLOCK == 1 else KBLOCK * 2}; k++) {
+    SpGEMMMicrokernelTester()
+      .mr(${MR})
+      .nr(${NR})
+      .m(${MR})
+      .n(${NR})
+      .k(k)
+      $if SPARSE_2OF4:
+        .sparse_2of4(true)
+      .Test(${", ".join(TEST_ARGS)});
+  }
+}
+
+$if KBLOCK > 1:
+  TEST(${TEST_NAME}, k_div_${KBLOCK}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t k = ${KBLOCK * 2}; k <= ${KBLOCK * 10}; k += ${KBLOCK}) {
+      SpGEMMMicrokernelTester()
+        .mr(${MR})
+        .nr(${NR})
+        .m(${MR})
+        .n(${NR})
+        .k(k)
+        $if SPARSE_2OF4:
+          .sparse_2of4(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+TEST(${TEST_NAME}, n_lt_${NR}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t n = 1; n < ${NR}; n++) {
+    for (size_t k = 1; k <= ${KBLOCK * 5}; k += ${KBLOCK + 1}) {
+      SpGEMMMicrokernelTester()
+        .mr(${MR})
+        .nr(${NR})
+        .m(${MR})
+        .n(n)
+        .k(k)
+        $if SPARSE_2OF4:
+          .sparse_2of4(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+
+TEST(${TEST_NAME}, n_gt_${NR}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t n = ${NR + 1}; n < ${NR * 2}; n++) {
+    for (size_t k = 1; k <= ${KBLOCK * 5}; k += ${KBLOCK + 1}) {
+      SpGEMMMicrokernelTester()
+        .mr(${MR})
+        .nr(${NR})
+        .m(${MR})
+        .n(n)
+        .k(k)
+        $if SPARSE_2OF4:
+          .sparse_2of4(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+
+TEST(${TEST_NAME}, n_div_${NR}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t n = ${NR * 2}; n <= ${NR * 3}; n += ${NR}) {
+    for (size_t k = 1; k <= ${KBLOCK * 5}; k += ${KBLOCK + 1}) {
+      SpGEMMMicrokernelTester()
+        .mr(${MR})
+        .nr(${NR})
+        .m(${MR})
+        .n(n)
+        .k(k)
+        $if SPARSE_2OF4:
+          .sparse_2of4(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+
+$if MR > 1:
+  TEST(${TEST_NAME}, m_lt_${MR}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t m = 1; m < ${MR}; m++) {
+      for (uint32_t n = 1; n <= ${NR * 2}; n += ${NR - 1}) {
+        for (size_t k = 1; k <= ${KBLOCK * 5}; k += ${KBLOCK + 1}) {
+          SpGEMMMicrokernelTester()
+            .mr(${MR})
+            .nr(${NR})
+            .m(m)
+            .n(n)
+            .k(k)
+            $if SPARSE_2OF4:
+              .sparse_2of4(true)
+            .Test(${", ".join(TEST_ARGS)});
+        }
+      }
+    }
+  }
+
+TEST(${TEST_NAME}, strided_cm) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  SpGEMMMicrokernelTester()
+    .mr(${MR})
+    .nr(${NR})
+    .m(${MR})
+    .n(${NR})
+    .k(${KBLOCK * 5})
+    .cm_stride(${next_prime(NR + 1)})
+    $if SPARSE_2OF4:
+      .sparse_2of4(true)
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+TEST(${TEST_NAME}, qmin) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  SpGEMMMicrokernelTester()
+    .mr(${MR})
+    .nr(${NR})
+    .m(${MR})
+    .n(${NR})
+    .k(${KBLOCK * 5})
+    .qmin(128)
+    $if SPARSE_2OF4:
+      .sparse_2of4(true)
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+TEST(${TEST_NAME}, qmax) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  SpGEMMMicrokernelTester()
+    .mr(${MR})
+    .nr(${NR})
+    .m(${MR})
+    .n(${NR})
+    .k(${KBLOCK * 5})
+    .qmax(128)
+    $if SPARSE_2OF4:
+      .sparse_2of4(true)
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+TEST(${TEST_NAME}, zero_weights) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t n = 1; n <= ${NR * 2}; n += ${NR - 1}) {
+    for (size_t k = 1; k <= ${KBLOCK * 5}; k += ${KBLOCK + 1}) {
+      SpGEMMMicrokernelTester()
+        .mr(${MR})
+        .nr(${NR})
+        .m(${MR})
+        .n(n)
+        .k(k)
+        .sparsity(1.0f)
+        $if SPARSE_2OF4:
+          .sparse_2of4(true)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+"""
+
+
+def generate_test_cases(ukernel, init_fn, mr, nr, k_block, isa):
+  """Generates all tests cases for a SpGEMM micro-kernel.
+
+  Args:
+    ukernel: C name of the micro-kernel function.
+    init_fn: C name of the function to initialize microkernel parameters.
+    mr: MR parameter of the SpGEMM micro-kernel.
+    nr: NR parameter of the SpGEMM micro-kernel.
+    k_block: Number of K values processed per one iteration of the main loop of
+             the micro-kernel.
+    isa: instruction set required to run the micro-kernel. Generated unit test
+         will skip execution if the host processor doesn't support this ISA.
+
+  Returns:
+    Code for the test case.
+  """
+  _, test_name = ukernel.split("_", 1)
+  return xngen.preprocess(TEST_TEMPLATE, {
+      "TEST_NAME": test_name.upper().replace("UKERNEL_", ""),
+      "TEST_ARGS": [ukernel, init_fn],
+      "MR": mr,
+      "NR": nr,
+      "KBLOCK": k_block,
+      "SPARSE_2OF4": "_2of4_" in ukernel,
+      "ISA_CHECK": xnncommon.generate_isa_check_macro(isa),
+      "next_prime": next_prime,
+    })
+
+
+def main(args):
+  options = parser.parse_args(args)
+
+  with codecs.open(options.spec, "r", encoding="utf-8") as spec_file:
+    spec_yaml = yaml.safe_load(spec_file)
+    if not isinstance(spec_yaml, list):
+      raise ValueError("expected a list of micro-kernels in the spec")
+
+    tests = """\
+// Copyright 2025 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: {specification}
+//   Generator: {generator}
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include "xnnpack/common.h"
+#include "xnnpack/isa-checks.h"
+#include "xnnpack/microparams-init.h"
+#include "xnnpack/spmm.h"
+#include "spgemm-microkernel-tester.h"
+""".format(specification=options.spec, generator=sys.argv[0])
+
+    for ukernel_spec in spec_yaml:
+      name = ukernel_spec["name"]
+      init_fn = ukernel_spec["init"]
+      k_block = int(ukernel_spec["k-block"])
+      mr, nr, arch, isa = split_ukernel_name(name)
+
+      test_case = generate_test_cases(name, init_fn, mr, nr, k_block, isa)
+      tests += "\n\n" + xnncommon.postprocess_test_case(test_case, arch, isa)
+
+    xnncommon.overwrite_if_changed(options.output, tests)
+
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
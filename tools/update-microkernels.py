@@ -43,6 +43,7 @@ _ISA_LIST = frozenset({
     'avx512vnnigfni',
     'avx512amx',
     'avx512fp16',
+    'avx512bf16',
     'avxvnni',
     'avxvnniint8',
     'avx256skx',
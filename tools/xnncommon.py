@@ -62,6 +62,7 @@ _ISA_TO_MACRO_MAP = {
   "avx512vnnigfni": "XNN_ENABLE_AVX512VNNIGFNI",
   "avx512amx": "XNN_ENABLE_AVX512AMX",
   "avx512fp16": "XNN_ENABLE_AVX512FP16",
+  "avx512bf16": "XNN_ENABLE_AVX512BF16",
   "hvx": "XNN_ENABLE_HVX",
 }
 
@@ -92,6 +93,7 @@ _ISA_TO_ARCH_MAP = {
   "avx512vnnigfni": ["x86-32", "x86-64"],
   "avx512amx": ["x86-32", "x86-64"],
   "avx512fp16": ["x86-32", "x86-64"],
+  "avx512bf16": ["x86-32", "x86-64"],
   "avxvnni": ["x86-32", "x86-64"],
   "avxvnniint8": ["x86-32", "x86-64"],
   "avx256skx": ["x86-32", "x86-64"],
@@ -136,6 +138,7 @@ _ISA_TO_UTILCHECK_MAP = {
   "avx512vnnigfni": "CheckAVX512VNNIGFNI",
   "avx512amx": "CheckAVX512AMX",
   "avx512fp16": "CheckAVX512FP16",
+  "avx512bf16": "CheckAVX512BF16",
   "avxvnni": "CheckAVXVNNI",
   "avxvnniint8": "CheckAVXVNNIINT8",
   "avx256skx": "CheckAVX256SKX",
@@ -177,6 +180,7 @@ _ISA_TO_CHECK_MAP = {
   "avx512vnnigfni": "TEST_REQUIRES_X86_AVX512VNNIGFNI",
   "avx512amx": "TEST_REQUIRES_X86_AVX512AMX",
   "avx512fp16": "TEST_REQUIRES_X86_AVX512FP16",
+  "avx512bf16": "TEST_REQUIRES_X86_AVX512BF16",
   "avxvnni": "TEST_REQUIRES_X86_AVXVNNI",
   "avxvnniint8": "TEST_REQUIRES_X86_AVXVNNIINT8",
   "avx256skx": "TEST_REQUIRES_X86_AVX256SKX",
@@ -266,6 +270,7 @@ _ISA_HIERARCHY = [
   "avx512vnni",
   "avx512vnnigfni",
   "avx512fp16",
+  "avx512bf16",
   "avx512amx",
   "armsimd32",
   "neon",